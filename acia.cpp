@@ -0,0 +1,107 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#include "acia.h"
+#include "cpu.h"
+#include <ctype.h>
+
+void acia::reset(CPU &cpu)
+{
+  cpu.unschedule(this,TXDONE);
+  cpu.unschedule(this,RXPOLL);
+  control=0;
+  txbusy=polling=0;
+}
+
+// bit 0: a character is waiting, bit 1: ready to send,
+// bit 7: asking for an interrupt
+unsigned acia::status(CPU &cpu)
+{
+  unsigned v=0;
+  if (cpu.io.ischar(iobase::CONSOLE)) v|=1;
+  if (!txbusy) v|=2;
+  if ((rxint() && (v&1)) || (txint() && (v&2))) v|=0x80;
+  return v;
+}
+
+void acia::setcontrol(CPU &cpu, unsigned v)
+{
+  if ((v&3)==3)  // master reset
+    {
+      reset(cpu);
+      return;
+    }
+  control=v;
+  if (rxint() && !polling)
+    {
+      polling=1;
+      cpu.schedule(POLL,this,RXPOLL);
+    }
+  if (txint() && !txbusy) cpu.interrupt(IRQ);
+}
+
+unsigned acia::read(CPU &cpu)
+{
+  int inp=cpu.io.getchar(iobase::CONSOLE);
+  unsigned v=(inp<0)?0:inp;
+  if (cpu.upper) v=toupper(v);
+  if (v==0x7F) v='_'; 
+  if (v=='\n') v='\r'; 
+  return v;
+}
+
+void acia::write(CPU &cpu, unsigned v)
+{
+  int c=v&0x7F;
+  if (c=='_') c='\010';
+  cpu.io.putchar(iobase::CONSOLE,c); 
+  if (c=='\010') 
+    {
+      cpu.io.putchar(iobase::CONSOLE,' ');
+      cpu.io.putchar(iobase::CONSOLE,'\010');
+    }
+  if (txbusy) cpu.unschedule(this,TXDONE);
+  txbusy=1;
+  cpu.schedule(CHARTIME,this,TXDONE);
+}
+
+void acia::event(CPU &cpu, unsigned tag)
+{
+  switch (tag)
+    {
+    case TXDONE:
+      txbusy=0;
+      if (txint()) cpu.interrupt(IRQ);
+      break;
+    case RXPOLL:
+      if (!rxint()) 
+	{
+	  polling=0;
+	  break;
+	}
+      if (cpu.io.ischar(iobase::CONSOLE)) cpu.interrupt(IRQ);
+      cpu.schedule(POLL,this,RXPOLL);
+      break;
+    }
+}
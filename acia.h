@@ -0,0 +1,56 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __ACIA_H
+#define __ACIA_H
+#include "scheduler.h"
+
+// The console serial port: a 6850 ACIA like the one on the 88-2SIO
+// (status/control at port 0x10, data at 0x11)
+// Sending a character keeps the transmitter busy for one character
+// time. With receive interrupts on, the keyboard gets looked at
+// every POLL T states instead of on every status read
+class acia : public timed
+{
+ protected:
+  unsigned control;  // last control byte written
+  int txbusy;   // still sending the last character
+  int polling;  // a receive poll is scheduled
+  int rxint(void) { return (control&0x80)!=0; }
+  int txint(void) { return (control&0x60)==0x20; }
+ public:
+  enum { IRQ=7 };   // no vectored interrupt board, so RST 7
+  enum { CHARTIME=2083 };  // 10 bits at 9600 baud with a 2 MHz clock
+  enum { POLL=20000 };  // 10 ms
+  enum tags { TXDONE, RXPOLL };
+  acia() { control=0; txbusy=polling=0; }
+  void reset(CPU &cpu);
+  unsigned status(CPU &cpu);
+  void setcontrol(CPU &cpu, unsigned v);
+  unsigned read(CPU &cpu);
+  void write(CPU &cpu, unsigned v);
+  void event(CPU &cpu, unsigned tag);
+};
+
+#endif
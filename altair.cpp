@@ -0,0 +1,134 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+// libaltair's C API (see altair.h)
+
+#include "altair.h"
+#include "machine.h"
+
+struct altair
+{
+  Machine m;
+  memconsole *con;   // m.io deletes it
+  altair(unsigned memsize) : m(NULL,memsize) 
+  { 
+    con=new memconsole(m.io);
+    m.cpu.usecache(1);
+  }
+};
+
+altair *altair_create(unsigned memsize)
+{
+  altair *a;
+  // no exceptions get out to C
+  try { a=new altair(memsize); }
+  catch (...) { return NULL; }
+  return a;
+}
+
+void altair_destroy(altair *a)
+{
+  delete a;
+}
+
+int altair_model(altair *a, int model)
+{
+  return a->m.cpu.setmodel(model);
+}
+
+int altair_jit(altair *a, int on)
+{
+  return a->m.cpu.usejit(on);
+}
+
+int altair_load(altair *a, const char *file, unsigned addr)
+{
+  return a->m.ram.load(file,addr);
+}
+
+void altair_reset(altair *a)
+{
+  a->m.cpu.reset();
+}
+
+unsigned long long altair_run(altair *a, unsigned long long tstates)
+{
+  CPU &cpu=a->m.cpu;
+  unsigned long long t0=cpu.tstates;
+  while (cpu.tstates-t0<tstates && !(cpu.ishalted() && !cpu.intenabled())) 
+    cpu.exec();
+  return cpu.tstates-t0;
+}
+
+unsigned long long altair_tstates(altair *a)
+{
+  return a->m.cpu.tstates;
+}
+
+int altair_halted(altair *a)
+{
+  return a->m.cpu.ishalted();
+}
+
+unsigned altair_read(altair *a, unsigned addr)
+{
+  return a->m.ram.read(addr,0);
+}
+
+void altair_write(altair *a, unsigned addr, unsigned val)
+{
+  a->m.ram.write(addr,val&0xFF,0);
+}
+
+void altair_readmem(altair *a, unsigned addr, void *buf, unsigned len)
+{
+  unsigned char *p=(unsigned char *)buf;
+  for (unsigned i=0;i<len;i++) p[i]=a->m.ram.read(addr+i,0);
+}
+
+void altair_writemem(altair *a, unsigned addr, const void *buf, unsigned len)
+{
+  const unsigned char *p=(const unsigned char *)buf;
+  for (unsigned i=0;i<len;i++) a->m.ram.write(addr+i,p[i],0);
+}
+
+unsigned altair_getreg(altair *a, const char *reg)
+{
+  return a->m.cpu.getreg(reg);
+}
+
+void altair_setreg(altair *a, const char *reg, unsigned val)
+{
+  a->m.cpu.setreg(reg,val);
+}
+
+void altair_push(altair *a, const char *bytes, unsigned len)
+{
+  a->con->type(bytes,len);
+}
+
+unsigned altair_pull(altair *a, char *buf, unsigned max)
+{
+  return a->con->take(buf,max);
+}
@@ -0,0 +1,93 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __ALTAIR_H
+#define __ALTAIR_H
+
+/* libaltair: the simulator as a library with a C API
+   (linux/Makefile builds libaltair.a and libaltair.so)
+   Each altair is a whole machine (see machine.h) with its console
+   in memory: push() types at it and pull() takes what it printed.
+   Nothing is shared between machines, so a program can run as many
+   as it likes, each on its own thread; one machine is only safe on
+   one thread at a time. There is no front panel, no control
+   terminal, and no streams besides the console */
+
+#ifdef __cplusplus
+extern "C" 
+{
+#endif
+
+typedef struct altair altair;
+
+/* Models for altair_model (same as cpumodels) */
+enum { ALTAIR_8080=0, ALTAIR_8085, ALTAIR_Z80 };
+
+/* A new machine with memsize bytes of RAM (all zero) that is reset
+   and ready to run from 0 on the table engine with the decoded 
+   instruction cache (NULL if there's no memory for it) */
+altair *altair_create(unsigned memsize);
+void altair_destroy(altair *a);
+
+/* Pick the CPU model; returns 0 if there's no such model */
+int altair_model(altair *a, int model);
+/* Turn the JIT on or off; returns 0 if it can't run here */
+int altair_jit(altair *a, int on);
+
+/* Read an image file into memory at addr; returns 0 if it can't */
+int altair_load(altair *a, const char *file, unsigned addr);
+/* Reset the CPU (memory stays as it is) */
+void altair_reset(altair *a);
+
+/* Run for (at least) tstates T states: an instruction isn't split
+   and the JIT does its blocks whole. Stops early on a HLT with 
+   interrupts off. Returns how many T states it ran */
+unsigned long long altair_run(altair *a, unsigned long long tstates);
+/* T states since the machine was made */
+unsigned long long altair_tstates(altair *a);
+/* Is the CPU sitting on a HLT? */
+int altair_halted(altair *a);
+
+/* Memory (reading past the end of RAM gives FF) */
+unsigned altair_read(altair *a, unsigned addr);
+void altair_write(altair *a, unsigned addr, unsigned val);
+void altair_readmem(altair *a, unsigned addr, void *buf, unsigned len);
+void altair_writemem(altair *a, unsigned addr, const void *buf, unsigned len);
+
+/* Registers by name as the control terminal takes them: 
+   A (meaning PSW), B, D, H, SP, PC, and for the Z80 IX, IY, and the
+   other set as A', B', D', H'. Unknown names read as 0 */
+unsigned altair_getreg(altair *a, const char *reg);
+void altair_setreg(altair *a, const char *reg, unsigned val);
+
+/* Console: queue len bytes of input / take up to max bytes of output
+   (returns how many; output past 1M that nobody has taken is lost) */
+void altair_push(altair *a, const char *bytes, unsigned len);
+unsigned altair_pull(altair *a, char *buf, unsigned max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,186 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+// Main file: the altairrfp command line (everything else is in
+// libaltair)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "machine.h"
+#include "outfile.h"
+#include <ctype.h>
+#include "iotelnet.h"
+#include "options.h"
+#include "lanes.h"
+#include "batch.h"
+#include "zygote.h"
+#if !defined(NOTELNET)
+#include <sched.h>
+#else
+#define sched_yield()
+#endif
+
+
+// The machine the command line runs
+static Machine *machine;
+
+// Most ways out of the simulator are exit() so write
+// the -P profile from here
+static void saveprofile(void)
+{
+  if (machine->cpu.saveprofile(options::profile))
+    machine->io.printf(iobase::ERROROUT,"Can't write profile to %s\n",options::profile);
+}
+
+// PROGRAM STARTS HERE!
+int main(int argc, char *argv[])
+{
+  if ( options::process_options(argc, argv)) return 1;
+  // create the machine (and the front panel and RAM)
+  machine=new Machine(options::softonly?NULL:options::port,options::memsize);
+  Machine &m=*machine;
+  // create I/O streams
+  console *keyboard=new console(m.io,iobase::CONSOLE);
+  iobase *io=keyboard;
+  if (*options::estream)
+    {
+      if (isdigit(*options::estream)) 
+	new iotelnet(m.io,iobase::ERROROUT,atoi(options::estream));
+      else
+	new outfile(m.io,iobase::ERROROUT,options::estream);
+    }
+  else m.io.dup(iobase::ERROROUT,iobase::CONSOLE);
+  if (*options::dstream)
+    {
+      if (isdigit(*options::dstream)) 
+	new iotelnet(m.io,iobase::DEBUG,atoi(options::dstream));
+      else 
+	  new outfile(m.io,iobase::DEBUG,options::dstream);
+    }
+  else m.io.dup(iobase::DEBUG,iobase::CONSOLE);
+  if (options::cstream)
+    {
+      io=new iotelnet(m.io,iobase::CONSOLE,options::cstream);
+      if (!*options::estream) m.io.dup(iobase::ERROROUT,iobase::CONSOLE);
+      if (!*options::dstream) m.io.dup(iobase::DEBUG,iobase::CONSOLE);
+    }
+
+  // default trace is a duplicate of the console
+  m.io.dup(iobase::TRACE,iobase::CONSOLE);
+  if (*options::tstream)
+    {
+      if (isdigit(*options::tstream)) 
+	new iotelnet(m.io,iobase::TRACE,atoi(options::tstream));
+      else
+	  new outfile(m.io,iobase::TRACE,options::tstream);
+    }
+#if !defined(NOTELNET)
+  if (options::xstream)
+    {
+      iobase *control= new iotelnet(m.io,iobase::CONTROL,options::xstream);
+      // wait for first control terminal
+      while (!control->ready()) sched_yield();
+      m.term.start();
+    }
+#endif
+  io->killchar=options::killchar;
+  if (*options::memmap && !m.layout(options::memmap)) return 1;
+  if (*options::banking && !m.banking(options::banking)) return 1;
+  if (*options::batch)
+    {
+      // every job gets its own machine set up like this one would be
+      batch farm;
+      farm.engine=options::refcore?CPU::SWITCH:(options::lazyflags?CPU::LAZY:CPU::TABLE);
+      farm.model=options::model;
+      farm.cache=!options::nocache;
+      farm.supers=!options::nosuper;
+      farm.upper=options::upper;
+      farm.memsize=options::memsize;
+      if (*options::memmap) farm.memmap=options::memmap;
+      if (*options::banking) farm.banking=options::banking;
+      if (!farm.read(options::batch,m.io)) return 1;
+      farm.run(options::workers);
+      return farm.summary(m.io)!=0;
+    }
+  if (*options::fn) m.ram.load(options::fn);
+
+  if (options::lanes) return lanes::report(m,options::lanes,options::laneinstr);
+  // wait for connect from console
+#if !defined(NOTELNET)
+  while (!io->ready())  sched_yield(); 
+  
+#endif  // note: "normal" console is always ready
+
+  // if we are ready then execute
+  if (!m.isReady())  
+    {
+      m.io.printf(iobase::ERROROUT,"Can't open front panel\n");
+      return 1;
+    }
+  // set up the CPU
+  CPU &cpu=m.cpu;
+  cpu.upper=options::upper;
+  cpu.engine=options::refcore?CPU::SWITCH:(options::lazyflags?CPU::LAZY:CPU::TABLE);
+  cpu.setmodel(options::model);
+  if (options::refcore && options::model!=I8080)
+    m.io.printf(iobase::ERROROUT,"The reference engine is 8080 only; using the table engine\n");
+  cpu.usecache(!options::nocache,!options::nosuper && !*options::profile);
+  if (*options::profile)
+    {
+      cpu.profile(1);
+      atexit(saveprofile);
+    }
+  else if (*options::aot && !cpu.useaot(options::aot))
+    {
+      m.io.printf(iobase::ERROROUT,"Can't run personality %s here. Built in:",options::aot);
+      for (AOT::personality *p=AOT::personalities;p;p=p->next)
+	m.io.printf(iobase::ERROROUT," %s",p->name);
+      m.io.printf(iobase::ERROROUT,"\n");
+    }
+  else if (options::jit && !cpu.usejit(1))
+    m.io.printf(iobase::ERROROUT,"Can't use the JIT here\n");
+  m.pace.set(options::speed);
+  m.runonly=options::runonly;
+  m.forcetrace=options::forcetrace;
+  m.skip=options::skip;
+  if (*options::zygote)
+    {
+      zygote z(m);
+      char *w=options::warmup, *k=options::warmmark, *f;
+      int bad=0;
+      char *input=(f=batch::field(&w))?batch::text(f,1,&bad):NULL;
+      char *marker=(f=batch::field(&k))?batch::text(f,0,&bad):NULL;
+      if (bad)
+	{
+	  m.io.printf(iobase::ERROROUT,"Can't read the warm-up input or marker\n");
+	  return 1;
+	}
+      // the jobs have the console now, so ^C works again
+      keyboard->release();
+      if (!z.warm(input,marker)) return 1;
+      return z.serve(options::zygote);
+    }
+  m.run();
+}
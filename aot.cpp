@@ -0,0 +1,142 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+// Recompiled code runtime (the code itself comes from altairaot)
+
+#include "aot.h"
+#include "cpu.h"
+#include <string.h>
+
+AOT::personality *AOT::personalities;
+
+// Generated files register themselves as they are constructed
+AOT::personality::personality(const char *n, const unsigned char *img, unsigned b, unsigned sz,
+			      const block *bl, unsigned nb, const unsigned short *v, unsigned nv)
+{
+  name=n;
+  image=img;
+  base=b;
+  size=sz;
+  blocks=bl;
+  nblocks=nb;
+  vars=v;
+  nvars=nv;
+  next=personalities;
+  personalities=this;
+}
+
+AOT::personality *AOT::find(const char *name)
+{
+  personality *p;
+  for (p=personalities;p;p=p->next)
+    if (!strcmp(p->name,name)) break;
+  return p;
+}
+
+AOT::AOT(CPU &c, personality &pers) : cpu(c), p(pers)
+{
+  instrs=kills=misses=0;
+  stop=0;
+  entry=new unsigned short[0x10000];
+  owner=new unsigned short[0x10000];
+  memset(entry,0,0x10000*sizeof(unsigned short));
+  memset(owner,0,0x10000*sizeof(unsigned short));
+  stale=new unsigned char[p.nblocks];
+  map=cpu.ram.aotmap=new unsigned char[0x10000];
+  memset(map,0,0x10000);
+  for (unsigned i=0;i<p.nblocks;i++)
+    {
+      const block &b=p.blocks[i];
+      for (unsigned a=b.start;a<b.end;a++)
+	{
+	  owner[a]=i+1;
+	  map[a]=1;
+	}
+    }
+  for (unsigned i=0;i<p.nvars;i++) map[p.vars[i]]=0;
+  // instruction starts are wherever the image's opcodes are
+  for (unsigned i=0;i<p.nblocks;i++)
+    {
+      const block &b=p.blocks[i];
+      for (unsigned a=b.start;a<b.end;a+=CPU::oplen[p.image[a-p.base]])
+	entry[a]=i+1;
+    }
+  cpu.ram.aot=this;
+  flush();
+}
+
+AOT::~AOT()
+{
+  cpu.ram.aot=NULL;
+  cpu.ram.aotmap=NULL;
+  delete [] map;
+  delete [] entry;
+  delete [] owner;
+  delete [] stale;
+}
+
+// Does block b match memory again?
+int AOT::check(unsigned b)
+{
+  const block &bl=p.blocks[b];
+  for (unsigned a=bl.start;a<bl.end;a++)
+    if (map[a] && cpu.ram.read(a,0)!=p.image[a-p.base]) return 0;
+  stale[b]=0;
+  return 1;
+}
+
+unsigned AOT::run(unsigned budget)
+{
+  unsigned done=0;
+  cpu.flagsnow();  // the recompiled code uses eager flags
+  while (done<budget && cpu.tstates<cpu.deadline)
+    {
+      unsigned b=entry[cpu.pc];
+      if (!b--) break;
+      if (stale[b] && !check(b)) break;
+      stop=0;
+      left=budget-done;
+      done+=p.blocks[b].fn(cpu,*this);
+    }
+  if (!done) misses++;
+  instrs+=done;
+  return done;
+}
+
+void AOT::invalidate(unsigned a)
+{
+  unsigned b=owner[a];
+  if (b-- && !stale[b])
+    {
+      stale[b]=1;
+      kills++;
+    }
+  stop=1;
+}
+
+// Anything could have changed, so check every block before it runs
+void AOT::flush(void)
+{
+  memset(stale,1,p.nblocks);
+}
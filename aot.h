@@ -0,0 +1,94 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __AOT_H
+#define __AOT_H
+#include <stddef.h>
+
+class CPU;
+
+// Recompiled ROM images (-A on the command line)
+// altairaot (aotgen.cpp) turns the code it can reach in an image
+// into C++ with one function per run of straight-line code, and
+// the build links the result in as a "personality". Each function
+// can be entered at any of its instructions and returns how many
+// it did. Whatever the recompiled code doesn't cover (or covers
+// but has since been written over) is left to the interpreter
+class AOT
+{
+ public:
+  typedef unsigned (*blockfn)(CPU &c, AOT &x);
+  struct block
+  {
+    unsigned short start, end;  // bytes covered are start..end-1
+    blockfn fn;
+  };
+  // One recompiled image (the generated file makes one of these)
+  struct personality
+  {
+    const char *name;
+    const unsigned char *image;  // what the code was compiled from
+    unsigned base, size;
+    const block *blocks;
+    unsigned nblocks;
+    // bytes the code reads at run time (so writing them is fine)
+    const unsigned short *vars;
+    unsigned nvars;
+    personality *next;
+    personality(const char *n, const unsigned char *img, unsigned b, unsigned sz,
+		const block *bl, unsigned nb, const unsigned short *v, unsigned nv);
+  };
+  static personality *personalities;
+  static personality *find(const char *name);
+
+  // What generated code calls: set PC past the instruction and run
+  // the table engine's handler for it, which is inlined from cpuops.h
+  template<unsigned OP> static void op(CPU &c, unsigned next, unsigned t1=0);
+  // an operand the program rewrites
+  static unsigned imm8(CPU &c, unsigned a);
+  static unsigned imm16(CPU &c, unsigned a);
+  int stop;   // a write hit recompiled code, so get out
+  unsigned left;  // instructions a block may do before it has to return
+
+ protected:
+  CPU &cpu;
+  personality &p;
+  unsigned short *entry;  // block index+1 for each instruction address
+  unsigned short *owner;  // block index+1 for each byte covered
+  unsigned char *stale;   // block may not match memory any more
+  unsigned char *map;     // RAM::aotmap (bytes the code depends on)
+  int check(unsigned b);
+ public:
+  AOT(CPU &c, personality &pers);
+  ~AOT();
+  // Run recompiled code until about budget instructions are done
+  // or the PC leaves it. Returns the instruction count
+  unsigned run(unsigned budget);
+  void invalidate(unsigned a);  // memory at a changed
+  void flush(void);   // memory changed all over (load)
+  const char *name(void) { return p.name; }
+  unsigned long long instrs, kills, misses;  // statistics
+};
+
+#endif
@@ -0,0 +1,330 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+// altairaot: recompile an 8080 image to C++ ahead of time
+//
+// altairaot [-n name] [-b base] [-e entry]... [-t addr:n]... [-s addr:n]... [-o out.cpp] image
+//
+// Starting from the entry points (default: the image base), follow
+// every JMP, CALL, RST, and conditional branch to find the code
+// and write it out as one function per run of straight-line code
+// (see aot.h). Link the result into altairrfp and run it with
+// -A name. An address loaded with LXI and pushed right away is
+// taken as a return address. Code that is only reached some other
+// way can be added with -e, or -t for a table of n addresses (the
+// targets of a PCHL dispatch, say). Getting these wrong costs
+// speed, not correctness: an instruction only runs recompiled when
+// the PC lands on it and memory still holds the bytes it came from.
+// -s says a CALL or RST to addr is followed by n bytes of inline
+// data that the routine skips (e.g., -s 8:1 for the BASIC syntax
+// check at RST 1) so the return address is n bytes further on.
+// Stores to fixed addresses inside an operand (BASIC patches its
+// own immediates) make that operand something the code reads at
+// run time
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static unsigned char image[0x10000];
+static unsigned base, size;
+static unsigned char insn[0x10000];   // an instruction starts here
+static unsigned char covered[0x10000];  // byte is part of an instruction
+static unsigned char var[0x10000];   // operand byte read at run time
+static unsigned char skip[0x10000];  // inline bytes after a call to here
+static unsigned todo[0x10000*2];
+static unsigned ntodo;
+// blocks: runs of instructions that follow on from each other
+static unsigned bstart[0x10000], bend[0x10000], nblocks;
+static unsigned blockof[0x10000];  // block index+1 for each instruction
+static unsigned char label[0x10000];  // a jump inside the block goes here
+
+static unsigned oplen(unsigned op)
+{
+  return (op&0xC7)==0x06 || (op&0xC7)==0xC6 || op==0xD3 || op==0xDB ? 2 :
+    (op&0xCF)==0x01 || (op&0xC7)==0xC2 || (op&0xC7)==0xC4 || (op&0xE7)==0x22 ||
+    (op&0xCF)==0xCD || op==0xC3 || op==0xCB ? 3 : 1;
+}
+
+static int inimage(unsigned a)
+{
+  return a>=base && a<base+size;
+}
+
+static unsigned byte(unsigned a)
+{
+  return image[a-base];
+}
+
+static unsigned word(unsigned a)
+{
+  return byte(a+1)+(byte(a+2)<<8);
+}
+
+static void follow(unsigned a)
+{
+  if (inimage(a) && !insn[a] && ntodo<sizeof(todo)/sizeof(todo[0])) todo[ntodo++]=a;
+}
+
+// Instruction classes
+static int isjmp(unsigned op) { return op==0xC3 || op==0xCB; }
+static int isjcc(unsigned op) { return (op&0xC7)==0xC2; }
+static int iscall(unsigned op) { return (op&0xCF)==0xCD; }
+static int isccc(unsigned op) { return (op&0xC7)==0xC4; }
+static int isrst(unsigned op) { return (op&0xC7)==0xC7; }
+static int isret(unsigned op) { return op==0xC9 || op==0xD9; }
+static int isrcc(unsigned op) { return (op&0xC7)==0xC0; }
+// no way on to the next instruction
+static int isend(unsigned op) { return isjmp(op) || isret(op) || op==0xE9; }
+static int islxi(unsigned op) { return (op&0xCF)==0x01; }
+
+// does it write memory?
+static int stores(unsigned op)
+{
+  return (op>=0x70 && op<=0x77) || op==0x36 || op==0x34 || op==0x35 ||
+    op==0x02 || op==0x12 || op==0x22 || op==0x32 || op==0xE3 ||
+    (op&0xCF)==0xC5 || iscall(op) || isccc(op) || isrst(op);
+}
+
+// Find the code reachable from the entry points
+static void trace(void)
+{
+  while (ntodo)
+    {
+      unsigned a=todo[--ntodo];
+      if (insn[a]) continue;
+      unsigned op=byte(a), len=oplen(op);
+      // HLT is left to the interpreter (it just waits)
+      if (op==0x76 || !inimage(a+len-1)) continue;
+      // don't let two decodings of the same bytes overlap
+      unsigned i;
+      for (i=0;i<len;i++) if (covered[a+i]) break;
+      if (i<len) continue;
+      insn[a]=1;
+      for (i=0;i<len;i++) covered[a+i]=1;
+      unsigned t=len==3?word(a):0;
+      if (isjmp(op) || isjcc(op)) follow(t);
+      if (iscall(op) || isccc(op))
+	{
+	  follow(t);
+	  if (inimage(t)) follow(a+len+skip[t]);
+	  else follow(a+len);
+	}
+      else if (isrst(op))
+	{
+	  follow(op&0x38);
+	  follow(a+len+skip[op&0x38]);
+	}
+      else if (!isend(op)) follow(a+len);
+      // LXI H,addr; PUSH H
+      if (islxi(op) && op!=0x31 && inimage(a+3) && byte(a+3)==(op|0xC4)) follow(t);
+    }
+}
+
+// Operands the program stores over from fixed addresses
+static void findvars(void)
+{
+  for (unsigned a=base;a<base+size;a++)
+    {
+      if (!insn[a]) continue;
+      unsigned op=byte(a), n=0;
+      if (op==0x32) n=1;  // STA
+      if (op==0x22) n=2;  // SHLD
+      for (unsigned i=0;i<n;i++)
+	{
+	  unsigned t=(word(a)+i)&0xFFFF;
+	  if (covered[t] && !insn[t]) var[t]=1;
+	}
+    }
+}
+
+// Split the code into blocks and find the jumps that can stay
+// inside one
+static void findblocks(void)
+{
+  for (unsigned a=base;a<base+size;)
+    {
+      if (!insn[a])
+	{
+	  a++;
+	  continue;
+	}
+      bstart[nblocks]=a;
+      while (1)
+	{
+	  unsigned op=byte(a);
+	  blockof[a]=nblocks+1;
+	  a+=oplen(op);
+	  if (isend(op) || !insn[a]) break;
+	}
+      bend[nblocks++]=a;
+    }
+  for (unsigned a=base;a<base+size;a++)
+    {
+      unsigned op=byte(a);
+      if (insn[a] && (isjmp(op) || isjcc(op)) && !var[a+1] && !var[a+2] &&
+	  blockof[word(a)]==blockof[a])
+	label[word(a)]=1;
+    }
+}
+
+static void instruction(FILE *out, unsigned a)
+{
+  unsigned op=byte(a), len=oplen(op), next=(a+len)&0xFFFF;
+  fprintf(out,"    case 0x%04X:",a);
+  if (label[a]) fprintf(out," L%04X:",a);
+  fprintf(out," AOT::op<0x%02X>(c,0x%04X",op,next);
+  if (len==2)
+    {
+      if (var[a+1]) fprintf(out,",AOT::imm8(c,0x%04X)",a+1);
+      else fprintf(out,",0x%02X",byte(a+1));
+    }
+  if (len==3)
+    {
+      if (var[a+1] || var[a+2]) fprintf(out,",AOT::imm16(c,0x%04X)",a+1);
+      else fprintf(out,",0x%04X",word(a));
+    }
+  fprintf(out,"); n++;");
+  // a jump to somewhere in this block can go straight there (as long
+  // as the budget lasts: it might be a loop)
+  int local=(isjmp(op) || isjcc(op)) && !var[a+1] && !var[a+2] &&
+    blockof[word(a)]==blockof[a];
+  if (isjcc(op) || isccc(op) || isrcc(op)) fprintf(out," if (c.pc!=0x%04X)",next);
+  if (local) fprintf(out," { if (n<x.left) goto L%04X; return n; }",word(a));
+  else if (isend(op) || isjmp(op) || iscall(op) || isrst(op) || isjcc(op) || isccc(op) || isrcc(op))
+    fprintf(out," return n;");
+  if (stores(op) && !iscall(op) && !isrst(op)) fprintf(out," if (x.stop) return n;");
+  fprintf(out,"\n");
+}
+
+static void usage(void)
+{
+  fprintf(stderr,"Usage: altairaot [-n name] [-b base] [-e entry]... [-t addr:n]... [-s addr:n]... [-o out.cpp] image\n"
+	  "\tentry, base, and addr are hex\n");
+  exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+  const char *name="image", *outname=NULL;
+  unsigned entries[256], nentries=0;
+  unsigned tables[64][2], ntables=0;
+  int c;
+  char *p;
+  while ((c=getopt(argc,argv,"n:b:e:t:s:o:"))!=-1)
+    switch (c)
+      {
+      case 'n':
+	name=optarg;
+	break;
+      case 'b':
+	base=strtoul(optarg,NULL,16);
+	break;
+      case 'e':
+	if (nentries<sizeof(entries)/sizeof(entries[0]))
+	  entries[nentries++]=strtoul(optarg,NULL,16)&0xFFFF;
+	break;
+      case 't':
+	if (ntables<sizeof(tables)/sizeof(tables[0]))
+	  {
+	    tables[ntables][0]=strtoul(optarg,&p,16)&0xFFFF;
+	    if (*p!=':') usage();
+	    tables[ntables++][1]=strtoul(p+1,NULL,0);
+	  }
+	break;
+      case 's':
+	{
+	  unsigned a=strtoul(optarg,&p,16)&0xFFFF;
+	  if (*p!=':') usage();
+	  skip[a]=strtoul(p+1,NULL,0);
+	}
+	break;
+      case 'o':
+	outname=optarg;
+	break;
+      default:
+	usage();
+      }
+  if (optind!=argc-1) usage();
+  FILE *f=fopen(argv[optind],"rb");
+  if (!f)
+    {
+      perror(argv[optind]);
+      return 1;
+    }
+  base&=0xFFFF;
+  size=fread(image,1,0x10000-base,f);
+  fclose(f);
+  if (!nentries) entries[nentries++]=base;
+  for (unsigned i=0;i<nentries;i++) follow(entries[i]);
+  for (unsigned i=0;i<ntables;i++)
+    for (unsigned j=0;j<tables[i][1];j++)
+      {
+	unsigned a=tables[i][0]+2*j;
+	if (inimage(a+1)) follow(byte(a)+(byte(a+1)<<8));
+      }
+  trace();
+  findvars();
+  findblocks();
+
+  FILE *out=outname?fopen(outname,"w"):stdout;
+  if (!out)
+    {
+      perror(outname);
+      return 1;
+    }
+  fprintf(out,"// Generated by altairaot from %s -- do not edit\n",argv[optind]);
+  fprintf(out,"#include \"cpuops.h\"\n\n");
+  fprintf(out,"static const unsigned char image[%u]=\n  {",size);
+  for (unsigned i=0;i<size;i++)
+    fprintf(out,"%s0x%02X%s",i%16?"":"\n    ",image[i],i+1<size?",":"");
+  fprintf(out,"\n  };\n\n");
+  unsigned ninsn=0, nbytes=0, nvars=0;
+  for (unsigned b=0;b<nblocks;b++)
+    {
+      fprintf(out,"static unsigned b%04X(CPU &c, AOT &x)\n{\n  unsigned n=0;\n  switch (c.pc)\n    {\n",bstart[b]);
+      for (unsigned a=bstart[b];a<bend[b];a+=oplen(byte(a)))
+	{
+	  instruction(out,a);
+	  ninsn++;
+	}
+      fprintf(out,"    }\n  return n;\n}\n\n");
+      nbytes+=bend[b]-bstart[b];
+    }
+  fprintf(out,"static const AOT::block blocks[%u]=\n  {\n",nblocks);
+  for (unsigned b=0;b<nblocks;b++)
+    fprintf(out,"    { 0x%04X, 0x%04X, b%04X }%s\n",bstart[b],bend[b],bstart[b],b+1<nblocks?",":"");
+  fprintf(out,"  };\n\nstatic const unsigned short vars[]=\n  {");
+  for (unsigned a=base;a<base+size;a++)
+    if (var[a]) fprintf(out,"%s0x%04X",nvars++?", ":"\n    ",a);
+  if (!nvars) fprintf(out,"\n    0");
+  fprintf(out,"\n  };\n\n");
+  fprintf(out,"static AOT::personality personality(\"%s\",image,0x%04X,%u,blocks,%u,vars,%u);\n",
+	  name,base,size,nblocks,nvars);
+  if (out!=stdout) fclose(out);
+  fprintf(stderr,"%s: %u blocks, %u instructions, %u of %u bytes, %u run time operands\n",
+	  name,nblocks,ninsn,nbytes,size,nvars);
+  return 0;
+}
@@ -0,0 +1,403 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+// Batch farm (see batch.h)
+
+#include "batch.h"
+#include "machine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#if !defined(NOTELNET)
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+struct batch::queue
+{
+#if !defined(NOTELNET)
+  pthread_mutex_t lock;
+#endif
+  unsigned head, tail;
+  unsigned long long steals;  // how many times this worker stole
+};
+
+const char *const batch::job::stopnames[]={ "expect", "halt", "budget", "time", "noload" };
+
+batch::batch()
+{
+  engine=CPU::TABLE;
+  model=I8080;
+  cache=supers=1;
+  upper=0;
+  memsize=0x10000;
+  memmap=banking=NULL;
+  jobs=NULL;
+  njobs=0;
+  queues=NULL;
+  nworkers=0;
+  elapsed=0;
+}
+
+batch::~batch()
+{
+  for (unsigned i=0;i<njobs;i++)
+    {
+      free(jobs[i].input);
+      free(jobs[i].expect);
+      free(jobs[i].output);
+    }
+  free(jobs);
+  delete [] queues;
+}
+
+// Read a whole file (NULL if we can't); cr turns line ends into
+// carriage returns
+static char *slurp(const char *fn, int cr)
+{
+  FILE *f=fopen(fn,"rb");
+  if (!f) return NULL;
+  unsigned size=4096, len=0;
+  char *buf=(char *)malloc(size);
+  int c;
+  while ((c=fgetc(f))!=EOF)
+    {
+      if (cr && c=='\r') continue;
+      if (cr && c=='\n') c='\r';
+      if (len+1>=size) buf=(char *)realloc(buf,size*=2);
+      buf[len++]=c;
+    }
+  buf[len]='\0';
+  fclose(f);
+  return buf;
+}
+
+// Pull the next field off a manifest line: a word, or a quoted
+// string with C escapes (which can't hold a NUL). Returns a copy
+// of the field (or NULL if there isn't one) and moves *p past it
+char *batch::field(char **p)
+{
+  char *s=*p;
+  while (isspace(*s)) s++;
+  if (!*s || *s=='#') return NULL;
+  char *out=(char *)malloc(strlen(s)+1), *o=out;
+  if (*s!='"')
+    {
+      while (*s && !isspace(*s)) *o++=*s++;
+    }
+  else for (s++;*s && *s!='"';s++)
+    {
+      if (*s!='\\' || !s[1])
+	{
+	  *o++=*s;
+	  continue;
+	}
+      switch (*++s)
+	{
+	case 'r': *o++='\r'; break;
+	case 'n': *o++='\n'; break;
+	case 't': *o++='\t'; break;
+	case 'x': *o++=strtoul(s+1,&s,16); s--; break;
+	default: *o++=*s; break;  // \\ \" and so on
+	}
+    }
+  if (*s=='"') s++;
+  *o='\0';
+  *p=s;
+  return out;
+}
+
+// An input or expect field: - for none, @file, or the text itself
+char *batch::text(char *f, int cr, int *bad)
+{
+  if (!strcmp(f,"-"))
+    {
+      free(f);
+      return NULL;
+    }
+  if (*f!='@') return f;
+  char *t=slurp(f+1,cr);
+  if (!t) *bad=1;
+  free(f);
+  return t;
+}
+
+int batch::read(const char *fn, iostreams &err)
+{
+  FILE *f=fopen(fn,"r");
+  if (!f)
+    {
+      err.printf(iobase::ERROROUT,"Can't read manifest %s\n",fn);
+      return 0;
+    }
+  char line[4096];
+  unsigned lineno=0, room=0;
+  while (fgets(line,sizeof(line),f))
+    {
+      char *p=line, *fld[7];
+      int n, bad=0;
+      lineno++;
+      for (n=0;n<7 && (fld[n]=field(&p));n++);
+      if (n==0) continue;  // blank or comment
+      if (n<6)
+	{
+	  err.printf(iobase::ERROROUT,"%s:%u: need name image load instructions seconds input [expect]\n",fn,lineno);
+	  for (int i=0;i<n;i++) free(fld[i]);
+	  fclose(f);
+	  return 0;
+	}
+      if (njobs==room) jobs=(job *)realloc(jobs,(room=room?room*2:64)*sizeof(job));
+      job &j=jobs[njobs++];
+      memset(&j,0,sizeof(j));
+      strncpy(j.name,fld[0],sizeof(j.name)-1);
+      strncpy(j.image,fld[1],sizeof(j.image)-1);
+      j.load=strtoul(fld[2],NULL,0);
+      j.budget=strtoull(fld[3],NULL,0);
+      j.seconds=atof(fld[4]);
+      for (int i=0;i<5;i++) free(fld[i]);
+      j.input=text(fld[5],1,&bad);
+      j.expect=n>6?text(fld[6],0,&bad):NULL;
+      if (bad)
+	{
+	  err.printf(iobase::ERROROUT,"%s:%u: can't read the input or expect file\n",fn,lineno);
+	  fclose(f);
+	  return 0;
+	}
+    }
+  fclose(f);
+  return 1;
+}
+
+// Run a machine until the job is done: the input is already typed
+// and the counts start from wherever the machine is now
+void batch::drive(Machine &m, memconsole &con, job &j)
+{
+  CPU &cpu=m.cpu;
+  double t0=throttle::now();
+  unsigned long long execs=0, fused0=cpu.fused, t=cpu.tstates;
+  unsigned seen=con.outcount(), explen=j.expect?strlen(j.expect):0;
+  // look at the budget and the output every CHUNK instructions
+  const unsigned CHUNK=1<<16;
+  j.instructions=0;
+  while (1)
+    {
+      unsigned n=CHUNK, i;
+      // a superinstruction counts two, so creep up on the budget
+      if (j.budget && (j.budget-j.instructions+1)/2<n) n=(j.budget-j.instructions+1)/2;
+      // (a HLT with interrupts on just runs again until one comes)
+      for (i=0;i<n && !(cpu.ishalted() && !cpu.intenabled());i++) cpu.exec();
+      execs+=i;
+      j.instructions=execs+cpu.fused-fused0;  // a superinstruction is two
+      if (j.expect && con.outcount()>seen)
+	{
+	  if (strstr(con.output()+(seen>explen?seen-explen:0),j.expect)) 
+	    {
+	      j.stop=job::EXPECT;
+	      break;
+	    }
+	  seen=con.outcount();
+	}
+      // nothing can wake a HLT with interrupts off
+      if (cpu.ishalted() && !cpu.intenabled())
+	{
+	  j.stop=job::HALT;
+	  break;
+	}
+      if (j.budget && j.instructions>=j.budget)
+	{
+	  j.stop=job::BUDGET;
+	  break;
+	}
+      if (j.seconds && throttle::now()-t0>=j.seconds)
+	{
+	  j.stop=job::TIME;
+	  break;
+	}
+    }
+  // no expect means the job just has to finish
+  j.passed=j.expect?j.stop==job::EXPECT:j.stop==job::HALT;
+  j.tstates=cpu.tstates-t;
+}
+
+// Run one job start to finish on its own machine
+void batch::runjob(job &j, unsigned w)
+{
+  double t0=throttle::now();
+  Machine m(NULL,memsize);
+  memconsole *con=new memconsole(m.io);  // the set deletes it
+  if (j.input) con->type(j.input,strlen(j.input));
+  m.io.dup(iobase::ERROROUT,iobase::CONSOLE);
+  m.io.dup(iobase::TRACE,iobase::CONSOLE);
+  m.io.dup(iobase::DEBUG,iobase::CONSOLE);
+  CPU &cpu=m.cpu;
+  if (memmap) m.layout(memmap);  // the command line checked these
+  if (banking) m.banking(banking);
+  cpu.upper=upper;
+  cpu.engine=engine;
+  cpu.setmodel(model);
+  cpu.usecache(cache,supers);
+  j.worker=w;
+  if (!m.ram.load(j.image,j.load)) j.stop=job::NOLOAD;
+  else
+    {
+      cpu.setreg(CPU::REG_PC,j.load);
+      drive(m,*con,j);
+    }
+  j.outlen=con->outcount();
+  j.output=(char *)malloc(j.outlen+1);
+  memcpy(j.output,con->output(),j.outlen+1);
+  j.wall=throttle::now()-t0;
+}
+
+// Next job for worker w: its own first, then half of somebody
+// else's (from the far end, away from where they are working)
+int batch::next(unsigned w, unsigned *j)
+{
+  queue &q=queues[w];
+#if !defined(NOTELNET)
+  pthread_mutex_lock(&q.lock);
+#endif
+  int got=q.head<q.tail;
+  if (got) *j=q.head++;
+#if !defined(NOTELNET)
+  pthread_mutex_unlock(&q.lock);
+#endif
+  if (got) return 1;
+  for (unsigned i=1;i<nworkers && !got;i++)
+    {
+#if !defined(NOTELNET)
+      queue &v=queues[(w+i)%nworkers];
+      unsigned head, tail;
+      pthread_mutex_lock(&v.lock);
+      unsigned left=v.tail-v.head;
+      if (left)
+	{
+	  // take the back half (all of it if there's just one)
+	  tail=v.tail;
+	  head=v.tail-=(left+1)/2;
+	  got=1;
+	}
+      pthread_mutex_unlock(&v.lock);
+      if (!got) continue;
+      // the jobs a worker holds are always a run of the
+      // manifest, so what we took is just a new [head,tail)
+      *j=head++;
+      pthread_mutex_lock(&q.lock);
+      q.head=head;
+      q.tail=tail;
+      q.steals++;
+      pthread_mutex_unlock(&q.lock);
+#endif
+    }
+  return got;
+}
+
+struct workerarg
+{
+  batch *b;
+  unsigned w;
+};
+
+void *batch::worker(void *arg)
+{
+  workerarg *a=(workerarg *)arg;
+  unsigned j;
+  while (a->b->next(a->w,&j)) a->b->runjob(a->b->jobs[j],a->w);
+  return NULL;
+}
+
+void batch::run(unsigned workers)
+{
+#if !defined(NOTELNET)
+  if (!workers) workers=sysconf(_SC_NPROCESSORS_ONLN);
+#else
+  workers=1;  // no threads
+#endif
+  if (workers<1) workers=1;
+  if (workers>njobs) workers=njobs?njobs:1;
+  nworkers=workers;
+  queues=new queue[nworkers];
+  workerarg *args=new workerarg[nworkers];
+  // deal the manifest out in runs
+  for (unsigned w=0;w<nworkers;w++)
+    {
+#if !defined(NOTELNET)
+      pthread_mutex_init(&queues[w].lock,NULL);
+#endif
+      queues[w].head=(unsigned long long)njobs*w/nworkers;
+      queues[w].tail=(unsigned long long)njobs*(w+1)/nworkers;
+      queues[w].steals=0;
+      args[w].b=this;
+      args[w].w=w;
+    }
+  double t0=throttle::now();
+#if !defined(NOTELNET)
+  pthread_t *threads=new pthread_t[nworkers];
+  for (unsigned w=1;w<nworkers;w++) pthread_create(&threads[w],NULL,worker,&args[w]);
+  worker(&args[0]);
+  for (unsigned w=1;w<nworkers;w++) pthread_join(threads[w],NULL);
+  for (unsigned w=0;w<nworkers;w++) pthread_mutex_destroy(&queues[w].lock);
+  delete [] threads;
+#else
+  worker(&args[0]);
+#endif
+  elapsed=throttle::now()-t0;
+  delete [] args;
+}
+
+unsigned batch::summary(iostreams &out)
+{
+  unsigned failed=0;
+  unsigned long long total=0, steals=0;
+  double busy=0;
+  out.printf(iobase::CONSOLE,"%-20s %-4s %-6s %14s %16s %9s %6s\n",
+	     "job","pass","stop","instructions","T states","seconds","worker");
+  for (unsigned i=0;i<njobs;i++)
+    {
+      job &j=jobs[i];
+      out.printf(iobase::CONSOLE,"%-20s %-4s %-6s %14llu %16llu %9.3f %6u\n",
+		 j.name,j.passed?"pass":"FAIL",job::stopnames[j.stop],j.instructions,j.tstates,j.wall,j.worker);
+      total+=j.instructions;
+      busy+=j.wall;
+      if (j.passed) continue;
+      failed++;
+      // show what it said (the tail of it if it said a lot)
+      const unsigned SHOW=2048;
+      const char *s=j.outlen>SHOW?j.output+j.outlen-SHOW:j.output;
+      int bol=1;
+      for (;*s;s++)
+	{
+	  if (*s=='\r') continue;
+	  if (bol) out.puts(iobase::CONSOLE,"  | ");
+	  out.putchar(iobase::CONSOLE,*s);
+	  bol=*s=='\n';
+	}
+      if (!bol) out.putchar(iobase::CONSOLE,'\n');
+    }
+  for (unsigned w=0;w<nworkers;w++) steals+=queues[w].steals;
+  out.printf(iobase::CONSOLE,"%u jobs, %u passed, %u failed: %llu instructions in %.3f s (%.3f s of work on %u workers, %llu steals)\n",
+	     njobs,njobs-failed,failed,total,elapsed,busy,nworkers,steals);
+  return failed;
+}
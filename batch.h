@@ -0,0 +1,105 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __BATCH_H
+#define __BATCH_H
+
+class iostreams;
+class Machine;
+class memconsole;
+
+// Headless batch runs (-B on the command line)
+// A manifest lists jobs, one per line:
+//   name image load instructions seconds input [expect]
+// image is loaded at load (which is also where the CPU starts),
+// input is typed at the console, and the job passes when its
+// console output contains expect. instructions and seconds are
+// the budget (0 for no limit): a job that hasn't passed or halted
+// by then is stopped. input and expect are - for none, a "quoted"
+// string with C escapes, or @file (line ends in an input file go
+// in as carriage returns, like the Enter key). # starts a comment.
+// Every job gets its own Machine with the console captured in
+// memory. The jobs are split up among the workers (one thread
+// each); a worker that runs out steals half of what is left from
+// somebody else, so one slow job doesn't hold up the rest. The
+// summary has one line per job (and the output of any that failed)
+class batch
+{
+ public:
+  struct job
+  {
+    char name[64];
+    char image[1024];
+    unsigned load;
+    unsigned long long budget;  // instructions (0 for no limit)
+    double seconds;   // host time (0 for no limit)
+    char *input;  // console input
+    char *expect;  // output that means it passed (NULL for none)
+    // what happened
+    enum stopreason { EXPECT, HALT, BUDGET, TIME, NOLOAD };
+    static const char *const stopnames[];  // for the summary
+    int stop;
+    int passed;
+    unsigned long long instructions, tstates;
+    double wall;
+    unsigned worker;
+    char *output;
+    unsigned outlen;
+  };
+  // how every job's machine is set up (the command line options)
+  int engine, model, cache, supers, upper;
+  unsigned memsize;
+  const char *memmap;  // for Machine::layout (NULL for the usual)
+  const char *banking;  // for Machine::banking (NULL for none)
+ protected:
+  job *jobs;
+  unsigned njobs;
+  // each worker's queue is the jobs [head,tail)
+  struct queue;
+  queue *queues;
+  unsigned nworkers;
+  double elapsed;  // host time for the whole run
+  int next(unsigned w, unsigned *j);
+  void runjob(job &j, unsigned w);
+  static void *worker(void *arg);
+ public:
+  batch();
+  ~batch();
+  // read a manifest (returns 0 and says why on err if it can't)
+  int read(const char *fn, iostreams &err);
+  // run everything on workers threads (0 for one per host CPU)
+  void run(unsigned workers=0);
+  // write the summary; returns how many jobs failed
+  unsigned summary(iostreams &out);
+  // run m (input already typed) until j is done by its budget and
+  // expect; sets what happened and counts from where m was
+  static void drive(Machine &m, memconsole &con, job &j);
+  // Manifest fields: the next one off *p (NULL at the end of the
+  // line), and what an input or expect field says (NULL for -,
+  // sets *bad if an @file isn't there; takes the field)
+  static char *field(char **p);
+  static char *text(char *f, int cr, int *bad);
+};
+
+#endif
@@ -23,9 +23,9 @@ Altairrfp (c) 2011 by Al Williams.
 
 ***********************************************************************/
 #include "breakpoint.h"
-#include "cpu.h"
-#include "contterm.h"
+#include "machine.h"
 #include <string.h>
+#include <stdlib.h>
 
 // See important comments in breakpoint.h
 
@@ -36,13 +36,16 @@ breakpoint::breakpoint()
   oneshot=0;
   count=0;
   ttype=0;
-  address=0;
+  address=endaddress=0;
+  hooked=written=0;
   reg[0]='\0';
+  regid=CPU::REG_NONE;
   mask=0xFFFF;
   value=0;
   action=0;
   announced=0;
   id='?';
+  m=NULL;
 }
 
 
@@ -57,49 +60,76 @@ void breakpoint::init(int st, const char *target,  unsigned v, unsigned msk)
   countreset=0;
   oneshot=0;
   action=0;
-  if (*target=='@')   // target of @xxx is an address
+  written=0;
+  if (*target=='@')   // target of @xxx is an address (or @xxx-yyy)
     {
-      address=strtonum(target+1);
+      const char *dash=strchr(target+1,'-');
+      address=m?m->term.strtonum(target+1):strtoul(target+1,NULL,16);
+      endaddress=address;
+      if (dash) endaddress=m?m->term.strtonum(dash+1):strtoul(dash+1,NULL,16);
+      if (endaddress<address || value<0x10000) endaddress=address;  // only change bps watch a range
       ttype=0;
     }
   else  // must be a register
     {
       strcpy(reg,target);
+      regid=CPU::regid(reg,m?m->cpu.model:I8080);
       ttype=1;
     }
-  if (!thecpu) lastvalue=0;  // what else can you do? No CPU means no last value
+  if (hooked && m) m->ram.unwatch(this);
+  hooked=0;
+  if (!m) lastvalue=0;  // what else can you do? No CPU means no last value
   else if (value>=0x10000)  // change bp?
     {
       if (ttype==0)
-	lastvalue=thecpu->ram.read(address,0);  // prime lastvalue
+	{
+	  lastvalue=m->ram.read(address,0);  // prime lastvalue
+	  hooked=m->ram.watch(address,endaddress,this);
+	}
       else
-	lastvalue=thecpu->getreg(reg);  // prime with register
+	lastvalue=m->cpu.getreg(regid);  // prime with register
     }
 }
 
 
 breakpoint::breakpoint(int st, const char *target,  unsigned v, unsigned msk)
 {
+  hooked=written=0;  // init looks at these
+  m=NULL;
+  id='?';
   init(st,target,v,msk);
 }
 
+// A write changed a byte from old to v in our range 
+// (returns 1 if this is something to stop for)
+int breakpoint::changed(unsigned a, unsigned old, unsigned v)
+{
+  if (state==0 || !((old^v)&mask)) return 0;
+  written=1;
+  return 1;
+}
+
 // returns action or -1 if not happening
 int breakpoint::check(void)
 {
   int hit=0;
-  unsigned target;
+  unsigned target=0;
   if (state==0) return -1;  // ignore disabled breakpoint
   // get current value
-  if (ttype==0)
-    target=thecpu->ram.read(address,0);
+  if (hooked)
+    ;  // RAM already told us
+  else if (ttype==0)
+    target=m->ram.read(address,0);
   else
-    target=thecpu->getreg(reg);
+    target=m->cpu.getreg(regid);
   // if value == 0x10000 then this is a change bp
   if (value<0x10000)
     {
       target&=mask;
       hit=target==value;   // simple match bp
     }
+  else if (hooked)
+    hit=written;  // change bp on memory
   else
     {
       hit=((target&mask)!=(lastvalue&mask));  // change bp
@@ -118,6 +148,7 @@ int breakpoint::check(void)
       state=oneshot?0:1;
       announced=0;
       lastvalue=target;
+      written=0;
       lasthit=0;
       return -1;
     }
@@ -152,11 +183,11 @@ int breakpoint::check(void)
       
   // if we have a hit here we are at a breakpoint
   // but if we are stopping and haven't already 
-  // announced then we ask contterm.cpp to print for us
+  // announced then we ask the control terminal to print for us
   if (hit && !announced && action==0)
     {
       announced=1;
-      print_bp(id);
+      m->term.announce(id);
     }
   // done!
   return hit?action:-1;
@@ -190,10 +221,11 @@ void breakpoint::dump(iobase::streamtype s, int base)
 {
   char tstring[16];
   char mstring[32];
-  if (ttype==0) sprintf(tstring,base==0x10?"@%04X":"@%06o",address); else strcpy(tstring,reg);
+  if (ttype==0 && endaddress!=address) sprintf(tstring,base==0x10?"@%04X-%04X":"@%06o-%06o",address,endaddress);
+  else if (ttype==0) sprintf(tstring,base==0x10?"@%04X":"@%06o",address); else strcpy(tstring,reg);
   if (value<0x10000) sprintf(mstring,base==0x10?"MASK %04X == %04X":"MASK %06o == %06o",mask,value);
   else sprintf(mstring,base==0x10?"MASK %04X CHANGE":"MASK %06o CHANGE",mask);
-  iobase::printf(s,
+  m->io.printf(s,
 		 base==0x10?"%c: %s %s %s\t%04X%s"
 		 :"%c: %s %s %s \t%06o%s",
 		 id,state?"ON ":"OFF",tstring,mstring,count,oneshot?"ONCE":"    ");
@@ -201,6 +233,6 @@ void breakpoint::dump(iobase::streamtype s, int base)
   if (action==1) strcpy(tstring,"TRACE");
   if (action&0x80) sprintf(tstring,"ENA %c",(action&0x3F)+'A');
   if (action&0x40) sprintf(tstring,"DIS %c",(action&0x3F)+'A');
-  iobase::printf(s,"%s\r\n",tstring);
+  m->io.printf(s,"%s\r\n",tstring);
 }
 
@@ -25,12 +25,15 @@ Altairrfp (c) 2011 by Al Williams.
 #ifndef __BREAKPOINT_H
 #define __BREAKPOINT_H
 
-class CPU;
-class RFP;
+class Machine;
 #include "iobase.h"
+#include "cpu.h"
 
 // This class represents a single breakpoint
-class breakpoint
+// A change breakpoint on memory doesn't look at memory every 
+// instruction: it asks RAM to tell it about writes to its range
+// (see RAM::watch) and only needs checking once one has changed something
+class breakpoint : public watcher
 {
  protected:
   unsigned lasthit;  // used for one shot, etc.
@@ -39,12 +42,17 @@ class breakpoint
   unsigned countreset;  // reset value for counts
   int announced;    // if 1 supress more messages
   int state;  // 1= active, 0=inactive, -1=hold
+  int hooked;  // 1 if RAM tells us about writes (memory change bp)
+  int written;  // a write changed something we watch
  public:
   char id;   // A-Z
+  Machine *m;  // whose breakpoint this is
   int oneshot;  // if 1, this breakpoint disables after it fires
   int ttype;    // do we match/change an address or a register?
   unsigned address;  // address to match/monitor
+  unsigned endaddress;  // last address for a change bp on a range (@start-end)
   char reg[16];      // register name to match/monitor (name so we can be CPU independent)
+  int regid;        // reg as the CPU knows it (looked up once in init)
   unsigned mask;    // value is masked (ANDed) against this
   unsigned value;  // value == 0x10000 means we are looking for change!
   int action; // 0= stop, 1=trace, 0x80+# = enable 0x40+# = disable
@@ -61,11 +69,20 @@ class breakpoint
   // and then goes to zero. It stays "hit" until the condition is cleared
   // which means we have to do things like set state to -1 (hold) to resume
   int check(void);
+  // does check() need calling every instruction?
+  int polled(void) { return state && !(hooked && !written); }
+  // is this a plain stop when PC gets to value? (then Machine::run
+  // only looks at it there; counting and one shot breakpoints have 
+  // to see every instruction)
+  int pcstop(void) { return ttype==1 && regid==CPU::REG_PC && value<0x10000 
+      && mask==0xFFFF && !countreset && !oneshot; }
+  // RAM calls this when a write changes our range
+  int changed(unsigned a, unsigned old, unsigned v);
   // dump breakpoint info to stream in base
   void dump(iobase::streamtype,int base);
-  static void header(iobase::streamtype s)
+  static void header(iostreams &io, iobase::streamtype s)
   {
-      iobase::printf(s,"ID ON  COND\t\t\tCOUNT\tACTION\r\n");
+      io.printf(s,"ID ON  COND\t\t\tCOUNT\tACTION\r\n");
 
   }
   
@@ -36,30 +36,40 @@ Altairrfp (c) 2011 by Al Williams.
 #define sched_yield()
 #endif
 
-#include "ram.h"
-#include "cpu.h"
-#include "rfp.h"
+#include "machine.h"
 
-// command line buffer
-char cmdbuf[1024];
-pthread_t controlthread;
-
-extern "C" 
+contterm::contterm(Machine &mach) : m(mach)
 {
-  #include "coniol.h"
+  virt_switch=virt_smask=virt_sreset=0;
+  virt_bank=-1;
+  base=0x10;
+  running=0;
+  rest=cmdbuf;
+  *cmdbuf='\0';
 }
 
+// process real switches (func) with virtual switches
+unsigned contterm::virtsw(int func)
+{
+  // the run loop calls this between quanta, so the CPU isn't using
+  // the page map or the decoded cache while the bank changes
+  if (virt_bank>=0)
+    {
+      m.ram.bank(virt_bank);
+      virt_bank=-1;
+    }
+  if (virt_smask)
+    {
+      func&=~virt_smask;
+      func|=virt_switch&virt_smask;
+      virt_smask=virt_sreset;
+    }
+  return func;
+}
 
-// These are used to virtually flip switches on the front panel (even if we don't have one)
-volatile int virt_switch=0;
-volatile int virt_smask=0;
-volatile int virt_sreset=0;
-
-int base=0x10; // default number base (must be 0x10 or 010).
- 
 // Convert a string to a number
 // use default radix unless number starts with # (dec), & (octal), or $ (hex)
-unsigned strtonum(const char *t)
+unsigned contterm::strtonum(const char *t)
 {
   int abase=base;  // assumed base
   if (*t=='$')   // hex
@@ -80,10 +90,21 @@ unsigned strtonum(const char *t)
   return strtoul(t,NULL,abase);
 }
 
+// Next token from the command line (like strtok but ours alone)
+char *contterm::token(const char *delims)
+{
+  rest+=strspn(rest,delims);
+  if (!*rest) return NULL;
+  char *t=rest;
+  rest+=strcspn(rest,delims);
+  if (*rest) *rest++='\0';
+  return t;
+}
+
 // Get numeric value out of command input stream
-unsigned getval(int *success=NULL)
+unsigned contterm::getval(int *success)
 {
-  char *t=strtok(NULL," ,\t");
+  char *t=token(" ,\t");
   if (success) *success=0;
   if (!t || !*t) return 0;
   if (success) *success=1;
@@ -95,36 +116,36 @@ unsigned getval(int *success=NULL)
 // Get a command line (optional prompt)
 // ends is a string that sets the allowable end of "line" (default \r\n but set can use space)
 // returns -1 for escape (cancel)
-int getcline(const char *prompt, const char *ends=NULL)
+int contterm::getcline(const char *prompt, const char *ends)
 {
   int cp=0;
   int c;
   if (!ends) ends="\r\n";
   cmdbuf[cp]='\0';
-  if (prompt) iobase::puts(iobase::CONTROL,prompt);
+  if (prompt) m.io.puts(iobase::CONTROL,prompt);
   while (1)
     {
-      c=iobase::getchar(iobase::CONTROL);
+      c=m.io.getchar(iobase::CONTROL);
       if (c=='\0'||c==-1) continue;
       if (c=='\x1b') return -1;  // escape cancels
-      if (c!='\x7f') iobase::putchar(iobase::CONTROL,c);  // echo
+      if (c!='\x7f') m.io.putchar(iobase::CONTROL,c);  // echo
       if (c=='\x7f') // if a rub out
 	{
 	  if (cp) // if not at start of line
 	    {
 	      // backspace over the last character and discard
 	      cp--;
-	      iobase::putchar(iobase::CONTROL,'\010');
-	      iobase::putchar(iobase::CONTROL,' ');
-	      iobase::putchar(iobase::CONTROL,'\010');
+	      m.io.putchar(iobase::CONTROL,'\010');
+	      m.io.putchar(iobase::CONTROL,' ');
+	      m.io.putchar(iobase::CONTROL,'\010');
 	    }
 	  continue;
 	}
       // end of line?
       if (strchr(ends,c))
 	{
-	  if (c!='\r') iobase::putchar(iobase::CONTROL,'\r');  // echo return if it wasn't
-	  iobase::putchar(iobase::CONTROL,'\n');  // and add a new line
+	  if (c!='\r') m.io.putchar(iobase::CONTROL,'\r');  // echo return if it wasn't
+	  m.io.putchar(iobase::CONTROL,'\n');  // and add a new line
 	  cmdbuf[cp]='\0';  // end string
 	  return 0;    // done!
 	}
@@ -141,29 +162,27 @@ int getcline(const char *prompt, const char *ends=NULL)
 
 // Functions that start with f_ are command handlers
 
-void f_exit(void)
+void contterm::f_exit(void)
 {
   // at exit should close keyboard!
   exit(0);
 }
 
-void do_help(const char *k); // we need help to do help ;-) forward ref
-
-void f_help(void)
+void contterm::f_help(void)
 {
-  char *t=strtok(NULL,"\r\n");
+  char *t=token("\r\n");
   if (!t || !*t) t=NULL;
   do_help(t);
 }
 
-void f_stop(void)
+void contterm::f_stop(void)
 {
   virt_switch=0;
   virt_sreset=1;
   virt_smask=1;
 }
 
-void f_run(void)
+void contterm::f_run(void)
 {
   virt_switch=1;
   virt_sreset=1;
@@ -171,22 +190,22 @@ void f_run(void)
 }
 
 // let front panel switches win no matter what
-void f_release(void)
+void contterm::f_release(void)
 {
   virt_smask=0;
 }
 
 // reset CPU
-void f_reset(void)
+void contterm::f_reset(void)
 {
   for (int i=0;i<27;i++) 
-    theRFP->bps[i].setannounce(0);
+    m.bps[i].setannounce(0);
   virt_switch=0x80;
   virt_sreset=0;
   virt_smask=0x80;
 }
 
-void f_step(void)
+void contterm::f_step(void)
 {
   virt_switch=2;
   virt_sreset=0;
@@ -195,105 +214,149 @@ void f_step(void)
 
 
 
-// TODO: save and load need start address and count (see f_disp)
-void f_save(void)
+// [@start] [-len] file for save and load (NULL if there's no file)
+char *contterm::rangefile(const char *cmd, unsigned *start, unsigned *len)
 {
-  unsigned start=0;
-  unsigned len0=thecpu->ram.getlen(), len;
-  char *t=strtok(NULL,"\r\n");
-  len=len0;
-  if (!t||!*t) f_help();
-  if (*t=='@')
+  unsigned len0=m.ram.getlen();
+  char *t;
+  *start=0;
+  *len=len0;
+  rest+=strspn(rest," \t");
+  if (*rest=='@')
+    {
+      rest++;
+      *start=getval();
+      rest+=strspn(rest," \t");
+    }
+  if (*rest=='-')
     {
-      start=strtonum(t+1);
-      t=strtok(NULL,"\r\n");
+      rest++;
+      *len=getval();
+      if (*len>len0) *len=len0;
+      rest+=strspn(rest," \t");
     }
-  if (!t||!*t) f_help();
-  if (*t=='-')
+  t=token("\r\n");
+  if (!t||!*t) 
     {
-      len=strtonum(t+1);
-      if (len>len0) len=len0;
-      t=strtok(NULL,"\r\n");
+      do_help(cmd);
+      return NULL;
     }
-  if (!t||!*t) f_help;
-  thecpu->ram.save(t,start,len);
+  return t;
 }
 
-void f_load(void)
+void contterm::f_save(void)
 {
-  unsigned start=0;
-  unsigned len0=thecpu->ram.getlen(), len;
-  char *t=strtok(NULL,"\r\n");
-  len=len0;
-  if (!t||!*t) f_help();
-  if (*t=='@')
-    {
-      start=strtonum(t+1);
-      t=strtok(NULL,"\r\n");
-    }
-  if (!t||!*t) f_help();
-  if (*t=='-')
-    {
-      len=strtonum(t+1);
-      if (len>len0) len=len0;
-      t=strtok(NULL,"\r\n");
-    }
-  if (!t||!*t) f_help;
+  unsigned start, len;
+  char *t=rangefile("save",&start,&len);
+  if (t && m.ram.save(t,start,len)) m.io.printf(iobase::CONTROL,"Saved\r\n");
+}
 
-      thecpu->ram.load(t);
+void contterm::f_load(void)
+{
+  unsigned start, len;
+  char *t=rangefile("load",&start,&len);
+  if (t && m.ram.load(t,start,len)) m.io.printf(iobase::CONTROL,"Loaded\r\n");
+}
+
+// Write persistent memory out now
+void contterm::f_sync(void)
+{
+  if (!m.ram.persists()) m.io.printf(iobase::CONTROL,"No persistent memory (see -R nv)\r\n");
+  else if (!m.ram.flush(1)) m.io.printf(iobase::CONTROL,"Couldn't write all of it\r\n");
 }
 
 // disp memory
-void f_disp(void)
+void contterm::f_disp(void)
 {
   unsigned add,end;
-  int i,j;
   add=getval();  // get address
   end=getval();  // get count
+  showmem(add,end,-1);
+}
+
+// Show count bytes from add as bank b sees them (-1 for the
+// bank the CPU sees now)
+void contterm::showmem(unsigned add, unsigned end, int b)
+{
+  int i,j;
   if (!end) end=256;  // default count to 256
   end+=add;
   j=0;
   // do the print in the proper base
   while (add+j*16<=end)
     {
-      iobase::printf(iobase::CONTROL,base==0x10?"%04X: ":"%06o: ",add+j*16);
+      m.io.printf(iobase::CONTROL,base==0x10?"%04X: ":"%06o: ",add+j*16);
       for (i=0;i<16;i++) 
-	iobase::printf(iobase::CONTROL,base==0x10?"%02X ":"%03o ",thecpu->ram.read(add+j*16+i,0));
-      iobase::printf(iobase::CONTROL,"\r\n");
+	{
+	  unsigned a=add+j*16+i;
+	  m.io.printf(iobase::CONTROL,base==0x10?"%02X ":"%03o ",b<0?m.ram.read(a,0):m.ram.peek(b,a));
+	}
+      m.io.printf(iobase::CONTROL,"\r\n");
       j++;
     }
 }
 
+// Show the banks, switch to one, or show memory in one
+void contterm::f_bank(void)
+{
+  int ok;
+  unsigned n, add;
+  if (!m.ram.getbanks())
+    {
+      m.io.printf(iobase::CONTROL,"No bank switching (see -K)\r\n");
+      return;
+    }
+  n=getval(&ok);
+  if (ok && n>=m.ram.getbanks())
+    {
+      m.io.printf(iobase::CONTROL,"There are only %u banks\r\n",m.ram.getbanks());
+      return;
+    }
+  if (ok)
+    {
+      add=getval(&ok);
+      if (ok)
+	{
+	  showmem(add,getval(),n);
+	  return;
+	}
+      // the run loop does it (see virtsw)
+      virt_bank=n;
+      while (virt_bank>=0) sched_yield();
+    }
+  m.io.printf(iobase::CONTROL,"Bank %u of %u in %04X-%04X (port %02X)\r\n",m.ram.getbank(),
+	      m.ram.getbanks(),m.ram.windowstart(),m.ram.windowend(),m.ram.bankport);
+}
+
 
 // set memory
-void f_set(void)
+void contterm::f_set(void)
 {
   unsigned add,n;
   int rv;
   add=getval();
   do 
     {
-      iobase::printf(iobase::CONTROL,base==0x10?"%04X: ":"%06o: ",add);
+      m.io.printf(iobase::CONTROL,base==0x10?"%04X: ":"%06o: ",add);
       rv=getcline(NULL,"\r\n \t");
-      if (rv>=0) thecpu->ram.write(add++,strtonum(cmdbuf),0);
+      if (rv>=0) m.ram.write(add++,strtonum(cmdbuf),0);
     } while (rv>=0);
-  iobase::printf(iobase::CONTROL,"\r\n");
+  m.io.printf(iobase::CONTROL,"\r\n");
 }
 
 
 // let CPU do most of the work because it knows what registers it has
 
-void f_reg(void)
+void contterm::f_reg(void)
 {
   unsigned v,newv;
   char *regstring;
   const char *fmt;
   int ok;
-  if (!thecpu) return;
-  regstring=strtok(NULL," ,\t");
+  regstring=token(" ,\t");
   if (regstring==NULL) 
     {
-      iobase::printf(iobase::CONTROL,"reg register_name [value]\r\n");
+      m.io.printf(iobase::CONTROL,"reg register_name [value]\r\n");
       return;  
     }
   // if there is a new value we have to set it
@@ -310,50 +373,123 @@ void f_reg(void)
 	  *t=toupper(*t);
 	  t++;
 	}
-      v=thecpu->getreg(regstring);
-      iobase::printf(iobase::CONTROL,fmt,regstring,v);
+      v=m.cpu.getreg(regstring);
+      m.io.printf(iobase::CONTROL,fmt,regstring,v);
       return;
     }
   // set value instead of display
-  thecpu->setreg(regstring,newv);
+  m.cpu.setreg(regstring,newv);
 }
 
 // radix changers
 
-void f_hex(void) 
+void contterm::f_hex(void) 
 {
   base=0x10;
 }
 
-void f_oct(void)
+void contterm::f_oct(void)
 {
   base=010;
 }
 
 
 // show registers
-void f_regs(void)
+void contterm::f_regs(void)
+{
+  m.cpu.dump(iobase::CONTROL,base);
+}
+
+
+// decoded instruction cache statistics
+void contterm::f_cache(void)
+{
+  if (!m.cpu.cacheon())
+    {
+      m.io.printf(iobase::CONTROL,"Decoded instruction cache is off\r\n");
+      return;
+    }
+  m.io.printf(iobase::CONTROL,"Hits %llu  Misses %llu  Invalidations %llu\r\n",
+		 m.cpu.dhits,m.cpu.dmisses,m.ram.codeinval);
+  unsigned long long dispatches=m.cpu.dhits+m.cpu.dmisses;
+  if (dispatches)
+    m.io.printf(iobase::CONTROL,"Fused %llu  (%.3f dispatches per instruction)\r\n",
+		   m.cpu.fused,(double)dispatches/(dispatches+m.cpu.fused));
+  JIT *jit=m.cpu.getjit();
+  if (jit)
+    m.io.printf(iobase::CONTROL,"JIT: Instructions %llu  Blocks %llu  Kills %llu  Flushes %llu  Run time immediates %llu\r\n",
+		   jit->instrs,jit->blocks,jit->kills,jit->flushes,jit->varimms);
+  AOT *aot=m.cpu.getaot();
+  if (aot)
+    m.io.printf(iobase::CONTROL,"Recompiled %s: Instructions %llu  Kills %llu  Misses %llu\r\n",
+		   aot->name(),aot->instrs,aot->kills,aot->misses);
+}
+
+void contterm::f_pages(void)
+{
+  unsigned shared, priv;
+  if (!m.ram.sharing(&shared,&priv))
+    {
+      m.io.printf(iobase::CONTROL,"Can't tell which pages are shared here\r\n");
+      return;
+    }
+  m.io.printf(iobase::CONTROL,"Image pages: %u shared  %u private (written)\r\n",shared,priv);
+}
+
+// Memory map, one line per run of pages of the same kind
+void contterm::f_map(void)
+{
+  static const char *const kinds[]={ "RAM", "ROM", "none", "I/O" };
+  unsigned start=0;
+  for (unsigned p=1;p<=256;p++)
+    if (p==256 || m.ram.kindof(p<<8)!=m.ram.kindof(start<<8))
+      {
+	m.io.printf(iobase::CONTROL,"%04X-%04X %s\r\n",start<<8,(p<<8)-1,kinds[m.ram.kindof(start<<8)]);
+	start=p;
+      }
+}
+
+void contterm::f_int(void)
 {
-  if (!thecpu) return;
-  thecpu->dump(iobase::CONTROL,base);
+  int ok;
+  unsigned n;
+  n=getval(&ok);
+  if (ok) m.cpu.interrupt(n);
+  m.io.printf(iobase::CONTROL,"Interrupts %s%s\r\n",m.cpu.intenabled()?"enabled":"disabled",
+		 m.cpu.intpending()?" (request pending)":"");
 }
 
+void contterm::f_speed(void)
+{
+  int ok;
+  unsigned mult;
+  mult=getval(&ok);
+  if (ok)
+    {
+      m.pace.set(mult);
+      m.pace.restart(m.cpu.tstates);
+    }
+  mult=m.pace.getmult();
+  m.io.printf(iobase::CONTROL,"T states %llu  ",m.cpu.tstates);
+  if (mult) m.io.printf(iobase::CONTROL,"Speed %ux (%u MHz)\r\n",mult,mult*throttle::CLOCK/1000000);
+  else m.io.printf(iobase::CONTROL,"Speed unlimited\r\n");
+}
 
-void f_n(void)
+void contterm::f_n(void)
 {
 #if 1  // this is one way to do things like this
   // this has the advantage of only stopping on whole instructions
   // set private breakpoint
-  theRFP->bps[26].init(1,"pc",0x10000,0xFFFF);
+  m.bps[26].init(1,"pc",0x10000,0xFFFF);
   // do not set OUR breakpoint to hold so 26 is the right #
   for (int i=0;i<26;i++) 
-    if (theRFP->bps[i].getstate()==1) theRFP->bps[i].setstate(-1);
+    if (m.bps[i].getstate()==1) m.bps[i].setstate(-1);
   virt_switch=1;
   virt_sreset=0;
   virt_smask=1;
-  while(theRFP->bps[26].check()==-1) { sched_yield(); virt_smask=1;  }
+  while(m.bps[26].check()==-1) { sched_yield(); virt_smask=1;  }
   virt_smask=0;
-  theRFP->bps[26].setstate(0);
+  m.bps[26].setstate(0);
 #else
   // and another way
   // this way steps one cycle at a time like step or the step button
@@ -367,19 +503,20 @@ void f_n(void)
 
 
 // Breakpoint (manu subcommands)
-void f_bp(void)
+void contterm::f_bp(void)
 {
-  char *tag=strtok(NULL," \t,");
+  char *tag=token(" \t,");
   int bp;
   if (!tag || !*tag || !strcasecmp(tag,"help"))
     {
     bphelp:
       // do bp help here
-      iobase::printf(iobase::CONTROL,
+      m.io.printf(iobase::CONTROL,
 		     "Breakpoints range from A-Z (not case sensitive; X in the list below represents any breakpoint letter)\r\n"
 		     "bp X set target value [mask] - set regular breakpoint\r\n"
 		     "   (for target use @address or register name)\r\n"
 		     "bp X onchange target [mask] - set a break on change\r\n"
+		     "   (@start-end breaks when a write changes anything in that range)\r\n"
 		     "bp X action (stop|trace|enable X|disable X) - set breakpoint action\r\n"
 		     "   Enable and disable allow you to change state of any breakpoint\r\n"
 		     "bp X count n - set the breakpoint counter (0=immediate)\r\n"
@@ -395,27 +532,27 @@ void f_bp(void)
       // list all breakpoints (or just one)
       int i;
       // print header
-      breakpoint::header(iobase::CONTROL);
-      tag=strtok(NULL," \t,");
+      breakpoint::header(m.io,iobase::CONTROL);
+      tag=token(" \t,");
       if (tag && *tag)
 	{
 	  *tag=toupper(*tag);
 	  if (*tag>='A' && *tag<='Z')
 	    {
-	      theRFP->bps[*tag-'A'].dump(iobase::CONTROL,base);
+	      m.bps[*tag-'A'].dump(iobase::CONTROL,base);
 	      return;
 	    }
 	}
       for (i=0;i<26;i++)
 	{
-	  if (tag && *tag=='*' && theRFP->bps[i].getstate()==0) continue;
-	  theRFP->bps[i].dump(iobase::CONTROL,base);
+	  if (tag && *tag=='*' && m.bps[i].getstate()==0) continue;
+	  m.bps[i].dump(iobase::CONTROL,base);
 	}
       return;
     }
   // everything but list and help take a BPID first
   bp=toupper(*tag)-'A';
-  tag=strtok(NULL," \t,");
+  tag=token(" \t,");
   if (!tag || !*tag) goto bphelp;
   if (!strcasecmp(tag,"set"))
     {
@@ -423,40 +560,40 @@ void f_bp(void)
       unsigned v;
       unsigned mask;
       mask=0xFFFF;
-      tag=strtok(NULL," \t,");
+      tag=token(" \t,");
       if (!tag || !*tag) 
 	{
 	bperr:
-	  iobase::printf(iobase::CONTROL,"?error\r\n");
+	  m.io.printf(iobase::CONTROL,"?error\r\n");
 	  return;
 	}
       // portable strupr
       for (tmp=tag;*tmp;tmp++) *tmp=toupper(*tmp);
-      tmp=strtok(NULL," \t,");
+      tmp=token(" \t,");
       if (!tmp || !*tmp) goto bperr;
       v=strtonum(tmp);
-      tmp=strtok(NULL," \t,");
+      tmp=token(" \t,");
       if (tmp && *tmp) mask=strtonum(tmp);
-      theRFP->bps[bp].init(1,tag,v,mask);
+      m.bps[bp].init(1,tag,v,mask);
       return;
     }
   if (!strcasecmp(tag,"onchange"))  // set a change breakpoint
     {
       unsigned mask=0xFFFF;
       char *tmp;
-      tag=strtok(NULL," \t,");
-      if (!tmp || !*tmp) goto bperr;
+      tag=token(" \t,");
+      if (!tag || !*tag) goto bperr;
       // portable strupr
       for (tmp=tag;*tmp;tmp++) *tmp=toupper(*tmp);
-      tmp=strtok(NULL," \t,");
+      tmp=token(" \t,");
       if (tmp && *tmp) mask=strtonum(tmp);
-      theRFP->bps[bp].init(1,tag,0x10000,mask);
+      m.bps[bp].init(1,tag,0x10000,mask);
       return;
     }
   if (!strcasecmp(tag,"action"))  // set action
     {
       int act=-1;
-      tag=strtok(NULL," \t,");
+      tag=token(" \t,");
       if (!strcasecmp(tag,"stop")) act=0;
       if (!strcasecmp(tag,"trace")) act=1;
       if (!strcasecmp(tag,"enable")) act=0x80;
@@ -465,106 +602,108 @@ void f_bp(void)
       if (act>=0x40)
 	{
 	  int c;
-	  tag=strtok(NULL," \t,");
+	  tag=token(" \t,");
 	  if (!tag||!*tag) goto bperr;
 	  c=toupper(*tag);
 	  if (c<'A'||c>'Z') goto bphelp;
 	  act+=c-'A';
 	}
-      theRFP->bps[bp].action=act;
+      m.bps[bp].action=act;
       return;
     }
   if (!strcasecmp(tag,"count"))  // set count
     {
       unsigned v;
-      tag=strtok(NULL," \t,");
+      tag=token(" \t,");
       if (!tag||!*tag) goto bperr;
       v=strtonum(tag);
-      theRFP->bps[bp].setcount(v);
+      m.bps[bp].setcount(v);
       return;
     }
   if (!strcasecmp(tag,"on"))  // enable 
     {
-      theRFP->bps[bp].setstate(1);
+      m.bps[bp].setstate(1);
       return;
     }
   if (!strcasecmp(tag,"off"))  // disable
     {
-      theRFP->bps[bp].setstate(0);
+      m.bps[bp].setstate(0);
       return;
     }
   if (!strcasecmp(tag,"once"))  // set one shot flag
     {
       int n=0;
-      tag=strtok(NULL," \t,");
+      tag=token(" \t,");
       if (!tag || !*tag || !strcasecmp(tag,"on")) n=1;
-      theRFP->bps[bp].oneshot=n;
+      m.bps[bp].oneshot=n;
       return;
     }
   if (!strcasecmp(tag,"resume"))   // resume from this breakpoint (note: bp X resume is not the same as just resume; see f_resume)
     {
-      theRFP->bps[bp].setstate(-1);
+      m.bps[bp].setstate(-1);
       return;
     }
   goto bphelp;
 }
 
 // Resume from all breakpoints
-void f_resume(void)
+void contterm::f_resume(void)
 {
   for (int i=0;i<27;i++) 
-      if (theRFP->bps[i].getstate()==1) theRFP->bps[i].setstate(-1);
+      if (m.bps[i].getstate()==1) m.bps[i].setstate(-1);
 }
 
 
 // command table -- string, function, help text
 
-struct cmdentry
-{
-  const char *cmd;
-  void (*func)(void);
-  const char *help;
-} cmds[]=
+const contterm::cmdentry contterm::cmds[]=
   {
-    {"bp",f_bp,"bp a_z command - Breakpoint commands (bp help for more)"  },
-    { "disp", f_disp, "display address [count] - Show memory" },
-    { "exit", f_exit , "exit - End simulator" },
-    { "help", f_help , "help [keyword] - Get help" },
-    { "hex", f_hex, "hex - Set default radix to hex (override # -decimal, & - octal, $ - hex)"  },
-    { "load", f_load, "load [@start] [-len] file - Load RAM with file" },
-    { "n", f_n, "n - step + regs command"  },
-    { "oct", f_oct,  "oct - Set default radix to octal (override # -decimal, & - octal, $ - hex)" },
-    { "reg", f_reg,  "reg register [value] - Display/set register (AF, BC, DE, HL, SP, PC for 8080" },
-    { "regs", f_regs, "regs - Show all registers" },
-    { "release", f_release, "release - Release all control switches to front panel or default" },
-    { "reset", f_reset, "reset - Reset CPU" },
-    { "resume", f_resume, "resume - Continue after breakpoint"   },
-    { "run", f_run, "run - Run/resume program"  },
-    { "save", f_save, "save [@start] [-len] filename - Save RAM to file"   },
-    { "set", f_set, "set address - Set RAM (Esc to quit)"   },
-    { "step", f_step, "step - Single step program"  },
-    { "stop", f_stop, "stop - Stop program execution" }
+    { "bank", &contterm::f_bank, "bank [n [address [count]]] - Show the banks; switch to bank n; show memory in bank n" },
+    { "bp", &contterm::f_bp,"bp a_z command - Breakpoint commands (bp help for more)"  },
+    { "cache", &contterm::f_cache, "cache - Show decoded instruction cache statistics" },
+    { "disp", &contterm::f_disp, "display address [count] - Show memory" },
+    { "exit", &contterm::f_exit, "exit - End simulator" },
+    { "help", &contterm::f_help, "help [keyword] - Get help" },
+    { "hex", &contterm::f_hex, "hex - Set default radix to hex (override # -decimal, & - octal, $ - hex)"  },
+    { "int", &contterm::f_int, "int [n] - Show interrupt state; request RST n" },
+    { "load", &contterm::f_load, "load [@start] [-len] file - Load RAM with file" },
+    { "map", &contterm::f_map, "map - Show the memory map" },
+    { "n", &contterm::f_n, "n - step + regs command"  },
+    { "oct", &contterm::f_oct,  "oct - Set default radix to octal (override # -decimal, & - octal, $ - hex)" },
+    { "pages", &contterm::f_pages, "pages - Show how many pages of loaded images are shared and how many are private" },
+    { "reg", &contterm::f_reg,  "reg register [value] - Display/set register (AF, BC, DE, HL, SP, PC for 8080; IX, IY, AF', BC', DE', HL' too on the Z80)" },
+    { "regs", &contterm::f_regs, "regs - Show all registers" },
+    { "release", &contterm::f_release, "release - Release all control switches to front panel or default" },
+    { "reset", &contterm::f_reset, "reset - Reset CPU" },
+    { "resume", &contterm::f_resume, "resume - Continue after breakpoint"   },
+    { "run", &contterm::f_run, "run - Run/resume program"  },
+    { "save", &contterm::f_save, "save [@start] [-len] filename - Save RAM to file"   },
+    { "set", &contterm::f_set, "set address - Set RAM (Esc to quit)"   },
+    { "speed", &contterm::f_speed, "speed [n] - Show T states; run at n times a 2 MHz Altair (0=no limit)"   },
+    { "step", &contterm::f_step, "step - Single step program"  },
+    { "stop", &contterm::f_stop, "stop - Stop program execution" },
+    { "sync", &contterm::f_sync, "sync - Write persistent memory (-R nv) to its files now" }
       
   };
 
 // Print a breakpoint when it hits (called by the breakpoint)
-void print_bp(char id)
+void contterm::announce(char id)
 {
   if (id=='Z'+1) return;
-  iobase::printf(iobase::CONTROL,"\r\nBreakpoint %c hit at ",id);
-  iobase::printf(iobase::CONTROL,base==0x10?"%04X\r\n":"%06o\r\n",thecpu->getreg("PC"));
+  m.io.printf(iobase::CONTROL,"\r\nBreakpoint %c hit at ",id);
+  m.io.printf(iobase::CONTROL,base==0x10?"%04X\r\n":"%06o\r\n",m.cpu.getreg("PC"));
 }
 
 
 // actually print help for a command or all help for k==NULL
-void do_help(const char *k)
+void contterm::do_help(const char *k)
 {
   int i;
   for (i=0;i<sizeof(cmds)/sizeof(cmds[0]);i++)
     {
       if (!k || !strcasecmp(k,cmds[i].cmd))
 	{
-	  iobase::printf(iobase::CONTROL,"%s\r\n",cmds[i].help);
+	  m.io.printf(iobase::CONTROL,"%s\r\n",cmds[i].help);
 	  if (k) return;
 	}
     }
@@ -574,26 +713,36 @@ void do_help(const char *k)
 
 // This is the thread function that does the control terminal
 
-void *controlterm(void *nothing)
+void *contterm::thread(void *term)
 {
+  contterm &t=*(contterm *)term;
   while (1)
     {
       int i, found;
       char *ctoken;
       do 
 	{
-	  getcline("? ");
-	} while (!*cmdbuf);
+	  t.getcline("? ");
+	} while (!*t.cmdbuf);
       found=0;
-      ctoken=strtok(cmdbuf," \t");
+      t.rest=t.cmdbuf;
+      ctoken=t.token(" \t");
       if (ctoken) for (i=0;i<sizeof(cmds)/sizeof(cmds[0]);i++)
 	if (!strcasecmp(ctoken,cmds[i].cmd))
 	  {
 	    found=1;
-	    cmds[i].func();
+	    (t.*cmds[i].func)();
 	    break;
 	  }
-      if (!found) iobase::printf(iobase::CONTROL,"Unknown command\r\n");
+      if (!found) t.m.io.printf(iobase::CONTROL,"Unknown command\r\n");
     }
   
 }
+
+void contterm::start(void)
+{
+#if !defined(NOTELNET)
+  running=1;
+  pthread_create(&worker,NULL,thread,this);
+#endif
+}
@@ -23,15 +23,84 @@ Altairrfp (c) 2011 by Al Williams.
 
 ***********************************************************************/
 #ifndef _CONTTERM_H
-#define _CONTERM_H
-
-// Just a few things that conterm exports for other people
-// this converts a string to a number using our
-// default base and syntax ($hex, &oct, #decimal or default base from contterm.cpp)
-extern unsigned strtonum(const char *t);
+#define _CONTTERM_H
+#if !defined(NOTELNET)
+#include <pthread.h>
+#else
+#define pthread_t int
+#endif
 
-// break point annunciation
-extern void print_bp(char id);
+class Machine;
 
+// Control terminal: commands typed on the machine's CONTROL 
+// stream (-X), read on a thread of their own. Every machine
+// has one; the virtual switches and the number base are its own
+class contterm
+{
+ protected:
+  Machine &m;
+  char cmdbuf[1024];  // command line buffer
+  char *rest;  // what token() hasn't looked at yet
+  char *token(const char *delims);
+  unsigned getval(int *success=NULL);
+  int getcline(const char *prompt, const char *ends=NULL);
+  void do_help(const char *k);
+  char *rangefile(const char *cmd, unsigned *start, unsigned *len);
+  // command handlers
+  void f_exit(void);
+  void f_help(void);
+  void f_stop(void);
+  void f_run(void);
+  void f_release(void);
+  void f_reset(void);
+  void f_step(void);
+  void f_save(void);
+  void f_load(void);
+  void f_disp(void);
+  void showmem(unsigned add, unsigned end, int b);
+  void f_bank(void);
+  void f_set(void);
+  void f_reg(void);
+  void f_hex(void);
+  void f_oct(void);
+  void f_pages(void);
+  void f_map(void);
+  void f_sync(void);
+  void f_regs(void);
+  void f_cache(void);
+  void f_int(void);
+  void f_speed(void);
+  void f_n(void);
+  void f_bp(void);
+  void f_resume(void);
+  // command table -- string, function, help text
+  struct cmdentry
+  {
+    const char *cmd;
+    void (contterm::*func)(void);
+    const char *help;
+  };
+  static const cmdentry cmds[];
+  static void *thread(void *term);
+ public:
+  // These are used to virtually flip switches on the front panel
+  // (even if we don't have one)
+  volatile int virt_switch, virt_smask, virt_sreset;
+  // and to switch banks between quanta (-1 for none)
+  volatile int virt_bank;
+  int base; // default number base (must be 0x10 or 010).
+  int running;  // is the command thread going?
+  pthread_t worker;
+  contterm(Machine &mach);
+  // start reading commands
+  void start(void);
+  // this converts a string to a number using our
+  // default base and syntax ($hex, &oct, #decimal or default base)
+  unsigned strtonum(const char *t);
+  // process real switches (func) with virtual switches
+  unsigned virtsw(int func);
+  // break point annunciation
+  void announce(char id);
+};
 
 #endif
@@ -23,7 +23,10 @@ Altairrfp (c) 2011 by Al Williams.
 
 ***********************************************************************/
 #include "cpu.h"
+#include "flags.h"
 #include <ctype.h>
+#include <string.h>
+#include <stdlib.h>
 
 
 
@@ -32,56 +35,30 @@ void CPU::reset(void)
 {
   pc=0;
   cycle=0;
+  intcheck=inte=eidelay=irq=halted=0;
+  deadline=0;
+  intmask=7;   // 8085: all masked
+  ireg=rreg=im=0;  // Z80
+  sio.reset(*this);
+  ram.bank(0);  // the bank select latch clears too
   // from Intel data sheet:
   // ...the ontents of the program counter is cleared.... the INTE and HLDA
   // flip flops are also reset. Note that the flags, accumulator, stack pointer
-  // and registers are not cleared. However, on power up regs could be >0xFF
-  // in the simulator so at least chop them
-  for (int i=0;i<8;i++) regs[i]=regs[i]&0xFF;
+  // and registers are not cleared.
   sp&=0xFFFF; 
 }
 
-// Set flags after an instruction
-unsigned CPU::setflags(unsigned value, unsigned savemask)
-{
-  unsigned oldflags;
-  unsigned newflags=0;
-  savemask|=0x3A;  // save A, N, and the unused (N not used on 8080?)
-  oldflags=regs[F]&savemask;
-  if (value>=256) newflags|=1;
-  value&=0xFF;
-  if (value & 0x80) newflags|=0x80;
-  if (value==0) newflags|=0x40;
-  if (parity(value)) newflags|=4;
-  newflags&=~savemask;
-  regs[F]=oldflags|newflags;
-  return value;
-}
-
-
-// Computer parity for flags
-unsigned CPU::parity(unsigned v)
-{
-  unsigned bit=0;
-  unsigned i;
-  for (i=0;i<8;i++) bit^=(v&(1<<i))?1:0;
-  return bit;
-}
-
-
 // Get 8 bits M (that is [HL])
 unsigned CPU::getM8(void)
 {
-  unsigned a=(regs[H]<<8)+regs[L];
-  return ram.read(a);
+  return ram.read(regs.pair(HL));
 }
 
 
 // set 8 bit M
 void CPU::setM8(unsigned v)
 {
-  unsigned a=(regs[H]<<8)+regs[L];
-  ram.write(a,v);
+  ram.write(regs.pair(HL),v);
 }
 
 
@@ -115,8 +92,8 @@ unsigned CPU::getcond(unsigned cc)
     case 1: return (regs[F]&0x40)==0x40;
     case 2: return (regs[F]&1)!=1;
     case 3: return (regs[F]&1)==1;
-    case 4: return (regs[F]&4)==4;
-    case 5: return (regs[F]&4)!=4;
+    case 4: return (regs[F]&4)!=4;   // PO
+    case 5: return (regs[F]&4)==4;   // PE
     case 6: return (regs[F]&0x80)!=0x80;
     case 7: return (regs[F]&0x80)==0x80;
     }
@@ -128,8 +105,6 @@ unsigned CPU::getcond(unsigned cc)
 // Do an opcode
 void CPU::doop(unsigned opcode)
 {
-  static unsigned r1,r2,op1,op2;
-  int inp;
   // rather than mess with pointers to member functions
   // assume the compiler will optmizize a big switch well
 
@@ -165,11 +140,7 @@ void CPU::doop(unsigned opcode)
     case 0x03:
     case 0x13:
     case 0x23:
-      r1=(opcode&0x30)>>3;
-      regs[r1+1]++;
-      if (regs[r1+1]>=0x100) regs[r1]++;
-      regs[r1]&=0xFF;
-      regs[r1+1]&=0xFF;
+      regs.pair((opcode&0x30)>>4)++;
       break;
 
       
@@ -184,11 +155,7 @@ void CPU::doop(unsigned opcode)
     case 0x0b:
     case 0x1b:
     case 0x2b:
-      r1=(opcode&0x30)>>3;
-      regs[r1+1]--;
-      if (regs[r1+1]>=0x100) regs[r1]--;
-      regs[r1]&=0xFF;
-      regs[r1+1]&=0xFF;
+      regs.pair((opcode&0x30)>>4)--;
       break;
 
     case 0x3B:  // DCX SP
@@ -201,21 +168,16 @@ void CPU::doop(unsigned opcode)
     case 0x09:
     case 0x19:
     case 0x29:
-      r1=(opcode&0x30)>>3;
-      t1=regs[r1]*0x100+regs[r1+1];
-      t1+=regs[H]*0x100+regs[L];
-      regs[H]=(t1>>8)&0xFF;
-      regs[L]=t1&0xFF;
+      t1=regs.pair((opcode&0x30)>>4)+regs.pair(HL);
+      regs.pair(HL)=t1;
       regs[F]&=0xFE;
       if (t1>0xFFFF) regs[F]|=1;
       break;
       
       // DAD SP
     case 0x39:
-      t1=regs[H]*0x100+regs[L];
-      t1+=sp;
-      regs[H]=(t1>>8)&0xFF;
-      regs[L]=t1&0xFF;
+      t1=regs.pair(HL)+sp;
+      regs.pair(HL)=t1;
       regs[F]&=0xFE;
       if (t1>0xFFFF) regs[F]|=1;
 
@@ -224,9 +186,7 @@ void CPU::doop(unsigned opcode)
       // LDAX
     case 0x0A:
     case 0x1A:
-      t1=256*((opcode&0x10)?regs[D]:regs[B]);
-      t1+=(opcode&0x10)?regs[E]:regs[C];
-      regs[A]=ram.read(t1);
+      regs[A]=ram.read(regs.pair((opcode&0x10)?DE:BC));
       break;
 
       // LHLD
@@ -253,10 +213,7 @@ void CPU::doop(unsigned opcode)
       // STAX
     case 0x02:
     case 0x12:
-      t1=(opcode&0x10)?regs[D]:regs[B];
-      t1*=256;
-      t1+=(opcode&0x10)?regs[E]:regs[C];
-      ram.write(t1,regs[A]);
+      ram.write(regs.pair((opcode&0x10)?DE:BC),regs[A]);
       break;
       
       // SHLD
@@ -304,26 +261,17 @@ void CPU::doop(unsigned opcode)
 
       // RAL
     case 0x17:
-      regs[A]<<=1;
-      t1=regs[F]&1;
-      regs[F]&=0xFE;
-      if (regs[A]&0x100) regs[F]|=1;
-      if (t1) regs[A]|=1;
-      regs[A]&=0xFF;
+      t1=(regs[A]<<1)|(regs[F]&1);
+      regs[F]=(regs[F]&0xFE)|(t1>>8);
+      regs[A]=t1;
       break;
       
 
       // DAA
     case 0x27:
-      t1=0;
-      if ((regs[A]&0xF)>9 || (regs[F]&0x10)) 
-	{
-	  if ((regs[A]&0xF)+6>=0x10) regs[F]|=0x10; else regs[F]&=~0x10;
-	  regs[A]+=6;
-	}
-        if ((regs[A]&0xF0)>0x90 || (regs[F]&1)) regs[A]+=0x60;
-      regs[A]=setflags(regs[A],0);
-      // not sure how C and AC get set here
+      t1=ftab.daa[regs[A]|((regs[F]&1)<<8)|((regs[F]&0x10)<<5)];
+      regs[A]=t1&0xFF;
+      regs[F]=(regs[F]&flagtables::KEEP)|(t1>>8);
       break;
 
       // RRC
@@ -335,10 +283,9 @@ void CPU::doop(unsigned opcode)
       
       // RAR
     case 0x1F:
-      regs[A]|=(regs[F]&1)?0x100:0;
-      regs[F]&=0xFE;
-      if (regs[A]&1) regs[F]|=1;
-      regs[A]>>=1;
+      t1=regs[A]|((regs[F]&1)<<8);
+      regs[F]=(regs[F]&0xFE)|(t1&1);
+      regs[A]=t1>>1;
       break;
       
 
@@ -352,12 +299,9 @@ void CPU::doop(unsigned opcode)
     case 0x34:
     case 0x3C:
       r1=(opcode&0x38)>>3;
-      op1=loadop8(r1);
-      if ((op1&0xF)+1>=0x10) 
-	regs[F]|=0x10;
-      else
-	regs[F]&=~0x10;
-      setop8(r1,setflags(++op1,1));
+      op1=(loadop8(r1)+1)&0xFF;
+      regs[F]=(regs[F]&(flagtables::KEEP|1))|ftab.inr[op1];
+      setop8(r1,op1);
       break;
 
       // DCR
@@ -370,12 +314,9 @@ void CPU::doop(unsigned opcode)
     case 0x35:
     case 0x3D:
       r1=(opcode&0x38)>>3;
-      op1=loadop8(r1);
-      if ((op1&0xF)==0) 
-	regs[F]|=0x10;
-      else
-	regs[F]&=~0x10;  // is this right?
-      setop8(r1,setflags(--op1,1));
+      op1=(loadop8(r1)-1)&0xFF;
+      regs[F]=(regs[F]&(flagtables::KEEP|1))|ftab.dcr[op1];
+      setop8(r1,op1);
       break;
       
       // CMA
@@ -405,11 +346,10 @@ void CPU::doop(unsigned opcode)
       r1=(opcode&7);
       op1=loadop8(r1);
     l_add:
-      if ((op1&0xF)+(regs[A]&0xF)>=0x10)
-	regs[F]|=0x10;
-      else
-	regs[F]&=~10;
-      regs[A]=setflags(regs[A]+op1,0);
+      t1=regs[A]+op1;
+    l_addflags:
+      regs[F]=(regs[F]&flagtables::KEEP)|ftab.szpc[t1]|ftab.acadd[flagtables::acindex(regs[A],op1,t1)];
+      regs[A]=t1&0xFF;
       break;
       
       // ADC
@@ -424,11 +364,8 @@ void CPU::doop(unsigned opcode)
       r1=(opcode&7);
       op1=loadop8(r1);
     l_adc:
-      if ((op1&0xF)+(regs[A]&0xF+(regs[F]&1))>=0x10)
-	regs[F]|=0x10;
-      else
-	regs[F]&=~10;
-      regs[A]=setflags(regs[A]+op1+(regs[F]&1),0);
+      t1=regs[A]+op1+(regs[F]&1);
+      goto l_addflags;
       break;
 
       // SUB
@@ -443,12 +380,10 @@ void CPU::doop(unsigned opcode)
       r1=(opcode&7);
       op1=loadop8(r1);
     l_sub:
-      if ((op1&0xF)+(regs[A]&0xF)>=0x10)  // does this matter?
-	regs[F]|=0x10;
-      else
-	regs[F]&=~10;
-      regs[A]=(regs[A]+(~op1&0xFF)+1)^0x100;
-      regs[A]=setflags(regs[A],0);
+      t1=(regs[A]-op1)&0x1FF;   // bit 8 is the borrow
+    l_subflags:
+      regs[F]=(regs[F]&flagtables::KEEP)|ftab.szpc[t1]|ftab.acsub[flagtables::acindex(regs[A],op1,t1)];
+      regs[A]=t1&0xFF;
       break;
       
       // SBB
@@ -463,12 +398,8 @@ void CPU::doop(unsigned opcode)
       r1=(opcode&7);
       op1=loadop8(r1);
     l_sbb:
-      if ((op1&0xF)+(regs[A]&0xF+(regs[F]&1))>=0x10)  // does this matter?
-	regs[F]|=0x10;
-      else
-	regs[F]&=~10;
-      regs[A]=(regs[A]+(~op1&0xFF)+1-(regs[F]&1))^0x100;
-      regs[A]=setflags(regs[A],0);
+      t1=(regs[A]-op1-(regs[F]&1))&0x1FF;
+      goto l_subflags;
       break;
 
       
@@ -484,8 +415,9 @@ void CPU::doop(unsigned opcode)
       r1=(opcode&7);
       op1=loadop8(r1);
     l_and:
-      regs[F]|=0x10;
-      regs[A]=setflags(regs[A]&op1,0);
+      // 8080 sets AC from bit 3 of either operand
+      regs[F]=(regs[F]&flagtables::KEEP)|ftab.szp[regs[A]&op1]|(((regs[A]|op1)&8)<<1);
+      regs[A]&=op1;
       break;
       
       // XRA
@@ -500,8 +432,8 @@ void CPU::doop(unsigned opcode)
       r1=(opcode&7);
       op1=loadop8(r1);
     l_xra:
-      regs[F]&=~0x10;
-      regs[A]=setflags(regs[A]^op1,0);
+      regs[A]^=op1;
+      regs[F]=(regs[F]&flagtables::KEEP)|ftab.szp[regs[A]];
       break;
 
       // OR
@@ -516,8 +448,8 @@ void CPU::doop(unsigned opcode)
       r1=(opcode&7);
       op1=loadop8(r1);
     l_ora:
-      regs[F]&=~0x10;
-      regs[A]=setflags(regs[A]|op1,0);
+      regs[A]|=op1;
+      regs[F]=(regs[F]&flagtables::KEEP)|ftab.szp[regs[A]];
       break;
       
       // CMP
@@ -532,11 +464,8 @@ void CPU::doop(unsigned opcode)
       r1=(opcode&7);
       op1=loadop8(r1);
     l_cmp:
-      if ((op1&0xF)+(regs[A]&0xF)>=0x10)  // does this matter?
-	regs[F]|=0x10;
-      else
-	regs[F]&=~10;
-      setflags((regs[A]+(~op1&0xFF)+1)^0x100,0);
+      t1=(regs[A]-op1)&0x1FF;
+      regs[F]=(regs[F]&flagtables::KEEP)|ftab.szpc[t1]|ftab.acsub[flagtables::acindex(regs[A],op1,t1)];
       break;
 
       // ADI
@@ -671,7 +600,7 @@ void CPU::doop(unsigned opcode)
 	{
 	case 1: cond=getcond((opcode>>3)&7); break;
 	case 2: t1=ram.read(incpc()); break;
-	case 3: cycle=0; t1+=ram.read(incpc())*256; if (cond) {  decsp(); ram.write(sp,pc>>8); decsp(); ram.write(sp,pc&0xFF); pc=t1; }  break;
+	case 3: cycle=0; t1+=ram.read(incpc())*256; if (cond) { tstates+=6; decsp(); ram.write(sp,pc>>8); decsp(); ram.write(sp,pc&0xFF); pc=t1; }  break;
 	}
       break;
       
@@ -696,6 +625,7 @@ void CPU::doop(unsigned opcode)
       cond=getcond((opcode>>3)&7); 
       if (cond) 
 	{
+	  tstates+=6;
 	  pc=ram.read(incsp());
 	  pc+=ram.read(incsp())<<8;
 	  pc&=0xFFFF;
@@ -739,23 +669,20 @@ void CPU::doop(unsigned opcode)
       
       // PCHL
     case 0xE9:
-      pc=(regs[H]<<8)+regs[L];
+      pc=regs.pair(HL);
       break;
 
       // SPHL
     case 0xF9:
-      sp=(regs[H]<<8)+regs[L];
+      sp=regs.pair(HL);
       break;
       
 
       // XCHG
     case 0xEB:
-      r1=regs[H];
-      r2=regs[L];
-      regs[H]=regs[D];
-      regs[L]=regs[E];
-      regs[D]=r1;
-      regs[E]=r2;
+      r1=regs.pair(HL);
+      regs.pair(HL)=regs.pair(DE);
+      regs.pair(DE)=r1;
       break;
 
       // OUT
@@ -763,18 +690,7 @@ void CPU::doop(unsigned opcode)
       if (++cycle==1) break;
       cycle=0;
       r1=ram.read(incpc());
-      if (r1==0x11) 
-	{ 
-	  int c=regs[A]&0x7F;
-	  if (c=='_') c='\010';
-	  iobase::putchar(iobase::CONSOLE,c); 
-	  if (c=='\010') 
-	    {
-	      iobase::putchar(iobase::CONSOLE,' ');
-	      iobase::putchar(iobase::CONSOLE,'\010');
-	    }
-	}
-      
+      portout(r1,regs[A]);
       break;
       
       // IN
@@ -785,20 +701,7 @@ void CPU::doop(unsigned opcode)
 	case 2: 
 	  cycle=0; 
 	  r1=ram.read(incpc());
-	  switch (r1)
-	    {
-	    case 0x11: 
-	      inp=iobase::getchar(iobase::CONSOLE);
-	      regs[A]=(inp<0)?0:inp;
-	      if (upper) regs[A]=toupper(regs[A]);
-	      if (regs[A]==0x7F) regs[A]='_'; 
-	      if (regs[A]=='\n') regs[A]='\r'; 
-	      break; 
-	    case 0x10: regs[A]=2+iobase::ischar(iobase::CONSOLE); break;  
-	    case 0xFF: regs[A]=rfp.getSWHigh(); break;
-	    }
-	  
-
+	  regs[A]=portin(r1,regs[A]);
 	  break;
 	}
       break;
@@ -822,9 +725,16 @@ void CPU::doop(unsigned opcode)
       
 
 
-      // EI/DI (no interrupts in this version so nothing)
+      // DI
     case 0xF3:
+      inte=eidelay=intcheck=0;
+      break;
+
+      // EI
     case 0xFB:
+      eidelay=intcheck=1;
+      deadline=0;
+      break;
 
       // NOP
     case 0x00:
@@ -838,7 +748,8 @@ void CPU::doop(unsigned opcode)
       break;
   // HLT
  case 0x76:
-   pc--;
+   pc=(pc-1)&0xFFFF;
+   halted=1;
    break;
 
 
@@ -849,104 +760,475 @@ void CPU::doop(unsigned opcode)
 
 
 
+// Output to a port
+void CPU::portout(unsigned port, unsigned v)
+{
+  switch (port)
+    {
+    case 0x11: sio.write(*this,v); break;
+    case 0x10: sio.setcontrol(*this,v); break;
+    default: if ((int)port==ram.bankport) ram.bank(v); break;
+    }
+}
+
+// Input from a port (IN passes A so unknown ports leave it alone)
+unsigned CPU::portin(unsigned port, unsigned idle)
+{
+  unsigned v=idle;
+  switch (port)
+    {
+    case 0x11: v=sio.read(*this); break;
+    case 0x10: v=sio.status(*this); break;
+    case 0xFF: v=rfp.getSWHigh(); break;
+    default: if ((int)port==ram.bankport) v=ram.getbank(); break;
+    }
+  return v;
+}
+
+
 // Do a step
+// The table engine still takes one step per byte fetched so
+// the front panel STEP switch behaves the same for both engines
 void CPU::step(void)
 {
-  if (!cycle) opcode=ram.read(incpc());
-  doop(opcode);
+  if (engine==SWITCH)
+    {
+      if (!cycle) 
+	{
+	  if (tstates>=deadline) service();
+	  opcode=ram.read(incpc());
+	  tstates+=opcycles[opcode];
+	}
+      doop(opcode);
+      return;
+    }
+  switch (cycle)
+    {
+    case 0:
+      if (tstates>=deadline) service();
+      opcode=ram.read(incpc());
+      if (lens[opcode]!=1) 
+	{
+	  cycle=1;
+	  return;
+	}
+      break;
+    case 1:
+      t1=ram.read(incpc());
+      if (lens[opcode]==3)
+	{
+	  cycle=2;
+	  return;
+	}
+      break;
+    case 2:
+      t1+=ram.read(incpc())<<8;
+      break;
+    }
+  cycle=0;
+  tstates+=cycles[opcode];
+  (this->*(engine==LAZY?lazy:eager)[opcode])();
+}
+
+// Called at an instruction boundary once tstates reaches deadline
+void CPU::service(void)
+{
+  events.run(*this,tstates);   // devices may call interrupt()
+  if (intcheck) takeint();
+  deadline=intcheck?0:events.next;
+}
+
+void CPU::takeint(void)
+{
+  if (eidelay)
+    {
+      // the instruction after EI still runs with interrupts off
+      eidelay=0;
+      inte=1;
+      intcheck=irq!=0;
+      return;
+    }
+  intcheck=0;
+  if (!inte || !irq) return;
+  // the device puts RST n on the bus
+  unsigned n=irq-1;
+  irq=inte=0;
+  if (halted)
+    {
+      halted=0;
+      pc=(pc+1)&0xFFFF;   // return past the HLT
+    }
+  decsp();
+  ram.write(sp,pc>>8);
+  decsp();
+  ram.write(sp,pc&0xFF);
+  tstates+=cycles[0xC7];
+  if (model!=Z80 || im==0)
+    {
+      pc=n*8;
+      if (model==Z80) tstates+=2;
+      return;
+    }
+  // Z80 mode 1 always goes to 38; mode 2 takes the vector from
+  // the table at I (we use RST n's opcode as the low byte, less 
+  // bit 0)
+  if (im==1)
+    {
+      pc=0x38;
+      tstates+=2;
+      return;
+    }
+  unsigned v=(ireg<<8)|((0xC7|(n<<3))&0xFE);
+  pc=ram.read(v)+(ram.read((v+1)&0xFFFF)<<8);
+  tstates+=8;
+}
+
+// Do a whole instruction (or finish the one the STEP switch started)
+// This skips the cycle state machine so it is what run mode uses
+void CPU::exec(void)
+{
+  if (cycle || engine==SWITCH)
+    {
+      do step(); while (cycle);
+      return;
+    }
+  if (tstates>=deadline) service();
+  if (aot && fuse && aot->run(JITRUN)) return;
+  if (jit && fuse)
+    {
+      // native code for as much as it will do; the rest (and 
+      // anything once breakpoints or tracing come on) is ours
+      jitstale=1;
+      if (!jit->noblock(pc) && jit->run(JITRUN)) return;
+    }
+  else if (jitstale && dcache)
+    {
+      memset(ram.codemap,0,0x10000);
+      jitstale=0;
+    }
+  pc&=0xFFFF;  // the tables below are 64K
+  if (dcache && !jitstale)
+    {
+      if (ram.codemap[pc]) dhits++;
+      else
+	{
+	  decode(pc);
+	  dmisses++;
+	}
+      // copy out first: the handler may overwrite its own entry
+      decoded &d=dcache[pc];
+      if (pairs) countpair(pc,d.opcode);
+      opcode=d.opcode;
+      t1=d.operand;
+      t2=d.operand2;
+      pc=(pc+d.len)&0xFFFF;
+      tstates+=d.cycles;
+      (this->*d.handler)();
+      return;
+    }
+  if (pairs) countpair(pc,ram.read(pc,0));
+  opcode=fetch();
+  switch (lens[opcode])
+    {
+    case 3:
+      t1=fetch();
+      t1+=fetch()<<8;
+      break;
+    case 2:
+      t1=fetch();
+      break;
+    }
+  tstates+=cycles[opcode];
+  (this->*(engine==LAZY?lazy:eager)[opcode])();
+}
+
+// Decode the instruction at a into the cache
+// Fetches don't go to the front panel here; the whole point
+// is to not read memory again for the same instruction
+void CPU::decode(unsigned a)
+{
+  decoded &d=dcache[a];
+  d.opcode=ram.read(a,0);
+  d.len=lens[d.opcode];
+  d.cycles=cycles[d.opcode];
+  d.handler=(engine==LAZY?lazy:eager)[d.opcode];
+  d.operand=0;
+  if (d.len>1) d.operand=ram.read((a+1)&0xFFFF,0);
+  if (d.len>2) d.operand+=ram.read((a+2)&0xFFFF,0)<<8;
+  ram.codemap[a]=d.len;
+  if (!superidx) return;
+  // is this the start of a superinstruction?
+  unsigned b=(a+d.len)&0xFFFF;
+  unsigned op2=ram.read(b,0);
+  unsigned s=superidx[(d.opcode<<8)+op2];
+  if (!s--) return;
+  if (fast) d.handler=engine==LAZY?supertable[s].fastlazy:supertable[s].fastplain;
+  else d.handler=engine==LAZY?supertable[s].lazy:supertable[s].plain;
+  d.operand2=0;
+  if (oplen[op2]>1) d.operand2=ram.read((b+1)&0xFFFF,0);
+  if (oplen[op2]>2) d.operand2+=ram.read((b+2)&0xFFFF,0)<<8;
+  // so writes to either instruction kill the pair
+  ram.codemap[a]=d.len+oplen[op2];
+}
+
+// Set up or tear down the decoded instruction cache
+void CPU::usecache(int on, int supers)
+{
+  if (on && !dcache && engine!=SWITCH)
+    {
+      dcache=new decoded[0x10000];
+      ram.codemap=new unsigned char[0x10000];
+      memset(ram.codemap,0,0x10000);
+      if (supers && model==I8080)
+	{
+	  superidx=new unsigned short[0x10000];
+	  memset(superidx,0,0x10000*sizeof(unsigned short));
+	  for (unsigned i=0;supertable[i].plain;i++)
+	    superidx[(supertable[i].op1<<8)+supertable[i].op2]=i+1;
+	}
+    }
+  if (!on && dcache)
+    {
+      unsigned char *map=ram.codemap;
+      ram.codemap=NULL;   // stop invalidating before we free it
+      delete [] map;
+      delete [] dcache;
+      delete [] superidx;
+      dcache=NULL;
+      superidx=NULL;
+    }
+}
+
+// Switch models (see cpumodel.h)
+// The 8080 and 8085 run on the fastmem handlers when there is no
+// front panel to show memory access on and the memory map is all 
+// RAM (so set the map up first)
+int CPU::setmodel(int m)
+{
+  fast=rfp.isSoft() && ram.isflat();
+  switch (m)
+    {
+    case I8080:
+      eager=fast?fasttable:optable;
+      lazy=fast?fastlazytable:lazytable;
+      lens=oplen;
+      cycles=opcycles;
+      break;
+    case I8085:
+      eager=fast?fasttable85:optable85;
+      lazy=fast?fastlazytable85:lazytable85;
+      lens=oplen;
+      cycles=opcycles85;
+      break;
+    case Z80:
+      eager=lazy=optablez80;  // no lazy flags (and always panelmem)
+      lens=oplenz80;
+      cycles=opcyclesz80;
+      break;
+    default:
+      return 0;
+    }
+  flagsnow();
+  model=m;
+  if (m!=I8080)
+    {
+      if (engine==SWITCH) engine=TABLE;
+      usejit(0);
+      useaot(NULL);
+      delete [] superidx;
+      superidx=NULL;
+    }
+  if (dcache) memset(ram.codemap,0,0x10000);
+  return 1;
+}
+
+// Start or stop the JIT
+// It needs an 8080 on a table engine and a memory map that is all RAM
+int CPU::usejit(int on)
+{
+  if (on && !jit && !aot && engine!=SWITCH && model==I8080 && ram.isflat())
+    {
+      jit=new JIT(*this);
+      if (!jit->ok())
+	{
+	  delete jit;
+	  jit=NULL;
+	}
+    }
+  if (!on && jit)
+    {
+      delete jit;
+      jit=NULL;
+    }
+  return jit!=NULL;
+}
+
+// Start or stop running recompiled code
+// Not with the JIT: its stores don't go through RAM::write
+// Not with bank switching either: it would switch the code away
+int CPU::useaot(const char *name)
+{
+  if (aot)
+    {
+      delete aot;
+      aot=NULL;
+    }
+  if (!name) return 1;
+  AOT::personality *p=AOT::find(name);
+  if (!p || jit || engine==SWITCH || model!=I8080 || p->base+p->size>ram.getlen() || ram.getbanks()) return 0;
+  aot=new AOT(*this,*p);
+  return 1;
+}
+
+// Start or stop counting opcode pairs
+// Only pairs where the second instruction follows the first in
+// memory count since those are the only ones we can fuse
+void CPU::profile(int on)
+{
+  if (on && !pairs)
+    {
+      pairs=new unsigned long long[0x10000];
+      memset(pairs,0,0x10000*sizeof(unsigned long long));
+      pairnext=0x10000;  // nothing before the first one
+    }
+  if (!on && pairs)
+    {
+      delete [] pairs;
+      pairs=NULL;
+    }
+}
+
+// Sort keys are count<<16|pair (no count gets anywhere near 2^48)
+static int paircmp(const void *a, const void *b)
+{
+  unsigned long long x=*(const unsigned long long *)a, y=*(const unsigned long long *)b;
+  return x<y?1:(x>y?-1:0);
+}
+
+// Write the n most common pairs as a new superops.h
+int CPU::saveprofile(const char *fn, unsigned n)
+{
+  if (!pairs) return -1;
+  FILE *f=fopen(fn,"w");
+  if (!f) return -1;
+  unsigned long long *order=new unsigned long long[0x10000];
+  unsigned long long total=0;
+  for (unsigned i=0;i<0x10000;i++)
+    {
+      order[i]=(pairs[i]<<16)|i;
+      total+=pairs[i];
+    }
+  qsort(order,0x10000,sizeof(order[0]),paircmp);
+  fprintf(f,"// Superinstructions (opcode pairs) for cpuops.cpp\n"
+	  "// Made by altairrfp -P from %llu pairs. Counts are in the comments\n",total);
+  for (unsigned i=0;i<n && (order[i]>>16);i++)
+    fprintf(f,"SUPER(0x%02X,0x%02X)   // %llu\n",(unsigned)(order[i]>>8)&0xFF,(unsigned)order[i]&0xFF,order[i]>>16);
+  delete [] order;
+  fclose(f);
+  return 0;
 }
 
 // Dump state
 void CPU::dump(iobase::streamtype s, int base)
 {
 
-  iobase::printf(s,
+  io.printf(s,
 		 base==0x10?"PC=%04X (%02X)  A=%02X F=%02X B=%02X C=%02X D=%02X E=%02X H=%02X L=%02X SP=%04X\r\n":
 		 "PC=%06o (%03o)  A=%03o F=%03o B=%03o C=%03o D=%03o E=%03o H=%03o L=%03o SP=%06o\r\n",
-	  pc, ram.read(pc,0), regs[A],regs[F],regs[B],regs[C],regs[D],regs[E],
+	  pc, ram.read(pc,0), regs[A],getflags(),regs[B],regs[C],regs[D],regs[E],
 	  regs[H],regs[L],sp);
-
+  if (model==Z80)
+    io.printf(s,
+		   base==0x10?"IX=%04X IY=%04X AF'=%04X BC'=%04X DE'=%04X HL'=%04X I=%02X R=%02X IM%u\r\n":
+		   "IX=%06o IY=%06o AF'=%06o BC'=%06o DE'=%06o HL'=%06o I=%03o R=%03o IM%u\r\n",
+		   ix,iy,alt.pair(PSW),alt.pair(BC),alt.pair(DE),alt.pair(HL),ireg,getR(),im);
 }
 
-// Get a register by name
-unsigned CPU::getreg(const char *regstring)
+// Register name to id
+// The first letter is A, B, D, H, S, or P (or IX, IY, or a 
+// primed pair on the Z80)
+int CPU::regid(const char *regstring, int model)
 {
-  // first letter is A, B, D, H, S, or P
-  int c=toupper(*regstring);
-  int idx=-1;
-  unsigned v;
-  
-  switch (c)
+  if (model==Z80)
     {
-    case 'A':
-      idx=6;
-      break;
-      
-    case 'B':
-      idx=0;
-      break;
-      
-    case 'D':
-      idx=2;
-      break;
-      
-    case 'H':
-      idx=4;
-      break;
-      
-    case 'S':
-      v=sp;
-      break;
-      
-    case 'P':
-      v=pc;
-      break;
+      if (strchr(regstring,'\''))
+	{
+	  int p=regid(regstring);
+	  return p>=0 && p<=PSW?REG_ALT+p:REG_NONE;
+	}
+      if (toupper(regstring[0])=='I')
+	switch (toupper(regstring[1]))
+	  {
+	  case 'X': return REG_IX;
+	  case 'Y': return REG_IY;
+	  }
+    }
+  switch (toupper(*regstring))
+    {
+    case 'A': return PSW;
+    case 'B': return BC;
+    case 'D': return DE;
+    case 'H': return HL;
+    case 'S': return REG_SP;
+    case 'P': return REG_PC;
     }
+  return REG_NONE;
+}
 
-  if (idx!=-1) v=regs[idx]<<8+regs[idx+1];
-  return v;
-  
-   
+// Get a register (see regid)
+unsigned CPU::getreg(int id)
+{
+  switch (id)
+    {
+    case PSW: return (regs[A]<<8)+getflags();
+    case BC:
+    case DE:
+    case HL: return regs.pair(id);
+    case REG_SP: return sp;
+    case REG_PC: return pc;
+    case REG_IX: return ix;
+    case REG_IY: return iy;
+    case REG_ALT+BC:
+    case REG_ALT+DE:
+    case REG_ALT+HL:
+    case REG_ALT+PSW: return alt.pair(id-REG_ALT);
+    }
+  return 0;
 }
 
-// set a register by name
-void CPU::setreg(const char *regstring,unsigned val)
+// Set a register (see regid)
+void CPU::setreg(int id,unsigned val)
 {
-  // first letter is A, B, D, H, S, or P
-  int c=toupper(*regstring);
   val&=0xFFFF;
-  unsigned vh=val>>8, vl=val&0xFF;
-  
-  switch (c)
+  switch (id)
     {
-    case 'A':
-      regs[6]=vh;
-      regs[7]=vl;
+    case PSW:
+      lzop=LZ_NONE;
+      // fall through
+    case BC:
+    case DE:
+    case HL:
+      regs.pair(id)=val;
+      break;
+    case REG_SP:
+      sp=val;
       break;
-      
-    case 'B':
-      regs[0]=vh;
-      regs[1]=vl;
+    case REG_PC:
+      pc=val;
+      halted=0;
       break;
-      
-    case 'D':
-      regs[2]=vh;
-      regs[3]=vl;
+    case REG_IX:
+      ix=val;
       break;
-      
-    case 'H':
-      regs[4]=vh;
-      regs[5]=vl;
+    case REG_IY:
+      iy=val;
       break;
-      
-    case 'S':
-      sp=val;
-      break;
-      
-    case 'P':
-      pc=val;
+    case REG_ALT+BC:
+    case REG_ALT+DE:
+    case REG_ALT+HL:
+    case REG_ALT+PSW:
+      alt.pair(id-REG_ALT)=val;
       break;
     }
-
 }
 
@@ -27,15 +27,21 @@ Altairrfp (c) 2011 by Al Williams.
 #include <stdio.h>  // need STDERR
 #include "ram.h"
 #include "rfp.h"
+#include "scheduler.h"
+#include "acia.h"
+#include "cpumodel.h"
 
-class CPU
+class CPU : public mapped
 {
+  friend class JIT;
+  friend class AOT;
+  friend class lanes;
  protected:
   unsigned cycle;   // which subcycle are we in on multipart instructions
-  unsigned parity(unsigned v);  // compute parity
   unsigned opcode;    // current opcode
    // temporaries for instructions
   unsigned t1,t2;
+  unsigned r1,r2,op1,op2;  // the reference engine's (MVI keeps r1 between steps)
   unsigned cond;   // condition
   unsigned getM8(void);   // get M
   void setM8(unsigned v);  // set M
@@ -46,33 +52,313 @@ class CPU
   // modify pc or sp
   unsigned incpc(void)  { unsigned t=pc; pc++; pc&=0xFFFF; return t; }
   unsigned incsp(void)  { unsigned t=sp; sp++; sp&=0xFFFF; return t; }
+  // next byte at PC for exec() without the decoded cache
+  unsigned fetch(void) { return fast?ram.get<fastmem>(incpc()):ram.read(incpc()); }
   void decsp(void)  { sp--; sp&=0xFFFF; }
+  // I/O ports (shared by both engines; an unknown port reads as idle)
+  void portout(unsigned port, unsigned v);
+  unsigned portin(unsigned port, unsigned idle);
+  acia sio;  // console port
+  // Device events and interrupts
+  // deadline is all exec() and step() look at per instruction:
+  // it is the T state of the next device event, or 0 while 
+  // intcheck says there is an interrupt to look at (a request 
+  // INTE will take, or an EI waiting out its one instruction delay)
+  scheduler events;
+  unsigned long long deadline;
+  void service(void);
+  // run device events that are due without taking interrupts (for
+  // an IN in the middle of a superinstruction or recompiled block)
+  void devicesnow(void) { if (tstates>=events.next) { events.run(*this,tstates); deadline=0; } }
+  unsigned intcheck;
+  unsigned inte;   // the INTE flip flop
+  unsigned eidelay;  // EI just happened; INTE comes on after the next instruction
+  unsigned irq;    // requested RST number+1 (0 for none)
+  unsigned halted;  // sitting on a HLT
+  unsigned intmask;  // 8085 RST 5.5/6.5/7.5 masks (RIM and SIM)
+  void takeint(void);
+
+  // Table-driven engine: one handler per opcode
+  // step() collects the operand bytes into t1 first, so handlers
+  // only see complete instructions
+  typedef void (CPU::*ophandler)(void);
+  static const ophandler optable[256];
+  static const ophandler lazytable[256];  // same thing with lazy flags
+  static const unsigned char oplen[256];  // instruction length in bytes
+  static const ophandler optable85[256];  // and the same for the other models
+  static const ophandler lazytable85[256];
+  static const ophandler optablez80[256];
+  static const unsigned char oplenz80[256];
+  // 8080 and 8085 again with no front panel (see fastmem)
+  static const ophandler fasttable[256];
+  static const ophandler fastlazytable[256];
+  static const ophandler fasttable85[256];
+  static const ophandler fastlazytable85[256];
+  // the running model's tables (see setmodel)
+  const ophandler *eager, *lazy;
+  const unsigned char *lens, *cycles;
+  static constexpr unsigned lenof(unsigned op)
+  {
+    return (op&0xC7)==0x06 || (op&0xC7)==0xC6 || op==0xD3 || op==0xDB ? 2 :
+      (op&0xCF)==0x01 || (op&0xC7)==0xC2 || (op&0xC7)==0xC4 || (op&0xE7)==0x22 ||
+      (op&0xCF)==0xCD || op==0xC3 || op==0xCB ? 3 : 1;
+  }
+  // Z80: JR and DJNZ take an offset, prefixes are one byte (their
+  // handlers fetch the rest)
+  static constexpr unsigned lenofz80(unsigned op)
+  {
+    return (op&0xC7)==0x00 && op>=0x10 ? 2 :
+      op==0xCB || op==0xDD || op==0xED || op==0xFD ? 1 : lenof(op);
+  }
+  template<unsigned OP, bool LZ, class M=i8080, class P=panelmem> static constexpr ophandler handlerof(void);
+  static const unsigned char opcycles[256];  // T states
+  static const unsigned char opcycles85[256];
+  static const unsigned char opcyclesz80[256];
+  // Decoded instruction cache for exec() (one entry per address)
+  // ram.codemap says which entries are good
+  struct decoded
+  {
+    ophandler handler;
+    unsigned short operand;
+    unsigned short operand2;  // second half of a superinstruction
+    unsigned char opcode;
+    unsigned char len;
+    unsigned char cycles;
+  };
+  decoded *dcache;
+  void decode(unsigned a);
+  // Superinstructions: each hot opcode pair listed in superops.h
+  // gets one handler that does both. exec() leaves the second
+  // operand in t2
+  template<unsigned OP1, unsigned OP2, bool LZ, class P> void x_super(void);
+  struct superop
+  {
+    ophandler plain, lazy, fastplain, fastlazy;
+    unsigned char op1, op2;
+  };
+  static const superop supertable[];
+  unsigned short *superidx;  // (op1<<8)+op2 -> supertable index+1
+  // Opcode pair profile (see saveprofile)
+  unsigned long long *pairs;  // (op1<<8)+op2 -> count
+  unsigned pairop, pairnext;  // last opcode and where the next one would be
+  // Basic block translator (see jit.h)
+  JIT *jit;
+  enum { JITRUN=1000 };  // instructions per exec() with the JIT (or AOT) on
+  // Recompiled code for the image in memory (see aot.h)
+  AOT *aot;
+  int jitstale;  // JIT blocks wrote memory without telling the decoded cache
+  void countpair(unsigned a, unsigned op)
+  {
+    if (a==pairnext) pairs[(pairop<<8)+op]++;
+    pairop=op;
+    pairnext=(a+lens[op])&0xFFFF;
+  }
+  // 8 bit operand access with the register known at compile time
+  // Handlers that touch memory take the access policy P (panelmem
+  // or fastmem) and pass it down to here
+  template<unsigned R, class P=panelmem> unsigned get8(void) 
+    { return R==6?ram.get<P>(regs.pair(HL)):regs[R==7?A:R]; }
+  template<unsigned R, class P=panelmem> void set8(unsigned v) 
+    { if (R==6) ram.put<P>(regs.pair(HL),v); else regs[R==7?A:R]=v; }
+  template<unsigned OP, bool LZ, class M=i8080> void alu(unsigned op1);  // ADD..CMP on A
+  template<class P> void pushpc(void);
+  int fast;  // running on the fastmem tables
+  // Lazy flags (engine==LAZY)
+  // Flag-setting instructions just record what they did and 
+  // regs[F] is only up to date when lzop==LZ_NONE
+  enum lazyops { LZ_NONE=0, LZ_ADD, LZ_SUB, LZ_ANA, LZ_LOGIC, LZ_INR, LZ_DCR, LZ_ANA85 };
+  unsigned lzop;   // last flag-setting operation
+  unsigned lza, lzb;  // its operands (lzb is the old carry for INR/DCR)
+  unsigned lzr;   // and its result (bit 8 is the carry or borrow)
+  unsigned lazyflags(void);  // compute F from the above
+  static unsigned aluflags(unsigned kind, unsigned a, unsigned b, unsigned r);
+  void flagsnow(void) { if (lzop!=LZ_NONE) { regs[F]=lazyflags(); lzop=LZ_NONE; } }
+  unsigned getcy(void);
+  template<unsigned CC, bool LZ> unsigned testcc(void);
+  // handlers (names follow the Intel mnemonics)
+  template<unsigned D, unsigned S, class P> void x_mov(void);
+  template<unsigned R, class P> void x_mvi(void);
+  template<unsigned R, bool LZ, class P> void x_inr(void);
+  template<unsigned R, bool LZ, class P> void x_dcr(void);
+  template<unsigned OP, unsigned R, bool LZ, class P, class M> void x_alu(void);
+  template<unsigned OP, bool LZ, class M> void x_alui(void);
+  template<unsigned RP> void x_lxi(void);
+  template<unsigned RP> void x_inx(void);
+  template<unsigned RP> void x_dcx(void);
+  template<unsigned RP, bool LZ> void x_dad(void);
+  template<unsigned RP, class P> void x_ldax(void);
+  template<unsigned RP, class P> void x_stax(void);
+  template<unsigned RP, bool LZ, class P> void x_push(void);
+  template<unsigned RP, bool LZ, class P> void x_pop(void);
+  template<unsigned CC, bool LZ, class M> void x_jcc(void);
+  template<unsigned CC, bool LZ, class M, class P> void x_ccc(void);
+  template<unsigned CC, bool LZ, class M, class P> void x_rcc(void);
+  template<unsigned N, class P> void x_rst(void);
+  void x_nop(void);
+  void x_hlt(void);
+  void x_ei(void);
+  void x_di(void);
+  template<class P> void x_lhld(void);
+  template<class P> void x_shld(void);
+  template<class P> void x_lda(void);
+  template<class P> void x_sta(void);
+  template<bool LZ> void x_rlc(void);
+  template<bool LZ> void x_rrc(void);
+  template<bool LZ> void x_ral(void);
+  template<bool LZ> void x_rar(void);
+  template<bool LZ> void x_daa(void);
+  void x_cma(void);
+  template<bool LZ> void x_stc(void);
+  template<bool LZ> void x_cmc(void);
+  void x_jmp(void);
+  template<class P> void x_call(void);
+  template<class P=panelmem> void x_ret(void);
+  template<class P> void x_xthl(void);
+  void x_pchl(void);
+  void x_sphl(void);
+  void x_xchg(void);
+  void x_out(void);
+  void x_in(void);
+  // 8085
+  void x_rim(void);
+  void x_sim(void);
+  // Z80 (z80ops.cpp; flags are always eager)
+  template<unsigned OP> static constexpr ophandler z80of(void);
+  unsigned getR(void);
+  void zalu(unsigned op, unsigned v);  // op is bits 3-5 of the opcode
+  unsigned zinc(unsigned v);
+  unsigned zdec(unsigned v);
+  unsigned zadd16(unsigned a, unsigned b);
+  unsigned zcb(unsigned op, unsigned v);  // CB prefix: shift, BIT, RES, SET
+  void zindexed(unsigned op, unsigned xy);  // (IX+d) forms of the (HL) opcodes
+  template<unsigned R> void x_zinc(void);
+  template<unsigned R> void x_zdec(void);
+  template<unsigned OP, unsigned R> void x_zalu(void);
+  template<unsigned OP> void x_zalui(void);
+  template<unsigned RP> void x_zadd(void);
+  template<unsigned OP> void x_zrot(void);  // RLCA RRCA RLA RRA
+  template<unsigned CC> void x_jrcc(void);
+  template<unsigned IY> void x_index(void);  // DD and FD prefixes
+  void x_zdaa(void);
+  void x_zcpl(void);
+  void x_zscf(void);
+  void x_zccf(void);
+  void x_exaf(void);
+  void x_exx(void);
+  void x_djnz(void);
+  void x_jr(void);
+  void x_cb(void);
+  void x_ed(void);
     
  public:
- CPU(RAM& r,RFP& rp) : ram(r), rfp(rp) { upper=0; reset(); } 
+ CPU(RAM& r,RFP& rp) : ram(r), io(rp.io), rfp(rp) 
+    { upper=0; engine=TABLE; lzop=LZ_NONE; dcache=NULL; superidx=NULL; pairs=NULL;
+      jit=NULL; jitstale=0; aot=NULL; tstates=0; ix=iy=0;
+      fuse=1; dhits=dmisses=fused=0; setmodel(I8080); reset(); } 
+  ~CPU() { usejit(0); useaot(NULL); usecache(0); profile(0); }
   // reset CPU
   void reset(void);
   // Are we at the start of an instruction (1) or in the middle of one? (0)
   int isInst(void) { return cycle==0;   }
   
   // registers
-  // af, bc, de, hl
-  unsigned  regs[8];
+  // The byte registers overlay the pairs: regs[C] is the low half
+  // of regs.pair(BC), regs[F] the low half of PSW. SWAP fixes up
+  // the byte index for the host's byte order
   enum regnames  { B=0, C, D, E, H, L, A, F   };
+  enum pairnames { BC=0, DE, HL, PSW };
+  union regfile
+  {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__==__ORDER_BIG_ENDIAN__
+    enum { SWAP=0 };
+#else
+    enum { SWAP=1 };
+#endif
+    unsigned char r8[8];
+    unsigned short r16[4];
+    unsigned char &operator[](unsigned r) { return r8[r^SWAP]; }
+    unsigned short &pair(unsigned p) { return r16[p]; }
+  } regs;
   unsigned pc, sp;
+  // Z80 only
+  regfile alt;   // the other register set (BC' DE' HL' AF')
+  unsigned ix, iy;
+  unsigned ireg, rreg, im;  // I, R (see getR), and interrupt mode
+  // clock: T states since power on (every engine counts them
+  // from the model's cycle table, plus the model's extra for a 
+  // conditional jump, call, or return taken)
+  unsigned long long tstates;
   // reference to memory
    RAM &ram;
-  // step
+   // the machine's streams
+   iostreams &io;
+  // step (one machine cycle or so; for the STEP switch)
    void step(void);
-   // Do an opcode
+   // execute one complete instruction
+   void exec(void);
+   // turn the decoded instruction cache on or off (table engines only)
+   // and say if it should use superinstructions
+   void usecache(int on, int supers=1);
+   int cacheon(void) { return dcache!=NULL; }
+   unsigned long long dhits, dmisses;  // cache statistics
+   unsigned long long fused;  // instructions done as the second half of a superinstruction
+   // may exec() do more than one instruction? (no if someone
+   // wants to look at every instruction boundary)
+   int fuse;
+   // turn the JIT on or off (returns 0 if it can't run here)
+   int usejit(int on);
+   JIT *getjit(void) { return jit; }
+   // run the named recompiled personality (NULL turns it off; 
+   // returns 0 if there's no such thing or it can't run here)
+   int useaot(const char *name);
+   AOT *getaot(void) { return aot; }
+   // count which opcode follows which (exec() only)
+   void profile(int on);
+   // write the hottest pairs out in superops.h format
+   int saveprofile(const char *fn, unsigned n=32);
+   // 8080 instruction length and T states (the lanes engine needs these too)
+   static constexpr unsigned length(unsigned op) { return lenof(op); }
+   static unsigned timing(unsigned op) { return opcycles[op]; }
+   // Do an opcode (reference engine)
    void doop(unsigned opcode);
-   // set flags after instruction
-   unsigned setflags(unsigned value, unsigned savemask);
+   // which engine does step() use?
+   enum enginetype { TABLE=0, SWITCH, LAZY };
+   int engine;
+   // which CPU is this (cpumodels)? Anything but the 8080 
+   // runs on the table engine without the JIT, recompiled
+   // code, or superinstructions (returns 0 for no such model)
+   int setmodel(int m);
+   int model;
+   // F as the program would see it (safe to call from another thread)
+   unsigned getflags(void) { return lzop==LZ_NONE?regs[F]:lazyflags(); }
    // support for trace and control
    void dump(iobase::streamtype s=iobase::TRACE, int base=0x10);
-   // set or get register by name
-   void setreg(const char *regstring,unsigned val);
-   unsigned getreg(const char *regstring);
+   // set or get register by name (A, B, D, H, SP, or PC, which
+   // regid turns into a pairnames value or one of these; the Z80
+   // adds IX, IY, and the other set as AF' BC' DE' HL')
+   enum { REG_SP=4, REG_PC, REG_IX, REG_IY, REG_ALT, REG_NONE=-1 };  // REG_ALT+pairnames
+   static int regid(const char *regstring, int model=I8080);
+   void setreg(int id,unsigned val);
+   unsigned getreg(int id);
+   void setreg(const char *regstring,unsigned val) { setreg(regid(regstring,model),val); }
+   unsigned getreg(const char *regstring) { return getreg(regid(regstring,model)); }
+   // Raise the interrupt request line for RST n (the CPU takes it 
+   // when INTE allows, which also wakes it from HLT)
+   void interrupt(unsigned n) { irq=(n&7)+1; if (inte) { intcheck=1; deadline=0; } }
+   // Call who->event(tag) delay T states from now
+   void schedule(unsigned long long delay, timed *who, unsigned tag=0)
+   {
+     events.at(tstates+delay,who,tag);
+     if (events.next<deadline) deadline=events.next;
+   }
+   void unschedule(timed *who, unsigned tag=0) { events.cancel(who,tag); }
+   int intenabled(void) { return inte; }
+   int intpending(void) { return irq!=0; }
+   int ishalted(void) { return halted; }
+   // Memory-mapped I/O: a PG_DEVICE page can go to the ports, with 
+   // the low byte of the address for the port number
+   unsigned memread(unsigned a) { return portin(a&0xFF,0xFF); }
+   void memwrite(unsigned a, unsigned v) { portout(a&0xFF,v); }
    // do we conert input to uppercase for SIO?
    int upper;
 };
@@ -0,0 +1,59 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __CPUMODEL_H
+#define __CPUMODEL_H
+
+// CPU models (-M on the command line)
+// Each model is a policy the table engine is specialized on: 
+// CPU::handlerof<OP,LZ,M> picks model M's handler for opcode OP at
+// compile time and each model gets its own tables built from that
+// (see CPU::setmodel). So the 8080 tables are exactly what they 
+// were and nothing the other models need costs them anything
+enum cpumodels { I8080=0, I8085, Z80 };
+
+struct i8080
+{
+  static constexpr int ID=I8080;
+  // extra T states when a conditional jump, call, or return is taken
+  enum { JTAKEN=0, CTAKEN=6, RTAKEN=6 };
+};
+
+// The 8085 runs 8080 code with different timing and adds RIM and SIM
+// (the undocumented 8085 opcodes stay 8080 aliases)
+struct i8085
+{
+  static constexpr int ID=I8085;
+  enum { JTAKEN=3, CTAKEN=9, RTAKEN=6 };
+};
+
+// The Z80 shares the 8080 handlers where the two agree and has its
+// own (z80ops.cpp) for everything else
+struct z80
+{
+  static constexpr int ID=Z80;
+  enum { JTAKEN=0, CTAKEN=7, RTAKEN=6 };
+};
+
+#endif
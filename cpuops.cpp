@@ -0,0 +1,185 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+// Table-driven CPU engine
+// Each opcode gets its own handler, specialized at compile time
+// on the register, pair, or condition field of the opcode.
+// CPU::step() fetches the operand bytes into t1 and then calls
+// through optable. The big switch in CPU::doop is still
+// around as the reference engine (-s on the command line)
+// lazytable is the same map with flag evaluation put off until
+// something actually looks at the flags (-z on the command line)
+// The 8085 tables are here too; the Z80's are in z80ops.cpp
+// Each 8080 and 8085 table comes twice: once on the panelmem policy
+// and once on fastmem for a machine with no front panel and a full
+// 64K, where memory access is a plain array index (see ram.h)
+// The handlers themselves are in cpuops.h
+
+#include "cpuops.h"
+
+// Build F from the last lazy operation
+unsigned CPU::lazyflags(void)
+{
+  return (regs[F]&flagtables::KEEP)|aluflags(lzop,lza,lzb,lzr);
+}
+
+// Just the carry (cheaper than building all of F)
+unsigned CPU::getcy(void)
+{
+  switch (lzop)
+    {
+    case LZ_NONE: return regs[F]&flagtables::CY;
+    case LZ_ADD:
+    case LZ_SUB: return (lzr>>8)&1;
+    case LZ_INR:
+    case LZ_DCR: return lzb;
+    }
+  return 0;  // logical ops clear carry
+}
+
+#define OPS4(n,lz,m,p) handlerof<(n),lz,m,p>(), handlerof<(n)+1,lz,m,p>(), handlerof<(n)+2,lz,m,p>(), handlerof<(n)+3,lz,m,p>()
+#define OPS16(n,lz,m,p) OPS4(n,lz,m,p), OPS4((n)+4,lz,m,p), OPS4((n)+8,lz,m,p), OPS4((n)+12,lz,m,p)
+#define OPS64(n,lz,m,p) OPS16(n,lz,m,p), OPS16((n)+16,lz,m,p), OPS16((n)+32,lz,m,p), OPS16((n)+48,lz,m,p)
+#define OPS256(lz,m,p) OPS64(0x00,lz,m,p), OPS64(0x40,lz,m,p), OPS64(0x80,lz,m,p), OPS64(0xC0,lz,m,p)
+
+const CPU::ophandler CPU::optable[256]=
+  {
+    OPS256(false,i8080,panelmem)
+  };
+
+const CPU::ophandler CPU::lazytable[256]=
+  {
+    OPS256(true,i8080,panelmem)
+  };
+
+const CPU::ophandler CPU::optable85[256]=
+  {
+    OPS256(false,i8085,panelmem)
+  };
+
+const CPU::ophandler CPU::lazytable85[256]=
+  {
+    OPS256(true,i8085,panelmem)
+  };
+
+// The same four with no front panel (see CPU::setmodel)
+const CPU::ophandler CPU::fasttable[256]=
+  {
+    OPS256(false,i8080,fastmem)
+  };
+
+const CPU::ophandler CPU::fastlazytable[256]=
+  {
+    OPS256(true,i8080,fastmem)
+  };
+
+const CPU::ophandler CPU::fasttable85[256]=
+  {
+    OPS256(false,i8085,fastmem)
+  };
+
+const CPU::ophandler CPU::fastlazytable85[256]=
+  {
+    OPS256(true,i8085,fastmem)
+  };
+
+// Superinstruction: OP1 then OP2 for one dispatch, with both
+// handlers inlined here
+template<unsigned OP1, unsigned OP2, bool LZ, class P> void CPU::x_super(void)
+{
+  constexpr ophandler first=handlerof<OP1,LZ,i8080,P>(), second=handlerof<OP2,LZ,i8080,P>();
+  unsigned next=pc;
+  (this->*first)();
+  // stop if OP1 jumped or halted, if it wrote over the pair, or if
+  // somebody wants to see the instruction boundary
+  if (pc!=next || !fuse || !ram.codemap[(next-lenof(OP1))&0xFFFF]) return;
+  fused++;
+  if (OP2==0xDB) devicesnow();
+  tstates+=opcycles[OP2];
+  opcode=OP2;
+  t1=t2;
+  pc=(pc+lenof(OP2))&0xFFFF;
+  (this->*second)();
+}
+
+// The pairs come from a profile (see CPU::saveprofile)
+#define SUPER(a,b) { &CPU::x_super<a,b,false,panelmem>, &CPU::x_super<a,b,true,panelmem>, \
+      &CPU::x_super<a,b,false,fastmem>, &CPU::x_super<a,b,true,fastmem>, a, b },
+const CPU::superop CPU::supertable[]=
+  {
+#include "superops.h"
+    { NULL, NULL, NULL, NULL, 0, 0 }
+  };
+
+#define LEN4(n) lenof(n), lenof((n)+1), lenof((n)+2), lenof((n)+3)
+#define LEN16(n) LEN4(n), LEN4((n)+4), LEN4((n)+8), LEN4((n)+12)
+#define LEN64(n) LEN16(n), LEN16((n)+16), LEN16((n)+32), LEN16((n)+48)
+
+const unsigned char CPU::oplen[256]=
+  {
+    LEN64(0x00), LEN64(0x40), LEN64(0x80), LEN64(0xC0)
+  };
+
+// T states (conditional calls and returns take 6 more when taken)
+const unsigned char CPU::opcycles[256]=
+  {
+     4, 10,  7,  5,  5,  5,  7,  4,  4, 10,  7,  5,  5,  5,  7,  4,  // 00
+     4, 10,  7,  5,  5,  5,  7,  4,  4, 10,  7,  5,  5,  5,  7,  4,  // 10
+     4, 10, 16,  5,  5,  5,  7,  4,  4, 10, 16,  5,  5,  5,  7,  4,  // 20
+     4, 10, 13,  5, 10, 10, 10,  4,  4, 10, 13,  5,  5,  5,  7,  4,  // 30
+     5,  5,  5,  5,  5,  5,  7,  5,  5,  5,  5,  5,  5,  5,  7,  5,  // 40
+     5,  5,  5,  5,  5,  5,  7,  5,  5,  5,  5,  5,  5,  5,  7,  5,  // 50
+     5,  5,  5,  5,  5,  5,  7,  5,  5,  5,  5,  5,  5,  5,  7,  5,  // 60
+     7,  7,  7,  7,  7,  7,  7,  7,  5,  5,  5,  5,  5,  5,  7,  5,  // 70
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 80
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 90
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // A0
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // B0
+     5, 10, 10, 10, 11, 11,  7, 11,  5, 10, 10, 10, 11, 17,  7, 11,  // C0
+     5, 10, 10, 10, 11, 11,  7, 11,  5, 10, 10, 10, 11, 17,  7, 11,  // D0
+     5, 10, 10, 18, 11, 11,  7, 11,  5,  5, 10,  4, 11, 17,  7, 11,  // E0
+     5, 10, 10,  4, 11, 11,  7, 11,  5,  5, 10,  4, 11, 17,  7, 11  // F0
+  };
+
+// 8085 T states (conditional jumps take 3 more when taken, calls 9,
+// and returns 6)
+const unsigned char CPU::opcycles85[256]=
+  {
+     4, 10,  7,  6,  4,  4,  7,  4,  4, 10,  7,  6,  4,  4,  7,  4,  // 00
+     4, 10,  7,  6,  4,  4,  7,  4,  4, 10,  7,  6,  4,  4,  7,  4,  // 10
+     4, 10, 16,  6,  4,  4,  7,  4,  4, 10, 16,  6,  4,  4,  7,  4,  // 20
+     4, 10, 13,  6, 10, 10, 10,  4,  4, 10, 13,  6,  4,  4,  7,  4,  // 30
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 40
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 50
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 60
+     7,  7,  7,  7,  7,  7,  5,  7,  4,  4,  4,  4,  4,  4,  7,  4,  // 70
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 80
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 90
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // A0
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // B0
+     6, 10,  7, 10,  9, 12,  7, 12,  6, 10,  7, 10,  9, 18,  7, 12,  // C0
+     6, 10,  7, 10,  9, 12,  7, 12,  6, 10,  7, 10,  9, 18,  7, 12,  // D0
+     6, 10,  7, 16,  9, 12,  7, 12,  6,  6,  7,  4,  9, 18,  7, 12,  // E0
+     6, 10,  7,  4,  9, 12,  7, 12,  6,  6,  7,  4,  9, 18,  7, 12   // F0
+  };
@@ -0,0 +1,514 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __CPUOPS_H
+#define __CPUOPS_H
+// Opcode handlers for the table engine (see cpuops.cpp)
+// These live in a header so anything that wants a handler
+// inlined (the tables, superinstructions, recompiled code)
+// can see the whole thing
+
+#include "cpu.h"
+#include "flags.h"
+
+// Flags (less the KEEP bits) for a flag-setting operation
+// The eager handlers call this with a constant kind so it folds away
+inline unsigned CPU::aluflags(unsigned kind, unsigned a, unsigned b, unsigned r)
+{
+  switch (kind)
+    {
+    case LZ_ADD: return ftab.szpc[r]|ftab.acadd[flagtables::acindex(a,b,r)];
+    case LZ_SUB: return ftab.szpc[r]|ftab.acsub[flagtables::acindex(a,b,r)];
+    case LZ_ANA: return ftab.szp[r]|(((a|b)&8)<<1);  // AC from bit 3 of either operand
+    case LZ_ANA85: return ftab.szp[r]|flagtables::AC;  // the 8085 always sets AC
+    case LZ_LOGIC: return ftab.szp[r];
+    case LZ_INR: return ftab.inr[r]|b;  // b is the untouched carry
+    case LZ_DCR: return ftab.dcr[r]|b;
+    }
+  return 0;
+}
+
+// Test a condition (NZ, Z, NC, C, PO, PE, P, M)
+// Lazily we can look at the saved result directly
+template<unsigned CC, bool LZ> unsigned CPU::testcc(void)
+{
+  if (!LZ || lzop==LZ_NONE) return getcond(CC);
+  switch (CC)
+    {
+    case 0: return (lzr&0xFF)!=0;
+    case 1: return (lzr&0xFF)==0;
+    case 2: return !getcy();
+    case 3: return getcy();
+    case 4: return !(ftab.szp[lzr&0xFF]&flagtables::P);
+    case 5: return (ftab.szp[lzr&0xFF]&flagtables::P)!=0;
+    case 6: return !(lzr&0x80);
+    case 7: return (lzr&0x80)!=0;
+    }
+  return 0;
+}
+
+// ALU operations on A (OP is bits 3-5 of the opcode) for model M
+template<unsigned OP, bool LZ, class M> void CPU::alu(unsigned op1)
+{
+  const unsigned kind=OP<2?LZ_ADD:OP==4?(M::ID==I8085?LZ_ANA85:LZ_ANA):(OP==5||OP==6)?LZ_LOGIC:LZ_SUB;
+  unsigned a=regs[A];
+  unsigned cy=0;  // carry (or borrow) in for ADC and SBB
+  unsigned r=0;
+  if (OP==1||OP==3) cy=LZ?getcy():regs[F]&flagtables::CY;
+  switch (OP)
+    {
+    case 0:  // ADD
+    case 1:  // ADC
+      r=a+op1+cy;
+      break;
+    case 2:  // SUB
+    case 3:  // SBB
+    case 7:  // CMP
+      r=(a-op1-cy)&0x1FF;   // bit 8 is the borrow
+      break;
+    case 4:  // ANA
+      r=a&op1;
+      break;
+    case 5:  // XRA
+      r=a^op1;
+      break;
+    case 6:  // ORA
+      r=a|op1;
+      break;
+    }
+  if (OP!=7) regs[A]=r&0xFF;
+  if (LZ)
+    {
+      lzop=kind;
+      lza=a;
+      lzb=op1;
+      lzr=r;
+    }
+  else 
+    regs[F]=(regs[F]&flagtables::KEEP)|aluflags(kind,a,op1,r);
+}
+
+// push PC (CALL and RST)
+template<class P> inline void CPU::pushpc(void)
+{
+  decsp(); 
+  ram.put<P>(sp,pc>>8); 
+  decsp(); 
+  ram.put<P>(sp,pc&0xFF); 
+}
+
+// Handlers
+
+template<unsigned D, unsigned S, class P> void CPU::x_mov(void)
+{
+  set8<D,P>(get8<S,P>());
+}
+
+template<unsigned R, class P> void CPU::x_mvi(void)
+{
+  set8<R,P>(t1);
+}
+
+template<unsigned R, bool LZ, class P> void CPU::x_inr(void)
+{
+  unsigned r=(get8<R,P>()+1)&0xFF;
+  if (LZ)
+    {
+      lzb=getcy();
+      lzop=LZ_INR;
+      lzr=r;
+    }
+  else
+    regs[F]=(regs[F]&(flagtables::KEEP|flagtables::CY))|ftab.inr[r];
+  set8<R,P>(r);
+}
+
+template<unsigned R, bool LZ, class P> void CPU::x_dcr(void)
+{
+  unsigned r=(get8<R,P>()-1)&0xFF;
+  if (LZ)
+    {
+      lzb=getcy();
+      lzop=LZ_DCR;
+      lzr=r;
+    }
+  else
+    regs[F]=(regs[F]&(flagtables::KEEP|flagtables::CY))|ftab.dcr[r];
+  set8<R,P>(r);
+}
+
+template<unsigned OP, unsigned R, bool LZ, class P, class M> void CPU::x_alu(void)
+{
+  alu<OP,LZ,M>(get8<R,P>());
+}
+
+template<unsigned OP, bool LZ, class M> void CPU::x_alui(void)
+{
+  alu<OP,LZ,M>(t1);
+}
+
+// register pairs are BC, DE, HL, SP (or PSW for push/pop)
+template<unsigned RP> void CPU::x_lxi(void)
+{
+  if (RP==3) sp=t1;
+  else regs.pair(RP)=t1;
+}
+
+template<unsigned RP> void CPU::x_inx(void)
+{
+  if (RP==3) 
+    {
+      sp++;
+      sp&=0xFFFF;
+      return;
+    }
+  regs.pair(RP)++;
+}
+
+template<unsigned RP> void CPU::x_dcx(void)
+{
+  if (RP==3) 
+    {
+      sp--;
+      sp&=0xFFFF;
+      return;
+    }
+  regs.pair(RP)--;
+}
+
+template<unsigned RP, bool LZ> void CPU::x_dad(void)
+{
+  if (LZ) flagsnow();
+  t1=regs.pair(HL)+(RP==3?sp:regs.pair(RP));
+  regs.pair(HL)=t1;
+  regs[F]&=0xFE;
+  if (t1>0xFFFF) regs[F]|=1;
+}
+
+template<unsigned RP, class P> void CPU::x_ldax(void)
+{
+  regs[A]=ram.get<P>(regs.pair(RP));
+}
+
+template<unsigned RP, class P> void CPU::x_stax(void)
+{
+  ram.put<P>(regs.pair(RP),regs[A]);
+}
+
+template<unsigned RP, bool LZ, class P> void CPU::x_push(void)
+{
+  if (LZ && RP==3) flagsnow();  // PUSH PSW
+  decsp();
+  ram.put<P>(sp,regs[RP*2]);
+  decsp();
+  ram.put<P>(sp,regs[RP*2+1]); 
+}
+
+template<unsigned RP, bool LZ, class P> void CPU::x_pop(void)
+{
+  if (LZ && RP==3) lzop=LZ_NONE;  // POP PSW
+  regs[RP*2+1]=ram.get<P>(incsp());
+  regs[RP*2]=ram.get<P>(incsp());  
+}
+
+// The model says how much longer these take when they go
+template<unsigned CC, bool LZ, class M> void CPU::x_jcc(void)
+{
+  if (testcc<CC,LZ>()) 
+    {
+      tstates+=M::JTAKEN;
+      pc=t1;
+    }
+}
+
+template<unsigned CC, bool LZ, class M, class P> void CPU::x_ccc(void)
+{
+  if (testcc<CC,LZ>()) 
+    {
+      tstates+=M::CTAKEN;
+      pushpc<P>();
+      pc=t1;
+    }
+}
+
+template<unsigned CC, bool LZ, class M, class P> void CPU::x_rcc(void)
+{
+  if (testcc<CC,LZ>()) 
+    {
+      tstates+=M::RTAKEN;
+      x_ret<P>();
+    }
+}
+
+template<unsigned N, class P> void CPU::x_rst(void)
+{
+  pushpc<P>();
+  pc=N*8;
+}
+
+inline void CPU::x_nop(void)
+{
+}
+
+inline void CPU::x_hlt(void)
+{
+  pc=(pc-1)&0xFFFF;
+  halted=1;
+}
+
+inline void CPU::x_ei(void)
+{
+  eidelay=intcheck=1;
+  deadline=0;
+}
+
+inline void CPU::x_di(void)
+{
+  inte=eidelay=intcheck=0;
+}
+
+template<class P> void CPU::x_lhld(void)
+{
+  regs[L]=ram.get<P>(t1); 
+  regs[H]=ram.get<P>(t1+1);
+}
+
+template<class P> void CPU::x_shld(void)
+{
+  ram.put<P>(t1,regs[L]); 
+  ram.put<P>(t1+1,regs[H]);
+}
+
+template<class P> void CPU::x_lda(void)
+{
+  regs[A]=ram.get<P>(t1);
+}
+
+template<class P> void CPU::x_sta(void)
+{
+  ram.put<P>(t1,regs[A]);
+}
+
+template<bool LZ> void CPU::x_rlc(void)
+{
+  if (LZ) flagsnow();
+  regs[F]&=0xFE;
+  if (regs[A]&0x80) regs[F]|=1;
+  regs[A]=((regs[A]<<1)&0xFE)|(regs[F]&1);
+}
+
+template<bool LZ> void CPU::x_rrc(void)
+{
+  if (LZ) flagsnow();
+  regs[F]&=0xFE;
+  if (regs[A]&1) regs[F]|=1;
+  regs[A]=((regs[A]>>1)&0x7F)|((regs[F]&1)?0x80:0);
+}
+
+template<bool LZ> void CPU::x_ral(void)
+{
+  if (LZ) flagsnow();
+  unsigned a=(regs[A]<<1)|(regs[F]&1);
+  regs[F]=(regs[F]&0xFE)|(a>>8);
+  regs[A]=a;
+}
+
+template<bool LZ> void CPU::x_rar(void)
+{
+  if (LZ) flagsnow();
+  unsigned a=regs[A]|((regs[F]&1)<<8);
+  regs[F]=(regs[F]&0xFE)|(a&1);
+  regs[A]=a>>1;
+}
+
+template<bool LZ> void CPU::x_daa(void)
+{
+  if (LZ) flagsnow();
+  unsigned r=ftab.daa[regs[A]|((regs[F]&flagtables::CY)<<8)|((regs[F]&flagtables::AC)<<5)];
+  regs[A]=r&0xFF;
+  regs[F]=(regs[F]&flagtables::KEEP)|(r>>8);
+}
+
+inline void CPU::x_cma(void)
+{
+  regs[A]=(~regs[A])&0xFF;
+}
+
+template<bool LZ> void CPU::x_stc(void)
+{
+  if (LZ) flagsnow();
+  regs[F]|=1;
+}
+
+template<bool LZ> void CPU::x_cmc(void)
+{
+  if (LZ) flagsnow();
+  regs[F]^=1;
+}
+
+inline void CPU::x_jmp(void)
+{
+  pc=t1;
+}
+
+template<class P> void CPU::x_call(void)
+{
+  pushpc<P>();
+  pc=t1;
+}
+
+template<class P> void CPU::x_ret(void)
+{
+  pc=ram.get<P>(incsp());
+  pc+=ram.get<P>(incsp())<<8;
+  pc&=0xFFFF;
+}
+
+template<class P> void CPU::x_xthl(void)
+{
+  unsigned h=regs[H], l=regs[L];
+  regs[L]=ram.get<P>(sp);
+  regs[H]=ram.get<P>((sp+1)&0xFFFF);
+  ram.put<P>(sp,l);
+  ram.put<P>((sp+1)&0xFFFF,h);
+}
+
+inline void CPU::x_pchl(void)
+{
+  pc=regs.pair(HL);
+}
+
+inline void CPU::x_sphl(void)
+{
+  sp=regs.pair(HL);
+}
+
+inline void CPU::x_xchg(void)
+{
+  unsigned hl=regs.pair(HL);
+  regs.pair(HL)=regs.pair(DE);
+  regs.pair(DE)=hl;
+}
+
+inline void CPU::x_out(void)
+{
+  portout(t1,regs[A]);
+}
+
+inline void CPU::x_in(void)
+{
+  regs[A]=portin(t1,regs[A]);
+}
+
+// 8085 interrupt masks
+// Nothing on the Altair bus drives RST 5.5, 6.5, or 7.5 (or SID),
+// so these just keep the masks for the program to read back
+inline void CPU::x_rim(void)
+{
+  regs[A]=(intmask&7)|(inte?8:0);
+}
+
+inline void CPU::x_sim(void)
+{
+  if (regs[A]&8) intmask=regs[A]&7;
+}
+
+
+// Opcode maps
+// Which handler runs opcode OP on model M with memory policy P?
+// Worked out at compile time so the tables and the superinstructions
+// (cpuops.cpp) can't disagree. The Z80 map (z80of) starts from this 
+// one too
+template<unsigned OP, bool LZ, class M, class P> constexpr CPU::ophandler CPU::handlerof(void)
+{
+  return
+    M::ID==I8085 && OP==0x20 ? &CPU::x_rim :
+    M::ID==I8085 && OP==0x30 ? &CPU::x_sim :
+    OP==0x76 ? &CPU::x_hlt :
+    (OP&0xC0)==0x40 ? &CPU::x_mov<(OP>>3)&7,OP&7,P> :
+    (OP&0xC0)==0x80 ? &CPU::x_alu<(OP>>3)&7,OP&7,LZ,P,M> :
+    (OP&0xC7)==0x04 ? &CPU::x_inr<(OP>>3)&7,LZ,P> :
+    (OP&0xC7)==0x05 ? &CPU::x_dcr<(OP>>3)&7,LZ,P> :
+    (OP&0xC7)==0x06 ? &CPU::x_mvi<(OP>>3)&7,P> :
+    (OP&0xCF)==0x01 ? &CPU::x_lxi<(OP>>4)&3> :
+    (OP&0xCF)==0x03 ? &CPU::x_inx<(OP>>4)&3> :
+    (OP&0xCF)==0x09 ? &CPU::x_dad<(OP>>4)&3,LZ> :
+    (OP&0xCF)==0x0B ? &CPU::x_dcx<(OP>>4)&3> :
+    (OP&0xEF)==0x02 ? &CPU::x_stax<(OP>>4)&1,P> :
+    (OP&0xEF)==0x0A ? &CPU::x_ldax<(OP>>4)&1,P> :
+    OP==0x22 ? &CPU::x_shld<P> :
+    OP==0x2A ? &CPU::x_lhld<P> :
+    OP==0x32 ? &CPU::x_sta<P> :
+    OP==0x3A ? &CPU::x_lda<P> :
+    OP==0x07 ? &CPU::x_rlc<LZ> :
+    OP==0x0F ? &CPU::x_rrc<LZ> :
+    OP==0x17 ? &CPU::x_ral<LZ> :
+    OP==0x1F ? &CPU::x_rar<LZ> :
+    OP==0x27 ? &CPU::x_daa<LZ> :
+    OP==0x2F ? &CPU::x_cma :
+    OP==0x37 ? &CPU::x_stc<LZ> :
+    OP==0x3F ? &CPU::x_cmc<LZ> :
+    (OP&0xC0)==0x00 ? &CPU::x_nop :   // 08, 10, 18...
+    (OP&0xC7)==0xC0 ? &CPU::x_rcc<(OP>>3)&7,LZ,M,P> :
+    (OP&0xC7)==0xC2 ? &CPU::x_jcc<(OP>>3)&7,LZ,M> :
+    (OP&0xC7)==0xC4 ? &CPU::x_ccc<(OP>>3)&7,LZ,M,P> :
+    (OP&0xC7)==0xC6 ? &CPU::x_alui<(OP>>3)&7,LZ,M> :
+    (OP&0xC7)==0xC7 ? &CPU::x_rst<(OP>>3)&7,P> :
+    (OP&0xCF)==0xC1 ? &CPU::x_pop<(OP>>4)&3,LZ,P> :
+    (OP&0xCF)==0xC5 ? &CPU::x_push<(OP>>4)&3,LZ,P> :
+    OP==0xC9 || OP==0xD9 ? &CPU::x_ret<P> :
+    (OP&0xCF)==0xCD ? &CPU::x_call<P> :    // and DD ED FD
+    OP==0xC3 || OP==0xCB ? &CPU::x_jmp :
+    OP==0xD3 ? &CPU::x_out :
+    OP==0xDB ? &CPU::x_in :
+    OP==0xE3 ? &CPU::x_xthl<P> :
+    OP==0xE9 ? &CPU::x_pchl :
+    OP==0xEB ? &CPU::x_xchg :
+    OP==0xF9 ? &CPU::x_sphl :
+    OP==0xF3 ? &CPU::x_di :
+    &CPU::x_ei;
+}
+
+// Recompiled code (see aot.h) runs the handlers through these
+template<unsigned OP> inline void AOT::op(CPU &c, unsigned next, unsigned t1)
+{
+  constexpr CPU::ophandler h=CPU::handlerof<OP,false>();
+  c.pc=next;
+  c.t1=t1;
+  if (OP==0xDB) c.devicesnow();
+  c.tstates+=CPU::opcycles[OP];
+  (c.*h)();
+}
+
+inline unsigned AOT::imm8(CPU &c, unsigned a)
+{
+  return c.ram.read(a,0);
+}
+
+inline unsigned AOT::imm16(CPU &c, unsigned a)
+{
+  return c.ram.read(a,0)+(c.ram.read((a+1)&0xFFFF,0)<<8);
+}
+
+#endif
@@ -0,0 +1,95 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __FLAGS_H
+#define __FLAGS_H
+
+// Precomputed flag tables for the 8080
+// Everything is built at compile time (see the constructor)
+// so there is no startup cost and no static init order to worry about
+
+struct flagtables
+{
+  enum flagbits { CY=0x01, P=0x04, AC=0x10, Z=0x40, S=0x80, 
+		  KEEP=0x2A  };  // KEEP: bits the ALU never touches
+  unsigned char szp[256];     // S, Z, and P for a byte
+  unsigned char szpc[512];    // same plus CY for a 9 bit result
+  unsigned char inr[256];     // S, Z, P, and AC after INR (by result)
+  unsigned char dcr[256];     // S, Z, P, and AC after DCR (by result)
+  unsigned char acadd[8];     // AC for add (see acindex)
+  unsigned char acsub[8];     // AC for subtract (see acindex)
+  unsigned short daa[1024];   // A (low byte) and flags (high byte) by A+CY*256+AC*512
+  // half carry only depends on bit 3 of both operands and the result
+  static constexpr unsigned acindex(unsigned a, unsigned b, unsigned r) 
+  { return ((a&8)>>1)|((b&8)>>2)|((r&8)>>3); }
+  constexpr flagtables();
+};
+
+constexpr flagtables::flagtables() : szp(), szpc(), inr(), dcr(), acadd(), acsub(), daa()
+{
+  for (unsigned v=0;v<256;v++)
+    {
+      unsigned f=0;
+      unsigned bit=0;
+      for (unsigned i=0;i<8;i++) bit^=(v>>i)&1;
+      if (v&0x80) f|=S;
+      if (v==0) f|=Z;
+      if (!bit) f|=P;   // even parity
+      szp[v]=f;
+      szpc[v]=f;
+      szpc[v+256]=f|CY;
+      inr[v]=f|((v&0xF)==0?AC:0);
+      dcr[v]=f|((v&0xF)!=0xF?AC:0);
+    }
+  // The 8080 subtracts by adding the complement, so AC is the carry
+  // out of bit 3 of a+~b, not a borrow
+  for (unsigned i=0;i<8;i++)
+    {
+      unsigned a=(i>>2)&1, b=(i>>1)&1, r=i&1;
+      unsigned c3=a^b^r;  // carry into bit 3
+      acadd[i]=(a&b)|(a&c3)|(b&c3)?AC:0;
+      b^=1;
+      c3=a^b^r;
+      acsub[i]=(a&b)|(a&c3)|(b&c3)?AC:0;
+    }
+  for (unsigned i=0;i<1024;i++)
+    {
+      unsigned a=i&0xFF, cy=(i>>8)&1, ac=(i>>9)&1;
+      unsigned lsb=a&0xF, msb=a>>4;
+      unsigned corr=0;
+      if (ac || lsb>9) corr+=0x06;
+      if (cy || msb>9 || (msb>=9 && lsb>9)) 
+	{
+	  corr+=0x60;
+	  cy=1;
+	}
+      unsigned r=(a+corr)&0xFF;
+      unsigned f=szp[r]|(cy?CY:0)|acadd[acindex(a,corr,r)];
+      daa[i]=(f<<8)|r;
+    }
+}
+
+extern const flagtables ftab;
+
+#endif
@@ -24,6 +24,7 @@ Altairrfp (c) 2011 by Al Williams.
 ***********************************************************************/
 #include "iobase.h"
 #include <stdlib.h>
+#include <string.h>
 #include <stdarg.h>
 #if !defined(NOTELNET)
 #include <pthread.h>
@@ -104,25 +105,25 @@ extern "C"
 }
 #endif
 
-int iobase::init=0;
-
-// There are 5 well-known stream names and you usually
-// access via the static calls
-// so that whatever is redirected gets the right call
-iobase *iobase::streams[5]=
-  { NULL, NULL, NULL, NULL, NULL };
+iostreams::iostreams()
+{
+  for (int i=0;i<sizeof(streams)/sizeof(streams[0]);i++) streams[i]=NULL;
+}
 
+// Get rid of all our streams (deleting one takes it out of
+// every slot it was dup'ed to)
+iostreams::~iostreams()
+{
+  for (int i=0;i<sizeof(streams)/sizeof(streams[0]);i++)
+    if (streams[i] && streams[i]->owner==this) delete streams[i];
+    else streams[i]=NULL;
+}
 
-iobase::iobase(streamtype type)
+iobase::iobase(iostreams &set, streamtype type)
 {
    killchar=-1; 
-   streams[type]=this;
-   if (!init)
-     {
-       init=1;
-       atexit(deleteall);
-     }
-   
+   owner=&set;
+   set.streams[type]=this;
 }
 
 // Generic iobase doesn't really know how
@@ -152,29 +153,13 @@ void iobase::puts(const char *s)
 // on destroy take yourself out of the stream list
 iobase::~iobase()
 {
-  for (int i=0;i<sizeof(streams)/sizeof(streams[0]);i++)
-    if (streams[i]==this) streams[i]=NULL;
-}
-
-#if !defined(NOTELNET)
-extern pthread_t controlthread;
-#endif
-
-// Get rid of all streams
-void iobase::deleteall(void)
-{
-  int i;
-    for (i=0;i<sizeof(streams)/sizeof(streams[0]);i++)
-    if (streams[i]) 
-      {
-	delete streams[i];
-      }
-  
+  for (int i=0;i<sizeof(owner->streams)/sizeof(owner->streams[0]);i++)
+    if (owner->streams[i]==this) owner->streams[i]=NULL;
 }
 
 // This is a subclass of iobase -- it handles the normal
 // console I/O
-console::console(iobase::streamtype st, FILE *outstream) : iobase(st)
+console::console(iostreams &set, iobase::streamtype st, FILE *outstream) : iobase(set,st)
 {
   init_keyboard();  // single key mode
   atexit(close_keyboard);  // set up so exit restores keyboard
@@ -187,6 +172,11 @@ console::~console()
   close_keyboard();
 }
 
+void console::release(void)
+{
+  close_keyboard();
+}
+
 
 // get a character from keyboard
 int console::getchar(void)
@@ -222,3 +212,74 @@ void console::puts(const char *s)
 }
 
   
+// In-memory console
+memconsole::memconsole(iostreams &set, iobase::streamtype st) : iobase(set,st)
+{
+  in=(char *)malloc(insize=256);
+  inhead=inlen=0;
+  out=(char *)malloc(outsize=4096);
+  outlen=0;
+  *out='\0';
+  starved=0;
+}
+
+memconsole::~memconsole()
+{
+  free(in);
+  free(out);
+}
+
+void memconsole::type(const char *s, unsigned len)
+{
+  // slide what is left to the front before growing
+  if (inhead)
+    {
+      memmove(in,in+inhead,inlen-inhead);
+      inlen-=inhead;
+      inhead=0;
+    }
+  if (inlen+len>insize)
+    {
+      while (inlen+len>insize) insize*=2;
+      in=(char *)realloc(in,insize);
+    }
+  memcpy(in+inlen,s,len);
+  inlen+=len;
+}
+
+int memconsole::getchar(void)
+{
+  if (inhead==inlen) 
+    {
+      starved++;
+      return -1;
+    }
+  return (unsigned char)in[inhead++];
+}
+
+int memconsole::ischar(void)
+{
+  if (inhead<inlen) return 1;
+  starved++;
+  return 0;
+}
+
+void memconsole::putchar(int c)
+{
+  if (outlen+1>=outsize)
+    {
+      if (outsize>=OUTMAX) return;
+      out=(char *)realloc(out,outsize*=2);
+    }
+  out[outlen++]=c;
+  out[outlen]='\0';
+}
+
+unsigned memconsole::take(char *buf, unsigned max)
+{
+  if (max>outlen) max=outlen;
+  memcpy(buf,out,max);
+  memmove(out,out+max,outlen-max+1);
+  outlen-=max;
+  return max;
+}
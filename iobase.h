@@ -30,15 +30,14 @@ Altairrfp (c) 2011 by Al Williams.
 #undef putchar
 #undef getchar
 
+class iostreams;
+
 // Base class for all I/O (console, file, telnet, etc.)
 class iobase
 {
+  friend class iostreams;
  protected:
-  // most users will get to these via static methods
-  // selecting one of the streams
-  static iobase *streams[];
-  static int init;
-  static void deleteall(void);
+  iostreams *owner;   // the set we are in
  public:
   // stream types
  enum streamtype 
@@ -50,48 +49,68 @@ class iobase
     DEBUG
   };
 
+  // This character exits the simulator if you send it followed
+  // by any other character. If you send it twice, the simulator
+  // receives one copy
+  int killchar;
+
+  // Is this device ready?
+  virtual int ready(void) { return 1;  }
+  
+  // core functions    
+  virtual int getchar(void);
+  virtual int ischar(void);
+  virtual void putchar(int c);
+  virtual void puts(const char *s);
+
+  // the new stream takes over slot type in set
+  iobase(iostreams &set, streamtype type);
+  virtual ~iobase();
+};
+
+// The well-known streams for one machine (see machine.h)
+// Everybody reaches a stream by name through their machine's set,
+// so whatever is redirected gets the right call. The set deletes
+// the streams in it when it goes
+class iostreams
+{
+  friend class iobase;
+ protected:
+  iobase *streams[5];
+ public:
+  iostreams();
+  ~iostreams();
+
  // Get a char
-  static int getchar(streamtype st) 
+  int getchar(iobase::streamtype st) 
   {
     if (!streams[st]) return -1;
     return streams[st]->getchar();
   }
 
   // Is there a char waiting?
-  static int ischar(streamtype st)
+  int ischar(iobase::streamtype st)
   {
     if (!streams[st]) return 0;
     return streams[st]->ischar();
   }
 
   // put a character out
-  static void putchar(streamtype st,int c)
+  void putchar(iobase::streamtype st,int c)
   {
     if (!streams[st]) return;
     streams[st]->putchar(c);
   }
 
-  // This character exits the simulator if you send it followed
-  // by any other character. If you send it twice, the simulator
-  // receives one copy
-  int killchar;
-
-  // Is this device ready?
-  virtual int ready(void) { return 1;  }
-  // static version
-  static int ready(streamtype st)
+  // Is this stream ready?
+  int ready(iobase::streamtype st)
   {
     if (!streams[st]) return 1;
     return streams[st]->ready();
   }
-  
-  // core functions    
-  virtual int getchar(void);
-  virtual int ischar(void);
-  virtual void putchar(int c);
-  
+
   // This printf works for any subclass
-  static void printf(streamtype st, const char *fmt,...)
+  void printf(iobase::streamtype st, const char *fmt,...)
   {
     if (!streams[st]) return;
     char buffer[1024];
@@ -103,23 +122,22 @@ class iobase
   }
 
   // put a string
-  static void puts(streamtype st, const char *s)
+  void puts(iobase::streamtype st, const char *s)
   {
     if (!streams[st]) return;
     streams[st]->puts(s);
   }
 
-  virtual void puts(const char *s);
-
-  iobase(streamtype type);
-  virtual ~iobase();
-
   // duplicate one slot to another
-  static void dup(streamtype dst, streamtype src)
+  void dup(iobase::streamtype dst, iobase::streamtype src)
   {
     streams[dst]=streams[src];
   }
-  
+
+  // what is in a slot (NULL for nothing)
+  iobase *get(iobase::streamtype st) { return streams[st]; }
+  // put a stream the set doesn't own in a slot (or NULL to empty it)
+  void set(iobase::streamtype st, iobase *io) { streams[st]=io; }
 };
 
 
@@ -131,8 +149,10 @@ class console : public iobase
   FILE *out;
  public:
   // note: could have file handle output
-  console(iobase::streamtype st,FILE *outstream=stderr) ;
+  console(iostreams &set, iobase::streamtype st,FILE *outstream=stderr) ;
   virtual ~console();
+  // put the keyboard back the way it was (output still works)
+  void release(void);
   // custom functions
   int getchar(void);
   int ischar(void);
@@ -140,4 +160,35 @@ class console : public iobase
   void puts(const char *s);
 };
 
+// Console in memory (batch jobs and libaltair): the program reads
+// whatever has been typed and what it writes piles up until
+// somebody takes it (up to OUTMAX; past that it is dropped)
+class memconsole : public iobase
+{
+ protected:
+  char *in, *out;
+  unsigned inhead, inlen, insize;
+  unsigned outlen, outsize;
+ public:
+  enum { OUTMAX=1<<20 };
+  memconsole(iostreams &set, iobase::streamtype st=iobase::CONSOLE);
+  virtual ~memconsole();
+  // queue input
+  void type(const char *s, unsigned len);
+  // input typed that nobody has read yet
+  unsigned pending(void) { return inlen-inhead; }
+  // output so far (with a '\0' after it)
+  const char *output(void) { return out; }
+  unsigned outcount(void) { return outlen; }
+  // move up to max bytes of output to buf (returns how many)
+  unsigned take(char *buf, unsigned max);
+  // throw the output away
+  void discard(void) { outlen=0; *out='\0'; }
+  // how many times the program looked for input and found none
+  unsigned long long starved;
+  int getchar(void);
+  int ischar(void);
+  void putchar(int c);
+};
+
 #endif
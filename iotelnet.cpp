@@ -42,10 +42,10 @@ Altairrfp (c) 2011 by Al Williams.
 
 
 // Construct telnet on given stream and port #
-iotelnet::iotelnet(streamtype st,int portno) : iobase(st)
+iotelnet::iotelnet(iostreams &set, streamtype st,int portno) : iobase(set,st)
 {
 #if defined(NOTELNET)
-  iobase::printf(iobase::ERROROUT,"Telnet not supported\n");
+  owner->printf(iobase::ERROROUT,"Telnet not supported\n");
   exit(1);
 #else
   killchar=cbuffer=-1;
@@ -72,7 +72,7 @@ void *iotelnet::connect(void *_this)
   obj->sockfd = socket(AF_INET, SOCK_STREAM, 0);
   if (obj->sockfd < 0) 
     {
-      iobase::printf(iobase::DEBUG,"socket failed %d\n",perror);
+      obj->owner->printf(iobase::DEBUG,"socket failed %d\n",perror);
       return NULL;
     }
   
@@ -83,7 +83,7 @@ void *iotelnet::connect(void *_this)
   if (bind(obj->sockfd, (struct sockaddr *) &serv_addr,
 	   sizeof(serv_addr)) < 0) 
     {
-      iobase::printf(iobase::DEBUG,"bind failed %d\n",errno);
+      obj->owner->printf(iobase::DEBUG,"bind failed %d\n",errno);
       return NULL;
     }
 
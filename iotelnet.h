@@ -44,7 +44,7 @@ class iotelnet : public iobase
   int skipct;
   int getch(void);
  public:
-  iotelnet(streamtype st, int portno);
+  iotelnet(iostreams &set, streamtype st, int portno);
   virtual ~iotelnet();
   void putchar(int c);
   int getchar(void);
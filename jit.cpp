@@ -0,0 +1,882 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+// Basic block translator for x86-64 hosts
+//
+// Host registers inside a block:
+//  B C D E H L = r8d-r13d  A = ebp  F = esi  SP = edi
+//  r15 = RAM  r14 = RAM::jitmap  rbx = JIT::state
+//  eax, ecx, edx are scratch
+// Each 8080 register lives in the low byte of its host register
+// and the upper bits stay zero, so 8 bit ALU operations can work
+// on them directly. The 8080 F register has the same layout as
+// the x86 flags LAHF loads into AH, so flags come straight from
+// the host ALU with a little fixing up (AC is inverted for
+// subtraction, and AND sets it from bit 3 of the operands)
+
+#include "jit.h"
+#include "cpu.h"
+#include "flags.h"
+#include <string.h>
+#if defined(HAVE_JIT)
+#include <sys/mman.h>
+#endif
+
+// marks a start address the JIT can't do (IN, OUT, HLT, self-modifying)
+unsigned char JIT::never;
+#define NOBLOCK (&never)
+
+JIT::JIT(CPU &c) : cpu(c)
+{
+  blocks=kills=flushes=instrs=varimms=0;
+  buf=NULL;
+  block=NULL;
+  blocklen=NULL;
+  hot=NULL;
+#if defined(HAVE_JIT)
+  void *m=mmap(NULL,BUFSIZE,PROT_READ|PROT_WRITE|PROT_EXEC,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+  if (m==MAP_FAILED) return;
+  buf=p=(unsigned char *)m;
+  block=new unsigned char *[0x10000];
+  blocklen=new unsigned char[0x10000];
+  memset(block,0,0x10000*sizeof(unsigned char *));
+  hot=new unsigned char[0x10000];
+  memset(hot,0,0x10000);
+  st.mem=cpu.ram.memory;
+  st.map=cpu.ram.jitmap=new unsigned char[0x10000];
+  memset(st.map,0,0x10000);
+  st.hit=0;
+  cpu.ram.jit=this;
+#endif
+}
+
+JIT::~JIT()
+{
+  if (!buf) return;
+#if defined(HAVE_JIT)
+  cpu.ram.jit=NULL;
+  cpu.ram.jitmap=NULL;
+  delete [] st.map;
+  delete [] block;
+  delete [] blocklen;
+  delete [] hot;
+  munmap(buf,BUFSIZE);
+#endif
+}
+
+unsigned JIT::run(unsigned budget)
+{
+  unsigned done=0;
+  cpu.flagsnow();
+  for (int i=0;i<8;i++) st.regs[i]=cpu.regs[i];
+  st.sp=cpu.sp;
+  st.pc=cpu.pc;
+  while (done<budget && cpu.tstates<cpu.deadline)
+    {
+      unsigned char *code=block[st.pc];
+      if (!code) code=translate(st.pc);
+      if (code==NOBLOCK) break;
+      ((blockfn)code)(&st);
+      done+=st.count;
+      cpu.tstates+=st.cycles;
+      if (st.hit)
+	{
+	  st.hit=0;
+	  invalidate(st.wa1);
+	  invalidate(st.wa2);
+	}
+    }
+  for (int i=0;i<8;i++) cpu.regs[i]=st.regs[i];
+  cpu.sp=st.sp;
+  cpu.pc=st.pc;
+  instrs+=done;
+  return done;
+}
+
+// Kill any block covering a
+void JIT::invalidate(unsigned a)
+{
+  int killed=0;
+  for (unsigned i=0;i<MAXBYTES;i++)
+    {
+      unsigned s=(a-i)&0xFFFF;
+      if (block[s] && blocklen[s]>i)
+	{
+	  if (block[s]!=NOBLOCK) kills++;
+	  block[s]=NULL;
+	  killed=1;
+	}
+    }
+  if (killed && hot[a]<SELFMOD) hot[a]++;
+  st.map[a]=0;
+}
+
+void JIT::flush(void)
+{
+  memset(block,0,0x10000*sizeof(unsigned char *));
+  memset(st.map,0,0x10000);
+  p=buf;
+  flushes++;
+}
+
+#if defined(HAVE_JIT)
+
+enum { RAX=0, RCX, RDX, RBX, RSP, RBP, RSI, RDI, R8, R9, R10, R11, R12, R13, R14, R15 };
+// 8080 register field (B C D E H L M A) to host register
+static const int hreg[8]={ R8, R9, R10, R11, R12, R13, -1, RBP };
+// CPU::regs order (B C D E H L A F) to host register
+static const int sreg[8]={ R8, R9, R10, R11, R12, R13, RBP, RSI };
+// x86 opcode extensions for ADD ADC SUB SBB ANA XRA ORA CMP
+static const unsigned x86alu[8]={ 0, 2, 5, 3, 4, 6, 1, 7 };
+enum { ADD=0, OR=1, AND=4, SUB=5, XOR=6, CMP=7, SHL=4, SHR=5 };  // opcode extensions
+enum { OR32=0x09, ADD32=0x01, MOV32=0x89 };
+enum { JZ=4, JNZ=5 };
+
+#define OFF(m) ((unsigned)offsetof(state,m))
+
+void JIT::emit32(unsigned d)
+{
+  memcpy(p,&d,4);
+  p+=4;
+}
+
+void JIT::rex(int w, int r, int x, int b, int force)
+{
+  unsigned v=0x40|(w<<3)|((r&8)>>1)|((x&8)>>2)|((b&8)>>3);
+  if (v!=0x40 || force) emit(v);
+}
+
+// byte registers 4-7 are SPL..DIL only with a REX prefix (else AH..BH)
+static int rex8(int r)
+{
+  return r>=4 && r<8;
+}
+
+// op r/m,reg between registers (dst is r/m)
+void JIT::oprr(unsigned op, int dst, int src, int byte)
+{
+  rex(0,src,0,dst,byte && (rex8(src)||rex8(dst)));
+  emit(op);
+  modrm(3,src,dst);
+}
+
+// op r/m,imm for the 80/81 group
+void JIT::opri(unsigned digit, int dst, unsigned imm, int byte)
+{
+  rex(0,0,0,dst,byte && rex8(dst));
+  emit(byte?0x80:0x81);
+  modrm(3,digit,dst);
+  if (byte) emit(imm&0xFF); else emit32(imm);
+}
+
+void JIT::testri(int dst, unsigned imm)
+{
+  rex(0,0,0,dst);
+  emit(0xF7);
+  modrm(3,0,dst);
+  emit32(imm);
+}
+
+void JIT::movri(int dst, unsigned imm)
+{
+  rex(0,0,0,dst);
+  emit(0xB8+(dst&7));
+  emit32(imm);
+}
+
+// movzx dst,byte [base+index] (base can't be rbp or r13)
+void JIT::load8(int dst, int base, int index)
+{
+  rex(0,dst,index,base);
+  emit(0x0F);
+  emit(0xB6);
+  modrm(0,dst,4);
+  emit(((index&7)<<3)|(base&7));
+}
+
+// mov byte [base+index],src
+void JIT::store8(int base, int index, int src)
+{
+  rex(0,src,index,base,rex8(src));
+  emit(0x88);
+  modrm(0,src,4);
+  emit(((index&7)<<3)|(base&7));
+}
+
+void JIT::store8i(int base, int index, unsigned imm)
+{
+  rex(0,0,index,base);
+  emit(0xC6);
+  modrm(0,0,4);
+  emit(((index&7)<<3)|(base&7));
+  emit(imm&0xFF);
+}
+
+void JIT::movzx8(int dst, int src)
+{
+  rex(0,dst,0,src,rex8(src));
+  emit(0x0F);
+  emit(0xB6);
+  modrm(3,dst,src);
+}
+
+void JIT::shift(unsigned digit, int dst, unsigned n)
+{
+  rex(0,0,0,dst);
+  emit(0xC1);
+  modrm(3,digit,dst);
+  emit(n);
+}
+
+// FE (INC/DEC) and D0 (rotate by 1) on a byte register
+void JIT::unary8(unsigned op, unsigned digit, int dst)
+{
+  rex(0,0,0,dst,rex8(dst));
+  emit(op);
+  modrm(3,digit,dst);
+}
+
+void JIT::bt(int r, unsigned bit)
+{
+  rex(0,0,0,r);
+  emit(0x0F);
+  emit(0xBA);
+  modrm(3,4,r);
+  emit(bit);
+}
+
+void JIT::getst(int dst, unsigned off, int wide)
+{
+  rex(wide,dst,0,RBX);
+  emit(0x8B);
+  modrm(2,dst,RBX);
+  emit32(off);
+}
+
+void JIT::setst(unsigned off, int src)
+{
+  rex(0,src,0,RBX);
+  emit(0x89);
+  modrm(2,src,RBX);
+  emit32(off);
+}
+
+void JIT::setsti(unsigned off, unsigned imm)
+{
+  emit(0xC7);
+  modrm(2,0,RBX);
+  emit32(off);
+  emit32(imm);
+}
+
+unsigned char *JIT::jcc(unsigned cc)
+{
+  emit(0x0F);
+  emit(0x80+cc);
+  emit32(0);
+  return p-4;
+}
+
+unsigned char *JIT::jmp(void)
+{
+  emit(0xE9);
+  emit32(0);
+  return p-4;
+}
+
+void JIT::patch(unsigned char *at, unsigned char *to)
+{
+  unsigned rel=(unsigned)(to-(at+4));
+  memcpy(at,&rel,4);
+}
+
+// dst=register pair (BC, DE, HL, SP)
+void JIT::pair(int dst, unsigned rp)
+{
+  if (rp==3)
+    {
+      oprr(MOV32,dst,RDI);
+      return;
+    }
+  oprr(MOV32,dst,hreg[rp*2]);
+  shift(SHL,dst,8);
+  oprr(OR32,dst,hreg[rp*2+1]);
+}
+
+// register pair=eax (which must be 16 bits)
+void JIT::unpair(unsigned rp)
+{
+  if (rp==3)
+    {
+      oprr(MOV32,RDI,RAX);
+      return;
+    }
+  movzx8(hreg[rp*2+1],RAX);
+  shift(SHR,RAX,8);
+  oprr(MOV32,hreg[rp*2],RAX);
+}
+
+// Merge the host flags into F: F=(F&keep)|((AH^ahxor)&ahmask)
+// (keep==0 means F was already masked)
+void JIT::getflags(unsigned ahmask, unsigned ahxor, unsigned keep)
+{
+  emit(0x9F);  // LAHF
+  if (ahxor)
+    {
+      emit(0x80);  // xor ah,ahxor
+      emit(0xF4);
+      emit(ahxor);
+    }
+  emit(0x80);  // and ah,ahmask
+  emit(0xE4);
+  emit(ahmask);
+  emit(0x0F);  // movzx eax,ah
+  emit(0xB6);
+  emit(0xC4);
+  if (keep) opri(AND,RSI,keep);
+  oprr(OR32,RSI,RAX);
+}
+
+// CY=host carry
+void JIT::carry(void)
+{
+  emit(0x0F);  // setc al
+  emit(0x92);
+  emit(0xC0);
+  movzx8(RAX,RAX);
+  opri(AND,RSI,0xFE);
+  oprr(OR32,RSI,RAX);
+}
+
+// ADD..CMP on A with a register or (src<0) an immediate
+void JIT::alu(unsigned op, int src, unsigned imm)
+{
+  unsigned x=x86alu[op];
+  if (op==4)  // ANA: AC from bit 3 of either operand
+    {
+      opri(AND,RSI,flagtables::KEEP);
+      oprr(MOV32,RAX,RBP);
+      if (src<0) opri(OR,RAX,imm); else oprr(OR32,RAX,src);
+      opri(AND,RAX,8);
+      shift(SHL,RAX,1);
+      oprr(OR32,RSI,RAX);
+    }
+  if (op==1||op==3) bt(RSI,0);  // carry in
+  if (src<0) opri(x,RBP,imm,1); else oprr(x<<3,RBP,src,1);
+  switch (op)
+    {
+    case 0:
+    case 1:
+      getflags(0xD5,0,flagtables::KEEP);
+      break;
+    case 2:
+    case 3:
+    case 7:  // the 8080 AC is a carry, not a borrow
+      getflags(0xD5,0x10,flagtables::KEEP);
+      break;
+    case 4:
+      getflags(0xC5,0,0);
+      break;
+    default:
+      getflags(0xC5,0,flagtables::KEEP);
+      break;
+    }
+}
+
+// After a store: leave the block if it wrote over translated
+// code (r2<0 if only one address). pc is where to go next
+void JIT::check(int r1, int r2, unsigned pc, unsigned n)
+{
+  stub &s=stubs[nstubs++];
+  s.r1=r1;
+  s.r2=r2<0?r1:r2;
+  s.next=pc;
+  s.count=n;
+  s.cycles=tcount;
+  s.at[1]=NULL;
+  for (int i=0;i<2;i++)
+    {
+      int r=i?r2:r1;
+      if (r<0) break;
+      rex(0,0,r,R14);   // cmp byte [r14+r],0
+      emit(0x80);
+      modrm(0,7,4);
+      emit(((r&7)<<3)|(R14&7));
+      emit(0);
+      s.at[i]=jcc(JNZ);
+    }
+}
+
+// Push two registers or (hi<0) a constant
+// Leaves the addresses in edx (high byte) and edi (low byte)
+void JIT::push(int hi, int lo, unsigned imm)
+{
+  oprr(MOV32,RDX,RDI);
+  opri(SUB,RDX,1);
+  opri(AND,RDX,0xFFFF);
+  oprr(MOV32,RDI,RDX);
+  opri(SUB,RDI,1);
+  opri(AND,RDI,0xFFFF);
+  if (hi<0)
+    {
+      store8i(R15,RDX,imm>>8);
+      store8i(R15,RDI,imm);
+    }
+  else
+    {
+      store8(R15,RDX,hi);
+      store8(R15,RDI,lo);
+    }
+}
+
+void JIT::pop(int hi, int lo)
+{
+  load8(lo,R15,RDI);
+  opri(ADD,RDI,1);
+  opri(AND,RDI,0xFFFF);
+  load8(hi,R15,RDI);
+  opri(ADD,RDI,1);
+  opri(AND,RDI,0xFFFF);
+}
+
+void JIT::exit(unsigned pc, unsigned n)
+{
+  setsti(OFF(pc),pc&0xFFFF);
+  setsti(OFF(count),n);
+  setsti(OFF(cycles),tcount);
+  exits[nexits++]=jmp();
+}
+
+// leave with the new PC in eax
+void JIT::exitdyn(unsigned n)
+{
+  setst(OFF(pc),RAX);
+  setsti(OFF(count),n);
+  setsti(OFF(cycles),tcount);
+  exits[nexits++]=jmp();
+}
+
+// test a condition; returns the host jcc for "taken"
+int JIT::cond(unsigned cc)
+{
+  static const unsigned masks[4]={ flagtables::Z, flagtables::CY, flagtables::P, flagtables::S };
+  testri(RSI,masks[cc>>1]);
+  return (cc&1)?JNZ:JZ;
+}
+
+// Translate one instruction (n is the count including this one)
+// Returns 0 to go on, 1 if it ended the block, -1 if it can't
+// be done here (nothing emitted)
+int JIT::instr(unsigned op, unsigned a, unsigned imm, unsigned next, unsigned n)
+{
+  unsigned d=(op>>3)&7, s=op&7, rp=(op>>4)&3;
+  unsigned char *at;
+  if (op==0x76 || op==0xD3 || op==0xDB) return -1;  // HLT, OUT, IN
+  if (op==0xF3 || op==0xFB) return -1;  // DI, EI
+  if ((op==0x22 || op==0x2A) && imm==0xFFFF) return -1;  // LHLD/SHLD wrap
+  if ((op&0xC0)==0x40)  // MOV
+    {
+      if (s==6)
+	{
+	  pair(RDX,2);
+	  load8(hreg[d],R15,RDX);
+	}
+      else if (d==6)
+	{
+	  pair(RDX,2);
+	  store8(R15,RDX,hreg[s]);
+	  check(RDX,-1,next,n);
+	}
+      else if (d!=s) oprr(MOV32,hreg[d],hreg[s]);
+      return 0;
+    }
+  if ((op&0xC0)==0x80)  // ALU
+    {
+      if (s==6)
+	{
+	  pair(RDX,2);
+	  load8(RCX,R15,RDX);
+	  alu(d,RCX,0);
+	}
+      else alu(d,hreg[s],0);
+      return 0;
+    }
+  switch (op&0xC7)
+    {
+    case 0x04:  // INR
+    case 0x05:  // DCR
+      if (d==6)
+	{
+	  pair(RDX,2);
+	  load8(RCX,R15,RDX);
+	  unary8(0xFE,s&1,RCX);
+	  store8(R15,RDX,RCX);
+	}
+      else unary8(0xFE,s&1,hreg[d]);
+      getflags(0xD4,(s&1)?0x10:0,flagtables::KEEP|flagtables::CY);
+      if (d==6) check(RDX,-1,next,n);
+      return 0;
+    case 0x06:  // MVI
+      if (hot[(a+1)&0xFFFF]>=HOT)
+	{
+	  movri(RCX,(a+1)&0xFFFF);
+	  load8(RCX,R15,RCX);
+	  varimm=1;
+	}
+      if (d==6)
+	{
+	  pair(RDX,2);
+	  if (varimm) store8(R15,RDX,RCX); else store8i(R15,RDX,imm);
+	  check(RDX,-1,next,n);
+	}
+      else if (varimm) oprr(MOV32,hreg[d],RCX);
+      else movri(hreg[d],imm);
+      return 0;
+    case 0xC6:  // ALU immediate
+      if (hot[(a+1)&0xFFFF]>=HOT)
+	{
+	  movri(RCX,(a+1)&0xFFFF);
+	  load8(RCX,R15,RCX);
+	  varimm=1;
+	  alu(d,RCX,0);
+	}
+      else alu(d,-1,imm);
+      return 0;
+    case 0xC2:  // Jcc
+      at=jcc(cond(d));
+      exit(next,n);
+      patch(at,p);
+      exit(imm,n);
+      return 1;
+    case 0xC4:  // Ccc
+      at=jcc(cond(d));
+      exit(next,n);
+      patch(at,p);
+      tcount+=6;  // taken
+      push(-1,-1,next);
+      check(RDX,RDI,imm,n);
+      exit(imm,n);
+      return 1;
+    case 0xC0:  // Rcc
+      at=jcc(cond(d));
+      exit(next,n);
+      patch(at,p);
+      tcount+=6;
+      pop(RCX,RAX);
+      shift(SHL,RCX,8);
+      oprr(OR32,RAX,RCX);
+      exitdyn(n);
+      return 1;
+    case 0xC7:  // RST
+      push(-1,-1,next);
+      check(RDX,RDI,d*8,n);
+      exit(d*8,n);
+      return 1;
+    }
+  switch (op&0xCF)
+    {
+    case 0x01:  // LXI
+      if (hot[a+1]>=HOT || hot[a+2]>=HOT)
+	{
+	  movri(RAX,a+2);
+	  load8(RAX,R15,RAX);
+	  shift(SHL,RAX,8);
+	  movri(RCX,a+1);
+	  load8(RCX,R15,RCX);
+	  oprr(OR32,RAX,RCX);
+	  unpair(rp);
+	  varimm=1;
+	}
+      else if (rp==3) movri(RDI,imm);
+      else
+	{
+	  movri(hreg[rp*2],imm>>8);
+	  movri(hreg[rp*2+1],imm&0xFF);
+	}
+      return 0;
+    case 0x03:  // INX
+    case 0x0B:  // DCX
+      if (rp==3)
+	{
+	  opri(op&8?SUB:ADD,RDI,1);
+	  opri(AND,RDI,0xFFFF);
+	  return 0;
+	}
+      pair(RAX,rp);
+      opri(op&8?SUB:ADD,RAX,1);
+      opri(AND,RAX,0xFFFF);
+      unpair(rp);
+      return 0;
+    case 0x09:  // DAD
+      pair(RAX,2);
+      pair(RCX,rp);
+      oprr(ADD32,RAX,RCX);
+      oprr(MOV32,RCX,RAX);
+      shift(SHR,RCX,16);
+      opri(AND,RSI,0xFE);
+      oprr(OR32,RSI,RCX);
+      opri(AND,RAX,0xFFFF);
+      unpair(2);
+      return 0;
+    case 0xC1:  // POP
+      if (rp==3) pop(RBP,RSI);
+      else pop(hreg[rp*2],hreg[rp*2+1]);
+      return 0;
+    case 0xC5:  // PUSH
+      if (rp==3) push(RBP,RSI,0);
+      else push(hreg[rp*2],hreg[rp*2+1],0);
+      check(RDX,RDI,next,n);
+      return 0;
+    }
+  switch (op)
+    {
+    case 0x02:  // STAX
+    case 0x12:
+      pair(RDX,rp);
+      store8(R15,RDX,RBP);
+      check(RDX,-1,next,n);
+      return 0;
+    case 0x0A:  // LDAX
+    case 0x1A:
+      pair(RDX,rp);
+      load8(RBP,R15,RDX);
+      return 0;
+    case 0x22:  // SHLD
+      movri(RDX,imm);
+      movri(RAX,imm+1);
+      store8(R15,RDX,hreg[5]);
+      store8(R15,RAX,hreg[4]);
+      check(RDX,RAX,next,n);
+      return 0;
+    case 0x2A:  // LHLD
+      movri(RDX,imm);
+      load8(hreg[5],R15,RDX);
+      movri(RDX,imm+1);
+      load8(hreg[4],R15,RDX);
+      return 0;
+    case 0x32:  // STA
+      movri(RDX,imm);
+      store8(R15,RDX,RBP);
+      check(RDX,-1,next,n);
+      return 0;
+    case 0x3A:  // LDA
+      movri(RDX,imm);
+      load8(RBP,R15,RDX);
+      return 0;
+    case 0x07:  // RLC
+    case 0x0F:  // RRC
+    case 0x17:  // RAL
+    case 0x1F:  // RAR
+      if (op&0x10) bt(RSI,0);
+      unary8(0xD0,d,RBP);
+      carry();
+      return 0;
+    case 0x27:  // DAA: A+CY*256+AC*512 indexes ftab.daa
+      oprr(MOV32,RAX,RBP);
+      oprr(MOV32,RCX,RSI);
+      opri(AND,RCX,flagtables::CY);
+      shift(SHL,RCX,8);
+      oprr(OR32,RAX,RCX);
+      oprr(MOV32,RCX,RSI);
+      opri(AND,RCX,flagtables::AC);
+      shift(SHL,RCX,5);
+      oprr(OR32,RAX,RCX);
+      {
+	const unsigned short *t=ftab.daa;
+	emit(0x48);  // mov rcx,imm64
+	emit(0xB9);
+	memcpy(p,&t,8);
+	p+=8;
+      }
+      emit(0x0F);  // movzx eax,word [rcx+rax*2]
+      emit(0xB7);
+      emit(0x04);
+      emit(0x41);
+      movzx8(RBP,RAX);
+      shift(SHR,RAX,8);
+      opri(AND,RSI,flagtables::KEEP);
+      oprr(OR32,RSI,RAX);
+      return 0;
+    case 0x2F:  // CMA
+      opri(XOR,RBP,0xFF);
+      return 0;
+    case 0x37:  // STC
+      opri(OR,RSI,flagtables::CY);
+      return 0;
+    case 0x3F:  // CMC
+      opri(XOR,RSI,flagtables::CY);
+      return 0;
+    case 0xC3:  // JMP
+    case 0xCB:
+      exit(imm,n);
+      return 1;
+    case 0xC9:  // RET
+    case 0xD9:
+      pop(RCX,RAX);
+      shift(SHL,RCX,8);
+      oprr(OR32,RAX,RCX);
+      exitdyn(n);
+      return 1;
+    case 0xCD:  // CALL
+    case 0xDD:
+    case 0xED:
+    case 0xFD:
+      push(-1,-1,next);
+      check(RDX,RDI,imm,n);
+      exit(imm,n);
+      return 1;
+    case 0xE3:  // XTHL
+      oprr(MOV32,RDX,RDI);
+      oprr(MOV32,RAX,RDI);
+      opri(ADD,RAX,1);
+      opri(AND,RAX,0xFFFF);
+      load8(RCX,R15,RDX);
+      store8(R15,RDX,hreg[5]);
+      oprr(MOV32,hreg[5],RCX);
+      load8(RCX,R15,RAX);
+      store8(R15,RAX,hreg[4]);
+      oprr(MOV32,hreg[4],RCX);
+      check(RDX,RAX,next,n);
+      return 0;
+    case 0xE9:  // PCHL
+      pair(RAX,2);
+      exitdyn(n);
+      return 1;
+    case 0xEB:  // XCHG
+      oprr(MOV32,RAX,hreg[2]);
+      oprr(MOV32,hreg[2],hreg[4]);
+      oprr(MOV32,hreg[4],RAX);
+      oprr(MOV32,RAX,hreg[3]);
+      oprr(MOV32,hreg[3],hreg[5]);
+      oprr(MOV32,hreg[5],RAX);
+      return 0;
+    case 0xF9:  // SPHL
+      pair(RDI,2);
+      return 0;
+    }
+  return 0;  // NOP
+}
+
+// Translate the block at a
+unsigned char *JIT::translate(unsigned start)
+{
+  static const int saved[6]={ RBX, RBP, R12, R13, R14, R15 };
+  if (buf+BUFSIZE-p<MAXCODE) flush();
+  unsigned char *code=p;
+  unsigned a=start, n=0, cyc=0;
+  nexits=nstubs=0;
+  // prologue: save what the ABI says we must and load the 8080
+  for (int i=0;i<6;i++)
+    {
+      rex(0,0,0,saved[i]);
+      emit(0x50+(saved[i]&7));
+    }
+  emit(0x48);  // mov rbx,rdi
+  emit(0x89);
+  emit(0xFB);
+  getst(R15,OFF(mem),1);
+  getst(R14,OFF(map),1);
+  for (int i=0;i<8;i++) getst(sreg[i],OFF(regs)+4*i);
+  getst(RDI,OFF(sp));
+  while (1)
+    {
+      unsigned op=st.mem[a], len=CPU::oplen[op];
+      int wraps=a+len>0x10000;
+      tcount=cyc;
+      if (n==MAXINST || (wraps && n) || a+len-start>MAXBYTES)
+	{
+	  exit(a,n);
+	  break;
+	}
+      unsigned imm=0;
+      if (len>1) imm=st.mem[(a+1)&0xFFFF];
+      if (len>2) imm|=st.mem[(a+2)&0xFFFF]<<8;
+      varimm=0;
+      tcount=cyc+CPU::opcycles[op];
+      // code that keeps rewriting its own opcodes is cheaper to 
+      // interpret and so is an instruction that wraps past FFFF 
+      // (an empty block would never get anywhere)
+      int r=wraps||hot[a]>=SELFMOD?-1:instr(op,a,imm,a+len,n+1);
+      if (r<0)
+	{
+	  tcount=cyc;
+	  if (n) 
+	    {
+	      exit(a,n);
+	      break;
+	    }
+	  // nothing to run natively here
+	  p=code;
+	  block[start]=NOBLOCK;
+	  blocklen[start]=len;
+	  for (unsigned i=0;i<len;i++) st.map[(start+i)&0xFFFF]=1;
+	  return NOBLOCK;
+	}
+      // writes to the code kill the block (but not to an
+      // immediate we read at run time)
+      for (unsigned i=0;i<len;i++) 
+	if (!varimm || i==0) st.map[a+i]=1;
+      varimms+=varimm;
+      a+=len;
+      n++;
+      cyc=tcount;
+      if (r) break;
+    }
+  // ways out for writes that hit code
+  for (unsigned i=0;i<nstubs;i++)
+    {
+      stub &s=stubs[i];
+      patch(s.at[0],p);
+      if (s.at[1]) patch(s.at[1],p);
+      setst(OFF(wa1),s.r1);
+      setst(OFF(wa2),s.r2);
+      setsti(OFF(hit),1);
+      tcount=s.cycles;
+      exit(s.next,s.count);
+    }
+  // epilogue: put the 8080 back and return
+  for (unsigned i=0;i<nexits;i++) patch(exits[i],p);
+  for (int i=0;i<8;i++) setst(OFF(regs)+4*i,sreg[i]);
+  setst(OFF(sp),RDI);
+  for (int i=5;i>=0;i--)
+    {
+      rex(0,0,0,saved[i]);
+      emit(0x58+(saved[i]&7));
+    }
+  emit(0xC3);
+  block[start]=code;
+  blocklen[start]=a-start;
+  blocks++;
+  return code;
+}
+
+#else
+
+// No native code on this host: every address needs the interpreter
+unsigned char *JIT::translate(unsigned a)
+{
+  return NOBLOCK;
+}
+
+#endif
@@ -0,0 +1,131 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __JIT_H
+#define __JIT_H
+#include <stddef.h>
+
+// Native code only for x86-64 with the System V calling convention
+#if defined(__x86_64__) && !defined(_WIN32) && !defined(__CYGWIN__)
+#define HAVE_JIT 1
+#endif
+
+class CPU;
+
+// Basic block translator (-J on the command line)
+// Straight-line 8080 code becomes x86-64 code with the 8080
+// registers kept in host registers. A block ends at the first
+// jump, call, return, or restart. IN, OUT, HLT, EI, and DI are
+// never translated: the block stops short of them and CPU::exec
+// interprets them. Interrupts are taken between blocks. A write that hits translated code (from a
+// block or through RAM::write) kills the blocks that cover it
+class JIT
+{
+ protected:
+  CPU &cpu;
+  // What the generated code works on (rbx points here)
+  struct state
+  {
+    unsigned regs[8];   // same order as CPU::regs
+    unsigned sp, pc;
+    unsigned count;     // instructions the block did
+    unsigned cycles;    // and the T states they took
+    unsigned hit, wa1, wa2;  // the block wrote over code at wa1 and/or wa2
+    unsigned char *mem;  // RAM
+    unsigned char *map;  // RAM::jitmap
+  } st;
+  typedef void (*blockfn)(state *);
+  enum { MAXBYTES=64, MAXINST=48, MAXCODE=4096, BUFSIZE=4<<20 };
+  unsigned char *buf;   // executable buffer
+  unsigned char *p;     // where the next block goes
+  unsigned char **block;  // native code for the block starting at each address
+  unsigned char *blocklen;  // and how many 8080 bytes it covers
+  // How often writes to each byte killed blocks. Once an immediate
+  // operand is this hot it gets read at run time instead; an opcode
+  // that hits SELFMOD is left to the interpreter
+  unsigned char *hot;
+  enum { HOT=2, SELFMOD=8 };
+  static unsigned char never;  // block[] marker for noblock()
+  unsigned char *translate(unsigned a);
+  // code generation (see jit.cpp)
+  unsigned char *exits[4*MAXINST];  // jumps to the epilogue
+  unsigned nexits;
+  struct stub
+  {
+    unsigned char *at[2];   // jumps to here
+    int r1, r2;   // registers holding the addresses written
+    unsigned next, count, cycles;
+  } stubs[2*MAXINST];
+  unsigned nstubs;
+  int instr(unsigned op, unsigned a, unsigned imm, unsigned next, unsigned n);
+  int varimm;  // instr() read the immediate byte from memory
+  unsigned tcount;  // T states up to here (exits store it in st.cycles)
+  void emit(unsigned b) { *p++=b; }
+  void emit32(unsigned d);
+  void rex(int w, int r, int x, int b, int force=0);
+  void modrm(int mod, int reg, int rm) { emit((mod<<6)|((reg&7)<<3)|(rm&7)); }
+  void oprr(unsigned op, int dst, int src, int byte=0);
+  void opri(unsigned digit, int dst, unsigned imm, int byte=0);
+  void testri(int dst, unsigned imm);
+  void movri(int dst, unsigned imm);
+  void load8(int dst, int base, int index);
+  void store8(int base, int index, int src);
+  void store8i(int base, int index, unsigned imm);
+  void movzx8(int dst, int src);
+  void shift(unsigned digit, int dst, unsigned n);
+  void unary8(unsigned op, unsigned digit, int dst);
+  void bt(int r, unsigned bit);
+  void getst(int dst, unsigned off, int wide=0);
+  void setst(unsigned off, int src);
+  void setsti(unsigned off, unsigned imm);
+  unsigned char *jcc(unsigned cc);
+  unsigned char *jmp(void);
+  void patch(unsigned char *at, unsigned char *to);
+  void pair(int dst, unsigned rp);
+  void unpair(unsigned rp);
+  void getflags(unsigned ahmask, unsigned ahxor, unsigned keep);
+  void carry(void);
+  void alu(unsigned op, int src, unsigned imm);
+  void check(int r1, int r2, unsigned next, unsigned n);
+  void push(int hi, int lo, unsigned imm);
+  void pop(int hi, int lo);
+  void exit(unsigned pc, unsigned n);
+  void exitdyn(unsigned n);
+  int cond(unsigned cc);
+ public:
+  JIT(CPU &c);
+  ~JIT();
+  int ok(void) { return buf!=NULL; }
+  // Is a known to need the interpreter?
+  int noblock(unsigned a) { return block[a]==&never; }
+  // Run blocks until about budget instructions are done or the
+  // next one needs the interpreter. Returns the instruction count
+  unsigned run(unsigned budget);
+  void invalidate(unsigned a);  // code at a changed
+  void flush(void);   // throw everything away
+  unsigned long long blocks, kills, flushes, instrs;  // statistics
+  unsigned long long varimms;  // immediates read at run time
+};
+
+#endif
@@ -0,0 +1,569 @@
+// Kernels for the lanes engine (see lanes.h)
+// No include guard: lanes.cpp includes this once for each instruction
+// set it builds kernels for, each time inside its own namespace
+// Each kernel does one opcode for cnt lanes: lanes 0..cnt-1 when D
+// (dense) is set, otherwise the lanes listed in idx. The dense ones
+// are plain loops over the register arrays so the compiler can
+// vectorize them. Flags follow the table engine (cpuops.h) but are
+// worked out instead of looked up where that lets a loop vectorize
+
+// S, Z, and P of a byte (the same as flagtables::szp)
+static inline unsigned lszp(unsigned r)
+{
+  unsigned p=r^(r>>4);
+  p^=p>>2;
+  p^=p>>1;
+  return (r&0x80)|(r==0?flagtables::Z:0)|((~p&1)<<2);
+}
+
+// One lane's memory (the lanes' bytes are interleaved, see lanes.h)
+struct lview
+{
+  unsigned char *p;
+  size_t n;
+  unsigned char &operator[](unsigned a) const { return p[(size_t)a*n]; }
+};
+
+static inline lview lmem(lanes::state &s, unsigned l)
+{
+  lview m={ s.mem+l, s.n };
+  return m;
+}
+
+// the operand bytes after the opcode at pc
+static inline unsigned limm8(const lview &m, unsigned pc)
+{
+  return m[(pc+1)&0xFFFF];
+}
+
+static inline unsigned limm16(const lview &m, unsigned pc)
+{
+  return m[(pc+1)&0xFFFF]+(m[(pc+2)&0xFFFF]<<8);
+}
+
+template<unsigned CC> static inline unsigned lcond(unsigned f)
+{
+  const unsigned bit=CC<2?flagtables::Z:CC<4?flagtables::CY:CC<6?flagtables::P:flagtables::S;
+  return (CC&1)?(f&bit)!=0:(f&bit)==0;
+}
+
+// ADD..CMP (K is bits 3-5 of the opcode)
+template<unsigned K> static inline void lalu(unsigned char &a, unsigned char &f, unsigned v)
+{
+  unsigned x=a, cy=(K==1||K==3)?(f&flagtables::CY):0, r, fl;
+  switch (K)
+    {
+    case 0:
+    case 1:
+      r=x+v+cy;
+      fl=lszp(r&0xFF)|((x^v^r)&flagtables::AC)|(r>>8);
+      break;
+    case 2:
+    case 3:
+    case 7:
+      // AC is the carry out of bit 3 of x+~v, as on the 8080
+      r=(x-v-cy)&0x1FF;
+      fl=lszp(r&0xFF)|(((x^v^r)&flagtables::AC)^flagtables::AC)|(r>>8);
+      break;
+    case 4:
+      r=x&v;
+      fl=lszp(r)|(((x|v)&8)<<1);
+      break;
+    case 5:
+      r=x^v;
+      fl=lszp(r);
+      break;
+    default:
+      r=x|v;
+      fl=lszp(r);
+      break;
+    }
+  if (K!=7) a=r;
+  f=(f&flagtables::KEEP)|fl;
+}
+
+static inline void lpush(const lview &m, unsigned short &sp, unsigned v)
+{
+  sp--;
+  m[sp]=v>>8;
+  sp--;
+  m[sp]=v;
+}
+
+static inline unsigned lpop(const lview &m, unsigned short &sp)
+{
+  unsigned v=m[sp];
+  sp++;
+  v+=m[sp]<<8;
+  sp++;
+  return v;
+}
+
+// Register R of lane l (6 is M)
+template<unsigned R> static inline unsigned lget(lanes::state &s, unsigned l)
+{
+  if (R==6) return lmem(s,l)[(s.r[CPU::H][l]<<8)|s.r[CPU::L][l]];
+  return s.r[R==7?CPU::A:R][l];
+}
+
+template<unsigned R> static inline void lset(lanes::state &s, unsigned l, unsigned v)
+{
+  if (R==6) lmem(s,l)[(s.r[CPU::H][l]<<8)|s.r[CPU::L][l]]=v;
+  else s.r[R==7?CPU::A:R][l]=v;
+}
+
+// Kernels
+// The register-only ones copy the array pointers into locals first;
+// otherwise every byte stored could be one of the pointers in s and
+// nothing would vectorize
+
+#define LANE const unsigned l=D?j:idx[j]
+
+template<unsigned OP, bool D> void k_mov(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned DST=(OP>>3)&7, SRC=OP&7, T=CPU::timing(OP);
+  unsigned short *__restrict pc=s.pc;
+  unsigned long long *__restrict t=s.t;
+  if (DST!=6 && SRC!=6)
+    {
+      unsigned char *__restrict d=s.r[DST==7?CPU::A:DST];
+      const unsigned char *__restrict from=s.r[SRC==7?CPU::A:SRC];
+      for (unsigned j=0;j<cnt;j++)
+	{
+	  LANE;
+	  d[l]=from[l];
+	  pc[l]++;
+	  t[l]+=T;
+	}
+      return;
+    }
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      lset<DST>(s,l,lget<SRC>(s,l));
+      pc[l]++;
+      t[l]+=T;
+    }
+}
+
+template<unsigned OP, bool D> void k_mvi(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned R=(OP>>3)&7, T=CPU::timing(OP);
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      lset<R>(s,l,limm8(lmem(s,l),s.pc[l]));
+      s.pc[l]+=2;
+      s.t[l]+=T;
+    }
+}
+
+template<unsigned OP, bool D> void k_inr(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned R=(OP>>3)&7, T=CPU::timing(OP), DCR=OP&1;
+  unsigned short *__restrict pc=s.pc;
+  unsigned long long *__restrict t=s.t;
+  unsigned char *__restrict f=s.r[CPU::F];
+  if (R!=6)
+    {
+      unsigned char *__restrict r=s.r[R==7?CPU::A:R];
+      for (unsigned j=0;j<cnt;j++)
+	{
+	  LANE;
+	  unsigned v=(r[l]+(DCR?0xFF:1))&0xFF;
+	  unsigned ac=DCR?((v&0xF)!=0xF):((v&0xF)==0);
+	  f[l]=(f[l]&(flagtables::KEEP|flagtables::CY))|lszp(v)|(ac<<4);
+	  r[l]=v;
+	  pc[l]++;
+	  t[l]+=T;
+	}
+      return;
+    }
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      unsigned v=(lget<6>(s,l)+(DCR?0xFF:1))&0xFF;
+      unsigned ac=DCR?((v&0xF)!=0xF):((v&0xF)==0);
+      f[l]=(f[l]&(flagtables::KEEP|flagtables::CY))|lszp(v)|(ac<<4);
+      lset<6>(s,l,v);
+      pc[l]++;
+      t[l]+=T;
+    }
+}
+
+template<unsigned OP, bool D> void k_alu(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned K=(OP>>3)&7, R=OP&7, T=CPU::timing(OP);
+  unsigned short *__restrict pc=s.pc;
+  unsigned long long *__restrict t=s.t;
+  unsigned char *__restrict a=s.r[CPU::A];
+  unsigned char *__restrict f=s.r[CPU::F];
+  if (R!=6)
+    {
+      const unsigned char *r=s.r[R==7?CPU::A:R];   // may be a
+      for (unsigned j=0;j<cnt;j++)
+	{
+	  LANE;
+	  lalu<K>(a[l],f[l],r[l]);
+	  pc[l]++;
+	  t[l]+=T;
+	}
+      return;
+    }
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      lalu<K>(a[l],f[l],lget<6>(s,l));
+      pc[l]++;
+      t[l]+=T;
+    }
+}
+
+template<unsigned OP, bool D> void k_alui(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned K=(OP>>3)&7, T=CPU::timing(OP);
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      lalu<K>(s.r[CPU::A][l],s.r[CPU::F][l],limm8(lmem(s,l),s.pc[l]));
+      s.pc[l]+=2;
+      s.t[l]+=T;
+    }
+}
+
+// LXI, INX, DCX, and DAD
+template<unsigned OP, bool D> void k_pair(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned RP=(OP>>4)&3, KIND=OP&0xF, T=CPU::timing(OP);
+  unsigned short *__restrict pc=s.pc;
+  unsigned short *__restrict sp=s.sp;
+  unsigned long long *__restrict t=s.t;
+  unsigned char *__restrict hi=s.r[RP*2&7];
+  unsigned char *__restrict lo=s.r[(RP*2+1)&7];
+  unsigned char *__restrict h=s.r[CPU::H];
+  unsigned char *__restrict lr=s.r[CPU::L];
+  unsigned char *__restrict f=s.r[CPU::F];
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      unsigned v=RP==3?sp[l]:(hi[l]<<8)|lo[l];
+      switch (KIND)
+	{
+	case 0x1:
+	  v=limm16(lmem(s,l),pc[l]);
+	  break;
+	case 0x3:
+	  v++;
+	  break;
+	case 0xB:
+	  v--;
+	  break;
+	default:  // DAD
+	  v+=(h[l]<<8)|lr[l];
+	  f[l]=(f[l]&~flagtables::CY)|((v>>16)&1);
+	  h[l]=v>>8;
+	  lr[l]=v;
+	  break;
+	}
+      if (KIND!=0x9)
+	{
+	  if (RP==3) sp[l]=v;
+	  else
+	    {
+	      hi[l]=v>>8;
+	      lo[l]=v;
+	    }
+	}
+      pc[l]+=KIND==1?3:1;
+      t[l]+=T;
+    }
+}
+
+// LDAX, STAX, LHLD, SHLD, LDA, and STA
+template<unsigned OP, bool D> void k_load(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned T=CPU::timing(OP), LEN=CPU::length(OP);
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      lview m=lmem(s,l);
+      unsigned a=LEN==3?limm16(m,s.pc[l]):OP&0x10?(s.r[CPU::D][l]<<8)|s.r[CPU::E][l]:(s.r[CPU::B][l]<<8)|s.r[CPU::C][l];
+      switch (OP)
+	{
+	case 0x22:
+	  m[a]=s.r[CPU::L][l];
+	  m[(a+1)&0xFFFF]=s.r[CPU::H][l];
+	  break;
+	case 0x2A:
+	  s.r[CPU::L][l]=m[a];
+	  s.r[CPU::H][l]=m[(a+1)&0xFFFF];
+	  break;
+	case 0x02:
+	case 0x12:
+	case 0x32:
+	  m[a]=s.r[CPU::A][l];
+	  break;
+	default:
+	  s.r[CPU::A][l]=m[a];
+	  break;
+	}
+      s.pc[l]+=LEN;
+      s.t[l]+=T;
+    }
+}
+
+// RLC, RRC, RAL, RAR, CMA, STC, and CMC
+template<unsigned OP, bool D> void k_acc(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned T=CPU::timing(OP);
+  unsigned short *__restrict pc=s.pc;
+  unsigned long long *__restrict t=s.t;
+  unsigned char *__restrict a=s.r[CPU::A];
+  unsigned char *__restrict f=s.r[CPU::F];
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      unsigned x=a[l], c=f[l]&flagtables::CY;
+      switch (OP)
+	{
+	case 0x07: c=x>>7; x=(x<<1)|c; break;
+	case 0x0F: c=x&1; x=(x>>1)|(c<<7); break;
+	case 0x17: x=(x<<1)|c; c=x>>8; break;
+	case 0x1F: x|=c<<8; c=x&1; x>>=1; break;
+	case 0x2F: x=~x; break;
+	case 0x37: c=1; break;
+	default: c^=1; break;
+	}
+      a[l]=x;
+      f[l]=(f[l]&~flagtables::CY)|(c&1);
+      pc[l]++;
+      t[l]+=T;
+    }
+}
+
+template<unsigned OP, bool D> void k_daa(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned T=CPU::timing(OP);
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      unsigned a=s.r[CPU::A][l], f=s.r[CPU::F][l];
+      unsigned r=ftab.daa[a|((f&flagtables::CY)<<8)|((f&flagtables::AC)<<5)];
+      s.r[CPU::A][l]=r;
+      s.r[CPU::F][l]=(f&flagtables::KEEP)|(r>>8);
+      s.pc[l]++;
+      s.t[l]+=T;
+    }
+}
+
+// NOP (and the opcodes that are NOPs here: the other 00s, EI, DI)
+template<unsigned OP, bool D> void k_nop(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned T=CPU::timing(OP);
+  unsigned short *__restrict pc=s.pc;
+  unsigned long long *__restrict t=s.t;
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      pc[l]++;
+      t[l]+=T;
+    }
+}
+
+// Jumps, calls, returns, and restarts (CC 8 is always)
+template<unsigned OP, bool D> void k_jmp(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned T=CPU::timing(OP), CC=(OP&1)?8:(OP>>3)&7, KIND=OP&7;
+  unsigned short *__restrict pc=s.pc;
+  unsigned long long *__restrict t=s.t;
+  const unsigned char *__restrict f=s.r[CPU::F];
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      unsigned go=CC==8?1:lcond<CC&7>(f[l]);
+      lview m=lmem(s,l);
+      t[l]+=T;
+      switch (KIND)
+	{
+	case 0:  // Rcc
+	case 1:  // RET
+	  if (go)
+	    {
+	      pc[l]=lpop(m,s.sp[l]);
+	      if (CC!=8) t[l]+=6;
+	    }
+	  else pc[l]++;
+	  break;
+	case 2:  // Jcc
+	case 3:  // JMP
+	  pc[l]=go?limm16(m,pc[l]):pc[l]+3;
+	  break;
+	case 4:  // Ccc
+	case 5:  // CALL
+	  if (go)
+	    {
+	      lpush(m,s.sp[l],pc[l]+3);
+	      pc[l]=limm16(m,pc[l]);
+	      if (CC!=8) t[l]+=6;
+	    }
+	  else pc[l]+=3;
+	  break;
+	default:  // RST
+	  lpush(m,s.sp[l],pc[l]+1);
+	  pc[l]=OP&0x38;
+	  break;
+	}
+    }
+}
+
+// PUSH, POP, XTHL, PCHL, SPHL, and XCHG
+template<unsigned OP, bool D> void k_stack(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned T=CPU::timing(OP), RP=(OP>>4)&3;
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      lview m=lmem(s,l);
+      unsigned hl=(s.r[CPU::H][l]<<8)|s.r[CPU::L][l], v;
+      s.pc[l]++;
+      s.t[l]+=T;
+      switch (OP)
+	{
+	case 0xE3:
+	  v=lpop(m,s.sp[l]);
+	  lpush(m,s.sp[l],hl);
+	  hl=v;
+	  break;
+	case 0xE9:
+	  s.pc[l]=hl;
+	  continue;
+	case 0xF9:
+	  s.sp[l]=hl;
+	  continue;
+	case 0xEB:
+	  v=(s.r[CPU::D][l]<<8)|s.r[CPU::E][l];
+	  s.r[CPU::D][l]=hl>>8;
+	  s.r[CPU::E][l]=hl;
+	  hl=v;
+	  break;
+	default:
+	  if (OP&4) lpush(m,s.sp[l],(s.r[RP*2][l]<<8)|s.r[RP*2+1][l]);
+	  else
+	    {
+	      v=lpop(m,s.sp[l]);
+	      s.r[RP*2][l]=v>>8;
+	      s.r[RP*2+1][l]=v;
+	    }
+	  continue;
+	}
+      s.r[CPU::H][l]=hl>>8;
+      s.r[CPU::L][l]=hl;
+    }
+}
+
+// The console port, the same as acia as far as a polling program
+// can tell: TDRE stays low for acia::CHARTIME after a character
+static inline void lputc(lanes::state &s, unsigned l, char c)
+{
+  if (s.outlen[l]<lanes::OUTMAX) s.out[(size_t)l*lanes::OUTMAX+s.outlen[l]++]=c;
+}
+
+template<unsigned OP, bool D> void k_io(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  const unsigned T=CPU::timing(OP);
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      unsigned port=limm8(lmem(s,l),s.pc[l]);
+      unsigned long long now=s.t[l];  // devices only catch up between instructions
+      s.pc[l]+=2;
+      s.t[l]+=T;
+      if (OP==0xD3)
+	{
+	  if (port!=0x11) continue;
+	  char c=s.r[CPU::A][l]&0x7F;
+	  if (c=='_')
+	    {
+	      lputc(s,l,'\010');
+	      lputc(s,l,' ');
+	      c='\010';
+	    }
+	  lputc(s,l,c);
+	  s.txdone[l]=s.t[l]+acia::CHARTIME;
+	  continue;
+	}
+      const char *&in=s.in[l];
+      switch (port)
+	{
+	case 0x10:
+	  s.r[CPU::A][l]=(in && *in?1:0)|(now>=s.txdone[l]?2:0);
+	  break;
+	case 0x11:
+	  {
+	    unsigned v=in && *in?(unsigned char)*in++:0;
+	    if (v==0x7F) v='_';
+	    if (v=='\n') v='\r';
+	    s.r[CPU::A][l]=v;
+	  }
+	  break;
+	case 0xFF:
+	  s.r[CPU::A][l]=0x08;  // the sense switches (see RFP::getSWHigh)
+	  break;
+	}
+    }
+}
+
+// HLT stops the lane (lanes::run takes it off the live list)
+template<unsigned OP, bool D> void k_hlt(lanes::state &s, const unsigned *idx, unsigned cnt)
+{
+  for (unsigned j=0;j<cnt;j++)
+    {
+      LANE;
+      s.halted[l]=1;
+      s.t[l]+=CPU::timing(OP);
+    }
+}
+
+#undef LANE
+
+// Which kernel does opcode OP? (the same split as CPU::handlerof)
+template<unsigned OP, bool D> constexpr lanes::kernel kernelof(void)
+{
+  return
+    OP==0x76 ? &k_hlt<OP,D> :
+    (OP&0xC0)==0x40 ? &k_mov<OP,D> :
+    (OP&0xC0)==0x80 ? &k_alu<OP,D> :
+    (OP&0xC6)==0x04 ? &k_inr<OP,D> :
+    (OP&0xC7)==0x06 ? &k_mvi<OP,D> :
+    (OP&0xC7)==0x01 || (OP&0xC7)==0x03 ? &k_pair<OP,D> :
+    (OP&0xE7)==0x02 || (OP&0xE7)==0x22 ? &k_load<OP,D> :
+    OP==0x27 ? &k_daa<OP,D> :
+    (OP&0xC7)==0x07 ? &k_acc<OP,D> :
+    (OP&0xC0)==0x00 ? &k_nop<OP,D> :
+    (OP&0xC7)==0xC6 ? &k_alui<OP,D> :
+    (OP&0xC7)==0xC0 || (OP&0xC7)==0xC2 || (OP&0xC7)==0xC4 || (OP&0xC7)==0xC7 ? &k_jmp<OP,D> :
+    OP==0xC9 || OP==0xD9 ? &k_jmp<0xC9,D> :
+    OP==0xC3 || OP==0xCB ? &k_jmp<0xC3,D> :
+    (OP&0xCF)==0xCD ? &k_jmp<0xCD,D> :
+    OP==0xD3 || OP==0xDB ? &k_io<OP,D> :
+    (OP&0xC3)==0xC1 || OP==0xE3 || OP==0xE9 || OP==0xEB || OP==0xF9 ? &k_stack<OP,D> :
+    &k_nop<OP,D>;   // EI and DI
+}
+
+#define KOPS4(n,d) kernelof<(n),d>(), kernelof<(n)+1,d>(), kernelof<(n)+2,d>(), kernelof<(n)+3,d>()
+#define KOPS16(n,d) KOPS4(n,d), KOPS4((n)+4,d), KOPS4((n)+8,d), KOPS4((n)+12,d)
+#define KOPS64(n,d) KOPS16(n,d), KOPS16((n)+16,d), KOPS16((n)+32,d), KOPS16((n)+48,d)
+
+static const lanes::kernel densetable[256]=
+  {
+    KOPS64(0x00,true), KOPS64(0x40,true), KOPS64(0x80,true), KOPS64(0xC0,true)
+  };
+
+static const lanes::kernel sparsetable[256]=
+  {
+    KOPS64(0x00,false), KOPS64(0x40,false), KOPS64(0x80,false), KOPS64(0xC0,false)
+  };
+
+#undef KOPS4
+#undef KOPS16
+#undef KOPS64
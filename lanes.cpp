@@ -0,0 +1,249 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+// Multi-lane engine (see lanes.h)
+// The kernels are in laneops.h. It gets compiled twice: once for
+// whatever the compiler targets by default and, on x86, once more
+// with AVX2 turned on. The constructor picks whichever the host runs
+#include <stdlib.h>
+#include <string.h>
+#include "lanes.h"
+#include "machine.h"
+#include "flags.h"
+#include "acia.h"
+#include "iobase.h"
+#include "throttle.h"
+
+namespace portable
+{
+#include "laneops.h"
+}
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LANES_AVX2
+#pragma GCC push_options
+#pragma GCC target("avx2")
+namespace avx2
+{
+#include "laneops.h"
+}
+#pragma GCC pop_options
+#endif
+
+lanes::lanes(unsigned n)
+{
+  s.n=n;
+  for (unsigned i=0;i<8;i++) s.r[i]=(unsigned char *)calloc(n,1);
+  s.pc=(unsigned short *)calloc(n,sizeof(unsigned short));
+  s.sp=(unsigned short *)calloc(n,sizeof(unsigned short));
+  s.t=(unsigned long long *)calloc(n,sizeof(unsigned long long));
+  s.txdone=(unsigned long long *)calloc(n,sizeof(unsigned long long));
+  s.halted=(unsigned char *)calloc(n,1);
+  s.mem=(unsigned char *)calloc(n,0x10000);
+  s.in=(const char **)calloc(n,sizeof(const char *));
+  s.out=(char *)calloc(n,OUTMAX);
+  s.outlen=(unsigned *)calloc(n,sizeof(unsigned));
+  live=(unsigned *)malloc(n*sizeof(unsigned));
+  order=(unsigned *)malloc(n*sizeof(unsigned));
+  op=(unsigned char *)malloc(n);
+  for (unsigned i=0;i<n;i++) live[i]=i;
+  nlive=n;
+  vectored=scalar=0;
+  dense=portable::densetable;
+  sparse=portable::sparsetable;
+  isa="portable";
+#if defined(LANES_AVX2)
+  if (__builtin_cpu_supports("avx2"))
+    {
+      dense=avx2::densetable;
+      sparse=avx2::sparsetable;
+      isa="AVX2";
+    }
+#endif
+}
+
+lanes::~lanes()
+{
+  for (unsigned i=0;i<8;i++) free(s.r[i]);
+  free(s.pc);
+  free(s.sp);
+  free(s.t);
+  free(s.txdone);
+  free(s.halted);
+  free(s.mem);
+  free(s.in);
+  free(s.out);
+  free(s.outlen);
+  free(live);
+  free(order);
+  free(op);
+}
+
+void lanes::tocpu(unsigned lane, CPU &cpu)
+{
+  for (unsigned i=0;i<8;i++) cpu.regs[i]=s.r[i][lane];
+  cpu.lzop=CPU::LZ_NONE;
+  cpu.pc=s.pc[lane];
+  cpu.sp=s.sp[lane];
+  cpu.tstates=s.t[lane];
+  cpu.halted=s.halted[lane];
+  for (unsigned a=0;a<0x10000;a++) cpu.ram.write(a,memory(lane,a),0);
+}
+
+void lanes::fromcpu(unsigned lane, CPU &cpu)
+{
+  for (unsigned i=0;i<8;i++) s.r[i][lane]=cpu.regs[i];
+  s.r[CPU::F][lane]=cpu.getflags();
+  s.pc[lane]=cpu.pc;
+  s.sp[lane]=cpu.sp;
+  s.t[lane]=cpu.tstates;
+  s.txdone[lane]=0;
+  s.halted[lane]=cpu.halted;
+  for (unsigned a=0;a<0x10000;a++) memory(lane,a)=cpu.ram.read(a,0);
+  // put it back on the live list if it was off
+  if (!s.halted[lane])
+    {
+      unsigned i;
+      for (i=0;i<nlive;i++) if (live[i]==lane) break;
+      if (i==nlive) live[nlive++]=lane;
+    }
+}
+
+unsigned long long lanes::run(unsigned long long n)
+{
+  unsigned long long done=0;
+  unsigned count[256], start[256];
+  while (n-- && nlive)
+    {
+      // the usual case: everybody at the same place (then the
+      // opcodes are side by side) and on the same instruction
+      unsigned pc=s.pc[0], first=memory(0,pc), i=0;
+      if (nlive==s.n)
+	{
+	  const unsigned short *__restrict lpc=s.pc;
+	  const unsigned char *__restrict ops=s.mem+(size_t)pc*s.n;
+	  unsigned differ=0;
+	  for (i=0;i<nlive;i++) differ|=(lpc[i]^pc)|(ops[i]^first);
+	  if (!differ)
+	    {
+	      dense[first](s,NULL,nlive);
+	      vectored+=nlive;
+	      done+=nlive;
+	      if (first==0x76) nlive=0;
+	      continue;
+	    }
+	}
+      // otherwise sort the lanes by opcode and do each group
+      memset(count,0,sizeof(count));
+      for (i=0;i<nlive;i++) 
+	{
+	  unsigned l=live[i];
+	  op[i]=memory(l,s.pc[l]);
+	  count[op[i]]++;
+	}
+      unsigned at=0;
+      for (i=0;i<256;i++)
+	{
+	  start[i]=at;
+	  at+=count[i];
+	}
+      for (i=0;i<nlive;i++) order[start[op[i]]++]=live[i];
+      at=0;
+      for (i=0;i<256;i++)
+	if (count[i])
+	  {
+	    sparse[i](s,order+at,count[i]);
+	    at+=count[i];
+	  }
+      scalar+=nlive;
+      done+=nlive;
+      // take out the lanes that halted
+      if (count[0x76])
+	{
+	  unsigned k=0;
+	  for (i=0;i<nlive;i++) if (!s.halted[live[i]]) live[k++]=live[i];
+	  nlive=k;
+	}
+    }
+  return done;
+}
+
+// Stands in for the console so the interpreter's output can be compared
+class capture : public iobase
+{
+ public:
+  char buf[lanes::OUTMAX];
+  unsigned len;
+  capture(iostreams &set) : iobase(set,iobase::CONSOLE) { len=0; }
+  int getchar(void) { return -1; }
+  int ischar(void) { return 0; }
+  void putchar(int c) { if (len<sizeof(buf)) buf[len++]=c; }
+  void puts(const char *s) { while (*s) putchar(*s++); }
+};
+
+int lanes::report(Machine &m, unsigned n, unsigned long long instructions)
+{
+  CPU &cpu=m.cpu;
+  RAM &ram=m.ram;
+  cpu.engine=CPU::TABLE;
+  cpu.setmodel(I8080);
+  for (unsigned i=0;i<8;i++) cpu.regs[i]=0;
+  cpu.sp=0;
+  cpu.tstates=0;
+  lanes farm(n);
+  for (unsigned i=0;i<n;i++) farm.fromcpu(i,cpu);
+  double t0=throttle::now();
+  unsigned long long done=farm.run(instructions);
+  double lanetime=throttle::now()-t0;
+  // the same program on one machine with the table engine
+  iobase *console=m.io.get(iobase::CONSOLE);
+  capture *cap=new capture(m.io);
+  cpu.usecache(1,0);
+  unsigned long long single=0;
+  t0=throttle::now();
+  while (single<instructions && !cpu.halted)
+    {
+      cpu.exec();
+      single++;
+    }
+  double cputime=throttle::now()-t0;
+  // lane 0 against the interpreter
+  int same=cpu.pc==farm.s.pc[0] && cpu.sp==farm.s.sp[0] && cpu.tstates==farm.s.t[0] && cpu.getflags()==farm.s.r[CPU::F][0];
+  for (unsigned i=0;i<CPU::F;i++) if (cpu.regs[i]!=farm.s.r[i][0]) same=0;
+  for (unsigned a=0;a<0x10000;a++) if (ram.read(a,0)!=farm.memory(0,a)) same=0;
+  unsigned outlen;
+  const char *out=farm.output(0,&outlen);
+  if (outlen!=cap->len || memcmp(out,cap->buf,outlen)) same=0;
+  delete cap;
+  m.io.set(iobase::CONSOLE,console);
+  if (lanetime<=0) lanetime=1e-9;
+  if (cputime<=0) cputime=1e-9;
+  double lanemips=done/lanetime/1e6, cpumips=single/cputime/1e6;
+  m.io.printf(iobase::ERROROUT,"%u lanes x %llu instructions: %llu in %.3f s, %.1f MIPS (%.1f%% vectorized, %s)\n",
+		 n,instructions,done,lanetime,lanemips,done?100.0*farm.vectored/done:0.0,farm.isa);
+  m.io.printf(iobase::ERROROUT,"table engine: %llu in %.3f s, %.1f MIPS (lanes %.1fx)\n",
+		 single,cputime,cpumips,lanemips/cpumips);
+  m.io.printf(iobase::ERROROUT,"lane 0 %s the table engine\n",same?"matches":"DOES NOT MATCH");
+  return same?0:1;
+}
@@ -0,0 +1,97 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __LANES_H
+#define __LANES_H
+#include <stddef.h>
+
+class CPU;
+class Machine;
+
+// Multi-lane 8080 engine (-L on the command line)
+// Runs many independent machines side by side, one lane each.
+// The registers are stored a register at a time across all the
+// lanes (r[A] is every lane's A) and memory is done the same way
+// a byte at a time: address a of lane l is mem[a*n+l], so when the
+// lanes are all at one pc their opcodes and operands sit together.
+// Every round each lane does one instruction: when all the lanes
+// are on the same opcode one kernel does them all in a loop the
+// compiler vectorizes (with AVX2 where the host has it); otherwise
+// the lanes are sorted by opcode and each group runs the same
+// kernel through an index list. The kernels (laneops.h) follow 
+// the table engine's handlers and use the same flag rules.
+// The console port is modelled well enough for polled I/O (input
+// comes from a string, output goes to a buffer); there are no 
+// other devices and no interrupts, so EI and DI do nothing and HLT
+// stops the lane for good
+class lanes
+{
+ public:
+  // What the kernels work on
+  struct state
+  {
+    unsigned n;  // lanes
+    unsigned char *r[8];   // B C D E H L A F (CPU::regnames order)
+    unsigned short *pc, *sp;
+    unsigned long long *t;   // T states
+    unsigned long long *txdone;  // when the transmitter is free again
+    unsigned char *halted;
+    unsigned char *mem;   // 64K for each lane, interleaved
+    const char **in;   // console input left (NULL for none)
+    char *out;   // console output, OUTMAX per lane
+    unsigned *outlen;
+  };
+  enum { OUTMAX=4096 };
+  typedef void (*kernel)(state &s, const unsigned *idx, unsigned cnt);
+
+ protected:
+  state s;
+  unsigned *live;   // lanes still running
+  unsigned nlive;
+  unsigned *order;  // live sorted by opcode
+  unsigned char *op;
+  const kernel *dense, *sparse;
+ public:
+  lanes(unsigned n);
+  ~lanes();
+  unsigned count(void) { return s.n; }
+  unsigned char &memory(unsigned lane, unsigned a) { return s.mem[(size_t)a*s.n+lane]; }
+  void input(unsigned lane, const char *text) { s.in[lane]=text; }
+  const char *output(unsigned lane, unsigned *len) { *len=s.outlen[lane]; return s.out+(size_t)lane*OUTMAX; }
+  int halted(unsigned lane) { return s.halted[lane]; }
+  // copy a lane's registers, clock, and memory to or from a CPU 
+  // (so it can be checked against or handed to the interpreter)
+  void tocpu(unsigned lane, CPU &cpu);
+  void fromcpu(unsigned lane, CPU &cpu);
+  // every lane still running does up to n instructions; returns
+  // how many instructions that was in all
+  unsigned long long run(unsigned long long n);
+  unsigned long long vectored, scalar;   // instructions done each way
+  const char *isa;  // which kernels we picked
+  // -L: run the machine's memory on every lane for n instructions,
+  // time it, and check lane 0 against the machine's own CPU
+  static int report(Machine &m, unsigned n, unsigned long long instructions);
+};
+
+#endif
@@ -0,0 +1,5594 @@
+// Generated by altairaot from ../images/8kbas.bin -- do not edit
+#include "cpuops.h"
+
+static const unsigned char image[8192]=
+  {
+    0xF3,0xC3,0x0B,0x1A,0x38,0x07,0xE5,0x0D,0x7E,0xE3,0xBE,0x23,0xE3,0xC2,0xC6,0x02,
+    0x23,0x7E,0xFE,0x3A,0xD0,0xC3,0x53,0x06,0xF5,0x3A,0xD1,0x01,0xB7,0xC3,0x2D,0x05,
+    0x7C,0x92,0xC0,0x7D,0x93,0xC9,0x01,0x00,0x3A,0x56,0x02,0xB7,0xC2,0x69,0x14,0xC9,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0x0E,0x02,0x0D,0x0A,0x42,0x52,0x45,
+    0x41,0x4B,0x00,0x73,0x14,0x31,0x15,0x87,0x14,0x4D,0x07,0xC3,0x0D,0xFA,0x10,0xF1,
+    0x0D,0xFF,0x16,0xDC,0x17,0x1D,0x13,0x4B,0x17,0x76,0x18,0x7C,0x18,0xD9,0x18,0xEE,
+    0x18,0xF9,0x11,0x41,0x10,0x6F,0x0E,0xD2,0x10,0x50,0x10,0x61,0x10,0x71,0x10,0xA1,
+    0x10,0xAB,0x10,0xC5,0x4E,0x44,0xC6,0x4F,0x52,0xCE,0x45,0x58,0x54,0xC4,0x41,0x54,
+    0x41,0xC9,0x4E,0x50,0x55,0x54,0xC4,0x49,0x4D,0xD2,0x45,0x41,0x44,0xCC,0x45,0x54,
+    0xC7,0x4F,0x54,0x4F,0xD2,0x55,0x4E,0xC9,0x46,0xD2,0x45,0x53,0x54,0x4F,0x52,0x45,
+    0xC7,0x4F,0x53,0x55,0x42,0xD2,0x45,0x54,0x55,0x52,0x4E,0xD2,0x45,0x4D,0xD3,0x54,
+    0x4F,0x50,0xCF,0x55,0x54,0xCF,0x4E,0xCE,0x55,0x4C,0x4C,0xD7,0x41,0x49,0x54,0xC4,
+    0x45,0x46,0xD0,0x4F,0x4B,0x45,0xD0,0x52,0x49,0x4E,0x54,0xC3,0x4F,0x4E,0x54,0xCC,
+    0x49,0x53,0x54,0xC3,0x4C,0x45,0x41,0x52,0xC3,0x4C,0x4F,0x41,0x44,0xC3,0x53,0x41,
+    0x56,0x45,0xCE,0x45,0x57,0xD4,0x41,0x42,0x28,0xD4,0x4F,0xC6,0x4E,0xD3,0x50,0x43,
+    0x28,0xD4,0x48,0x45,0x4E,0xCE,0x4F,0x54,0xD3,0x54,0x45,0x50,0xAB,0xAD,0xAA,0xAF,
+    0xDE,0xC1,0x4E,0x44,0xCF,0x52,0xBE,0xBD,0xBC,0xD3,0x47,0x4E,0xC9,0x4E,0x54,0xC1,
+    0x42,0x53,0xD5,0x53,0x52,0xC6,0x52,0x45,0xC9,0x4E,0x50,0xD0,0x4F,0x53,0xD3,0x51,
+    0x52,0xD2,0x4E,0x44,0xCC,0x4F,0x47,0xC5,0x58,0x50,0xC3,0x4F,0x53,0xD3,0x49,0x4E,
+    0xD4,0x41,0x4E,0xC1,0x54,0x4E,0xD0,0x45,0x45,0x4B,0xCC,0x45,0x4E,0xD3,0x54,0x52,
+    0x24,0xD6,0x41,0x4C,0xC1,0x53,0x43,0xC3,0x48,0x52,0x24,0xCC,0x45,0x46,0x54,0x24,
+    0xD2,0x49,0x47,0x48,0x54,0x24,0xCD,0x49,0x44,0x24,0x80,0x81,0x06,0xB7,0x05,0x3A,
+    0x0A,0xFA,0x07,0x5E,0x09,0x3F,0x0C,0x88,0x09,0x11,0x08,0xB9,0x07,0x9C,0x07,0x7F,
+    0x08,0x5E,0x06,0xA8,0x07,0xD5,0x07,0xFC,0x07,0x7F,0x06,0x05,0x11,0x63,0x08,0xC0,
+    0x06,0x0B,0x11,0xF9,0x0D,0x00,0x12,0x9B,0x08,0xAD,0x06,0x6D,0x05,0x73,0x07,0x85,
+    0x11,0x59,0x11,0xB0,0x03,0x79,0xEB,0x15,0x79,0x1C,0x12,0x7C,0x59,0x13,0x7C,0xB7,
+    0x13,0x7F,0x08,0x17,0x50,0x9C,0x0B,0x46,0x9B,0x0B,0x4E,0x46,0x53,0x4E,0x52,0x47,
+    0x4F,0x44,0x46,0x43,0x4F,0x56,0x4F,0x4D,0x55,0x4C,0x42,0x53,0x44,0x44,0x2F,0x30,
+    0x49,0x44,0x54,0x4D,0x4F,0x53,0x4C,0x53,0x53,0x54,0x43,0x4E,0x55,0x46,0x4D,0x4F,
+    0x00,0x00,0x73,0x1C,0xFE,0xFF,0x10,0x1C,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0x05,
+    0x47,0x05,0x68,0x06,0x0C,0x06,0x7F,0x19,0xA8,0x19,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x20,0x45,0x52,0x52,0x4F,0x52,0x00,0x20,0x49,0x4E,0x20,
+    0x00,0x4F,0x4B,0x0D,0x0A,0x00,0x21,0x04,0x00,0x39,0x7E,0x23,0xFE,0x81,0xC0,0x4E,
+    0x23,0x46,0x23,0xE5,0x69,0x60,0x7A,0xB3,0xEB,0xCA,0x8E,0x02,0xEB,0xE7,0x01,0x0D,
+    0x00,0xE1,0xC8,0x09,0xC3,0x7A,0x02,0xCD,0xAF,0x02,0xC5,0xE3,0xC1,0xE7,0x7E,0x02,
+    0xC8,0x0B,0x2B,0xC3,0x9D,0x02,0xE5,0x2A,0x4F,0x02,0x06,0x00,0x09,0x09,0x3E,0xE5,
+    0x3E,0xD4,0x95,0x6F,0x3E,0xFF,0x9C,0x67,0x39,0xE1,0xD8,0x1E,0x0C,0xC3,0xD1,0x02,
+    0x2A,0x3E,0x02,0x22,0xD4,0x01,0x1E,0x02,0x01,0x1E,0x14,0x01,0x1E,0x00,0x01,0x1E,
+    0x12,0xCD,0xD5,0x03,0x32,0xD1,0x01,0xCD,0xE0,0x08,0x21,0xAA,0x01,0x57,0x3E,0x3F,
+    0xDF,0x19,0x7E,0xDF,0xD7,0xDF,0x21,0x65,0x02,0xCD,0xE3,0x0E,0x2A,0xD4,0x01,0x7C,
+    0xA5,0x3C,0xC4,0xFC,0x15,0x3E,0xC1,0xAF,0x32,0xD1,0x01,0xCD,0xE0,0x08,0x21,0x71,
+    0x02,0xCD,0x0B,0x1A,0x21,0xFF,0xFF,0x22,0xD4,0x01,0xCD,0xD4,0x04,0xDA,0x04,0x03,
+    0xAF,0x32,0x41,0x02,0xD7,0x3C,0x3D,0xCA,0x04,0x03,0xF5,0xCD,0x52,0x07,0xD5,0xCD,
+    0xF8,0x03,0x47,0xD1,0xF1,0xD2,0x30,0x06,0xD5,0xC5,0xD7,0xB7,0xF5,0xCD,0x92,0x03,
+    0xDA,0x39,0x03,0xF1,0xF5,0xCA,0xD0,0x07,0xB7,0xC5,0xD2,0x4E,0x03,0xEB,0x2A,0x4B,
+    0x02,0x1A,0x02,0x03,0x13,0xE7,0xC2,0x41,0x03,0x60,0x69,0x22,0x4B,0x02,0xD1,0xF1,
+    0xCA,0x75,0x03,0x2A,0x4B,0x02,0xE3,0xC1,0x09,0xE5,0xCD,0x97,0x02,0xE1,0x22,0x4B,
+    0x02,0xEB,0x74,0xD1,0x23,0x23,0x73,0x23,0x72,0x23,0x11,0xD9,0x01,0x1A,0x77,0x23,
+    0x13,0xB7,0xC2,0x6D,0x03,0xCD,0xBC,0x03,0x23,0xEB,0x62,0x6B,0x7E,0x23,0xB6,0xCA,
+    0x04,0x03,0x23,0x23,0x23,0xAF,0xBE,0x23,0xC2,0x86,0x03,0xEB,0x73,0x23,0x72,0xC3,
+    0x7A,0x03,0x2A,0xD6,0x01,0x44,0x4D,0x7E,0x23,0xB6,0x2B,0xC8,0x23,0x23,0x7E,0x23,
+    0x66,0x6F,0xE7,0x60,0x69,0x7E,0x23,0x66,0x6F,0x3F,0xC8,0x3F,0xD0,0xC3,0x95,0x03,
+    0xC0,0x2A,0xD6,0x01,0xAF,0x77,0x23,0x77,0x23,0x22,0x4B,0x02,0x2A,0xD6,0x01,0x2B,
+    0x22,0x43,0x02,0x2A,0x26,0x02,0x22,0x3A,0x02,0xCD,0x5E,0x06,0x2A,0x4B,0x02,0x22,
+    0x4D,0x02,0x22,0x4F,0x02,0xC1,0x2A,0xD2,0x01,0xF9,0x21,0x2A,0x02,0x22,0x28,0x02,
+    0xAF,0x6F,0x67,0x22,0x49,0x02,0x32,0x40,0x02,0xE5,0xC5,0x2A,0x43,0x02,0xC9,0x3E,
+    0x3F,0xDF,0x3E,0x20,0xDF,0xC3,0xD4,0x04,0xAF,0x32,0x25,0x02,0x0E,0x05,0x11,0xD9,
+    0x01,0x7E,0xFE,0x20,0xCA,0x7E,0x04,0x47,0xFE,0x22,0xCA,0x9E,0x04,0xB7,0xCA,0xA5,
+    0x04,0x3A,0x25,0x02,0xB7,0x7E,0xC2,0x7E,0x04,0xFE,0x3F,0x3E,0x96,0xCA,0x7E,0x04,
+    0x7E,0xFE,0x30,0xDA,0x2B,0x04,0xFE,0x3C,0xDA,0x7E,0x04,0xD5,0x11,0x72,0x00,0xC5,
+    0x01,0x7A,0x04,0xC5,0x06,0x7F,0x7E,0xFE,0x61,0xDA,0x44,0x04,0xFE,0x7B,0xD2,0x44,
+    0x04,0xE6,0x5F,0x77,0x4E,0xEB,0x23,0xB6,0xF2,0x46,0x04,0x04,0x7E,0xE6,0x7F,0xC8,
+    0xB9,0xC2,0x46,0x04,0xEB,0xE5,0x13,0x1A,0xB7,0xFA,0x76,0x04,0x4F,0x78,0xFE,0x88,
+    0xC2,0x65,0x04,0xD7,0x2B,0x23,0x7E,0xFE,0x61,0xDA,0x6E,0x04,0xE6,0x5F,0xB9,0xCA,
+    0x56,0x04,0xE1,0xC3,0x44,0x04,0x48,0xF1,0xEB,0xC9,0xEB,0x79,0xC1,0xD1,0x23,0x12,
+    0x13,0x0C,0xD6,0x3A,0xCA,0x8C,0x04,0xFE,0x49,0xC2,0x8F,0x04,0x32,0x25,0x02,0xD6,
+    0x54,0xC2,0x01,0x04,0x47,0x7E,0xB7,0xCA,0xA5,0x04,0xB8,0xCA,0x7E,0x04,0x23,0x12,
+    0x0C,0x13,0xC3,0x95,0x04,0x21,0xD8,0x01,0x12,0x13,0x12,0x13,0x12,0xC9,0x3A,0xD0,
+    0x01,0xB7,0x3E,0x5C,0x32,0xD0,0x01,0xC2,0xC0,0x04,0x05,0xCA,0xD4,0x04,0xDF,0x3E,
+    0x05,0x2B,0xCA,0xD0,0x04,0x7E,0xDF,0xC3,0xDD,0x04,0x05,0x2B,0xDF,0xC2,0xDD,0x04,
+    0xDF,0xCD,0xED,0x08,0x21,0xD9,0x01,0x06,0x01,0xAF,0x32,0xD0,0x01,0xCD,0x56,0x05,
+    0x4F,0xFE,0x7F,0xCA,0xAE,0x04,0x3A,0xD0,0x01,0xB7,0xCA,0xF4,0x04,0x3E,0x5C,0xDF,
+    0xAF,0x32,0xD0,0x01,0x79,0xFE,0x07,0xCA,0x1A,0x05,0xFE,0x03,0xCC,0xED,0x08,0x37,
+    0xC8,0xFE,0x0D,0xCA,0xE8,0x08,0xFE,0x15,0xCA,0xD0,0x04,0xFE,0x40,0xCA,0xD0,0x04,
+    0xFE,0x5F,0xCA,0xCA,0x04,0xFE,0x20,0xDA,0xDD,0x04,0x78,0xFE,0x48,0x3E,0x07,0xD2,
+    0x29,0x05,0x79,0x71,0x32,0x41,0x02,0x23,0x04,0xDF,0xC3,0xDD,0x04,0x3A,0xD1,0x01,
+    0xB7,0xC2,0x14,0x0F,0xF1,0xF5,0xFE,0x20,0xDA,0x47,0x05,0x3A,0x27,0x00,0xFE,0x48,
+    0xCC,0xED,0x08,0x3C,0x32,0x27,0x00,0xDB,0x00,0xE6,0xC8,0xC2,0x47,0x05,0xF1,0xD3,
+    0x01,0xF5,0xDB,0x13,0xF1,0xC9,0xDB,0x00,0xE6,0x01,0xC2,0x56,0x05,0xDB,0x01,0xE6,
+    0x7F,0xFE,0x0F,0xC0,0x3A,0xD1,0x01,0x2F,0x32,0xD1,0x01,0xAF,0xC9,0xCD,0x52,0x07,
+    0xC0,0xC1,0xCD,0x92,0x03,0xC5,0xE1,0x4E,0x23,0x46,0x23,0x78,0xB1,0xCA,0xF7,0x02,
+    0xCD,0x68,0x06,0xC5,0xCD,0xED,0x08,0x5E,0x23,0x56,0x23,0xE5,0xEB,0xCD,0x04,0x16,
+    0x3E,0x20,0xE1,0xDF,0x7E,0xB7,0x23,0xCA,0x76,0x05,0xF2,0x93,0x05,0xD6,0x7F,0x4F,
+    0x11,0x73,0x00,0x1A,0x13,0xB7,0xF2,0xA3,0x05,0x0D,0xC2,0xA3,0x05,0xDF,0x1A,0x13,
+    0xB7,0xF2,0xAD,0x05,0xC3,0x94,0x05,0x3E,0x64,0x32,0x40,0x02,0xCD,0x11,0x08,0xE3,
+    0xCD,0x76,0x02,0xD1,0xC2,0xC9,0x05,0x09,0xF9,0xEB,0x0E,0x08,0xCD,0xA6,0x02,0xE5,
+    0xCD,0xFA,0x07,0xE3,0xE5,0x2A,0xD4,0x01,0xE3,0xCD,0x86,0x0A,0xCF,0x9E,0xCD,0x83,
+    0x0A,0xE5,0xCD,0xAC,0x14,0xE1,0xC5,0xD5,0x01,0x00,0x81,0x51,0x5A,0x7E,0xFE,0xA3,
+    0x3E,0x01,0xC2,0xFF,0x05,0xD7,0xCD,0x83,0x0A,0xE5,0xCD,0xAC,0x14,0xEF,0xE1,0xC5,
+    0xD5,0xF5,0x33,0xE5,0x2A,0x43,0x02,0xE3,0x06,0x81,0xC5,0x33,0xDB,0x00,0xE6,0x01,
+    0xCC,0x6D,0x06,0x22,0x43,0x02,0x7E,0xFE,0x3A,0xCA,0x30,0x06,0xB7,0xC2,0xC6,0x02,
+    0x23,0x7E,0x23,0xB6,0xCA,0x89,0x06,0x23,0x5E,0x23,0x56,0xEB,0x22,0xD4,0x01,0xEB,
+    0xD7,0x11,0x0C,0x06,0xD5,0xC8,0xD6,0x80,0xDA,0x11,0x08,0xFE,0x1D,0xD2,0xC6,0x02,
+    0x07,0x4F,0x06,0x00,0xEB,0x21,0x5B,0x01,0x09,0x4E,0x23,0x46,0xC5,0xEB,0x23,0x7E,
+    0xFE,0x3A,0xD0,0xFE,0x20,0xCA,0x4E,0x06,0xFE,0x30,0x3F,0x3C,0x3D,0xC9,0xEB,0x2A,
+    0xD6,0x01,0x2B,0x22,0x51,0x02,0xEB,0xC9,0xDB,0x00,0xE6,0x01,0xC0,0xCD,0x56,0x05,
+    0xFE,0x03,0xCA,0x7F,0x06,0xFE,0x11,0xCA,0x68,0x06,0xFE,0x13,0xCA,0x6D,0x06,0xC0,
+    0xF6,0xC0,0x22,0x43,0x02,0x21,0xF6,0xFF,0xC1,0x2A,0xD4,0x01,0xF5,0x7D,0xA4,0x3C,
+    0xCA,0x9C,0x06,0x22,0x47,0x02,0x2A,0x43,0x02,0x22,0x49,0x02,0xAF,0x32,0xD1,0x01,
+    0xCD,0xE0,0x08,0xF1,0x21,0x3B,0x00,0xC2,0xE9,0x02,0xC3,0xF7,0x02,0x2A,0x49,0x02,
+    0x7C,0xB5,0x1E,0x20,0xCA,0xD1,0x02,0xEB,0x2A,0x47,0x02,0x22,0xD4,0x01,0xEB,0xC9,
+    0xCD,0x31,0x11,0xC0,0x3C,0xFE,0x48,0xD2,0x4D,0x07,0x32,0x26,0x00,0xC9,0x06,0xFF,
+    0xD7,0x78,0x32,0x43,0x02,0x3E,0x01,0x32,0x40,0x02,0xC3,0x44,0x0C,0x32,0x40,0x02,
+    0x44,0x4D,0x0B,0x0B,0x0B,0x0B,0x3A,0x43,0x02,0xB7,0xF5,0xEB,0x19,0xEB,0x4E,0x06,
+    0x00,0x09,0x09,0x23,0x06,0xD2,0xFA,0x03,0x07,0x78,0xCD,0x4A,0x11,0xCD,0x4A,0x11,
+    0xC3,0x10,0x07,0x0E,0x04,0xCD,0x40,0x11,0xB8,0xC2,0x03,0x07,0x0D,0xC2,0x05,0x07,
+    0xCD,0x86,0x0A,0xE7,0xCA,0x25,0x07,0xF1,0xF5,0x7E,0xF4,0x4D,0x11,0xFC,0x40,0x11,
+    0x77,0x23,0xC3,0x13,0x07,0xF1,0xE1,0xC9,0x7E,0xFE,0x41,0xD8,0xFE,0x5B,0x3F,0xC9,
+    0xD7,0xCD,0x83,0x0A,0xEF,0xFA,0x4D,0x07,0x3A,0x56,0x02,0xFE,0x90,0xDA,0x06,0x15,
+    0x01,0x80,0x90,0x11,0x00,0x00,0xE5,0xCD,0xDB,0x14,0xE1,0x51,0xC8,0x1E,0x08,0xC3,
+    0xD1,0x02,0x2B,0x11,0x00,0x00,0xD7,0xD0,0xE5,0xF5,0x21,0x98,0x19,0xE7,0xDA,0xC6,
+    0x02,0x62,0x6B,0x19,0x29,0x19,0x29,0xF1,0xD6,0x30,0x5F,0x16,0x00,0x19,0xEB,0xE1,
+    0xC3,0x56,0x07,0xCA,0xC0,0x03,0xCD,0x31,0x07,0x2B,0xD7,0xC0,0xE5,0x2A,0x26,0x02,
+    0x7D,0x93,0x5F,0x7C,0x9A,0x57,0xDA,0xBB,0x02,0x2A,0x4B,0x02,0x01,0x28,0x00,0x09,
+    0xE7,0xD2,0xBB,0x02,0xEB,0x22,0xD2,0x01,0xE1,0xC3,0xC0,0x03,0xCA,0xBC,0x03,0xCD,
+    0xC0,0x03,0x01,0x0C,0x06,0xC3,0xB8,0x07,0x0E,0x03,0xCD,0xA6,0x02,0xC1,0xE5,0xE5,
+    0x2A,0xD4,0x01,0xE3,0x3E,0x8C,0xF5,0x33,0xC5,0xCD,0x52,0x07,0xCD,0xFC,0x07,0xE5,
+    0x2A,0xD4,0x01,0xE7,0xE1,0x23,0xDC,0x95,0x03,0xD4,0x92,0x03,0x60,0x69,0x2B,0xD8,
+    0x1E,0x0E,0xC3,0xD1,0x02,0xC0,0x16,0xFF,0xCD,0x76,0x02,0xF9,0xFE,0x8C,0x1E,0x04,
+    0xC2,0xD1,0x02,0xE1,0x22,0xD4,0x01,0x23,0x7C,0xB5,0xC2,0xF4,0x07,0x3A,0x41,0x02,
+    0xB7,0xC2,0xF6,0x02,0x21,0x0C,0x06,0xE3,0x3E,0xE1,0x01,0x3A,0x0E,0x00,0x06,0x00,
+    0x79,0x48,0x47,0x7E,0xB7,0xC8,0xB8,0xC8,0x23,0xFE,0x22,0xCA,0x00,0x08,0xC3,0x03,
+    0x08,0xCD,0x44,0x0C,0xCF,0xAC,0xD5,0x3A,0x24,0x02,0xF5,0xCD,0x94,0x0A,0xF1,0xE3,
+    0x22,0x43,0x02,0x1F,0xCD,0x88,0x0A,0xCA,0x5C,0x08,0xE5,0x2A,0x53,0x02,0xE5,0x23,
+    0x23,0x5E,0x23,0x56,0x2A,0xD6,0x01,0xE7,0xD2,0x4B,0x08,0x2A,0xD2,0x01,0xE7,0xD1,
+    0xD2,0x53,0x08,0x2A,0x4B,0x02,0xE7,0xD2,0x53,0x08,0x3E,0xD1,0xCD,0x32,0x10,0xEB,
+    0xCD,0x7F,0x0E,0xCD,0x32,0x10,0xE1,0xCD,0xBB,0x14,0xE1,0xC9,0xE5,0xCD,0xB8,0x14,
+    0xD1,0xE1,0xC9,0xCD,0x31,0x11,0x7E,0x47,0xFE,0x8C,0xCA,0x70,0x08,0xCF,0x88,0x2B,
+    0x4B,0x0D,0x78,0xCA,0x36,0x06,0xCD,0x53,0x07,0xFE,0x2C,0xC0,0xC3,0x71,0x08,0xCD,
+    0x94,0x0A,0x7E,0xFE,0x88,0xCA,0x8A,0x08,0xCF,0xA1,0x2B,0xCD,0x86,0x0A,0xEF,0xCA,
+    0xFC,0x07,0xD7,0xDA,0xB9,0x07,0xC3,0x35,0x06,0x2B,0xD7,0xCA,0xED,0x08,0xC8,0xFE,
+    0x9D,0xCA,0x16,0x09,0xFE,0xA0,0xCA,0x16,0x09,0xE5,0xFE,0x2C,0xCA,0x02,0x09,0xFE,
+    0x3B,0xCA,0x35,0x09,0xC1,0xCD,0x94,0x0A,0xE5,0x3A,0x24,0x02,0xB7,0xC2,0xD9,0x08,
+    0xCD,0x0F,0x16,0xCD,0xA3,0x0E,0x2A,0x53,0x02,0x3A,0x27,0x00,0x86,0xFE,0x48,0xD4,
+    0xED,0x08,0xCD,0xE6,0x0E,0x3E,0x20,0xDF,0xAF,0xC4,0xE6,0x0E,0xE1,0xC3,0x99,0x08,
+    0x3A,0x27,0x00,0xB7,0xC8,0xC3,0xED,0x08,0x36,0x00,0x21,0xD8,0x01,0x3E,0x0D,0xDF,
+    0x3E,0x0A,0xDF,0x3A,0x26,0x00,0x3D,0x32,0x27,0x00,0xC8,0xF5,0xAF,0xDF,0xF1,0xC3,
+    0xF6,0x08,0x3A,0x27,0x00,0xFE,0x38,0xD4,0xED,0x08,0xD2,0x35,0x09,0xD6,0x0E,0xD2,
+    0x0D,0x09,0x2F,0xC3,0x2C,0x09,0xF5,0xCD,0x30,0x11,0xCF,0x29,0x2B,0xF1,0xD6,0xA0,
+    0xE5,0xCA,0x27,0x09,0x3A,0x27,0x00,0x2F,0x83,0xD2,0x35,0x09,0x3C,0x47,0x3E,0x20,
+    0xDF,0x05,0xC2,0x30,0x09,0xE1,0xD7,0xC3,0x9E,0x08,0x3F,0x52,0x45,0x44,0x4F,0x20,
+    0x46,0x52,0x4F,0x4D,0x20,0x53,0x54,0x41,0x52,0x54,0x0D,0x0A,0x00,0x3A,0x42,0x02,
+    0xB7,0xC2,0xC0,0x02,0xC1,0x21,0x3A,0x09,0xCD,0xE3,0x0E,0xC3,0xEB,0x03,0xFE,0x22,
+    0x3E,0x00,0x32,0xD1,0x01,0xC2,0x72,0x09,0xCD,0xA4,0x0E,0xCF,0x3B,0xE5,0xCD,0xE6,
+    0x0E,0x3E,0xE5,0xCD,0x52,0x0E,0xCD,0xEF,0x03,0xC1,0xDA,0x86,0x06,0x23,0x7E,0xB7,
+    0x2B,0xC5,0xCA,0xF9,0x07,0xC3,0x8D,0x09,0xE5,0x2A,0x51,0x02,0xF6,0xAF,0x32,0x42,
+    0x02,0xE3,0x01,0xCF,0x2C,0xCD,0x44,0x0C,0xE3,0xD5,0x7E,0xFE,0x2C,0xCA,0xBB,0x09,
+    0x3A,0x42,0x02,0xB7,0xC2,0x18,0x0A,0x3E,0x3F,0xDF,0xCD,0xEF,0x03,0xD1,0xC1,0xDA,
+    0x86,0x06,0x23,0x7E,0xB7,0x2B,0xC5,0xCA,0xF9,0x07,0xD5,0x3A,0x24,0x02,0xB7,0xCA,
+    0xDB,0x09,0xD7,0x57,0x47,0xFE,0x22,0xCA,0xCF,0x09,0x16,0x3A,0x06,0x2C,0x2B,0xCD,
+    0xA7,0x0E,0xEB,0x21,0xE4,0x09,0xE3,0xD5,0xC3,0x2A,0x08,0xD7,0xCD,0x65,0x15,0xE3,
+    0xCD,0xB8,0x14,0xE1,0x2B,0xD7,0xCA,0xEE,0x09,0xFE,0x2C,0xC2,0x4D,0x09,0xE3,0x2B,
+    0xD7,0xC2,0x93,0x09,0xD1,0x3A,0x42,0x02,0xB7,0xEB,0xC2,0x63,0x06,0xD5,0xB6,0x21,
+    0x07,0x0A,0xC4,0xE3,0x0E,0xE1,0xC9,0x3F,0x45,0x58,0x54,0x52,0x41,0x20,0x49,0x47,
+    0x4E,0x4F,0x52,0x45,0x44,0x0D,0x0A,0x00,0xCD,0xFA,0x07,0xB7,0xC2,0x31,0x0A,0x23,
+    0x7E,0x23,0xB6,0x1E,0x06,0xCA,0xD1,0x02,0x23,0x5E,0x23,0x56,0xEB,0x22,0x3E,0x02,
+    0xEB,0xD7,0xFE,0x83,0xC2,0x18,0x0A,0xC3,0xBB,0x09,0x11,0x00,0x00,0xC4,0x44,0x0C,
+    0x22,0x43,0x02,0xCD,0x76,0x02,0xC2,0xCC,0x02,0xF9,0xD5,0x7E,0x23,0xF5,0xD5,0xCD,
+    0x9E,0x14,0xE3,0xE5,0xCD,0x12,0x12,0xE1,0xCD,0xB8,0x14,0xE1,0xCD,0xAF,0x14,0xE5,
+    0xCD,0xDB,0x14,0xE1,0xC1,0x90,0xCD,0xAF,0x14,0xCA,0x75,0x0A,0xEB,0x22,0xD4,0x01,
+    0x69,0x60,0xC3,0x08,0x06,0xF9,0x2A,0x43,0x02,0x7E,0xFE,0x2C,0xC2,0x0C,0x06,0xD7,
+    0xCD,0x3D,0x0A,0xCD,0x94,0x0A,0xF6,0x37,0x3A,0x24,0x02,0x8F,0xE8,0x1E,0x18,0xC3,
+    0xD1,0x02,0xCF,0x28,0x2B,0x16,0x00,0xD5,0x0E,0x01,0xCD,0xA6,0x02,0xCD,0x09,0x0B,
+    0x22,0x45,0x02,0x2A,0x45,0x02,0xC1,0x78,0xFE,0x78,0xD4,0x86,0x0A,0x7E,0x16,0x00,
+    0xD6,0xAB,0xDA,0xCA,0x0A,0xFE,0x03,0xD2,0xCA,0x0A,0xFE,0x01,0x17,0xAA,0xBA,0x57,
+    0xDA,0xC6,0x02,0x22,0x3C,0x02,0xD7,0xC3,0xB0,0x0A,0x7A,0xB7,0xC2,0xC3,0x0B,0x7E,
+    0x22,0x3C,0x02,0xD6,0xA4,0xD8,0xFE,0x07,0xD0,0x5F,0x3A,0x24,0x02,0x3D,0xB3,0x7B,
+    0xCA,0xC9,0x0F,0x07,0x83,0x5F,0x21,0x95,0x01,0x19,0x78,0x56,0xBA,0xD0,0x23,0xCD,
+    0x86,0x0A,0xC5,0x01,0xA3,0x0A,0xC5,0x43,0x4A,0xCD,0x91,0x14,0x58,0x51,0x4E,0x23,
+    0x46,0x23,0xC5,0x2A,0x3C,0x02,0xC3,0x97,0x0A,0xAF,0x32,0x24,0x02,0xD7,0x1E,0x24,
+    0xCA,0xD1,0x02,0xDA,0x65,0x15,0xCD,0x28,0x07,0xD2,0x56,0x0B,0xFE,0xA4,0xCA,0x09,
+    0x0B,0xFE,0x2E,0xCA,0x65,0x15,0xFE,0xA5,0xCA,0x45,0x0B,0xFE,0x22,0xCA,0xA4,0x0E,
+    0xFE,0xA2,0xCA,0x23,0x0C,0xFE,0x9F,0xCA,0x16,0x0E,0xD6,0xAE,0xD2,0x67,0x0B,0xCD,
+    0x92,0x0A,0xCF,0x29,0xC9,0x16,0x7D,0xCD,0x97,0x0A,0x2A,0x45,0x02,0xE5,0xCD,0x89,
+    0x14,0xCD,0x86,0x0A,0xE1,0xC9,0xCD,0x44,0x0C,0xE5,0xEB,0x22,0x53,0x02,0x3A,0x24,
+    0x02,0xB7,0xCC,0x9E,0x14,0xE1,0xC9,0x06,0x00,0x07,0x4F,0xC5,0xD7,0x79,0xFE,0x29,
+    0xDA,0x8A,0x0B,0xCD,0x92,0x0A,0xCF,0x2C,0xCD,0x87,0x0A,0xEB,0x2A,0x53,0x02,0xE3,
+    0xE5,0xEB,0xCD,0x31,0x11,0xEB,0xE3,0xC3,0x92,0x0B,0xCD,0x3F,0x0B,0xE3,0x11,0x51,
+    0x0B,0xD5,0x01,0x43,0x00,0x09,0x4E,0x23,0x66,0x69,0xE9,0xF6,0xAF,0xF5,0xCD,0x86,
+    0x0A,0xCD,0x38,0x07,0xF1,0xEB,0xC1,0xE3,0xEB,0xCD,0xA1,0x14,0xF5,0xCD,0x38,0x07,
+    0xF1,0xC1,0x79,0x21,0xE4,0x0D,0xC2,0xBE,0x0B,0xA3,0x4F,0x78,0xA2,0xE9,0xB3,0x4F,
+    0x78,0xB2,0xE9,0x21,0xD5,0x0B,0x3A,0x24,0x02,0x1F,0x7A,0x17,0x5F,0x16,0x64,0x78,
+    0xBA,0xD0,0xC3,0xF2,0x0A,0xD7,0x0B,0x79,0xB7,0x1F,0xC1,0xD1,0xF5,0xCD,0x88,0x0A,
+    0x21,0x19,0x0C,0xE5,0xCA,0xDB,0x14,0xAF,0x32,0x24,0x02,0xD5,0xCD,0x16,0x10,0x7E,
+    0x23,0x23,0x4E,0x23,0x46,0xD1,0xC5,0xF5,0xCD,0x1A,0x10,0xCD,0xAF,0x14,0xF1,0x57,
+    0xE1,0x7B,0xB2,0xC8,0x7A,0xD6,0x01,0xD8,0xAF,0xBB,0x3C,0xD0,0x15,0x1D,0x0A,0xBE,
+    0x23,0x03,0xCA,0x01,0x0C,0x3F,0xC3,0x6F,0x14,0x3C,0x8F,0xC1,0xA0,0xC6,0xFF,0x9F,
+    0xC3,0x74,0x14,0x16,0x5A,0xCD,0x97,0x0A,0xCD,0x86,0x0A,0xCD,0x38,0x07,0x7B,0x2F,
+    0x4F,0x7A,0x2F,0xCD,0xE4,0x0D,0xC1,0xC3,0xA3,0x0A,0x2B,0xD7,0xC8,0xCF,0x2C,0x01,
+    0x3A,0x0C,0xC5,0xF6,0xAF,0x32,0x23,0x02,0x46,0xCD,0x28,0x07,0xDA,0xC6,0x02,0xAF,
+    0x4F,0x32,0x24,0x02,0xD7,0xDA,0x5E,0x0C,0xCD,0x28,0x07,0xDA,0x69,0x0C,0x4F,0xD7,
+    0xDA,0x5F,0x0C,0xCD,0x28,0x07,0xD2,0x5F,0x0C,0xD6,0x24,0xC2,0x76,0x0C,0x3C,0x32,
+    0x24,0x02,0x0F,0x81,0x4F,0xD7,0x3A,0x40,0x02,0x3D,0xCA,0x0D,0x0D,0xF2,0x86,0x0C,
+    0x7E,0xD6,0x28,0xCA,0xE7,0x0C,0xAF,0x32,0x40,0x02,0xE5,0x2A,0x4D,0x02,0xEB,0x2A,
+    0x4B,0x02,0xE7,0xCA,0xA9,0x0C,0x79,0x96,0x23,0xC2,0x9E,0x0C,0x78,0x96,0x23,0xCA,
+    0xD9,0x0C,0x23,0x23,0x23,0x23,0xC3,0x92,0x0C,0xE1,0xE3,0xD5,0x11,0x59,0x0B,0xE7,
+    0xD1,0xCA,0xDC,0x0C,0xE3,0xE5,0xC5,0x01,0x06,0x00,0x2A,0x4F,0x02,0xE5,0x09,0xC1,
+    0xE5,0xCD,0x97,0x02,0xE1,0x22,0x4F,0x02,0x60,0x69,0x22,0x4D,0x02,0x2B,0x36,0x00,
+    0xE7,0xC2,0xCD,0x0C,0xD1,0x73,0x23,0x72,0x23,0xEB,0xE1,0xC9,0x32,0x56,0x02,0x21,
+    0x70,0x02,0x22,0x53,0x02,0xE1,0xC9,0xE5,0x2A,0x23,0x02,0xE3,0x57,0xD5,0xC5,0xCD,
+    0x30,0x07,0xC1,0xF1,0xEB,0xE3,0xE5,0xEB,0x3C,0x57,0x7E,0xFE,0x2C,0xCA,0xED,0x0C,
+    0xCF,0x29,0x22,0x45,0x02,0xE1,0x22,0x23,0x02,0x1E,0x00,0xD5,0x11,0xE5,0xF5,0x2A,
+    0x4D,0x02,0x3E,0x19,0xEB,0x2A,0x4F,0x02,0xEB,0xE7,0xCA,0x41,0x0D,0x7E,0xB9,0x23,
+    0xC2,0x25,0x0D,0x7E,0xB8,0x23,0x5E,0x23,0x56,0x23,0xC2,0x13,0x0D,0x3A,0x23,0x02,
+    0xB7,0xC2,0xCF,0x02,0xF1,0xCA,0xDD,0x06,0x96,0xCA,0x9D,0x0D,0x1E,0x10,0xC3,0xD1,
+    0x02,0x11,0x04,0x00,0xF1,0xCA,0x4D,0x07,0x71,0x23,0x70,0x23,0x4F,0xCD,0xA6,0x02,
+    0x23,0x23,0x22,0x3C,0x02,0x71,0x23,0x3A,0x23,0x02,0x17,0x79,0x01,0x0B,0x00,0xD2,
+    0x64,0x0D,0xC1,0x03,0x71,0x23,0x70,0x23,0xF5,0xE5,0xCD,0x4A,0x15,0xEB,0xE1,0xF1,
+    0x3D,0xC2,0x5C,0x0D,0xF5,0x42,0x4B,0xEB,0x19,0xDA,0x3C,0x0D,0xCD,0xAF,0x02,0x22,
+    0x4F,0x02,0x2B,0x36,0x00,0xE7,0xC2,0x82,0x0D,0x03,0x57,0x2A,0x3C,0x02,0x5E,0xEB,
+    0x29,0x09,0xEB,0x2B,0x2B,0x73,0x23,0x72,0x23,0xF1,0xDA,0xBF,0x0D,0x47,0x4F,0x7E,
+    0x23,0x16,0xE1,0x5E,0x23,0x56,0x23,0xE3,0xF5,0xE7,0xD2,0x3C,0x0D,0xE5,0xCD,0x4A,
+    0x15,0xD1,0x19,0xF1,0x3D,0x44,0x4D,0xC2,0xA2,0x0D,0x29,0x29,0xC1,0x09,0xEB,0x2A,
+    0x45,0x02,0xC9,0x2A,0x4F,0x02,0xEB,0x21,0x00,0x00,0x39,0x3A,0x24,0x02,0xB7,0xCA,
+    0xDF,0x0D,0xCD,0x16,0x10,0xCD,0x22,0x0F,0x2A,0xD2,0x01,0xEB,0x2A,0x3A,0x02,0x7D,
+    0x93,0x4F,0x7C,0x9A,0x41,0x50,0x1E,0x00,0x21,0x24,0x02,0x73,0x06,0x90,0xC3,0x79,
+    0x14,0x3A,0x27,0x00,0x47,0xAF,0xC3,0xE5,0x0D,0xCD,0x60,0x0E,0xCD,0x52,0x0E,0x01,
+    0xFA,0x07,0xC5,0xD5,0xCF,0x28,0xCD,0x44,0x0C,0xCD,0x86,0x0A,0xCF,0x29,0xCF,0xAC,
+    0x44,0x4D,0xE3,0xC3,0x4C,0x0E,0xCD,0x60,0x0E,0xD5,0xCD,0x3F,0x0B,0xCD,0x86,0x0A,
+    0xE3,0x5E,0x23,0x56,0x23,0x7E,0x23,0x66,0x6F,0x4E,0x23,0x46,0x23,0xC5,0x4E,0x23,
+    0x46,0xC5,0x2B,0x2B,0x2B,0xE5,0xE7,0xD5,0x1E,0x22,0xCA,0xD1,0x02,0xCD,0xB8,0x14,
+    0xE1,0xCD,0x83,0x0A,0x2B,0xD7,0xC2,0xC6,0x02,0xE1,0xD1,0xC1,0x71,0x23,0x70,0xC3,
+    0x9D,0x0E,0xE5,0x2A,0xD4,0x01,0x23,0x7C,0xB5,0xE1,0xC0,0x1E,0x16,0xC3,0xD1,0x02,
+    0xCF,0x9F,0x3E,0x80,0x32,0x40,0x02,0xB6,0x47,0xCD,0x49,0x0C,0xC3,0x86,0x0A,0xCD,
+    0x86,0x0A,0xCD,0x0F,0x16,0xCD,0xA3,0x0E,0xCD,0x16,0x10,0x01,0x6D,0x10,0xC5,0x7E,
+    0x23,0x23,0xE5,0xCD,0xFA,0x0E,0xE1,0x4E,0x23,0x46,0xCD,0x97,0x0E,0xE5,0x6F,0xCD,
+    0x09,0x10,0xD1,0xC9,0xCD,0xFA,0x0E,0x21,0x36,0x02,0xE5,0x77,0x23,0x23,0x73,0x23,
+    0x72,0xE1,0xC9,0x2B,0x06,0x22,0x50,0xE5,0x0E,0xFF,0x23,0x7E,0x0C,0xB7,0xCA,0xB9,
+    0x0E,0xBA,0xCA,0xB9,0x0E,0xB8,0xC2,0xAA,0x0E,0xFE,0x22,0xCC,0x4E,0x06,0xE3,0x23,
+    0xEB,0x79,0xCD,0x97,0x0E,0x11,0x36,0x02,0x2A,0x28,0x02,0x22,0x53,0x02,0x3E,0x01,
+    0x32,0x24,0x02,0xCD,0xBB,0x14,0xE7,0x22,0x28,0x02,0xE1,0x7E,0xC0,0x1E,0x1E,0xC3,
+    0xD1,0x02,0x23,0xCD,0xA3,0x0E,0xCD,0x16,0x10,0xCD,0xAF,0x14,0x1C,0x1D,0xC8,0x0A,
+    0xDF,0xFE,0x0D,0xCC,0xF3,0x08,0x03,0xC3,0xED,0x0E,0xB7,0x0E,0xF1,0xF5,0x2A,0xD2,
+    0x01,0xEB,0x2A,0x3A,0x02,0x2F,0x4F,0x06,0xFF,0x09,0x23,0xE7,0xDA,0x16,0x0F,0x22,
+    0x3A,0x02,0x23,0xEB,0xF1,0xC9,0xF1,0x1E,0x1A,0xCA,0xD1,0x02,0xBF,0xF5,0x01,0xFC,
+    0x0E,0xC5,0x2A,0x26,0x02,0x22,0x3A,0x02,0x21,0x00,0x00,0xE5,0x2A,0xD2,0x01,0xE5,
+    0x21,0x2A,0x02,0xEB,0x2A,0x28,0x02,0xEB,0xE7,0x01,0x33,0x0F,0xC2,0x7F,0x0F,0x2A,
+    0x4B,0x02,0xEB,0x2A,0x4D,0x02,0xEB,0xE7,0xCA,0x56,0x0F,0x7E,0x23,0x23,0xB7,0xCD,
+    0x82,0x0F,0xC3,0x42,0x0F,0xC1,0xEB,0x2A,0x4F,0x02,0xEB,0xE7,0xCA,0xA4,0x0F,0xCD,
+    0xAF,0x14,0x7B,0xE5,0x09,0xB7,0xF2,0x55,0x0F,0x22,0x3C,0x02,0xE1,0x4E,0x06,0x00,
+    0x09,0x09,0x23,0xEB,0x2A,0x3C,0x02,0xEB,0xE7,0xCA,0x56,0x0F,0x01,0x73,0x0F,0xC5,
+    0xF6,0x80,0x7E,0x23,0x23,0x5E,0x23,0x56,0x23,0xF0,0xB7,0xC8,0x44,0x4D,0x2A,0x3A,
+    0x02,0xE7,0x60,0x69,0xD8,0xE1,0xE3,0xE7,0xE3,0xE5,0x60,0x69,0xD0,0xC1,0xF1,0xF1,
+    0xE5,0xD5,0xC5,0xC9,0xD1,0xE1,0x7D,0xB4,0xC8,0x2B,0x46,0x2B,0x4E,0xE5,0x2B,0x2B,
+    0x6E,0x26,0x00,0x09,0x50,0x59,0x2B,0x44,0x4D,0x2A,0x3A,0x02,0xCD,0x9A,0x02,0xE1,
+    0x71,0x23,0x70,0x69,0x60,0x2B,0xC3,0x25,0x0F,0xC5,0xE5,0x2A,0x53,0x02,0xE3,0xCD,
+    0x09,0x0B,0xE3,0xCD,0x87,0x0A,0x7E,0xE5,0x2A,0x53,0x02,0xE5,0x86,0x1E,0x1C,0xDA,
+    0xD1,0x02,0xCD,0x94,0x0E,0xD1,0xCD,0x1A,0x10,0xE3,0xCD,0x19,0x10,0xE5,0x2A,0x38,
+    0x02,0xEB,0xCD,0x00,0x10,0xCD,0x00,0x10,0x21,0xA6,0x0A,0xE3,0xE5,0xC3,0xC5,0x0E,
+    0xE1,0xE3,0x7E,0x23,0x23,0x4E,0x23,0x46,0x6F,0x2C,0x2D,0xC8,0x0A,0x12,0x03,0x13,
+    0xC3,0x0A,0x10,0xCD,0x87,0x0A,0x2A,0x53,0x02,0xEB,0xCD,0x32,0x10,0xEB,0xC0,0xD5,
+    0x50,0x59,0x1B,0x4E,0x2A,0x3A,0x02,0xE7,0xC2,0x30,0x10,0x47,0x09,0x22,0x3A,0x02,
+    0xE1,0xC9,0x2A,0x28,0x02,0x2B,0x46,0x2B,0x4E,0x2B,0x2B,0xE7,0xC0,0x22,0x28,0x02,
+    0xC9,0x01,0xF4,0x0D,0xC5,0xCD,0x13,0x10,0xAF,0x57,0x32,0x24,0x02,0x7E,0xB7,0xC9,
+    0x01,0xF4,0x0D,0xC5,0xCD,0x45,0x10,0xCA,0x4D,0x07,0x23,0x23,0x5E,0x23,0x56,0x1A,
+    0xC9,0x3E,0x01,0xCD,0x94,0x0E,0xCD,0x34,0x11,0x2A,0x38,0x02,0x73,0xC1,0xC3,0xC5,
+    0x0E,0xCD,0xED,0x10,0xAF,0xE3,0x4F,0xE5,0x7E,0xB8,0xDA,0x7F,0x10,0x78,0x11,0x0E,
+    0x00,0xC5,0xCD,0xFA,0x0E,0xC1,0xE1,0xE5,0x23,0x23,0x46,0x23,0x66,0x68,0x06,0x00,
+    0x09,0x44,0x4D,0xCD,0x97,0x0E,0x6F,0xCD,0x09,0x10,0xD1,0xCD,0x1A,0x10,0xC3,0xC5,
+    0x0E,0xCD,0xED,0x10,0xD1,0xD5,0x1A,0x90,0xC3,0x75,0x10,0xEB,0x7E,0xCD,0xF0,0x10,
+    0xC5,0x1E,0xFF,0xFE,0x29,0xCA,0xBD,0x10,0xCF,0x2C,0xCD,0x31,0x11,0xCF,0x29,0xF1,
+    0xE3,0x01,0x77,0x10,0xC5,0x3D,0xBE,0x06,0x00,0xD0,0x4F,0x7E,0x91,0xBB,0x47,0xD8,
+    0x43,0xC9,0xCD,0x45,0x10,0xCA,0x87,0x12,0x5F,0x23,0x23,0x7E,0x23,0x66,0x6F,0xE5,
+    0x19,0x46,0x72,0xE3,0xC5,0x7E,0xCD,0x65,0x15,0xC1,0xE1,0x70,0xC9,0xEB,0xCF,0x29,
+    0xC1,0xD1,0xC5,0x43,0x04,0x05,0xC0,0xC3,0x4D,0x07,0xCD,0x34,0x11,0x32,0x01,0x11,
+    0xDB,0x00,0xC3,0xF4,0x0D,0xCD,0x24,0x11,0xD3,0x00,0xC9,0xCD,0x24,0x11,0xF5,0x1E,
+    0x00,0x2B,0xD7,0xCA,0x1B,0x11,0xCF,0x2C,0xCD,0x31,0x11,0xC1,0xDB,0x00,0xAB,0xA0,
+    0xCA,0x1C,0x11,0xC9,0xCD,0x31,0x11,0x32,0x1D,0x11,0x32,0x09,0x11,0xCF,0x2C,0x06,
+    0xD7,0xCD,0x83,0x0A,0xCD,0x34,0x07,0x7A,0xB7,0xC2,0x4D,0x07,0x2B,0xD7,0x7B,0xC9,
+    0xDB,0x06,0xE6,0x01,0xC2,0x40,0x11,0xDB,0x07,0xC9,0xCD,0x4D,0x11,0xF5,0xDB,0x06,
+    0xE6,0x80,0xC2,0x4E,0x11,0xF1,0xD3,0x07,0xC9,0x06,0x01,0xFE,0xA6,0xCA,0xD0,0x06,
+    0xCD,0x94,0x0A,0xE5,0xCD,0x54,0x10,0x3E,0xD3,0xCD,0x4D,0x11,0xCD,0x4A,0x11,0x1A,
+    0xCD,0x4D,0x11,0x2A,0xD6,0x01,0xEB,0x2A,0x4B,0x02,0x1A,0x13,0xCD,0x4D,0x11,0xE7,
+    0xC2,0x7A,0x11,0xE1,0xC9,0xFE,0xA6,0xCA,0xCE,0x06,0xD6,0x96,0xCA,0x91,0x11,0xAF,
+    0x01,0x2F,0x23,0xF5,0xCD,0x94,0x0A,0xCD,0x54,0x10,0x1A,0x6F,0xF1,0xB7,0x67,0x22,
+    0x53,0x02,0xCC,0xB1,0x03,0x2A,0x53,0x02,0xEB,0x06,0x03,0xCD,0x40,0x11,0xD6,0xD3,
+    0xC2,0xA9,0x11,0x05,0xC2,0xAB,0x11,0xCD,0x40,0x11,0x93,0xC2,0xA9,0x11,0x2A,0xD6,
+    0x01,0x06,0x03,0xCD,0x40,0x11,0x5F,0x96,0xA2,0xC2,0xE6,0x11,0x73,0xCD,0xAF,0x02,
+    0x7E,0xB7,0x23,0xC2,0xC1,0x11,0x05,0xC2,0xC3,0x11,0x22,0x4B,0x02,0x21,0x71,0x02,
+    0xCD,0xE3,0x0E,0xC3,0x75,0x03,0x21,0xEF,0x11,0xCD,0xE3,0x0E,0xC3,0xF6,0x02,0x4E,
+    0x4F,0x20,0x47,0x4F,0x4F,0x44,0x0D,0x0A,0x00,0xCD,0x38,0x07,0x1A,0xC3,0xF4,0x0D,
+    0xCD,0x83,0x0A,0xCD,0x38,0x07,0xD5,0xCF,0x2C,0xCD,0x31,0x11,0xD1,0x12,0xC9,0x21,
+    0xE4,0x16,0xCD,0xAF,0x14,0xC3,0x21,0x12,0xCD,0xAF,0x14,0x21,0xC1,0xD1,0xCD,0x89,
+    0x14,0x78,0xB7,0xC8,0x3A,0x56,0x02,0xB7,0xCA,0xA1,0x14,0x90,0xD2,0x3B,0x12,0x2F,
+    0x3C,0xEB,0xCD,0x91,0x14,0xEB,0xCD,0xA1,0x14,0xC1,0xD1,0xFE,0x19,0xD0,0xF5,0xCD,
+    0xC6,0x14,0x67,0xF1,0xCD,0xE8,0x12,0xB4,0x21,0x53,0x02,0xF2,0x61,0x12,0xCD,0xC8,
+    0x12,0xD2,0xA7,0x12,0x23,0x34,0xCA,0xC3,0x12,0x2E,0x01,0xCD,0xFE,0x12,0xC3,0xA7,
+    0x12,0xAF,0x90,0x47,0x7E,0x9B,0x5F,0x23,0x7E,0x9A,0x57,0x23,0x7E,0x99,0x4F,0xDC,
+    0xD4,0x12,0x68,0x63,0xAF,0x47,0x79,0xB7,0xC2,0x94,0x12,0x4A,0x54,0x65,0x6F,0x78,
+    0xD6,0x08,0xFE,0xE0,0xC2,0x75,0x12,0xAF,0x32,0x56,0x02,0xC9,0x05,0x29,0x7A,0x17,
+    0x57,0x79,0x8F,0x4F,0xF2,0x8C,0x12,0x78,0x5C,0x45,0xB7,0xCA,0xA7,0x12,0x21,0x56,
+    0x02,0x86,0x77,0xD2,0x87,0x12,0xC8,0x78,0x21,0x56,0x02,0xB7,0xFC,0xB9,0x12,0x46,
+    0x23,0x7E,0xE6,0x80,0xA9,0x4F,0xC3,0xA1,0x14,0x1C,0xC0,0x14,0xC0,0x0C,0xC0,0x0E,
+    0x80,0x34,0xC0,0x1E,0x0A,0xC3,0xD1,0x02,0x7E,0x83,0x5F,0x23,0x7E,0x8A,0x57,0x23,
+    0x7E,0x89,0x4F,0xC9,0x21,0x57,0x02,0x7E,0x2F,0x77,0xAF,0x6F,0x90,0x47,0x7D,0x9B,
+    0x5F,0x7D,0x9A,0x57,0x7D,0x99,0x4F,0xC9,0x06,0x00,0xD6,0x08,0xDA,0xF7,0x12,0x43,
+    0x5A,0x51,0x0E,0x00,0xC3,0xEA,0x12,0xC6,0x09,0x6F,0xAF,0x2D,0xC8,0x79,0x1F,0x4F,
+    0x7A,0x1F,0x57,0x7B,0x1F,0x5F,0x78,0x1F,0x47,0xC3,0xFA,0x12,0x00,0x00,0x00,0x81,
+    0x03,0xAA,0x56,0x19,0x80,0xF1,0x22,0x76,0x80,0x45,0xAA,0x38,0x82,0xEF,0xEA,0x4D,
+    0x07,0x21,0x56,0x02,0x7E,0x01,0x35,0x80,0x11,0xF3,0x04,0x90,0xF5,0x70,0xD5,0xC5,
+    0xCD,0x21,0x12,0xC1,0xD1,0x04,0xCD,0xB9,0x13,0x21,0x0C,0x13,0xCD,0x18,0x12,0x21,
+    0x10,0x13,0xCD,0xAC,0x17,0x01,0x80,0x80,0x11,0x00,0x00,0xCD,0x21,0x12,0xF1,0xCD,
+    0xE5,0x15,0x01,0x31,0x80,0x11,0x18,0x72,0x21,0xC1,0xD1,0xEF,0xC8,0x2E,0x00,0xCD,
+    0x29,0x14,0x79,0x32,0x92,0x13,0xEB,0x22,0x8D,0x13,0x01,0x00,0x00,0x50,0x58,0x21,
+    0x72,0x12,0xE5,0x21,0x7B,0x13,0xE5,0xE5,0x21,0x53,0x02,0x7E,0x23,0xB7,0xCA,0xA6,
+    0x13,0xE5,0xEB,0x1E,0x08,0x1F,0x57,0x79,0xD2,0x93,0x13,0xD5,0x11,0x00,0x00,0x19,
+    0xD1,0xCE,0x00,0x1F,0x4F,0x7C,0x1F,0x67,0x7D,0x1F,0x6F,0x78,0x1F,0x47,0x1D,0x7A,
+    0xC2,0x85,0x13,0xEB,0xE1,0xC9,0x43,0x5A,0x51,0x4F,0xC9,0xCD,0x91,0x14,0x01,0x20,
+    0x84,0x11,0x00,0x00,0xCD,0xA1,0x14,0xC1,0xD1,0xEF,0xCA,0xC9,0x02,0x2E,0xFF,0xCD,
+    0x29,0x14,0x34,0x34,0x2B,0x7E,0x32,0xE8,0x13,0x2B,0x7E,0x32,0xE4,0x13,0x2B,0x7E,
+    0x32,0xE0,0x13,0x41,0xEB,0xAF,0x4F,0x57,0x5F,0x32,0xEB,0x13,0xE5,0xC5,0x7D,0xD6,
+    0x00,0x6F,0x7C,0xDE,0x00,0x67,0x78,0xDE,0x00,0x47,0x3E,0x00,0xDE,0x00,0x3F,0xD2,
+    0xF9,0x13,0x32,0xEB,0x13,0xF1,0xF1,0x37,0xD2,0xC1,0xE1,0x79,0x3C,0x3D,0x1F,0xFA,
+    0xA8,0x12,0x17,0x7B,0x17,0x5F,0x7A,0x17,0x57,0x79,0x17,0x4F,0x29,0x78,0x17,0x47,
+    0x3A,0xEB,0x13,0x17,0x32,0xEB,0x13,0x79,0xB2,0xB3,0xC2,0xDC,0x13,0xE5,0x21,0x56,
+    0x02,0x35,0xE1,0xC2,0xDC,0x13,0xC3,0xC3,0x12,0x78,0xB7,0xCA,0x4B,0x14,0x7D,0x21,
+    0x56,0x02,0xAE,0x80,0x47,0x1F,0xA8,0x78,0xF2,0x4A,0x14,0xC6,0x80,0x77,0xCA,0xA4,
+    0x13,0xCD,0xC6,0x14,0x77,0x2B,0xC9,0xEF,0x2F,0xE1,0xB7,0xE1,0xF2,0x87,0x12,0xC3,
+    0xC3,0x12,0xCD,0xAC,0x14,0x78,0xB7,0xC8,0xC6,0x02,0xDA,0xC3,0x12,0x47,0xCD,0x21,
+    0x12,0x21,0x56,0x02,0x34,0xC0,0xC3,0xC3,0x12,0x3A,0x55,0x02,0xFE,0x2F,0x17,0x9F,
+    0xC0,0x3C,0xC9,0xEF,0x06,0x88,0x11,0x00,0x00,0x21,0x56,0x02,0x4F,0x70,0x06,0x00,
+    0x23,0x36,0x80,0x17,0xC3,0x6F,0x12,0xEF,0xF0,0x21,0x55,0x02,0x7E,0xEE,0x80,0x77,
+    0xC9,0xEB,0x2A,0x53,0x02,0xE3,0xE5,0x2A,0x55,0x02,0xE3,0xE5,0xEB,0xC9,0xCD,0xAF,
+    0x14,0xEB,0x22,0x53,0x02,0x60,0x69,0x22,0x55,0x02,0xEB,0xC9,0x21,0x53,0x02,0x5E,
+    0x23,0x56,0x23,0x4E,0x23,0x46,0x23,0xC9,0x11,0x53,0x02,0x06,0x04,0x1A,0x77,0x13,
+    0x23,0x05,0xC2,0xBD,0x14,0xC9,0x21,0x55,0x02,0x7E,0x07,0x37,0x1F,0x77,0x3F,0x1F,
+    0x23,0x23,0x77,0x79,0x07,0x37,0x1F,0x4F,0x1F,0xAE,0xC9,0x78,0xB7,0xCA,0x28,0x00,
+    0x21,0x6D,0x14,0xE5,0xEF,0x79,0xC8,0x21,0x55,0x02,0xAE,0x79,0xF8,0xCD,0xF3,0x14,
+    0x1F,0xA9,0xC9,0x23,0x78,0xBE,0xC0,0x2B,0x79,0xBE,0xC0,0x2B,0x7A,0xBE,0xC0,0x2B,
+    0x7B,0x96,0xC0,0xE1,0xE1,0xC9,0x47,0x4F,0x57,0x5F,0xB7,0xC8,0xE5,0xCD,0xAC,0x14,
+    0xCD,0xC6,0x14,0xAE,0x67,0xFC,0x2A,0x15,0x3E,0x98,0x90,0xCD,0xE8,0x12,0x7C,0x17,
+    0xDC,0xB9,0x12,0x06,0x00,0xDC,0xD4,0x12,0xE1,0xC9,0x1B,0x7A,0xA3,0x3C,0xC0,0x0B,
+    0xC9,0x21,0x56,0x02,0x7E,0xFE,0x98,0x3A,0x53,0x02,0xD0,0x7E,0xCD,0x06,0x15,0x36,
+    0x98,0x7B,0xF5,0x79,0x17,0xCD,0x6F,0x12,0xF1,0xC9,0x21,0x00,0x00,0x78,0xB1,0xC8,
+    0x3E,0x10,0x29,0xDA,0x3C,0x0D,0xEB,0x29,0xEB,0xD2,0x60,0x15,0x09,0xDA,0x3C,0x0D,
+    0x3D,0xC2,0x52,0x15,0xC9,0xFE,0x2D,0xF5,0xCA,0x71,0x15,0xFE,0x2B,0xCA,0x71,0x15,
+    0x2B,0xCD,0x87,0x12,0x47,0x57,0x5F,0x2F,0x4F,0xD7,0xDA,0xCE,0x15,0xFE,0x2E,0xCA,
+    0xA9,0x15,0xFE,0x45,0xC2,0xAD,0x15,0xD7,0xE5,0x21,0x9D,0x15,0xE3,0x15,0xFE,0xA5,
+    0xC8,0xFE,0x2D,0xC8,0x14,0xFE,0x2B,0xC8,0xFE,0xA4,0xC8,0xF1,0x2B,0xD7,0xDA,0xF0,
+    0x15,0x14,0xC2,0xAD,0x15,0xAF,0x93,0x5F,0x0C,0x0C,0xCA,0x79,0x15,0xE5,0x7B,0x90,
+    0xF4,0xC6,0x15,0xF2,0xBC,0x15,0xF5,0xCD,0xAB,0x13,0xF1,0x3C,0xC2,0xB0,0x15,0xD1,
+    0xF1,0xCC,0x89,0x14,0xEB,0xC9,0xC8,0xF5,0xCD,0x52,0x14,0xF1,0x3D,0xC9,0xD5,0x57,
+    0x78,0x89,0x47,0xC5,0xE5,0xD5,0xCD,0x52,0x14,0xF1,0xD6,0x30,0xCD,0xE5,0x15,0xE1,
+    0xC1,0xD1,0xC3,0x79,0x15,0xCD,0x91,0x14,0xCD,0x74,0x14,0xC1,0xD1,0xC3,0x21,0x12,
+    0x7B,0x07,0x07,0x83,0x07,0x86,0xD6,0x30,0x5F,0xC3,0x9D,0x15,0xE5,0x21,0x6C,0x02,
+    0xCD,0xE3,0x0E,0xE1,0xEB,0xAF,0x06,0x98,0xCD,0x79,0x14,0x21,0xE2,0x0E,0xE5,0x21,
+    0x58,0x02,0xE5,0xEF,0x36,0x20,0xF2,0x1B,0x16,0x36,0x2D,0x23,0x36,0x30,0xCA,0xD0,
+    0x16,0xE5,0xFC,0x89,0x14,0xAF,0xF5,0xCD,0xD6,0x16,0x01,0x43,0x91,0x11,0xF8,0x4F,
+    0xCD,0xDB,0x14,0xE2,0x47,0x16,0xF1,0xCD,0xC7,0x15,0xF5,0xC3,0x2A,0x16,0xCD,0xAB,
+    0x13,0xF1,0x3C,0xF5,0xCD,0xD6,0x16,0xCD,0x0F,0x12,0x3C,0xCD,0x06,0x15,0xCD,0xA1,
+    0x14,0x01,0x06,0x03,0xF1,0x81,0x3C,0xFA,0x63,0x16,0xFE,0x08,0xD2,0x63,0x16,0x3C,
+    0x47,0x3E,0x02,0x3D,0x3D,0xE1,0xF5,0x11,0xE8,0x16,0x05,0xC2,0x74,0x16,0x36,0x2E,
+    0x23,0x36,0x30,0x23,0x05,0x36,0x2E,0xCC,0xB6,0x14,0xC5,0xE5,0xD5,0xCD,0xAC,0x14,
+    0xE1,0x06,0x2F,0x04,0x7B,0x96,0x5F,0x23,0x7A,0x9E,0x57,0x23,0x79,0x9E,0x4F,0x2B,
+    0x2B,0xD2,0x83,0x16,0xCD,0xC8,0x12,0x23,0xCD,0xA1,0x14,0xEB,0xE1,0x70,0x23,0xC1,
+    0x0D,0xC2,0x74,0x16,0x05,0xCA,0xB4,0x16,0x2B,0x7E,0xFE,0x30,0xCA,0xA8,0x16,0xFE,
+    0x2E,0xC4,0xB6,0x14,0xF1,0xCA,0xD3,0x16,0x36,0x45,0x23,0x36,0x2B,0xF2,0xC4,0x16,
+    0x36,0x2D,0x2F,0x3C,0x06,0x2F,0x04,0xD6,0x0A,0xD2,0xC6,0x16,0xC6,0x3A,0x23,0x70,
+    0x23,0x77,0x23,0x71,0xE1,0xC9,0x01,0x74,0x94,0x11,0xF7,0x23,0xCD,0xDB,0x14,0xE1,
+    0xE2,0x3E,0x16,0xE9,0x00,0x00,0x00,0x80,0xA0,0x86,0x01,0x10,0x27,0x00,0xE8,0x03,
+    0x00,0x64,0x00,0x00,0x0A,0x00,0x00,0x01,0x00,0x00,0x21,0x89,0x14,0xE3,0xE9,0xCD,
+    0x91,0x14,0x21,0xE4,0x16,0xCD,0x9E,0x14,0xC1,0xD1,0xEF,0x78,0xCA,0x4B,0x17,0xF2,
+    0x16,0x17,0xB7,0xCA,0xC9,0x02,0xB7,0xCA,0x88,0x12,0xD5,0xC5,0x79,0xF6,0x7F,0xCD,
+    0xAC,0x14,0xF2,0x33,0x17,0xD5,0xC5,0xCD,0x31,0x15,0xC1,0xD1,0xF5,0xCD,0xDB,0x14,
+    0xE1,0x7C,0x1F,0xE1,0x22,0x55,0x02,0xE1,0x22,0x53,0x02,0xDC,0xFA,0x16,0xCC,0x89,
+    0x14,0xD5,0xC5,0xCD,0x1D,0x13,0xC1,0xD1,0xCD,0x5B,0x13,0xCD,0x91,0x14,0x01,0x38,
+    0x81,0x11,0x3B,0xAA,0xCD,0x5B,0x13,0x3A,0x56,0x02,0xFE,0x88,0xD2,0x47,0x14,0xCD,
+    0x31,0x15,0xC6,0x80,0xC6,0x02,0xDA,0x47,0x14,0xF5,0x21,0x0C,0x13,0xCD,0x12,0x12,
+    0xCD,0x52,0x13,0xF1,0xC1,0xD1,0xF5,0xCD,0x1E,0x12,0xCD,0x89,0x14,0x21,0x8B,0x17,
+    0xCD,0xBB,0x17,0x11,0x00,0x00,0xC1,0x4A,0xC3,0x5B,0x13,0x08,0x40,0x2E,0x94,0x74,
+    0x70,0x4F,0x2E,0x77,0x6E,0x02,0x88,0x7A,0xE6,0xA0,0x2A,0x7C,0x50,0xAA,0xAA,0x7E,
+    0xFF,0xFF,0x7F,0x7F,0x00,0x00,0x80,0x81,0x00,0x00,0x00,0x81,0xCD,0x91,0x14,0x11,
+    0x59,0x13,0xD5,0xE5,0xCD,0xAC,0x14,0xCD,0x5B,0x13,0xE1,0xCD,0x91,0x14,0x7E,0x23,
+    0xCD,0x9E,0x14,0x06,0xF1,0xC1,0xD1,0x3D,0xC8,0xD5,0xC5,0xF5,0xE5,0xCD,0x5B,0x13,
+    0xE1,0xCD,0xAF,0x14,0xE5,0xCD,0x21,0x12,0xE1,0xC3,0xC4,0x17,0xEF,0x21,0x45,0x18,
+    0xFA,0x3B,0x18,0x21,0x66,0x18,0xCD,0x9E,0x14,0x21,0x45,0x18,0xC8,0x86,0xE6,0x07,
+    0x06,0x00,0x77,0x23,0x87,0x87,0x4F,0x09,0xCD,0xAF,0x14,0xCD,0x5B,0x13,0x3A,0x44,
+    0x18,0x3C,0xE6,0x03,0x06,0x00,0xFE,0x01,0x88,0x32,0x44,0x18,0x21,0x66,0x18,0x87,
+    0x87,0x4F,0x09,0xCD,0x12,0x12,0xCD,0xAC,0x14,0x7B,0x59,0xEE,0x4F,0x4F,0x36,0x80,
+    0x2B,0x46,0x36,0x80,0x21,0x43,0x18,0x34,0x7E,0xD6,0xAB,0xC2,0x32,0x18,0x77,0x0C,
+    0x15,0x1C,0xCD,0x72,0x12,0x21,0x66,0x18,0xC3,0xB8,0x14,0x77,0x2B,0x77,0x2B,0x77,
+    0xC3,0x16,0x18,0x00,0x00,0x00,0x35,0x4A,0xCA,0x99,0x39,0x1C,0x76,0x98,0x22,0x95,
+    0xB3,0x98,0x0A,0xDD,0x47,0x98,0x53,0xD1,0x99,0x99,0x0A,0x1A,0x9F,0x98,0x65,0xBC,
+    0xCD,0x98,0xD6,0x77,0x3E,0x98,0x52,0xC7,0x4F,0x80,0x68,0xB1,0x46,0x68,0x99,0xE9,
+    0x92,0x69,0x10,0xD1,0x75,0x68,0x21,0xBC,0x18,0xCD,0x12,0x12,0xCD,0x91,0x14,0x01,
+    0x49,0x83,0x11,0xDB,0x0F,0xCD,0xA1,0x14,0xC1,0xD1,0xCD,0xB9,0x13,0xCD,0x91,0x14,
+    0xCD,0x31,0x15,0xC1,0xD1,0xCD,0x1E,0x12,0x21,0xC0,0x18,0xCD,0x18,0x12,0xEF,0x37,
+    0xF2,0xA8,0x18,0xCD,0x0F,0x12,0xEF,0xB7,0xF5,0xF4,0x89,0x14,0x21,0xC0,0x18,0xCD,
+    0x12,0x12,0xF1,0xD4,0x89,0x14,0x21,0xC4,0x18,0xC3,0xAC,0x17,0xDB,0x0F,0x49,0x81,
+    0x00,0x00,0x00,0x7F,0x05,0xBA,0xD7,0x1E,0x86,0x64,0x26,0x99,0x87,0x58,0x34,0x23,
+    0x87,0xE0,0x5D,0xA5,0x86,0xDA,0x0F,0x49,0x83,0xCD,0x91,0x14,0xCD,0x7C,0x18,0xC1,
+    0xE1,0xCD,0x91,0x14,0xEB,0xCD,0xA1,0x14,0xCD,0x76,0x18,0xC3,0xB7,0x13,0xEF,0xFC,
+    0xFA,0x16,0xFC,0x89,0x14,0x3A,0x56,0x02,0xFE,0x81,0xDA,0x09,0x19,0x01,0x00,0x81,
+    0x51,0x59,0xCD,0xB9,0x13,0x21,0x18,0x12,0xE5,0x21,0x13,0x19,0xCD,0xAC,0x17,0x21,
+    0xBC,0x18,0xC9,0x09,0x4A,0xD7,0x3B,0x78,0x02,0x6E,0x84,0x7B,0xFE,0xC1,0x2F,0x7C,
+    0x74,0x31,0x9A,0x7D,0x84,0x3D,0x5A,0x7D,0xC8,0x7F,0x91,0x7E,0xE4,0xBB,0x4C,0x7E,
+    0x6C,0xAA,0xAA,0x7F,0x00,0x00,0x00,0x81,0x00,0x00,0xDB,0xFF,0xE6,0xF0,0x0F,0x0F,
+    0xFE,0x3C,0xC8,0xFE,0x38,0x37,0xC2,0x53,0x19,0x21,0xFF,0x1F,0x4E,0x2B,0x7E,0xE6,
+    0xF0,0x0F,0x0F,0xF5,0x6F,0x26,0x00,0x11,0xB8,0x19,0x19,0x7E,0x23,0x56,0x23,0x46,
+    0x23,0x5E,0x67,0xF1,0xF5,0x7C,0xDA,0x6A,0x19,0x79,0x32,0xB6,0x19,0xF1,0x21,0xD4,
+    0x19,0xE5,0x0E,0xFF,0xFE,0x10,0x21,0x00,0x00,0x22,0x52,0x05,0xCA,0x8E,0x19,0xFE,
+    0x08,0xD0,0xC6,0x11,0xF5,0x3E,0x03,0xCD,0xB5,0x19,0xF1,0xC3,0xB5,0x19,0xAF,0xCD,
+    0xB5,0x19,0xCD,0xB1,0x19,0xCD,0xB1,0x19,0x2F,0x0E,0x01,0xCD,0xB1,0x19,0xE5,0x2A,
+    0xB5,0x19,0x2E,0xDB,0x22,0x52,0x05,0xE1,0x3E,0x2C,0x35,0xCD,0xB5,0x19,0x35,0x35,
+    0x35,0x21,0xB6,0x19,0x34,0xD3,0x10,0xC9,0x10,0xCA,0x01,0x02,0x10,0xCA,0x01,0x02,
+    0x00,0xC2,0x01,0x80,0x06,0xC2,0x01,0x80,0x20,0xCA,0x80,0x80,0x04,0xCA,0x02,0x01,
+    0x24,0xCA,0x40,0x40,0x62,0x68,0x22,0x59,0x05,0x7C,0xE6,0xC8,0x67,0x22,0x6B,0x06,
+    0xEE,0x0C,0x67,0x22,0x0F,0x06,0xEB,0x22,0x4A,0x05,0x3A,0xB6,0x19,0x32,0x57,0x05,
+    0x32,0x69,0x06,0x32,0x0D,0x06,0x3C,0x32,0x5E,0x05,0x81,0x32,0x48,0x05,0x3C,0x32,
+    0x50,0x05,0xC9,0x00,0x00,0x21,0x30,0x1B,0xCD,0xE3,0x0E,0x21,0x0F,0x1C,0xF9,0x22,
+    0xD2,0x01,0xCD,0x3A,0x19,0x21,0xFF,0xFF,0x22,0xD4,0x01,0xAF,0x32,0xD1,0x01,0xCD,
+    0xED,0x08,0x21,0x2A,0x02,0x22,0x28,0x02,0x21,0x68,0x1B,0xCD,0xE3,0x0E,0xCD,0xEF,
+    0x03,0xDA,0x28,0x1A,0xD7,0xFE,0x41,0xCA,0x05,0x1A,0xB7,0xC2,0x51,0x1A,0x21,0xC9,
+    0x1B,0x23,0x7C,0xB5,0xCA,0x5D,0x1A,0x7E,0x2F,0x77,0xBE,0xCA,0x41,0x1A,0xC3,0x5D,
+    0x1A,0x21,0xD9,0x01,0xCD,0x52,0x07,0x7E,0xB7,0xC2,0xC6,0x02,0xEB,0x2B,0xE5,0x21,
+    0x59,0x1B,0xCD,0xE3,0x0E,0xCD,0xEF,0x03,0xDA,0x5F,0x1A,0xD7,0xB7,0x3E,0x48,0x5F,
+    0xCA,0x81,0x1A,0xCD,0x52,0x07,0x7A,0xB7,0xC2,0x5F,0x1A,0x7B,0xFE,0x0F,0xDA,0x5F,
+    0x1A,0x32,0x3F,0x05,0x32,0xC6,0x06,0x32,0xCE,0x08,0xD6,0x0E,0xD2,0x8A,0x1A,0xC6,
+    0x1C,0x2F,0x3C,0x83,0x32,0x06,0x09,0x11,0xCF,0xFF,0xE1,0x22,0x26,0x02,0x19,0xD2,
+    0xBB,0x02,0x2B,0xE5,0x21,0x1B,0x1B,0xCD,0xE3,0x0E,0xCD,0xEF,0x03,0xDA,0xA4,0x1A,
+    0xD7,0x21,0x4D,0x07,0xFE,0x59,0x11,0x38,0x19,0xCA,0xDD,0x1A,0xFE,0x41,0xCA,0xC6,
+    0x1A,0xFE,0x4E,0xC2,0xA4,0x1A,0x11,0xEE,0x18,0x22,0x5F,0x00,0xFE,0x41,0xCA,0xDD,
+    0x1A,0x22,0x59,0x00,0x22,0x5D,0x00,0x22,0x5B,0x00,0x11,0x76,0x18,0xEB,0x36,0x00,
+    0x23,0x22,0xD6,0x01,0xE3,0x11,0x0F,0x1C,0xE7,0xDA,0xBB,0x02,0xD1,0xF9,0x22,0xD2,
+    0x01,0xEB,0xCD,0xAF,0x02,0x7B,0x95,0x6F,0x7A,0x9C,0x67,0x01,0xF0,0xFF,0x09,0xCD,
+    0xED,0x08,0xCD,0x04,0x16,0x21,0x74,0x1B,0xCD,0xE3,0x0E,0x21,0xE3,0x0E,0x22,0x02,
+    0x03,0xCD,0xB1,0x03,0x21,0xF7,0x02,0x22,0x02,0x00,0xE9,0x57,0x41,0x4E,0x54,0x20,
+    0x53,0x49,0x4E,0x2D,0x43,0x4F,0x53,0x2D,0x54,0x41,0x4E,0x2D,0x41,0x54,0x4E,0x00,
+    0x0D,0x0A,0x0A,0x57,0x52,0x49,0x54,0x54,0x45,0x4E,0x20,0x46,0x4F,0x52,0x20,0x52,
+    0x4F,0x59,0x41,0x4C,0x54,0x49,0x45,0x53,0x20,0x42,0x59,0x20,0x4D,0x49,0x43,0x52,
+    0x4F,0x2D,0x53,0x4F,0x46,0x54,0x0D,0x0A,0x00,0x54,0x45,0x52,0x4D,0x49,0x4E,0x41,
+    0x4C,0x20,0x57,0x49,0x44,0x54,0x48,0x00,0x4D,0x45,0x4D,0x4F,0x52,0x59,0x20,0x53,
+    0x49,0x5A,0x45,0x00,0x20,0x42,0x59,0x54,0x45,0x53,0x20,0x46,0x52,0x45,0x45,0x0D,
+    0x0A,0x41,0x4C,0x54,0x41,0x49,0x52,0x20,0x42,0x41,0x53,0x49,0x43,0x20,0x52,0x45,
+    0x56,0x2E,0x20,0x34,0x2E,0x30,0x0D,0x0A,0x5B,0x45,0x49,0x47,0x48,0x54,0x2D,0x4B,
+    0x20,0x56,0x45,0x52,0x53,0x49,0x4F,0x4E,0x5D,0x0D,0x0A,0x43,0x4F,0x50,0x59,0x52,
+    0x49,0x47,0x48,0x54,0x20,0x31,0x39,0x37,0x36,0x20,0x42,0x59,0x20,0x4D,0x49,0x54,
+    0x53,0x20,0x49,0x4E,0x43,0x2E,0x0D,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+  };
+
+static unsigned b0000(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0000: AOT::op<0xF3>(c,0x0001); n++;
+    case 0x0001: AOT::op<0xC3>(c,0x0004,AOT::imm16(c,0x0002)); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0008(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0008: AOT::op<0x7E>(c,0x0009); n++;
+    case 0x0009: AOT::op<0xE3>(c,0x000A); n++; if (x.stop) return n;
+    case 0x000A: AOT::op<0xBE>(c,0x000B); n++;
+    case 0x000B: AOT::op<0x23>(c,0x000C); n++;
+    case 0x000C: AOT::op<0xE3>(c,0x000D); n++; if (x.stop) return n;
+    case 0x000D: AOT::op<0xC2>(c,0x0010,0x02C6); n++; if (c.pc!=0x0010) return n;
+    case 0x0010: AOT::op<0x23>(c,0x0011); n++;
+    case 0x0011: AOT::op<0x7E>(c,0x0012); n++;
+    case 0x0012: AOT::op<0xFE>(c,0x0014,0x3A); n++;
+    case 0x0014: AOT::op<0xD0>(c,0x0015); n++; if (c.pc!=0x0015) return n;
+    case 0x0015: AOT::op<0xC3>(c,0x0018,0x0653); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0018(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0018: AOT::op<0xF5>(c,0x0019); n++; if (x.stop) return n;
+    case 0x0019: AOT::op<0x3A>(c,0x001C,0x01D1); n++;
+    case 0x001C: AOT::op<0xB7>(c,0x001D); n++;
+    case 0x001D: AOT::op<0xC3>(c,0x0020,0x052D); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0020(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0020: AOT::op<0x7C>(c,0x0021); n++;
+    case 0x0021: AOT::op<0x92>(c,0x0022); n++;
+    case 0x0022: AOT::op<0xC0>(c,0x0023); n++; if (c.pc!=0x0023) return n;
+    case 0x0023: AOT::op<0x7D>(c,0x0024); n++;
+    case 0x0024: AOT::op<0x93>(c,0x0025); n++;
+    case 0x0025: AOT::op<0xC9>(c,0x0026); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0028(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0028: AOT::op<0x3A>(c,0x002B,0x0256); n++;
+    case 0x002B: AOT::op<0xB7>(c,0x002C); n++;
+    case 0x002C: AOT::op<0xC2>(c,0x002F,0x1469); n++; if (c.pc!=0x002F) return n;
+    case 0x002F: AOT::op<0xC9>(c,0x0030); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0236(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0236: AOT::op<0x00>(c,0x0237); n++;
+    case 0x0237: AOT::op<0x00>(c,0x0238); n++;
+    case 0x0238: AOT::op<0x00>(c,0x0239); n++;
+    case 0x0239: AOT::op<0x00>(c,0x023A); n++;
+    case 0x023A: AOT::op<0x00>(c,0x023B); n++;
+    case 0x023B: AOT::op<0x00>(c,0x023C); n++;
+    case 0x023C: AOT::op<0x00>(c,0x023D); n++;
+    case 0x023D: AOT::op<0x00>(c,0x023E); n++;
+    case 0x023E: AOT::op<0x00>(c,0x023F); n++;
+    case 0x023F: AOT::op<0x00>(c,0x0240); n++;
+    case 0x0240: AOT::op<0x00>(c,0x0241); n++;
+    case 0x0241: AOT::op<0x00>(c,0x0242); n++;
+    case 0x0242: AOT::op<0x00>(c,0x0243); n++;
+    case 0x0243: AOT::op<0x00>(c,0x0244); n++;
+    case 0x0244: AOT::op<0x00>(c,0x0245); n++;
+    case 0x0245: AOT::op<0x00>(c,0x0246); n++;
+    case 0x0246: AOT::op<0x00>(c,0x0247); n++;
+    case 0x0247: AOT::op<0x00>(c,0x0248); n++;
+    case 0x0248: AOT::op<0x00>(c,0x0249); n++;
+    case 0x0249: AOT::op<0x00>(c,0x024A); n++;
+    case 0x024A: AOT::op<0x00>(c,0x024B); n++;
+    case 0x024B: AOT::op<0x00>(c,0x024C); n++;
+    case 0x024C: AOT::op<0x00>(c,0x024D); n++;
+    case 0x024D: AOT::op<0x00>(c,0x024E); n++;
+    case 0x024E: AOT::op<0x00>(c,0x024F); n++;
+    case 0x024F: AOT::op<0x00>(c,0x0250); n++;
+    case 0x0250: AOT::op<0x00>(c,0x0251); n++;
+    case 0x0251: AOT::op<0x00>(c,0x0252); n++;
+    case 0x0252: AOT::op<0x00>(c,0x0253); n++;
+    case 0x0253: AOT::op<0x00>(c,0x0254); n++;
+    case 0x0254: AOT::op<0x00>(c,0x0255); n++;
+    case 0x0255: AOT::op<0x00>(c,0x0256); n++;
+    case 0x0256: AOT::op<0x00>(c,0x0257); n++;
+    case 0x0257: AOT::op<0x00>(c,0x0258); n++;
+    case 0x0258: AOT::op<0x00>(c,0x0259); n++;
+    case 0x0259: AOT::op<0x00>(c,0x025A); n++;
+    case 0x025A: AOT::op<0x00>(c,0x025B); n++;
+    case 0x025B: AOT::op<0x00>(c,0x025C); n++;
+    case 0x025C: AOT::op<0x00>(c,0x025D); n++;
+    case 0x025D: AOT::op<0x00>(c,0x025E); n++;
+    case 0x025E: AOT::op<0x00>(c,0x025F); n++;
+    case 0x025F: AOT::op<0x00>(c,0x0260); n++;
+    case 0x0260: AOT::op<0x00>(c,0x0261); n++;
+    case 0x0261: AOT::op<0x00>(c,0x0262); n++;
+    case 0x0262: AOT::op<0x00>(c,0x0263); n++;
+    case 0x0263: AOT::op<0x00>(c,0x0264); n++;
+    case 0x0264: AOT::op<0x00>(c,0x0265); n++;
+    case 0x0265: AOT::op<0x20>(c,0x0266); n++;
+    case 0x0266: AOT::op<0x45>(c,0x0267); n++;
+    case 0x0267: AOT::op<0x52>(c,0x0268); n++;
+    case 0x0268: AOT::op<0x52>(c,0x0269); n++;
+    case 0x0269: AOT::op<0x4F>(c,0x026A); n++;
+    case 0x026A: AOT::op<0x52>(c,0x026B); n++;
+    case 0x026B: AOT::op<0x00>(c,0x026C); n++;
+    case 0x026C: AOT::op<0x20>(c,0x026D); n++;
+    case 0x026D: AOT::op<0x49>(c,0x026E); n++;
+    case 0x026E: AOT::op<0x4E>(c,0x026F); n++;
+    case 0x026F: AOT::op<0x20>(c,0x0270); n++;
+    case 0x0270: AOT::op<0x00>(c,0x0271); n++;
+    case 0x0271: AOT::op<0x4F>(c,0x0272); n++;
+    case 0x0272: AOT::op<0x4B>(c,0x0273); n++;
+    case 0x0273: AOT::op<0x0D>(c,0x0274); n++;
+    case 0x0274: AOT::op<0x0A>(c,0x0275); n++;
+    case 0x0275: AOT::op<0x00>(c,0x0276); n++;
+    case 0x0276: AOT::op<0x21>(c,0x0279,0x0004); n++;
+    case 0x0279: AOT::op<0x39>(c,0x027A); n++;
+    case 0x027A: L027A: AOT::op<0x7E>(c,0x027B); n++;
+    case 0x027B: AOT::op<0x23>(c,0x027C); n++;
+    case 0x027C: AOT::op<0xFE>(c,0x027E,0x81); n++;
+    case 0x027E: AOT::op<0xC0>(c,0x027F); n++; if (c.pc!=0x027F) return n;
+    case 0x027F: AOT::op<0x4E>(c,0x0280); n++;
+    case 0x0280: AOT::op<0x23>(c,0x0281); n++;
+    case 0x0281: AOT::op<0x46>(c,0x0282); n++;
+    case 0x0282: AOT::op<0x23>(c,0x0283); n++;
+    case 0x0283: AOT::op<0xE5>(c,0x0284); n++; if (x.stop) return n;
+    case 0x0284: AOT::op<0x69>(c,0x0285); n++;
+    case 0x0285: AOT::op<0x60>(c,0x0286); n++;
+    case 0x0286: AOT::op<0x7A>(c,0x0287); n++;
+    case 0x0287: AOT::op<0xB3>(c,0x0288); n++;
+    case 0x0288: AOT::op<0xEB>(c,0x0289); n++;
+    case 0x0289: AOT::op<0xCA>(c,0x028C,0x028E); n++; if (c.pc!=0x028C) { if (n<x.left) goto L028E; return n; }
+    case 0x028C: AOT::op<0xEB>(c,0x028D); n++;
+    case 0x028D: AOT::op<0xE7>(c,0x028E); n++; return n;
+    case 0x028E: L028E: AOT::op<0x01>(c,0x0291,0x000D); n++;
+    case 0x0291: AOT::op<0xE1>(c,0x0292); n++;
+    case 0x0292: AOT::op<0xC8>(c,0x0293); n++; if (c.pc!=0x0293) return n;
+    case 0x0293: AOT::op<0x09>(c,0x0294); n++;
+    case 0x0294: AOT::op<0xC3>(c,0x0297,0x027A); n++; { if (n<x.left) goto L027A; return n; }
+    }
+  return n;
+}
+
+static unsigned b0297(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0297: AOT::op<0xCD>(c,0x029A,0x02AF); n++; return n;
+    case 0x029A: AOT::op<0xC5>(c,0x029B); n++; if (x.stop) return n;
+    case 0x029B: AOT::op<0xE3>(c,0x029C); n++; if (x.stop) return n;
+    case 0x029C: AOT::op<0xC1>(c,0x029D); n++;
+    case 0x029D: L029D: AOT::op<0xE7>(c,0x029E); n++; return n;
+    case 0x029E: AOT::op<0x7E>(c,0x029F); n++;
+    case 0x029F: AOT::op<0x02>(c,0x02A0); n++; if (x.stop) return n;
+    case 0x02A0: AOT::op<0xC8>(c,0x02A1); n++; if (c.pc!=0x02A1) return n;
+    case 0x02A1: AOT::op<0x0B>(c,0x02A2); n++;
+    case 0x02A2: AOT::op<0x2B>(c,0x02A3); n++;
+    case 0x02A3: AOT::op<0xC3>(c,0x02A6,0x029D); n++; { if (n<x.left) goto L029D; return n; }
+    }
+  return n;
+}
+
+static unsigned b02A6(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x02A6: AOT::op<0xE5>(c,0x02A7); n++; if (x.stop) return n;
+    case 0x02A7: AOT::op<0x2A>(c,0x02AA,0x024F); n++;
+    case 0x02AA: AOT::op<0x06>(c,0x02AC,0x00); n++;
+    case 0x02AC: AOT::op<0x09>(c,0x02AD); n++;
+    case 0x02AD: AOT::op<0x09>(c,0x02AE); n++;
+    }
+  return n;
+}
+
+static unsigned b02AF(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x02AF: AOT::op<0xE5>(c,0x02B0); n++; if (x.stop) return n;
+    case 0x02B0: AOT::op<0x3E>(c,0x02B2,0xD4); n++;
+    case 0x02B2: AOT::op<0x95>(c,0x02B3); n++;
+    case 0x02B3: AOT::op<0x6F>(c,0x02B4); n++;
+    case 0x02B4: AOT::op<0x3E>(c,0x02B6,0xFF); n++;
+    case 0x02B6: AOT::op<0x9C>(c,0x02B7); n++;
+    case 0x02B7: AOT::op<0x67>(c,0x02B8); n++;
+    case 0x02B8: AOT::op<0x39>(c,0x02B9); n++;
+    case 0x02B9: AOT::op<0xE1>(c,0x02BA); n++;
+    case 0x02BA: AOT::op<0xD8>(c,0x02BB); n++; if (c.pc!=0x02BB) return n;
+    case 0x02BB: AOT::op<0x1E>(c,0x02BD,0x0C); n++;
+    case 0x02BD: AOT::op<0xC3>(c,0x02C0,0x02D1); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b02C0(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x02C0: AOT::op<0x2A>(c,0x02C3,0x023E); n++;
+    case 0x02C3: AOT::op<0x22>(c,0x02C6,0x01D4); n++; if (x.stop) return n;
+    case 0x02C6: AOT::op<0x1E>(c,0x02C8,0x02); n++;
+    case 0x02C8: AOT::op<0x01>(c,0x02CB,0x141E); n++;
+    case 0x02CB: AOT::op<0x01>(c,0x02CE,0x001E); n++;
+    case 0x02CE: AOT::op<0x01>(c,0x02D1,0x121E); n++;
+    case 0x02D1: AOT::op<0xCD>(c,0x02D4,0x03D5); n++; return n;
+    case 0x02D4: AOT::op<0x32>(c,0x02D7,0x01D1); n++; if (x.stop) return n;
+    case 0x02D7: AOT::op<0xCD>(c,0x02DA,0x08E0); n++; return n;
+    case 0x02DA: AOT::op<0x21>(c,0x02DD,0x01AA); n++;
+    case 0x02DD: AOT::op<0x57>(c,0x02DE); n++;
+    case 0x02DE: AOT::op<0x3E>(c,0x02E0,0x3F); n++;
+    case 0x02E0: AOT::op<0xDF>(c,0x02E1); n++; return n;
+    case 0x02E1: AOT::op<0x19>(c,0x02E2); n++;
+    case 0x02E2: AOT::op<0x7E>(c,0x02E3); n++;
+    case 0x02E3: AOT::op<0xDF>(c,0x02E4); n++; return n;
+    case 0x02E4: AOT::op<0xD7>(c,0x02E5); n++; return n;
+    case 0x02E5: AOT::op<0xDF>(c,0x02E6); n++; return n;
+    case 0x02E6: AOT::op<0x21>(c,0x02E9,0x0265); n++;
+    case 0x02E9: AOT::op<0xCD>(c,0x02EC,0x0EE3); n++; return n;
+    case 0x02EC: AOT::op<0x2A>(c,0x02EF,0x01D4); n++;
+    case 0x02EF: AOT::op<0x7C>(c,0x02F0); n++;
+    case 0x02F0: AOT::op<0xA5>(c,0x02F1); n++;
+    case 0x02F1: AOT::op<0x3C>(c,0x02F2); n++;
+    case 0x02F2: AOT::op<0xC4>(c,0x02F5,0x15FC); n++; if (c.pc!=0x02F5) return n; if (x.stop) return n;
+    case 0x02F5: AOT::op<0x3E>(c,0x02F7,0xC1); n++;
+    case 0x02F7: AOT::op<0xAF>(c,0x02F8); n++;
+    case 0x02F8: AOT::op<0x32>(c,0x02FB,0x01D1); n++; if (x.stop) return n;
+    case 0x02FB: AOT::op<0xCD>(c,0x02FE,0x08E0); n++; return n;
+    case 0x02FE: AOT::op<0x21>(c,0x0301,0x0271); n++;
+    case 0x0301: AOT::op<0xCD>(c,0x0304,AOT::imm16(c,0x0302)); n++; return n;
+    case 0x0304: L0304: AOT::op<0x21>(c,0x0307,0xFFFF); n++;
+    case 0x0307: AOT::op<0x22>(c,0x030A,0x01D4); n++; if (x.stop) return n;
+    case 0x030A: AOT::op<0xCD>(c,0x030D,0x04D4); n++; return n;
+    case 0x030D: AOT::op<0xDA>(c,0x0310,0x0304); n++; if (c.pc!=0x0310) { if (n<x.left) goto L0304; return n; }
+    case 0x0310: AOT::op<0xAF>(c,0x0311); n++;
+    case 0x0311: AOT::op<0x32>(c,0x0314,0x0241); n++; if (x.stop) return n;
+    case 0x0314: AOT::op<0xD7>(c,0x0315); n++; return n;
+    case 0x0315: AOT::op<0x3C>(c,0x0316); n++;
+    case 0x0316: AOT::op<0x3D>(c,0x0317); n++;
+    case 0x0317: AOT::op<0xCA>(c,0x031A,0x0304); n++; if (c.pc!=0x031A) { if (n<x.left) goto L0304; return n; }
+    case 0x031A: AOT::op<0xF5>(c,0x031B); n++; if (x.stop) return n;
+    case 0x031B: AOT::op<0xCD>(c,0x031E,0x0752); n++; return n;
+    case 0x031E: AOT::op<0xD5>(c,0x031F); n++; if (x.stop) return n;
+    case 0x031F: AOT::op<0xCD>(c,0x0322,0x03F8); n++; return n;
+    case 0x0322: AOT::op<0x47>(c,0x0323); n++;
+    case 0x0323: AOT::op<0xD1>(c,0x0324); n++;
+    case 0x0324: AOT::op<0xF1>(c,0x0325); n++;
+    case 0x0325: AOT::op<0xD2>(c,0x0328,0x0630); n++; if (c.pc!=0x0328) return n;
+    case 0x0328: AOT::op<0xD5>(c,0x0329); n++; if (x.stop) return n;
+    case 0x0329: AOT::op<0xC5>(c,0x032A); n++; if (x.stop) return n;
+    case 0x032A: AOT::op<0xD7>(c,0x032B); n++; return n;
+    case 0x032B: AOT::op<0xB7>(c,0x032C); n++;
+    case 0x032C: AOT::op<0xF5>(c,0x032D); n++; if (x.stop) return n;
+    case 0x032D: AOT::op<0xCD>(c,0x0330,0x0392); n++; return n;
+    case 0x0330: AOT::op<0xDA>(c,0x0333,0x0339); n++; if (c.pc!=0x0333) { if (n<x.left) goto L0339; return n; }
+    case 0x0333: AOT::op<0xF1>(c,0x0334); n++;
+    case 0x0334: AOT::op<0xF5>(c,0x0335); n++; if (x.stop) return n;
+    case 0x0335: AOT::op<0xCA>(c,0x0338,0x07D0); n++; if (c.pc!=0x0338) return n;
+    case 0x0338: AOT::op<0xB7>(c,0x0339); n++;
+    case 0x0339: L0339: AOT::op<0xC5>(c,0x033A); n++; if (x.stop) return n;
+    case 0x033A: AOT::op<0xD2>(c,0x033D,0x034E); n++; if (c.pc!=0x033D) { if (n<x.left) goto L034E; return n; }
+    case 0x033D: AOT::op<0xEB>(c,0x033E); n++;
+    case 0x033E: AOT::op<0x2A>(c,0x0341,0x024B); n++;
+    case 0x0341: L0341: AOT::op<0x1A>(c,0x0342); n++;
+    case 0x0342: AOT::op<0x02>(c,0x0343); n++; if (x.stop) return n;
+    case 0x0343: AOT::op<0x03>(c,0x0344); n++;
+    case 0x0344: AOT::op<0x13>(c,0x0345); n++;
+    case 0x0345: AOT::op<0xE7>(c,0x0346); n++; return n;
+    case 0x0346: AOT::op<0xC2>(c,0x0349,0x0341); n++; if (c.pc!=0x0349) { if (n<x.left) goto L0341; return n; }
+    case 0x0349: AOT::op<0x60>(c,0x034A); n++;
+    case 0x034A: AOT::op<0x69>(c,0x034B); n++;
+    case 0x034B: AOT::op<0x22>(c,0x034E,0x024B); n++; if (x.stop) return n;
+    case 0x034E: L034E: AOT::op<0xD1>(c,0x034F); n++;
+    case 0x034F: AOT::op<0xF1>(c,0x0350); n++;
+    case 0x0350: AOT::op<0xCA>(c,0x0353,0x0375); n++; if (c.pc!=0x0353) { if (n<x.left) goto L0375; return n; }
+    case 0x0353: AOT::op<0x2A>(c,0x0356,0x024B); n++;
+    case 0x0356: AOT::op<0xE3>(c,0x0357); n++; if (x.stop) return n;
+    case 0x0357: AOT::op<0xC1>(c,0x0358); n++;
+    case 0x0358: AOT::op<0x09>(c,0x0359); n++;
+    case 0x0359: AOT::op<0xE5>(c,0x035A); n++; if (x.stop) return n;
+    case 0x035A: AOT::op<0xCD>(c,0x035D,0x0297); n++; return n;
+    case 0x035D: AOT::op<0xE1>(c,0x035E); n++;
+    case 0x035E: AOT::op<0x22>(c,0x0361,0x024B); n++; if (x.stop) return n;
+    case 0x0361: AOT::op<0xEB>(c,0x0362); n++;
+    case 0x0362: AOT::op<0x74>(c,0x0363); n++; if (x.stop) return n;
+    case 0x0363: AOT::op<0xD1>(c,0x0364); n++;
+    case 0x0364: AOT::op<0x23>(c,0x0365); n++;
+    case 0x0365: AOT::op<0x23>(c,0x0366); n++;
+    case 0x0366: AOT::op<0x73>(c,0x0367); n++; if (x.stop) return n;
+    case 0x0367: AOT::op<0x23>(c,0x0368); n++;
+    case 0x0368: AOT::op<0x72>(c,0x0369); n++; if (x.stop) return n;
+    case 0x0369: AOT::op<0x23>(c,0x036A); n++;
+    case 0x036A: AOT::op<0x11>(c,0x036D,0x01D9); n++;
+    case 0x036D: L036D: AOT::op<0x1A>(c,0x036E); n++;
+    case 0x036E: AOT::op<0x77>(c,0x036F); n++; if (x.stop) return n;
+    case 0x036F: AOT::op<0x23>(c,0x0370); n++;
+    case 0x0370: AOT::op<0x13>(c,0x0371); n++;
+    case 0x0371: AOT::op<0xB7>(c,0x0372); n++;
+    case 0x0372: AOT::op<0xC2>(c,0x0375,0x036D); n++; if (c.pc!=0x0375) { if (n<x.left) goto L036D; return n; }
+    case 0x0375: L0375: AOT::op<0xCD>(c,0x0378,0x03BC); n++; return n;
+    case 0x0378: AOT::op<0x23>(c,0x0379); n++;
+    case 0x0379: AOT::op<0xEB>(c,0x037A); n++;
+    case 0x037A: L037A: AOT::op<0x62>(c,0x037B); n++;
+    case 0x037B: AOT::op<0x6B>(c,0x037C); n++;
+    case 0x037C: AOT::op<0x7E>(c,0x037D); n++;
+    case 0x037D: AOT::op<0x23>(c,0x037E); n++;
+    case 0x037E: AOT::op<0xB6>(c,0x037F); n++;
+    case 0x037F: AOT::op<0xCA>(c,0x0382,0x0304); n++; if (c.pc!=0x0382) { if (n<x.left) goto L0304; return n; }
+    case 0x0382: AOT::op<0x23>(c,0x0383); n++;
+    case 0x0383: AOT::op<0x23>(c,0x0384); n++;
+    case 0x0384: AOT::op<0x23>(c,0x0385); n++;
+    case 0x0385: AOT::op<0xAF>(c,0x0386); n++;
+    case 0x0386: L0386: AOT::op<0xBE>(c,0x0387); n++;
+    case 0x0387: AOT::op<0x23>(c,0x0388); n++;
+    case 0x0388: AOT::op<0xC2>(c,0x038B,0x0386); n++; if (c.pc!=0x038B) { if (n<x.left) goto L0386; return n; }
+    case 0x038B: AOT::op<0xEB>(c,0x038C); n++;
+    case 0x038C: AOT::op<0x73>(c,0x038D); n++; if (x.stop) return n;
+    case 0x038D: AOT::op<0x23>(c,0x038E); n++;
+    case 0x038E: AOT::op<0x72>(c,0x038F); n++; if (x.stop) return n;
+    case 0x038F: AOT::op<0xC3>(c,0x0392,0x037A); n++; { if (n<x.left) goto L037A; return n; }
+    }
+  return n;
+}
+
+static unsigned b0392(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0392: AOT::op<0x2A>(c,0x0395,0x01D6); n++;
+    case 0x0395: L0395: AOT::op<0x44>(c,0x0396); n++;
+    case 0x0396: AOT::op<0x4D>(c,0x0397); n++;
+    case 0x0397: AOT::op<0x7E>(c,0x0398); n++;
+    case 0x0398: AOT::op<0x23>(c,0x0399); n++;
+    case 0x0399: AOT::op<0xB6>(c,0x039A); n++;
+    case 0x039A: AOT::op<0x2B>(c,0x039B); n++;
+    case 0x039B: AOT::op<0xC8>(c,0x039C); n++; if (c.pc!=0x039C) return n;
+    case 0x039C: AOT::op<0x23>(c,0x039D); n++;
+    case 0x039D: AOT::op<0x23>(c,0x039E); n++;
+    case 0x039E: AOT::op<0x7E>(c,0x039F); n++;
+    case 0x039F: AOT::op<0x23>(c,0x03A0); n++;
+    case 0x03A0: AOT::op<0x66>(c,0x03A1); n++;
+    case 0x03A1: AOT::op<0x6F>(c,0x03A2); n++;
+    case 0x03A2: AOT::op<0xE7>(c,0x03A3); n++; return n;
+    case 0x03A3: AOT::op<0x60>(c,0x03A4); n++;
+    case 0x03A4: AOT::op<0x69>(c,0x03A5); n++;
+    case 0x03A5: AOT::op<0x7E>(c,0x03A6); n++;
+    case 0x03A6: AOT::op<0x23>(c,0x03A7); n++;
+    case 0x03A7: AOT::op<0x66>(c,0x03A8); n++;
+    case 0x03A8: AOT::op<0x6F>(c,0x03A9); n++;
+    case 0x03A9: AOT::op<0x3F>(c,0x03AA); n++;
+    case 0x03AA: AOT::op<0xC8>(c,0x03AB); n++; if (c.pc!=0x03AB) return n;
+    case 0x03AB: AOT::op<0x3F>(c,0x03AC); n++;
+    case 0x03AC: AOT::op<0xD0>(c,0x03AD); n++; if (c.pc!=0x03AD) return n;
+    case 0x03AD: AOT::op<0xC3>(c,0x03B0,0x0395); n++; { if (n<x.left) goto L0395; return n; }
+    }
+  return n;
+}
+
+static unsigned b03B1(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x03B1: AOT::op<0x2A>(c,0x03B4,0x01D6); n++;
+    case 0x03B4: AOT::op<0xAF>(c,0x03B5); n++;
+    case 0x03B5: AOT::op<0x77>(c,0x03B6); n++; if (x.stop) return n;
+    case 0x03B6: AOT::op<0x23>(c,0x03B7); n++;
+    case 0x03B7: AOT::op<0x77>(c,0x03B8); n++; if (x.stop) return n;
+    case 0x03B8: AOT::op<0x23>(c,0x03B9); n++;
+    case 0x03B9: AOT::op<0x22>(c,0x03BC,0x024B); n++; if (x.stop) return n;
+    case 0x03BC: AOT::op<0x2A>(c,0x03BF,0x01D6); n++;
+    case 0x03BF: AOT::op<0x2B>(c,0x03C0); n++;
+    case 0x03C0: AOT::op<0x22>(c,0x03C3,0x0243); n++; if (x.stop) return n;
+    case 0x03C3: AOT::op<0x2A>(c,0x03C6,0x0226); n++;
+    case 0x03C6: AOT::op<0x22>(c,0x03C9,0x023A); n++; if (x.stop) return n;
+    case 0x03C9: AOT::op<0xCD>(c,0x03CC,0x065E); n++; return n;
+    case 0x03CC: AOT::op<0x2A>(c,0x03CF,0x024B); n++;
+    case 0x03CF: AOT::op<0x22>(c,0x03D2,0x024D); n++; if (x.stop) return n;
+    case 0x03D2: AOT::op<0x22>(c,0x03D5,0x024F); n++; if (x.stop) return n;
+    case 0x03D5: AOT::op<0xC1>(c,0x03D6); n++;
+    case 0x03D6: AOT::op<0x2A>(c,0x03D9,0x01D2); n++;
+    case 0x03D9: AOT::op<0xF9>(c,0x03DA); n++;
+    case 0x03DA: AOT::op<0x21>(c,0x03DD,0x022A); n++;
+    case 0x03DD: AOT::op<0x22>(c,0x03E0,0x0228); n++; if (x.stop) return n;
+    case 0x03E0: AOT::op<0xAF>(c,0x03E1); n++;
+    case 0x03E1: AOT::op<0x6F>(c,0x03E2); n++;
+    case 0x03E2: AOT::op<0x67>(c,0x03E3); n++;
+    case 0x03E3: AOT::op<0x22>(c,0x03E6,0x0249); n++; if (x.stop) return n;
+    case 0x03E6: AOT::op<0x32>(c,0x03E9,0x0240); n++; if (x.stop) return n;
+    case 0x03E9: AOT::op<0xE5>(c,0x03EA); n++; if (x.stop) return n;
+    case 0x03EA: AOT::op<0xC5>(c,0x03EB); n++; if (x.stop) return n;
+    case 0x03EB: AOT::op<0x2A>(c,0x03EE,0x0243); n++;
+    case 0x03EE: AOT::op<0xC9>(c,0x03EF); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b03EF(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x03EF: AOT::op<0x3E>(c,0x03F1,0x3F); n++;
+    case 0x03F1: AOT::op<0xDF>(c,0x03F2); n++; return n;
+    case 0x03F2: AOT::op<0x3E>(c,0x03F4,0x20); n++;
+    case 0x03F4: AOT::op<0xDF>(c,0x03F5); n++; return n;
+    case 0x03F5: AOT::op<0xC3>(c,0x03F8,0x04D4); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b03F8(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x03F8: AOT::op<0xAF>(c,0x03F9); n++;
+    case 0x03F9: AOT::op<0x32>(c,0x03FC,0x0225); n++; if (x.stop) return n;
+    case 0x03FC: AOT::op<0x0E>(c,0x03FE,0x05); n++;
+    case 0x03FE: AOT::op<0x11>(c,0x0401,0x01D9); n++;
+    case 0x0401: AOT::op<0x7E>(c,0x0402); n++;
+    case 0x0402: AOT::op<0xFE>(c,0x0404,0x20); n++;
+    case 0x0404: AOT::op<0xCA>(c,0x0407,0x047E); n++; if (c.pc!=0x0407) return n;
+    case 0x0407: AOT::op<0x47>(c,0x0408); n++;
+    case 0x0408: AOT::op<0xFE>(c,0x040A,0x22); n++;
+    case 0x040A: AOT::op<0xCA>(c,0x040D,0x049E); n++; if (c.pc!=0x040D) return n;
+    case 0x040D: AOT::op<0xB7>(c,0x040E); n++;
+    case 0x040E: AOT::op<0xCA>(c,0x0411,0x04A5); n++; if (c.pc!=0x0411) return n;
+    case 0x0411: AOT::op<0x3A>(c,0x0414,0x0225); n++;
+    case 0x0414: AOT::op<0xB7>(c,0x0415); n++;
+    case 0x0415: AOT::op<0x7E>(c,0x0416); n++;
+    case 0x0416: AOT::op<0xC2>(c,0x0419,0x047E); n++; if (c.pc!=0x0419) return n;
+    case 0x0419: AOT::op<0xFE>(c,0x041B,0x3F); n++;
+    case 0x041B: AOT::op<0x3E>(c,0x041D,0x96); n++;
+    case 0x041D: AOT::op<0xCA>(c,0x0420,0x047E); n++; if (c.pc!=0x0420) return n;
+    case 0x0420: AOT::op<0x7E>(c,0x0421); n++;
+    case 0x0421: AOT::op<0xFE>(c,0x0423,0x30); n++;
+    case 0x0423: AOT::op<0xDA>(c,0x0426,0x042B); n++; if (c.pc!=0x0426) { if (n<x.left) goto L042B; return n; }
+    case 0x0426: AOT::op<0xFE>(c,0x0428,0x3C); n++;
+    case 0x0428: AOT::op<0xDA>(c,0x042B,0x047E); n++; if (c.pc!=0x042B) return n;
+    case 0x042B: L042B: AOT::op<0xD5>(c,0x042C); n++; if (x.stop) return n;
+    case 0x042C: AOT::op<0x11>(c,0x042F,0x0072); n++;
+    case 0x042F: AOT::op<0xC5>(c,0x0430); n++; if (x.stop) return n;
+    case 0x0430: AOT::op<0x01>(c,0x0433,0x047A); n++;
+    case 0x0433: AOT::op<0xC5>(c,0x0434); n++; if (x.stop) return n;
+    case 0x0434: AOT::op<0x06>(c,0x0436,0x7F); n++;
+    case 0x0436: AOT::op<0x7E>(c,0x0437); n++;
+    case 0x0437: AOT::op<0xFE>(c,0x0439,0x61); n++;
+    case 0x0439: AOT::op<0xDA>(c,0x043C,0x0444); n++; if (c.pc!=0x043C) { if (n<x.left) goto L0444; return n; }
+    case 0x043C: AOT::op<0xFE>(c,0x043E,0x7B); n++;
+    case 0x043E: AOT::op<0xD2>(c,0x0441,0x0444); n++; if (c.pc!=0x0441) { if (n<x.left) goto L0444; return n; }
+    case 0x0441: AOT::op<0xE6>(c,0x0443,0x5F); n++;
+    case 0x0443: AOT::op<0x77>(c,0x0444); n++; if (x.stop) return n;
+    case 0x0444: L0444: AOT::op<0x4E>(c,0x0445); n++;
+    case 0x0445: AOT::op<0xEB>(c,0x0446); n++;
+    case 0x0446: L0446: AOT::op<0x23>(c,0x0447); n++;
+    case 0x0447: AOT::op<0xB6>(c,0x0448); n++;
+    case 0x0448: AOT::op<0xF2>(c,0x044B,0x0446); n++; if (c.pc!=0x044B) { if (n<x.left) goto L0446; return n; }
+    case 0x044B: AOT::op<0x04>(c,0x044C); n++;
+    case 0x044C: AOT::op<0x7E>(c,0x044D); n++;
+    case 0x044D: AOT::op<0xE6>(c,0x044F,0x7F); n++;
+    case 0x044F: AOT::op<0xC8>(c,0x0450); n++; if (c.pc!=0x0450) return n;
+    case 0x0450: AOT::op<0xB9>(c,0x0451); n++;
+    case 0x0451: AOT::op<0xC2>(c,0x0454,0x0446); n++; if (c.pc!=0x0454) { if (n<x.left) goto L0446; return n; }
+    case 0x0454: AOT::op<0xEB>(c,0x0455); n++;
+    case 0x0455: AOT::op<0xE5>(c,0x0456); n++; if (x.stop) return n;
+    case 0x0456: L0456: AOT::op<0x13>(c,0x0457); n++;
+    case 0x0457: AOT::op<0x1A>(c,0x0458); n++;
+    case 0x0458: AOT::op<0xB7>(c,0x0459); n++;
+    case 0x0459: AOT::op<0xFA>(c,0x045C,0x0476); n++; if (c.pc!=0x045C) return n;
+    case 0x045C: AOT::op<0x4F>(c,0x045D); n++;
+    case 0x045D: AOT::op<0x78>(c,0x045E); n++;
+    case 0x045E: AOT::op<0xFE>(c,0x0460,0x88); n++;
+    case 0x0460: AOT::op<0xC2>(c,0x0463,0x0465); n++; if (c.pc!=0x0463) { if (n<x.left) goto L0465; return n; }
+    case 0x0463: AOT::op<0xD7>(c,0x0464); n++; return n;
+    case 0x0464: AOT::op<0x2B>(c,0x0465); n++;
+    case 0x0465: L0465: AOT::op<0x23>(c,0x0466); n++;
+    case 0x0466: AOT::op<0x7E>(c,0x0467); n++;
+    case 0x0467: AOT::op<0xFE>(c,0x0469,0x61); n++;
+    case 0x0469: AOT::op<0xDA>(c,0x046C,0x046E); n++; if (c.pc!=0x046C) { if (n<x.left) goto L046E; return n; }
+    case 0x046C: AOT::op<0xE6>(c,0x046E,0x5F); n++;
+    case 0x046E: L046E: AOT::op<0xB9>(c,0x046F); n++;
+    case 0x046F: AOT::op<0xCA>(c,0x0472,0x0456); n++; if (c.pc!=0x0472) { if (n<x.left) goto L0456; return n; }
+    case 0x0472: AOT::op<0xE1>(c,0x0473); n++;
+    case 0x0473: AOT::op<0xC3>(c,0x0476,0x0444); n++; { if (n<x.left) goto L0444; return n; }
+    }
+  return n;
+}
+
+static unsigned b0476(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0476: AOT::op<0x48>(c,0x0477); n++;
+    case 0x0477: AOT::op<0xF1>(c,0x0478); n++;
+    case 0x0478: AOT::op<0xEB>(c,0x0479); n++;
+    case 0x0479: AOT::op<0xC9>(c,0x047A); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b047A(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x047A: AOT::op<0xEB>(c,0x047B); n++;
+    case 0x047B: AOT::op<0x79>(c,0x047C); n++;
+    case 0x047C: AOT::op<0xC1>(c,0x047D); n++;
+    case 0x047D: AOT::op<0xD1>(c,0x047E); n++;
+    case 0x047E: L047E: AOT::op<0x23>(c,0x047F); n++;
+    case 0x047F: AOT::op<0x12>(c,0x0480); n++; if (x.stop) return n;
+    case 0x0480: AOT::op<0x13>(c,0x0481); n++;
+    case 0x0481: AOT::op<0x0C>(c,0x0482); n++;
+    case 0x0482: AOT::op<0xD6>(c,0x0484,0x3A); n++;
+    case 0x0484: AOT::op<0xCA>(c,0x0487,0x048C); n++; if (c.pc!=0x0487) { if (n<x.left) goto L048C; return n; }
+    case 0x0487: AOT::op<0xFE>(c,0x0489,0x49); n++;
+    case 0x0489: AOT::op<0xC2>(c,0x048C,0x048F); n++; if (c.pc!=0x048C) { if (n<x.left) goto L048F; return n; }
+    case 0x048C: L048C: AOT::op<0x32>(c,0x048F,0x0225); n++; if (x.stop) return n;
+    case 0x048F: L048F: AOT::op<0xD6>(c,0x0491,0x54); n++;
+    case 0x0491: AOT::op<0xC2>(c,0x0494,0x0401); n++; if (c.pc!=0x0494) return n;
+    case 0x0494: AOT::op<0x47>(c,0x0495); n++;
+    case 0x0495: L0495: AOT::op<0x7E>(c,0x0496); n++;
+    case 0x0496: AOT::op<0xB7>(c,0x0497); n++;
+    case 0x0497: AOT::op<0xCA>(c,0x049A,0x04A5); n++; if (c.pc!=0x049A) return n;
+    case 0x049A: AOT::op<0xB8>(c,0x049B); n++;
+    case 0x049B: AOT::op<0xCA>(c,0x049E,0x047E); n++; if (c.pc!=0x049E) { if (n<x.left) goto L047E; return n; }
+    case 0x049E: AOT::op<0x23>(c,0x049F); n++;
+    case 0x049F: AOT::op<0x12>(c,0x04A0); n++; if (x.stop) return n;
+    case 0x04A0: AOT::op<0x0C>(c,0x04A1); n++;
+    case 0x04A1: AOT::op<0x13>(c,0x04A2); n++;
+    case 0x04A2: AOT::op<0xC3>(c,0x04A5,0x0495); n++; { if (n<x.left) goto L0495; return n; }
+    }
+  return n;
+}
+
+static unsigned b04A5(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x04A5: AOT::op<0x21>(c,0x04A8,0x01D8); n++;
+    case 0x04A8: AOT::op<0x12>(c,0x04A9); n++; if (x.stop) return n;
+    case 0x04A9: AOT::op<0x13>(c,0x04AA); n++;
+    case 0x04AA: AOT::op<0x12>(c,0x04AB); n++; if (x.stop) return n;
+    case 0x04AB: AOT::op<0x13>(c,0x04AC); n++;
+    case 0x04AC: AOT::op<0x12>(c,0x04AD); n++; if (x.stop) return n;
+    case 0x04AD: AOT::op<0xC9>(c,0x04AE); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b04AE(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x04AE: AOT::op<0x3A>(c,0x04B1,0x01D0); n++;
+    case 0x04B1: AOT::op<0xB7>(c,0x04B2); n++;
+    case 0x04B2: AOT::op<0x3E>(c,0x04B4,0x5C); n++;
+    case 0x04B4: AOT::op<0x32>(c,0x04B7,0x01D0); n++; if (x.stop) return n;
+    case 0x04B7: AOT::op<0xC2>(c,0x04BA,0x04C0); n++; if (c.pc!=0x04BA) return n;
+    case 0x04BA: AOT::op<0x05>(c,0x04BB); n++;
+    case 0x04BB: AOT::op<0xCA>(c,0x04BE,0x04D4); n++; if (c.pc!=0x04BE) return n;
+    case 0x04BE: AOT::op<0xDF>(c,0x04BF); n++; return n;
+    case 0x04BF: AOT::op<0x3E>(c,0x04C1,0x05); n++;
+    case 0x04C1: AOT::op<0x2B>(c,0x04C2); n++;
+    case 0x04C2: AOT::op<0xCA>(c,0x04C5,0x04D0); n++; if (c.pc!=0x04C5) return n;
+    case 0x04C5: AOT::op<0x7E>(c,0x04C6); n++;
+    case 0x04C6: AOT::op<0xDF>(c,0x04C7); n++; return n;
+    case 0x04C7: AOT::op<0xC3>(c,0x04CA,0x04DD); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b04CA(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x04CA: L04CA: AOT::op<0x05>(c,0x04CB); n++;
+    case 0x04CB: AOT::op<0x2B>(c,0x04CC); n++;
+    case 0x04CC: AOT::op<0xDF>(c,0x04CD); n++; return n;
+    case 0x04CD: AOT::op<0xC2>(c,0x04D0,0x04DD); n++; if (c.pc!=0x04D0) { if (n<x.left) goto L04DD; return n; }
+    case 0x04D0: L04D0: AOT::op<0xDF>(c,0x04D1); n++; return n;
+    case 0x04D1: AOT::op<0xCD>(c,0x04D4,0x08ED); n++; return n;
+    case 0x04D4: AOT::op<0x21>(c,0x04D7,0x01D9); n++;
+    case 0x04D7: AOT::op<0x06>(c,0x04D9,0x01); n++;
+    case 0x04D9: AOT::op<0xAF>(c,0x04DA); n++;
+    case 0x04DA: AOT::op<0x32>(c,0x04DD,0x01D0); n++; if (x.stop) return n;
+    case 0x04DD: L04DD: AOT::op<0xCD>(c,0x04E0,0x0556); n++; return n;
+    case 0x04E0: AOT::op<0x4F>(c,0x04E1); n++;
+    case 0x04E1: AOT::op<0xFE>(c,0x04E3,0x7F); n++;
+    case 0x04E3: AOT::op<0xCA>(c,0x04E6,0x04AE); n++; if (c.pc!=0x04E6) return n;
+    case 0x04E6: AOT::op<0x3A>(c,0x04E9,0x01D0); n++;
+    case 0x04E9: AOT::op<0xB7>(c,0x04EA); n++;
+    case 0x04EA: AOT::op<0xCA>(c,0x04ED,0x04F4); n++; if (c.pc!=0x04ED) { if (n<x.left) goto L04F4; return n; }
+    case 0x04ED: AOT::op<0x3E>(c,0x04EF,0x5C); n++;
+    case 0x04EF: AOT::op<0xDF>(c,0x04F0); n++; return n;
+    case 0x04F0: AOT::op<0xAF>(c,0x04F1); n++;
+    case 0x04F1: AOT::op<0x32>(c,0x04F4,0x01D0); n++; if (x.stop) return n;
+    case 0x04F4: L04F4: AOT::op<0x79>(c,0x04F5); n++;
+    case 0x04F5: AOT::op<0xFE>(c,0x04F7,0x07); n++;
+    case 0x04F7: AOT::op<0xCA>(c,0x04FA,0x051A); n++; if (c.pc!=0x04FA) { if (n<x.left) goto L051A; return n; }
+    case 0x04FA: AOT::op<0xFE>(c,0x04FC,0x03); n++;
+    case 0x04FC: AOT::op<0xCC>(c,0x04FF,0x08ED); n++; if (c.pc!=0x04FF) return n; if (x.stop) return n;
+    case 0x04FF: AOT::op<0x37>(c,0x0500); n++;
+    case 0x0500: AOT::op<0xC8>(c,0x0501); n++; if (c.pc!=0x0501) return n;
+    case 0x0501: AOT::op<0xFE>(c,0x0503,0x0D); n++;
+    case 0x0503: AOT::op<0xCA>(c,0x0506,0x08E8); n++; if (c.pc!=0x0506) return n;
+    case 0x0506: AOT::op<0xFE>(c,0x0508,0x15); n++;
+    case 0x0508: AOT::op<0xCA>(c,0x050B,0x04D0); n++; if (c.pc!=0x050B) { if (n<x.left) goto L04D0; return n; }
+    case 0x050B: AOT::op<0xFE>(c,0x050D,0x40); n++;
+    case 0x050D: AOT::op<0xCA>(c,0x0510,0x04D0); n++; if (c.pc!=0x0510) { if (n<x.left) goto L04D0; return n; }
+    case 0x0510: AOT::op<0xFE>(c,0x0512,0x5F); n++;
+    case 0x0512: AOT::op<0xCA>(c,0x0515,0x04CA); n++; if (c.pc!=0x0515) { if (n<x.left) goto L04CA; return n; }
+    case 0x0515: AOT::op<0xFE>(c,0x0517,0x20); n++;
+    case 0x0517: AOT::op<0xDA>(c,0x051A,0x04DD); n++; if (c.pc!=0x051A) { if (n<x.left) goto L04DD; return n; }
+    case 0x051A: L051A: AOT::op<0x78>(c,0x051B); n++;
+    case 0x051B: AOT::op<0xFE>(c,0x051D,0x48); n++;
+    case 0x051D: AOT::op<0x3E>(c,0x051F,0x07); n++;
+    case 0x051F: AOT::op<0xD2>(c,0x0522,0x0529); n++; if (c.pc!=0x0522) { if (n<x.left) goto L0529; return n; }
+    case 0x0522: AOT::op<0x79>(c,0x0523); n++;
+    case 0x0523: AOT::op<0x71>(c,0x0524); n++; if (x.stop) return n;
+    case 0x0524: AOT::op<0x32>(c,0x0527,0x0241); n++; if (x.stop) return n;
+    case 0x0527: AOT::op<0x23>(c,0x0528); n++;
+    case 0x0528: AOT::op<0x04>(c,0x0529); n++;
+    case 0x0529: L0529: AOT::op<0xDF>(c,0x052A); n++; return n;
+    case 0x052A: AOT::op<0xC3>(c,0x052D,0x04DD); n++; { if (n<x.left) goto L04DD; return n; }
+    }
+  return n;
+}
+
+static unsigned b052D(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x052D: AOT::op<0x3A>(c,0x0530,0x01D1); n++;
+    case 0x0530: AOT::op<0xB7>(c,0x0531); n++;
+    case 0x0531: AOT::op<0xC2>(c,0x0534,0x0F14); n++; if (c.pc!=0x0534) return n;
+    case 0x0534: AOT::op<0xF1>(c,0x0535); n++;
+    case 0x0535: AOT::op<0xF5>(c,0x0536); n++; if (x.stop) return n;
+    case 0x0536: AOT::op<0xFE>(c,0x0538,0x20); n++;
+    case 0x0538: AOT::op<0xDA>(c,0x053B,0x0547); n++; if (c.pc!=0x053B) { if (n<x.left) goto L0547; return n; }
+    case 0x053B: AOT::op<0x3A>(c,0x053E,0x0027); n++;
+    case 0x053E: AOT::op<0xFE>(c,0x0540,AOT::imm8(c,0x053F)); n++;
+    case 0x0540: AOT::op<0xCC>(c,0x0543,0x08ED); n++; if (c.pc!=0x0543) return n; if (x.stop) return n;
+    case 0x0543: AOT::op<0x3C>(c,0x0544); n++;
+    case 0x0544: AOT::op<0x32>(c,0x0547,0x0027); n++; if (x.stop) return n;
+    case 0x0547: L0547: AOT::op<0xDB>(c,0x0549,AOT::imm8(c,0x0548)); n++;
+    case 0x0549: AOT::op<0xE6>(c,0x054B,AOT::imm8(c,0x054A)); n++;
+    case 0x054B: AOT::op<0xC2>(c,0x054E,0x0547); n++; if (c.pc!=0x054E) { if (n<x.left) goto L0547; return n; }
+    case 0x054E: AOT::op<0xF1>(c,0x054F); n++;
+    case 0x054F: AOT::op<0xD3>(c,0x0551,AOT::imm8(c,0x0550)); n++;
+    case 0x0551: AOT::op<0xF5>(c,0x0552); n++; if (x.stop) return n;
+    case 0x0552: AOT::op<0xDB>(c,0x0554,AOT::imm8(c,0x0553)); n++;
+    case 0x0554: AOT::op<0xF1>(c,0x0555); n++;
+    case 0x0555: AOT::op<0xC9>(c,0x0556); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0556(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0556: L0556: AOT::op<0xDB>(c,0x0558,AOT::imm8(c,0x0557)); n++;
+    case 0x0558: AOT::op<0xE6>(c,0x055A,AOT::imm8(c,0x0559)); n++;
+    case 0x055A: AOT::op<0xC2>(c,0x055D,0x0556); n++; if (c.pc!=0x055D) { if (n<x.left) goto L0556; return n; }
+    case 0x055D: AOT::op<0xDB>(c,0x055F,AOT::imm8(c,0x055E)); n++;
+    case 0x055F: AOT::op<0xE6>(c,0x0561,0x7F); n++;
+    case 0x0561: AOT::op<0xFE>(c,0x0563,0x0F); n++;
+    case 0x0563: AOT::op<0xC0>(c,0x0564); n++; if (c.pc!=0x0564) return n;
+    case 0x0564: AOT::op<0x3A>(c,0x0567,0x01D1); n++;
+    case 0x0567: AOT::op<0x2F>(c,0x0568); n++;
+    case 0x0568: AOT::op<0x32>(c,0x056B,0x01D1); n++; if (x.stop) return n;
+    case 0x056B: AOT::op<0xAF>(c,0x056C); n++;
+    case 0x056C: AOT::op<0xC9>(c,0x056D); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b05B7(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x05B7: AOT::op<0x3E>(c,0x05B9,0x64); n++;
+    case 0x05B9: AOT::op<0x32>(c,0x05BC,0x0240); n++; if (x.stop) return n;
+    case 0x05BC: AOT::op<0xCD>(c,0x05BF,0x0811); n++; return n;
+    case 0x05BF: AOT::op<0xE3>(c,0x05C0); n++; if (x.stop) return n;
+    case 0x05C0: AOT::op<0xCD>(c,0x05C3,0x0276); n++; return n;
+    case 0x05C3: AOT::op<0xD1>(c,0x05C4); n++;
+    case 0x05C4: AOT::op<0xC2>(c,0x05C7,0x05C9); n++; if (c.pc!=0x05C7) { if (n<x.left) goto L05C9; return n; }
+    case 0x05C7: AOT::op<0x09>(c,0x05C8); n++;
+    case 0x05C8: AOT::op<0xF9>(c,0x05C9); n++;
+    case 0x05C9: L05C9: AOT::op<0xEB>(c,0x05CA); n++;
+    case 0x05CA: AOT::op<0x0E>(c,0x05CC,0x08); n++;
+    case 0x05CC: AOT::op<0xCD>(c,0x05CF,0x02A6); n++; return n;
+    case 0x05CF: AOT::op<0xE5>(c,0x05D0); n++; if (x.stop) return n;
+    case 0x05D0: AOT::op<0xCD>(c,0x05D3,0x07FA); n++; return n;
+    case 0x05D3: AOT::op<0xE3>(c,0x05D4); n++; if (x.stop) return n;
+    case 0x05D4: AOT::op<0xE5>(c,0x05D5); n++; if (x.stop) return n;
+    case 0x05D5: AOT::op<0x2A>(c,0x05D8,0x01D4); n++;
+    case 0x05D8: AOT::op<0xE3>(c,0x05D9); n++; if (x.stop) return n;
+    case 0x05D9: AOT::op<0xCD>(c,0x05DC,0x0A86); n++; return n;
+    case 0x05DC: AOT::op<0xCF>(c,0x05DD); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b05DE(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x05DE: AOT::op<0xCD>(c,0x05E1,0x0A83); n++; return n;
+    case 0x05E1: AOT::op<0xE5>(c,0x05E2); n++; if (x.stop) return n;
+    case 0x05E2: AOT::op<0xCD>(c,0x05E5,0x14AC); n++; return n;
+    case 0x05E5: AOT::op<0xE1>(c,0x05E6); n++;
+    case 0x05E6: AOT::op<0xC5>(c,0x05E7); n++; if (x.stop) return n;
+    case 0x05E7: AOT::op<0xD5>(c,0x05E8); n++; if (x.stop) return n;
+    case 0x05E8: AOT::op<0x01>(c,0x05EB,0x8100); n++;
+    case 0x05EB: AOT::op<0x51>(c,0x05EC); n++;
+    case 0x05EC: AOT::op<0x5A>(c,0x05ED); n++;
+    case 0x05ED: AOT::op<0x7E>(c,0x05EE); n++;
+    case 0x05EE: AOT::op<0xFE>(c,0x05F0,0xA3); n++;
+    case 0x05F0: AOT::op<0x3E>(c,0x05F2,0x01); n++;
+    case 0x05F2: AOT::op<0xC2>(c,0x05F5,0x05FF); n++; if (c.pc!=0x05F5) { if (n<x.left) goto L05FF; return n; }
+    case 0x05F5: AOT::op<0xD7>(c,0x05F6); n++; return n;
+    case 0x05F6: AOT::op<0xCD>(c,0x05F9,0x0A83); n++; return n;
+    case 0x05F9: AOT::op<0xE5>(c,0x05FA); n++; if (x.stop) return n;
+    case 0x05FA: AOT::op<0xCD>(c,0x05FD,0x14AC); n++; return n;
+    case 0x05FD: AOT::op<0xEF>(c,0x05FE); n++; return n;
+    case 0x05FE: AOT::op<0xE1>(c,0x05FF); n++;
+    case 0x05FF: L05FF: AOT::op<0xC5>(c,0x0600); n++; if (x.stop) return n;
+    case 0x0600: AOT::op<0xD5>(c,0x0601); n++; if (x.stop) return n;
+    case 0x0601: AOT::op<0xF5>(c,0x0602); n++; if (x.stop) return n;
+    case 0x0602: AOT::op<0x33>(c,0x0603); n++;
+    case 0x0603: AOT::op<0xE5>(c,0x0604); n++; if (x.stop) return n;
+    case 0x0604: AOT::op<0x2A>(c,0x0607,0x0243); n++;
+    case 0x0607: AOT::op<0xE3>(c,0x0608); n++; if (x.stop) return n;
+    case 0x0608: AOT::op<0x06>(c,0x060A,0x81); n++;
+    case 0x060A: AOT::op<0xC5>(c,0x060B); n++; if (x.stop) return n;
+    case 0x060B: AOT::op<0x33>(c,0x060C); n++;
+    case 0x060C: AOT::op<0xDB>(c,0x060E,AOT::imm8(c,0x060D)); n++;
+    case 0x060E: AOT::op<0xE6>(c,0x0610,AOT::imm8(c,0x060F)); n++;
+    case 0x0610: AOT::op<0xCC>(c,0x0613,0x066D); n++; if (c.pc!=0x0613) return n; if (x.stop) return n;
+    case 0x0613: AOT::op<0x22>(c,0x0616,0x0243); n++; if (x.stop) return n;
+    case 0x0616: AOT::op<0x7E>(c,0x0617); n++;
+    case 0x0617: AOT::op<0xFE>(c,0x0619,0x3A); n++;
+    case 0x0619: AOT::op<0xCA>(c,0x061C,0x0630); n++; if (c.pc!=0x061C) { if (n<x.left) goto L0630; return n; }
+    case 0x061C: AOT::op<0xB7>(c,0x061D); n++;
+    case 0x061D: AOT::op<0xC2>(c,0x0620,0x02C6); n++; if (c.pc!=0x0620) return n;
+    case 0x0620: AOT::op<0x23>(c,0x0621); n++;
+    case 0x0621: AOT::op<0x7E>(c,0x0622); n++;
+    case 0x0622: AOT::op<0x23>(c,0x0623); n++;
+    case 0x0623: AOT::op<0xB6>(c,0x0624); n++;
+    case 0x0624: AOT::op<0xCA>(c,0x0627,0x0689); n++; if (c.pc!=0x0627) return n;
+    case 0x0627: AOT::op<0x23>(c,0x0628); n++;
+    case 0x0628: AOT::op<0x5E>(c,0x0629); n++;
+    case 0x0629: AOT::op<0x23>(c,0x062A); n++;
+    case 0x062A: AOT::op<0x56>(c,0x062B); n++;
+    case 0x062B: AOT::op<0xEB>(c,0x062C); n++;
+    case 0x062C: AOT::op<0x22>(c,0x062F,0x01D4); n++; if (x.stop) return n;
+    case 0x062F: AOT::op<0xEB>(c,0x0630); n++;
+    case 0x0630: L0630: AOT::op<0xD7>(c,0x0631); n++; return n;
+    case 0x0631: AOT::op<0x11>(c,0x0634,0x060C); n++;
+    case 0x0634: AOT::op<0xD5>(c,0x0635); n++; if (x.stop) return n;
+    case 0x0635: AOT::op<0xC8>(c,0x0636); n++; if (c.pc!=0x0636) return n;
+    case 0x0636: AOT::op<0xD6>(c,0x0638,0x80); n++;
+    case 0x0638: AOT::op<0xDA>(c,0x063B,0x0811); n++; if (c.pc!=0x063B) return n;
+    case 0x063B: AOT::op<0xFE>(c,0x063D,0x1D); n++;
+    case 0x063D: AOT::op<0xD2>(c,0x0640,0x02C6); n++; if (c.pc!=0x0640) return n;
+    case 0x0640: AOT::op<0x07>(c,0x0641); n++;
+    case 0x0641: AOT::op<0x4F>(c,0x0642); n++;
+    case 0x0642: AOT::op<0x06>(c,0x0644,0x00); n++;
+    case 0x0644: AOT::op<0xEB>(c,0x0645); n++;
+    case 0x0645: AOT::op<0x21>(c,0x0648,0x015B); n++;
+    case 0x0648: AOT::op<0x09>(c,0x0649); n++;
+    case 0x0649: AOT::op<0x4E>(c,0x064A); n++;
+    case 0x064A: AOT::op<0x23>(c,0x064B); n++;
+    case 0x064B: AOT::op<0x46>(c,0x064C); n++;
+    case 0x064C: AOT::op<0xC5>(c,0x064D); n++; if (x.stop) return n;
+    case 0x064D: AOT::op<0xEB>(c,0x064E); n++;
+    case 0x064E: L064E: AOT::op<0x23>(c,0x064F); n++;
+    case 0x064F: AOT::op<0x7E>(c,0x0650); n++;
+    case 0x0650: AOT::op<0xFE>(c,0x0652,0x3A); n++;
+    case 0x0652: AOT::op<0xD0>(c,0x0653); n++; if (c.pc!=0x0653) return n;
+    case 0x0653: AOT::op<0xFE>(c,0x0655,0x20); n++;
+    case 0x0655: AOT::op<0xCA>(c,0x0658,0x064E); n++; if (c.pc!=0x0658) { if (n<x.left) goto L064E; return n; }
+    case 0x0658: AOT::op<0xFE>(c,0x065A,0x30); n++;
+    case 0x065A: AOT::op<0x3F>(c,0x065B); n++;
+    case 0x065B: AOT::op<0x3C>(c,0x065C); n++;
+    case 0x065C: AOT::op<0x3D>(c,0x065D); n++;
+    case 0x065D: AOT::op<0xC9>(c,0x065E); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b065E(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x065E: AOT::op<0xEB>(c,0x065F); n++;
+    case 0x065F: AOT::op<0x2A>(c,0x0662,0x01D6); n++;
+    case 0x0662: AOT::op<0x2B>(c,0x0663); n++;
+    case 0x0663: AOT::op<0x22>(c,0x0666,0x0251); n++; if (x.stop) return n;
+    case 0x0666: AOT::op<0xEB>(c,0x0667); n++;
+    case 0x0667: AOT::op<0xC9>(c,0x0668); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0668(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0668: L0668: AOT::op<0xDB>(c,0x066A,AOT::imm8(c,0x0669)); n++;
+    case 0x066A: AOT::op<0xE6>(c,0x066C,AOT::imm8(c,0x066B)); n++;
+    case 0x066C: AOT::op<0xC0>(c,0x066D); n++; if (c.pc!=0x066D) return n;
+    case 0x066D: L066D: AOT::op<0xCD>(c,0x0670,0x0556); n++; return n;
+    case 0x0670: AOT::op<0xFE>(c,0x0672,0x03); n++;
+    case 0x0672: AOT::op<0xCA>(c,0x0675,0x067F); n++; if (c.pc!=0x0675) { if (n<x.left) goto L067F; return n; }
+    case 0x0675: AOT::op<0xFE>(c,0x0677,0x11); n++;
+    case 0x0677: AOT::op<0xCA>(c,0x067A,0x0668); n++; if (c.pc!=0x067A) { if (n<x.left) goto L0668; return n; }
+    case 0x067A: AOT::op<0xFE>(c,0x067C,0x13); n++;
+    case 0x067C: AOT::op<0xCA>(c,0x067F,0x066D); n++; if (c.pc!=0x067F) { if (n<x.left) goto L066D; return n; }
+    case 0x067F: L067F: AOT::op<0xC0>(c,0x0680); n++; if (c.pc!=0x0680) return n;
+    case 0x0680: AOT::op<0xF6>(c,0x0682,0xC0); n++;
+    case 0x0682: AOT::op<0x22>(c,0x0685,0x0243); n++; if (x.stop) return n;
+    case 0x0685: AOT::op<0x21>(c,0x0688,0xFFF6); n++;
+    case 0x0688: AOT::op<0xC1>(c,0x0689); n++;
+    case 0x0689: AOT::op<0x2A>(c,0x068C,0x01D4); n++;
+    case 0x068C: AOT::op<0xF5>(c,0x068D); n++; if (x.stop) return n;
+    case 0x068D: AOT::op<0x7D>(c,0x068E); n++;
+    case 0x068E: AOT::op<0xA4>(c,0x068F); n++;
+    case 0x068F: AOT::op<0x3C>(c,0x0690); n++;
+    case 0x0690: AOT::op<0xCA>(c,0x0693,0x069C); n++; if (c.pc!=0x0693) { if (n<x.left) goto L069C; return n; }
+    case 0x0693: AOT::op<0x22>(c,0x0696,0x0247); n++; if (x.stop) return n;
+    case 0x0696: AOT::op<0x2A>(c,0x0699,0x0243); n++;
+    case 0x0699: AOT::op<0x22>(c,0x069C,0x0249); n++; if (x.stop) return n;
+    case 0x069C: L069C: AOT::op<0xAF>(c,0x069D); n++;
+    case 0x069D: AOT::op<0x32>(c,0x06A0,0x01D1); n++; if (x.stop) return n;
+    case 0x06A0: AOT::op<0xCD>(c,0x06A3,0x08E0); n++; return n;
+    case 0x06A3: AOT::op<0xF1>(c,0x06A4); n++;
+    case 0x06A4: AOT::op<0x21>(c,0x06A7,0x003B); n++;
+    case 0x06A7: AOT::op<0xC2>(c,0x06AA,0x02E9); n++; if (c.pc!=0x06AA) return n;
+    case 0x06AA: AOT::op<0xC3>(c,0x06AD,0x02F7); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b06AD(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x06AD: AOT::op<0x2A>(c,0x06B0,0x0249); n++;
+    case 0x06B0: AOT::op<0x7C>(c,0x06B1); n++;
+    case 0x06B1: AOT::op<0xB5>(c,0x06B2); n++;
+    case 0x06B2: AOT::op<0x1E>(c,0x06B4,0x20); n++;
+    case 0x06B4: AOT::op<0xCA>(c,0x06B7,0x02D1); n++; if (c.pc!=0x06B7) return n;
+    case 0x06B7: AOT::op<0xEB>(c,0x06B8); n++;
+    case 0x06B8: AOT::op<0x2A>(c,0x06BB,0x0247); n++;
+    case 0x06BB: AOT::op<0x22>(c,0x06BE,0x01D4); n++; if (x.stop) return n;
+    case 0x06BE: AOT::op<0xEB>(c,0x06BF); n++;
+    case 0x06BF: AOT::op<0xC9>(c,0x06C0); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b06C0(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x06C0: AOT::op<0xCD>(c,0x06C3,0x1131); n++; return n;
+    case 0x06C3: AOT::op<0xC0>(c,0x06C4); n++; if (c.pc!=0x06C4) return n;
+    case 0x06C4: AOT::op<0x3C>(c,0x06C5); n++;
+    case 0x06C5: AOT::op<0xFE>(c,0x06C7,AOT::imm8(c,0x06C6)); n++;
+    case 0x06C7: AOT::op<0xD2>(c,0x06CA,0x074D); n++; if (c.pc!=0x06CA) return n;
+    case 0x06CA: AOT::op<0x32>(c,0x06CD,0x0026); n++; if (x.stop) return n;
+    case 0x06CD: AOT::op<0xC9>(c,0x06CE); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b06DD(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x06DD: AOT::op<0x32>(c,0x06E0,0x0240); n++; if (x.stop) return n;
+    case 0x06E0: AOT::op<0x44>(c,0x06E1); n++;
+    case 0x06E1: AOT::op<0x4D>(c,0x06E2); n++;
+    case 0x06E2: AOT::op<0x0B>(c,0x06E3); n++;
+    case 0x06E3: AOT::op<0x0B>(c,0x06E4); n++;
+    case 0x06E4: AOT::op<0x0B>(c,0x06E5); n++;
+    case 0x06E5: AOT::op<0x0B>(c,0x06E6); n++;
+    case 0x06E6: AOT::op<0x3A>(c,0x06E9,0x0243); n++;
+    case 0x06E9: AOT::op<0xB7>(c,0x06EA); n++;
+    case 0x06EA: AOT::op<0xF5>(c,0x06EB); n++; if (x.stop) return n;
+    case 0x06EB: AOT::op<0xEB>(c,0x06EC); n++;
+    case 0x06EC: AOT::op<0x19>(c,0x06ED); n++;
+    case 0x06ED: AOT::op<0xEB>(c,0x06EE); n++;
+    case 0x06EE: AOT::op<0x4E>(c,0x06EF); n++;
+    case 0x06EF: AOT::op<0x06>(c,0x06F1,0x00); n++;
+    case 0x06F1: AOT::op<0x09>(c,0x06F2); n++;
+    case 0x06F2: AOT::op<0x09>(c,0x06F3); n++;
+    case 0x06F3: AOT::op<0x23>(c,0x06F4); n++;
+    case 0x06F4: AOT::op<0x06>(c,0x06F6,0xD2); n++;
+    case 0x06F6: AOT::op<0xFA>(c,0x06F9,0x0703); n++; if (c.pc!=0x06F9) return n;
+    case 0x06F9: AOT::op<0x78>(c,0x06FA); n++;
+    case 0x06FA: AOT::op<0xCD>(c,0x06FD,0x114A); n++; return n;
+    case 0x06FD: AOT::op<0xCD>(c,0x0700,0x114A); n++; return n;
+    case 0x0700: AOT::op<0xC3>(c,0x0703,0x0710); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0703(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0703: L0703: AOT::op<0x0E>(c,0x0705,0x04); n++;
+    case 0x0705: L0705: AOT::op<0xCD>(c,0x0708,0x1140); n++; return n;
+    case 0x0708: AOT::op<0xB8>(c,0x0709); n++;
+    case 0x0709: AOT::op<0xC2>(c,0x070C,0x0703); n++; if (c.pc!=0x070C) { if (n<x.left) goto L0703; return n; }
+    case 0x070C: AOT::op<0x0D>(c,0x070D); n++;
+    case 0x070D: AOT::op<0xC2>(c,0x0710,0x0705); n++; if (c.pc!=0x0710) { if (n<x.left) goto L0705; return n; }
+    case 0x0710: AOT::op<0xCD>(c,0x0713,0x0A86); n++; return n;
+    case 0x0713: L0713: AOT::op<0xE7>(c,0x0714); n++; return n;
+    case 0x0714: AOT::op<0xCA>(c,0x0717,0x0725); n++; if (c.pc!=0x0717) return n;
+    case 0x0717: AOT::op<0xF1>(c,0x0718); n++;
+    case 0x0718: AOT::op<0xF5>(c,0x0719); n++; if (x.stop) return n;
+    case 0x0719: AOT::op<0x7E>(c,0x071A); n++;
+    case 0x071A: AOT::op<0xF4>(c,0x071D,0x114D); n++; if (c.pc!=0x071D) return n; if (x.stop) return n;
+    case 0x071D: AOT::op<0xFC>(c,0x0720,0x1140); n++; if (c.pc!=0x0720) return n; if (x.stop) return n;
+    case 0x0720: AOT::op<0x77>(c,0x0721); n++; if (x.stop) return n;
+    case 0x0721: AOT::op<0x23>(c,0x0722); n++;
+    case 0x0722: AOT::op<0xC3>(c,0x0725,0x0713); n++; { if (n<x.left) goto L0713; return n; }
+    }
+  return n;
+}
+
+static unsigned b0725(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0725: AOT::op<0xF1>(c,0x0726); n++;
+    case 0x0726: AOT::op<0xE1>(c,0x0727); n++;
+    case 0x0727: AOT::op<0xC9>(c,0x0728); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0728(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0728: AOT::op<0x7E>(c,0x0729); n++;
+    case 0x0729: AOT::op<0xFE>(c,0x072B,0x41); n++;
+    case 0x072B: AOT::op<0xD8>(c,0x072C); n++; if (c.pc!=0x072C) return n;
+    case 0x072C: AOT::op<0xFE>(c,0x072E,0x5B); n++;
+    case 0x072E: AOT::op<0x3F>(c,0x072F); n++;
+    case 0x072F: AOT::op<0xC9>(c,0x0730); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0730(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0730: AOT::op<0xD7>(c,0x0731); n++; return n;
+    case 0x0731: AOT::op<0xCD>(c,0x0734,0x0A83); n++; return n;
+    case 0x0734: AOT::op<0xEF>(c,0x0735); n++; return n;
+    case 0x0735: AOT::op<0xFA>(c,0x0738,0x074D); n++; if (c.pc!=0x0738) { if (n<x.left) goto L074D; return n; }
+    case 0x0738: AOT::op<0x3A>(c,0x073B,0x0256); n++;
+    case 0x073B: AOT::op<0xFE>(c,0x073D,0x90); n++;
+    case 0x073D: AOT::op<0xDA>(c,0x0740,0x1506); n++; if (c.pc!=0x0740) return n;
+    case 0x0740: AOT::op<0x01>(c,0x0743,0x9080); n++;
+    case 0x0743: AOT::op<0x11>(c,0x0746,0x0000); n++;
+    case 0x0746: AOT::op<0xE5>(c,0x0747); n++; if (x.stop) return n;
+    case 0x0747: AOT::op<0xCD>(c,0x074A,0x14DB); n++; return n;
+    case 0x074A: AOT::op<0xE1>(c,0x074B); n++;
+    case 0x074B: AOT::op<0x51>(c,0x074C); n++;
+    case 0x074C: AOT::op<0xC8>(c,0x074D); n++; if (c.pc!=0x074D) return n;
+    case 0x074D: L074D: AOT::op<0x1E>(c,0x074F,0x08); n++;
+    case 0x074F: AOT::op<0xC3>(c,0x0752,0x02D1); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0752(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0752: AOT::op<0x2B>(c,0x0753); n++;
+    case 0x0753: AOT::op<0x11>(c,0x0756,0x0000); n++;
+    case 0x0756: L0756: AOT::op<0xD7>(c,0x0757); n++; return n;
+    case 0x0757: AOT::op<0xD0>(c,0x0758); n++; if (c.pc!=0x0758) return n;
+    case 0x0758: AOT::op<0xE5>(c,0x0759); n++; if (x.stop) return n;
+    case 0x0759: AOT::op<0xF5>(c,0x075A); n++; if (x.stop) return n;
+    case 0x075A: AOT::op<0x21>(c,0x075D,0x1998); n++;
+    case 0x075D: AOT::op<0xE7>(c,0x075E); n++; return n;
+    case 0x075E: AOT::op<0xDA>(c,0x0761,0x02C6); n++; if (c.pc!=0x0761) return n;
+    case 0x0761: AOT::op<0x62>(c,0x0762); n++;
+    case 0x0762: AOT::op<0x6B>(c,0x0763); n++;
+    case 0x0763: AOT::op<0x19>(c,0x0764); n++;
+    case 0x0764: AOT::op<0x29>(c,0x0765); n++;
+    case 0x0765: AOT::op<0x19>(c,0x0766); n++;
+    case 0x0766: AOT::op<0x29>(c,0x0767); n++;
+    case 0x0767: AOT::op<0xF1>(c,0x0768); n++;
+    case 0x0768: AOT::op<0xD6>(c,0x076A,0x30); n++;
+    case 0x076A: AOT::op<0x5F>(c,0x076B); n++;
+    case 0x076B: AOT::op<0x16>(c,0x076D,0x00); n++;
+    case 0x076D: AOT::op<0x19>(c,0x076E); n++;
+    case 0x076E: AOT::op<0xEB>(c,0x076F); n++;
+    case 0x076F: AOT::op<0xE1>(c,0x0770); n++;
+    case 0x0770: AOT::op<0xC3>(c,0x0773,0x0756); n++; { if (n<x.left) goto L0756; return n; }
+    }
+  return n;
+}
+
+static unsigned b079C(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x079C: AOT::op<0xCA>(c,0x079F,0x03BC); n++; if (c.pc!=0x079F) return n;
+    case 0x079F: AOT::op<0xCD>(c,0x07A2,0x03C0); n++; return n;
+    case 0x07A2: AOT::op<0x01>(c,0x07A5,0x060C); n++;
+    case 0x07A5: AOT::op<0xC3>(c,0x07A8,0x07B8); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b07A8(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x07A8: AOT::op<0x0E>(c,0x07AA,0x03); n++;
+    case 0x07AA: AOT::op<0xCD>(c,0x07AD,0x02A6); n++; return n;
+    case 0x07AD: AOT::op<0xC1>(c,0x07AE); n++;
+    case 0x07AE: AOT::op<0xE5>(c,0x07AF); n++; if (x.stop) return n;
+    case 0x07AF: AOT::op<0xE5>(c,0x07B0); n++; if (x.stop) return n;
+    case 0x07B0: AOT::op<0x2A>(c,0x07B3,0x01D4); n++;
+    case 0x07B3: AOT::op<0xE3>(c,0x07B4); n++; if (x.stop) return n;
+    case 0x07B4: AOT::op<0x3E>(c,0x07B6,0x8C); n++;
+    case 0x07B6: AOT::op<0xF5>(c,0x07B7); n++; if (x.stop) return n;
+    case 0x07B7: AOT::op<0x33>(c,0x07B8); n++;
+    case 0x07B8: AOT::op<0xC5>(c,0x07B9); n++; if (x.stop) return n;
+    case 0x07B9: AOT::op<0xCD>(c,0x07BC,0x0752); n++; return n;
+    case 0x07BC: AOT::op<0xCD>(c,0x07BF,0x07FC); n++; return n;
+    case 0x07BF: AOT::op<0xE5>(c,0x07C0); n++; if (x.stop) return n;
+    case 0x07C0: AOT::op<0x2A>(c,0x07C3,0x01D4); n++;
+    case 0x07C3: AOT::op<0xE7>(c,0x07C4); n++; return n;
+    case 0x07C4: AOT::op<0xE1>(c,0x07C5); n++;
+    case 0x07C5: AOT::op<0x23>(c,0x07C6); n++;
+    case 0x07C6: AOT::op<0xDC>(c,0x07C9,0x0395); n++; if (c.pc!=0x07C9) return n; if (x.stop) return n;
+    case 0x07C9: AOT::op<0xD4>(c,0x07CC,0x0392); n++; if (c.pc!=0x07CC) return n; if (x.stop) return n;
+    case 0x07CC: AOT::op<0x60>(c,0x07CD); n++;
+    case 0x07CD: AOT::op<0x69>(c,0x07CE); n++;
+    case 0x07CE: AOT::op<0x2B>(c,0x07CF); n++;
+    case 0x07CF: AOT::op<0xD8>(c,0x07D0); n++; if (c.pc!=0x07D0) return n;
+    case 0x07D0: AOT::op<0x1E>(c,0x07D2,0x0E); n++;
+    case 0x07D2: AOT::op<0xC3>(c,0x07D5,0x02D1); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b07D5(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x07D5: AOT::op<0xC0>(c,0x07D6); n++; if (c.pc!=0x07D6) return n;
+    case 0x07D6: AOT::op<0x16>(c,0x07D8,0xFF); n++;
+    case 0x07D8: AOT::op<0xCD>(c,0x07DB,0x0276); n++; return n;
+    case 0x07DB: AOT::op<0xF9>(c,0x07DC); n++;
+    case 0x07DC: AOT::op<0xFE>(c,0x07DE,0x8C); n++;
+    case 0x07DE: AOT::op<0x1E>(c,0x07E0,0x04); n++;
+    case 0x07E0: AOT::op<0xC2>(c,0x07E3,0x02D1); n++; if (c.pc!=0x07E3) return n;
+    case 0x07E3: AOT::op<0xE1>(c,0x07E4); n++;
+    case 0x07E4: AOT::op<0x22>(c,0x07E7,0x01D4); n++; if (x.stop) return n;
+    case 0x07E7: AOT::op<0x23>(c,0x07E8); n++;
+    case 0x07E8: AOT::op<0x7C>(c,0x07E9); n++;
+    case 0x07E9: AOT::op<0xB5>(c,0x07EA); n++;
+    case 0x07EA: AOT::op<0xC2>(c,0x07ED,0x07F4); n++; if (c.pc!=0x07ED) { if (n<x.left) goto L07F4; return n; }
+    case 0x07ED: AOT::op<0x3A>(c,0x07F0,0x0241); n++;
+    case 0x07F0: AOT::op<0xB7>(c,0x07F1); n++;
+    case 0x07F1: AOT::op<0xC2>(c,0x07F4,0x02F6); n++; if (c.pc!=0x07F4) return n;
+    case 0x07F4: L07F4: AOT::op<0x21>(c,0x07F7,0x060C); n++;
+    case 0x07F7: AOT::op<0xE3>(c,0x07F8); n++; if (x.stop) return n;
+    case 0x07F8: AOT::op<0x3E>(c,0x07FA,0xE1); n++;
+    case 0x07FA: AOT::op<0x01>(c,0x07FD,0x0E3A); n++;
+    case 0x07FD: AOT::op<0x00>(c,0x07FE); n++;
+    case 0x07FE: AOT::op<0x06>(c,0x0800,0x00); n++;
+    case 0x0800: L0800: AOT::op<0x79>(c,0x0801); n++;
+    case 0x0801: AOT::op<0x48>(c,0x0802); n++;
+    case 0x0802: AOT::op<0x47>(c,0x0803); n++;
+    case 0x0803: L0803: AOT::op<0x7E>(c,0x0804); n++;
+    case 0x0804: AOT::op<0xB7>(c,0x0805); n++;
+    case 0x0805: AOT::op<0xC8>(c,0x0806); n++; if (c.pc!=0x0806) return n;
+    case 0x0806: AOT::op<0xB8>(c,0x0807); n++;
+    case 0x0807: AOT::op<0xC8>(c,0x0808); n++; if (c.pc!=0x0808) return n;
+    case 0x0808: AOT::op<0x23>(c,0x0809); n++;
+    case 0x0809: AOT::op<0xFE>(c,0x080B,0x22); n++;
+    case 0x080B: AOT::op<0xCA>(c,0x080E,0x0800); n++; if (c.pc!=0x080E) { if (n<x.left) goto L0800; return n; }
+    case 0x080E: AOT::op<0xC3>(c,0x0811,0x0803); n++; { if (n<x.left) goto L0803; return n; }
+    }
+  return n;
+}
+
+static unsigned b0811(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0811: AOT::op<0xCD>(c,0x0814,0x0C44); n++; return n;
+    case 0x0814: AOT::op<0xCF>(c,0x0815); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0816(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0816: AOT::op<0xD5>(c,0x0817); n++; if (x.stop) return n;
+    case 0x0817: AOT::op<0x3A>(c,0x081A,0x0224); n++;
+    case 0x081A: AOT::op<0xF5>(c,0x081B); n++; if (x.stop) return n;
+    case 0x081B: AOT::op<0xCD>(c,0x081E,0x0A94); n++; return n;
+    case 0x081E: AOT::op<0xF1>(c,0x081F); n++;
+    case 0x081F: AOT::op<0xE3>(c,0x0820); n++; if (x.stop) return n;
+    case 0x0820: AOT::op<0x22>(c,0x0823,0x0243); n++; if (x.stop) return n;
+    case 0x0823: AOT::op<0x1F>(c,0x0824); n++;
+    case 0x0824: AOT::op<0xCD>(c,0x0827,0x0A88); n++; return n;
+    case 0x0827: AOT::op<0xCA>(c,0x082A,0x085C); n++; if (c.pc!=0x082A) return n;
+    case 0x082A: AOT::op<0xE5>(c,0x082B); n++; if (x.stop) return n;
+    case 0x082B: AOT::op<0x2A>(c,0x082E,0x0253); n++;
+    case 0x082E: AOT::op<0xE5>(c,0x082F); n++; if (x.stop) return n;
+    case 0x082F: AOT::op<0x23>(c,0x0830); n++;
+    case 0x0830: AOT::op<0x23>(c,0x0831); n++;
+    case 0x0831: AOT::op<0x5E>(c,0x0832); n++;
+    case 0x0832: AOT::op<0x23>(c,0x0833); n++;
+    case 0x0833: AOT::op<0x56>(c,0x0834); n++;
+    case 0x0834: AOT::op<0x2A>(c,0x0837,0x01D6); n++;
+    case 0x0837: AOT::op<0xE7>(c,0x0838); n++; return n;
+    case 0x0838: AOT::op<0xD2>(c,0x083B,0x084B); n++; if (c.pc!=0x083B) return n;
+    case 0x083B: AOT::op<0x2A>(c,0x083E,0x01D2); n++;
+    case 0x083E: AOT::op<0xE7>(c,0x083F); n++; return n;
+    case 0x083F: AOT::op<0xD1>(c,0x0840); n++;
+    case 0x0840: AOT::op<0xD2>(c,0x0843,0x0853); n++; if (c.pc!=0x0843) { if (n<x.left) goto L0853; return n; }
+    case 0x0843: AOT::op<0x2A>(c,0x0846,0x024B); n++;
+    case 0x0846: AOT::op<0xE7>(c,0x0847); n++; return n;
+    case 0x0847: AOT::op<0xD2>(c,0x084A,0x0853); n++; if (c.pc!=0x084A) { if (n<x.left) goto L0853; return n; }
+    case 0x084A: AOT::op<0x3E>(c,0x084C,0xD1); n++;
+    case 0x084C: AOT::op<0xCD>(c,0x084F,0x1032); n++; return n;
+    case 0x084F: AOT::op<0xEB>(c,0x0850); n++;
+    case 0x0850: AOT::op<0xCD>(c,0x0853,0x0E7F); n++; return n;
+    case 0x0853: L0853: AOT::op<0xCD>(c,0x0856,0x1032); n++; return n;
+    case 0x0856: AOT::op<0xE1>(c,0x0857); n++;
+    case 0x0857: AOT::op<0xCD>(c,0x085A,0x14BB); n++; return n;
+    case 0x085A: AOT::op<0xE1>(c,0x085B); n++;
+    case 0x085B: AOT::op<0xC9>(c,0x085C); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b085C(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x085C: AOT::op<0xE5>(c,0x085D); n++; if (x.stop) return n;
+    case 0x085D: AOT::op<0xCD>(c,0x0860,0x14B8); n++; return n;
+    case 0x0860: AOT::op<0xD1>(c,0x0861); n++;
+    case 0x0861: AOT::op<0xE1>(c,0x0862); n++;
+    case 0x0862: AOT::op<0xC9>(c,0x0863); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0863(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0863: AOT::op<0xCD>(c,0x0866,0x1131); n++; return n;
+    case 0x0866: AOT::op<0x7E>(c,0x0867); n++;
+    case 0x0867: AOT::op<0x47>(c,0x0868); n++;
+    case 0x0868: AOT::op<0xFE>(c,0x086A,0x8C); n++;
+    case 0x086A: AOT::op<0xCA>(c,0x086D,0x0870); n++; if (c.pc!=0x086D) return n;
+    case 0x086D: AOT::op<0xCF>(c,0x086E); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b086F(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x086F: AOT::op<0x2B>(c,0x0870); n++;
+    case 0x0870: AOT::op<0x4B>(c,0x0871); n++;
+    case 0x0871: L0871: AOT::op<0x0D>(c,0x0872); n++;
+    case 0x0872: AOT::op<0x78>(c,0x0873); n++;
+    case 0x0873: AOT::op<0xCA>(c,0x0876,0x0636); n++; if (c.pc!=0x0876) return n;
+    case 0x0876: AOT::op<0xCD>(c,0x0879,0x0753); n++; return n;
+    case 0x0879: AOT::op<0xFE>(c,0x087B,0x2C); n++;
+    case 0x087B: AOT::op<0xC0>(c,0x087C); n++; if (c.pc!=0x087C) return n;
+    case 0x087C: AOT::op<0xC3>(c,0x087F,0x0871); n++; { if (n<x.left) goto L0871; return n; }
+    }
+  return n;
+}
+
+static unsigned b087F(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x087F: AOT::op<0xCD>(c,0x0882,0x0A94); n++; return n;
+    case 0x0882: AOT::op<0x7E>(c,0x0883); n++;
+    case 0x0883: AOT::op<0xFE>(c,0x0885,0x88); n++;
+    case 0x0885: AOT::op<0xCA>(c,0x0888,0x088A); n++; if (c.pc!=0x0888) return n;
+    case 0x0888: AOT::op<0xCF>(c,0x0889); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b088A(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x088A: AOT::op<0x2B>(c,0x088B); n++;
+    case 0x088B: AOT::op<0xCD>(c,0x088E,0x0A86); n++; return n;
+    case 0x088E: AOT::op<0xEF>(c,0x088F); n++; return n;
+    case 0x088F: AOT::op<0xCA>(c,0x0892,0x07FC); n++; if (c.pc!=0x0892) return n;
+    case 0x0892: AOT::op<0xD7>(c,0x0893); n++; return n;
+    case 0x0893: AOT::op<0xDA>(c,0x0896,0x07B9); n++; if (c.pc!=0x0896) return n;
+    case 0x0896: AOT::op<0xC3>(c,0x0899,0x0635); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0899(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0899: L0899: AOT::op<0x2B>(c,0x089A); n++;
+    case 0x089A: AOT::op<0xD7>(c,0x089B); n++; return n;
+    case 0x089B: AOT::op<0xCA>(c,0x089E,0x08ED); n++; if (c.pc!=0x089E) return n;
+    case 0x089E: AOT::op<0xC8>(c,0x089F); n++; if (c.pc!=0x089F) return n;
+    case 0x089F: AOT::op<0xFE>(c,0x08A1,0x9D); n++;
+    case 0x08A1: AOT::op<0xCA>(c,0x08A4,0x0916); n++; if (c.pc!=0x08A4) return n;
+    case 0x08A4: AOT::op<0xFE>(c,0x08A6,0xA0); n++;
+    case 0x08A6: AOT::op<0xCA>(c,0x08A9,0x0916); n++; if (c.pc!=0x08A9) return n;
+    case 0x08A9: AOT::op<0xE5>(c,0x08AA); n++; if (x.stop) return n;
+    case 0x08AA: AOT::op<0xFE>(c,0x08AC,0x2C); n++;
+    case 0x08AC: AOT::op<0xCA>(c,0x08AF,0x0902); n++; if (c.pc!=0x08AF) return n;
+    case 0x08AF: AOT::op<0xFE>(c,0x08B1,0x3B); n++;
+    case 0x08B1: AOT::op<0xCA>(c,0x08B4,0x0935); n++; if (c.pc!=0x08B4) return n;
+    case 0x08B4: AOT::op<0xC1>(c,0x08B5); n++;
+    case 0x08B5: AOT::op<0xCD>(c,0x08B8,0x0A94); n++; return n;
+    case 0x08B8: AOT::op<0xE5>(c,0x08B9); n++; if (x.stop) return n;
+    case 0x08B9: AOT::op<0x3A>(c,0x08BC,0x0224); n++;
+    case 0x08BC: AOT::op<0xB7>(c,0x08BD); n++;
+    case 0x08BD: AOT::op<0xC2>(c,0x08C0,0x08D9); n++; if (c.pc!=0x08C0) { if (n<x.left) goto L08D9; return n; }
+    case 0x08C0: AOT::op<0xCD>(c,0x08C3,0x160F); n++; return n;
+    case 0x08C3: AOT::op<0xCD>(c,0x08C6,0x0EA3); n++; return n;
+    case 0x08C6: AOT::op<0x2A>(c,0x08C9,0x0253); n++;
+    case 0x08C9: AOT::op<0x3A>(c,0x08CC,0x0027); n++;
+    case 0x08CC: AOT::op<0x86>(c,0x08CD); n++;
+    case 0x08CD: AOT::op<0xFE>(c,0x08CF,AOT::imm8(c,0x08CE)); n++;
+    case 0x08CF: AOT::op<0xD4>(c,0x08D2,0x08ED); n++; if (c.pc!=0x08D2) return n; if (x.stop) return n;
+    case 0x08D2: AOT::op<0xCD>(c,0x08D5,0x0EE6); n++; return n;
+    case 0x08D5: AOT::op<0x3E>(c,0x08D7,0x20); n++;
+    case 0x08D7: AOT::op<0xDF>(c,0x08D8); n++; return n;
+    case 0x08D8: AOT::op<0xAF>(c,0x08D9); n++;
+    case 0x08D9: L08D9: AOT::op<0xC4>(c,0x08DC,0x0EE6); n++; if (c.pc!=0x08DC) return n; if (x.stop) return n;
+    case 0x08DC: AOT::op<0xE1>(c,0x08DD); n++;
+    case 0x08DD: AOT::op<0xC3>(c,0x08E0,0x0899); n++; { if (n<x.left) goto L0899; return n; }
+    }
+  return n;
+}
+
+static unsigned b08E0(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x08E0: AOT::op<0x3A>(c,0x08E3,0x0027); n++;
+    case 0x08E3: AOT::op<0xB7>(c,0x08E4); n++;
+    case 0x08E4: AOT::op<0xC8>(c,0x08E5); n++; if (c.pc!=0x08E5) return n;
+    case 0x08E5: AOT::op<0xC3>(c,0x08E8,0x08ED); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b08E8(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x08E8: AOT::op<0x36>(c,0x08EA,0x00); n++; if (x.stop) return n;
+    case 0x08EA: AOT::op<0x21>(c,0x08ED,0x01D8); n++;
+    case 0x08ED: AOT::op<0x3E>(c,0x08EF,0x0D); n++;
+    case 0x08EF: AOT::op<0xDF>(c,0x08F0); n++; return n;
+    case 0x08F0: AOT::op<0x3E>(c,0x08F2,0x0A); n++;
+    case 0x08F2: AOT::op<0xDF>(c,0x08F3); n++; return n;
+    case 0x08F3: AOT::op<0x3A>(c,0x08F6,0x0026); n++;
+    case 0x08F6: L08F6: AOT::op<0x3D>(c,0x08F7); n++;
+    case 0x08F7: AOT::op<0x32>(c,0x08FA,0x0027); n++; if (x.stop) return n;
+    case 0x08FA: AOT::op<0xC8>(c,0x08FB); n++; if (c.pc!=0x08FB) return n;
+    case 0x08FB: AOT::op<0xF5>(c,0x08FC); n++; if (x.stop) return n;
+    case 0x08FC: AOT::op<0xAF>(c,0x08FD); n++;
+    case 0x08FD: AOT::op<0xDF>(c,0x08FE); n++; return n;
+    case 0x08FE: AOT::op<0xF1>(c,0x08FF); n++;
+    case 0x08FF: AOT::op<0xC3>(c,0x0902,0x08F6); n++; { if (n<x.left) goto L08F6; return n; }
+    }
+  return n;
+}
+
+static unsigned b0902(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0902: AOT::op<0x3A>(c,0x0905,0x0027); n++;
+    case 0x0905: AOT::op<0xFE>(c,0x0907,AOT::imm8(c,0x0906)); n++;
+    case 0x0907: AOT::op<0xD4>(c,0x090A,0x08ED); n++; if (c.pc!=0x090A) return n; if (x.stop) return n;
+    case 0x090A: AOT::op<0xD2>(c,0x090D,0x0935); n++; if (c.pc!=0x090D) return n;
+    case 0x090D: L090D: AOT::op<0xD6>(c,0x090F,0x0E); n++;
+    case 0x090F: AOT::op<0xD2>(c,0x0912,0x090D); n++; if (c.pc!=0x0912) { if (n<x.left) goto L090D; return n; }
+    case 0x0912: AOT::op<0x2F>(c,0x0913); n++;
+    case 0x0913: AOT::op<0xC3>(c,0x0916,0x092C); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0916(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0916: AOT::op<0xF5>(c,0x0917); n++; if (x.stop) return n;
+    case 0x0917: AOT::op<0xCD>(c,0x091A,0x1130); n++; return n;
+    case 0x091A: AOT::op<0xCF>(c,0x091B); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b091C(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x091C: AOT::op<0x2B>(c,0x091D); n++;
+    case 0x091D: AOT::op<0xF1>(c,0x091E); n++;
+    case 0x091E: AOT::op<0xD6>(c,0x0920,0xA0); n++;
+    case 0x0920: AOT::op<0xE5>(c,0x0921); n++; if (x.stop) return n;
+    case 0x0921: AOT::op<0xCA>(c,0x0924,0x0927); n++; if (c.pc!=0x0924) { if (n<x.left) goto L0927; return n; }
+    case 0x0924: AOT::op<0x3A>(c,0x0927,0x0027); n++;
+    case 0x0927: L0927: AOT::op<0x2F>(c,0x0928); n++;
+    case 0x0928: AOT::op<0x83>(c,0x0929); n++;
+    case 0x0929: AOT::op<0xD2>(c,0x092C,0x0935); n++; if (c.pc!=0x092C) { if (n<x.left) goto L0935; return n; }
+    case 0x092C: AOT::op<0x3C>(c,0x092D); n++;
+    case 0x092D: AOT::op<0x47>(c,0x092E); n++;
+    case 0x092E: AOT::op<0x3E>(c,0x0930,0x20); n++;
+    case 0x0930: L0930: AOT::op<0xDF>(c,0x0931); n++; return n;
+    case 0x0931: AOT::op<0x05>(c,0x0932); n++;
+    case 0x0932: AOT::op<0xC2>(c,0x0935,0x0930); n++; if (c.pc!=0x0935) { if (n<x.left) goto L0930; return n; }
+    case 0x0935: L0935: AOT::op<0xE1>(c,0x0936); n++;
+    case 0x0936: AOT::op<0xD7>(c,0x0937); n++; return n;
+    case 0x0937: AOT::op<0xC3>(c,0x093A,0x089E); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b094D(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x094D: AOT::op<0x3A>(c,0x0950,0x0242); n++;
+    case 0x0950: AOT::op<0xB7>(c,0x0951); n++;
+    case 0x0951: AOT::op<0xC2>(c,0x0954,0x02C0); n++; if (c.pc!=0x0954) return n;
+    case 0x0954: AOT::op<0xC1>(c,0x0955); n++;
+    case 0x0955: AOT::op<0x21>(c,0x0958,0x093A); n++;
+    case 0x0958: AOT::op<0xCD>(c,0x095B,0x0EE3); n++; return n;
+    case 0x095B: AOT::op<0xC3>(c,0x095E,0x03EB); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b095E(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x095E: AOT::op<0xFE>(c,0x0960,0x22); n++;
+    case 0x0960: AOT::op<0x3E>(c,0x0962,0x00); n++;
+    case 0x0962: AOT::op<0x32>(c,0x0965,0x01D1); n++; if (x.stop) return n;
+    case 0x0965: AOT::op<0xC2>(c,0x0968,0x0972); n++; if (c.pc!=0x0968) return n;
+    case 0x0968: AOT::op<0xCD>(c,0x096B,0x0EA4); n++; return n;
+    case 0x096B: AOT::op<0xCF>(c,0x096C); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b096D(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x096D: AOT::op<0xE5>(c,0x096E); n++; if (x.stop) return n;
+    case 0x096E: AOT::op<0xCD>(c,0x0971,0x0EE6); n++; return n;
+    case 0x0971: AOT::op<0x3E>(c,0x0973,0xE5); n++;
+    case 0x0973: AOT::op<0xCD>(c,0x0976,0x0E52); n++; return n;
+    case 0x0976: AOT::op<0xCD>(c,0x0979,0x03EF); n++; return n;
+    case 0x0979: AOT::op<0xC1>(c,0x097A); n++;
+    case 0x097A: AOT::op<0xDA>(c,0x097D,0x0686); n++; if (c.pc!=0x097D) return n;
+    case 0x097D: AOT::op<0x23>(c,0x097E); n++;
+    case 0x097E: AOT::op<0x7E>(c,0x097F); n++;
+    case 0x097F: AOT::op<0xB7>(c,0x0980); n++;
+    case 0x0980: AOT::op<0x2B>(c,0x0981); n++;
+    case 0x0981: AOT::op<0xC5>(c,0x0982); n++; if (x.stop) return n;
+    case 0x0982: AOT::op<0xCA>(c,0x0985,0x07F9); n++; if (c.pc!=0x0985) return n;
+    case 0x0985: AOT::op<0xC3>(c,0x0988,0x098D); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0988(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0988: AOT::op<0xE5>(c,0x0989); n++; if (x.stop) return n;
+    case 0x0989: AOT::op<0x2A>(c,0x098C,0x0251); n++;
+    case 0x098C: AOT::op<0xF6>(c,0x098E,0xAF); n++;
+    case 0x098E: AOT::op<0x32>(c,0x0991,0x0242); n++; if (x.stop) return n;
+    case 0x0991: AOT::op<0xE3>(c,0x0992); n++; if (x.stop) return n;
+    case 0x0992: AOT::op<0x01>(c,0x0995,0x2CCF); n++;
+    case 0x0995: AOT::op<0xCD>(c,0x0998,0x0C44); n++; return n;
+    case 0x0998: AOT::op<0xE3>(c,0x0999); n++; if (x.stop) return n;
+    case 0x0999: AOT::op<0xD5>(c,0x099A); n++; if (x.stop) return n;
+    case 0x099A: AOT::op<0x7E>(c,0x099B); n++;
+    case 0x099B: AOT::op<0xFE>(c,0x099D,0x2C); n++;
+    case 0x099D: AOT::op<0xCA>(c,0x09A0,0x09BB); n++; if (c.pc!=0x09A0) { if (n<x.left) goto L09BB; return n; }
+    case 0x09A0: AOT::op<0x3A>(c,0x09A3,0x0242); n++;
+    case 0x09A3: AOT::op<0xB7>(c,0x09A4); n++;
+    case 0x09A4: AOT::op<0xC2>(c,0x09A7,0x0A18); n++; if (c.pc!=0x09A7) return n;
+    case 0x09A7: AOT::op<0x3E>(c,0x09A9,0x3F); n++;
+    case 0x09A9: AOT::op<0xDF>(c,0x09AA); n++; return n;
+    case 0x09AA: AOT::op<0xCD>(c,0x09AD,0x03EF); n++; return n;
+    case 0x09AD: AOT::op<0xD1>(c,0x09AE); n++;
+    case 0x09AE: AOT::op<0xC1>(c,0x09AF); n++;
+    case 0x09AF: AOT::op<0xDA>(c,0x09B2,0x0686); n++; if (c.pc!=0x09B2) return n;
+    case 0x09B2: AOT::op<0x23>(c,0x09B3); n++;
+    case 0x09B3: AOT::op<0x7E>(c,0x09B4); n++;
+    case 0x09B4: AOT::op<0xB7>(c,0x09B5); n++;
+    case 0x09B5: AOT::op<0x2B>(c,0x09B6); n++;
+    case 0x09B6: AOT::op<0xC5>(c,0x09B7); n++; if (x.stop) return n;
+    case 0x09B7: AOT::op<0xCA>(c,0x09BA,0x07F9); n++; if (c.pc!=0x09BA) return n;
+    case 0x09BA: AOT::op<0xD5>(c,0x09BB); n++; if (x.stop) return n;
+    case 0x09BB: L09BB: AOT::op<0x3A>(c,0x09BE,0x0224); n++;
+    case 0x09BE: AOT::op<0xB7>(c,0x09BF); n++;
+    case 0x09BF: AOT::op<0xCA>(c,0x09C2,0x09DB); n++; if (c.pc!=0x09C2) return n;
+    case 0x09C2: AOT::op<0xD7>(c,0x09C3); n++; return n;
+    case 0x09C3: AOT::op<0x57>(c,0x09C4); n++;
+    case 0x09C4: AOT::op<0x47>(c,0x09C5); n++;
+    case 0x09C5: AOT::op<0xFE>(c,0x09C7,0x22); n++;
+    case 0x09C7: AOT::op<0xCA>(c,0x09CA,0x09CF); n++; if (c.pc!=0x09CA) { if (n<x.left) goto L09CF; return n; }
+    case 0x09CA: AOT::op<0x16>(c,0x09CC,0x3A); n++;
+    case 0x09CC: AOT::op<0x06>(c,0x09CE,0x2C); n++;
+    case 0x09CE: AOT::op<0x2B>(c,0x09CF); n++;
+    case 0x09CF: L09CF: AOT::op<0xCD>(c,0x09D2,0x0EA7); n++; return n;
+    case 0x09D2: AOT::op<0xEB>(c,0x09D3); n++;
+    case 0x09D3: AOT::op<0x21>(c,0x09D6,0x09E4); n++;
+    case 0x09D6: AOT::op<0xE3>(c,0x09D7); n++; if (x.stop) return n;
+    case 0x09D7: AOT::op<0xD5>(c,0x09D8); n++; if (x.stop) return n;
+    case 0x09D8: AOT::op<0xC3>(c,0x09DB,0x082A); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b09DB(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x09DB: AOT::op<0xD7>(c,0x09DC); n++; return n;
+    case 0x09DC: AOT::op<0xCD>(c,0x09DF,0x1565); n++; return n;
+    case 0x09DF: AOT::op<0xE3>(c,0x09E0); n++; if (x.stop) return n;
+    case 0x09E0: AOT::op<0xCD>(c,0x09E3,0x14B8); n++; return n;
+    case 0x09E3: AOT::op<0xE1>(c,0x09E4); n++;
+    case 0x09E4: AOT::op<0x2B>(c,0x09E5); n++;
+    case 0x09E5: AOT::op<0xD7>(c,0x09E6); n++; return n;
+    case 0x09E6: AOT::op<0xCA>(c,0x09E9,0x09EE); n++; if (c.pc!=0x09E9) { if (n<x.left) goto L09EE; return n; }
+    case 0x09E9: AOT::op<0xFE>(c,0x09EB,0x2C); n++;
+    case 0x09EB: AOT::op<0xC2>(c,0x09EE,0x094D); n++; if (c.pc!=0x09EE) return n;
+    case 0x09EE: L09EE: AOT::op<0xE3>(c,0x09EF); n++; if (x.stop) return n;
+    case 0x09EF: AOT::op<0x2B>(c,0x09F0); n++;
+    case 0x09F0: AOT::op<0xD7>(c,0x09F1); n++; return n;
+    case 0x09F1: AOT::op<0xC2>(c,0x09F4,0x0993); n++; if (c.pc!=0x09F4) return n;
+    case 0x09F4: AOT::op<0xD1>(c,0x09F5); n++;
+    case 0x09F5: AOT::op<0x3A>(c,0x09F8,0x0242); n++;
+    case 0x09F8: AOT::op<0xB7>(c,0x09F9); n++;
+    case 0x09F9: AOT::op<0xEB>(c,0x09FA); n++;
+    case 0x09FA: AOT::op<0xC2>(c,0x09FD,0x0663); n++; if (c.pc!=0x09FD) return n;
+    case 0x09FD: AOT::op<0xD5>(c,0x09FE); n++; if (x.stop) return n;
+    case 0x09FE: AOT::op<0xB6>(c,0x09FF); n++;
+    case 0x09FF: AOT::op<0x21>(c,0x0A02,0x0A07); n++;
+    case 0x0A02: AOT::op<0xC4>(c,0x0A05,0x0EE3); n++; if (c.pc!=0x0A05) return n; if (x.stop) return n;
+    case 0x0A05: AOT::op<0xE1>(c,0x0A06); n++;
+    case 0x0A06: AOT::op<0xC9>(c,0x0A07); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0A18(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0A18: L0A18: AOT::op<0xCD>(c,0x0A1B,0x07FA); n++; return n;
+    case 0x0A1B: AOT::op<0xB7>(c,0x0A1C); n++;
+    case 0x0A1C: AOT::op<0xC2>(c,0x0A1F,0x0A31); n++; if (c.pc!=0x0A1F) { if (n<x.left) goto L0A31; return n; }
+    case 0x0A1F: AOT::op<0x23>(c,0x0A20); n++;
+    case 0x0A20: AOT::op<0x7E>(c,0x0A21); n++;
+    case 0x0A21: AOT::op<0x23>(c,0x0A22); n++;
+    case 0x0A22: AOT::op<0xB6>(c,0x0A23); n++;
+    case 0x0A23: AOT::op<0x1E>(c,0x0A25,0x06); n++;
+    case 0x0A25: AOT::op<0xCA>(c,0x0A28,0x02D1); n++; if (c.pc!=0x0A28) return n;
+    case 0x0A28: AOT::op<0x23>(c,0x0A29); n++;
+    case 0x0A29: AOT::op<0x5E>(c,0x0A2A); n++;
+    case 0x0A2A: AOT::op<0x23>(c,0x0A2B); n++;
+    case 0x0A2B: AOT::op<0x56>(c,0x0A2C); n++;
+    case 0x0A2C: AOT::op<0xEB>(c,0x0A2D); n++;
+    case 0x0A2D: AOT::op<0x22>(c,0x0A30,0x023E); n++; if (x.stop) return n;
+    case 0x0A30: AOT::op<0xEB>(c,0x0A31); n++;
+    case 0x0A31: L0A31: AOT::op<0xD7>(c,0x0A32); n++; return n;
+    case 0x0A32: AOT::op<0xFE>(c,0x0A34,0x83); n++;
+    case 0x0A34: AOT::op<0xC2>(c,0x0A37,0x0A18); n++; if (c.pc!=0x0A37) { if (n<x.left) goto L0A18; return n; }
+    case 0x0A37: AOT::op<0xC3>(c,0x0A3A,0x09BB); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0A3A(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0A3A: AOT::op<0x11>(c,0x0A3D,0x0000); n++;
+    case 0x0A3D: AOT::op<0xC4>(c,0x0A40,0x0C44); n++; if (c.pc!=0x0A40) return n; if (x.stop) return n;
+    case 0x0A40: AOT::op<0x22>(c,0x0A43,0x0243); n++; if (x.stop) return n;
+    case 0x0A43: AOT::op<0xCD>(c,0x0A46,0x0276); n++; return n;
+    case 0x0A46: AOT::op<0xC2>(c,0x0A49,0x02CC); n++; if (c.pc!=0x0A49) return n;
+    case 0x0A49: AOT::op<0xF9>(c,0x0A4A); n++;
+    case 0x0A4A: AOT::op<0xD5>(c,0x0A4B); n++; if (x.stop) return n;
+    case 0x0A4B: AOT::op<0x7E>(c,0x0A4C); n++;
+    case 0x0A4C: AOT::op<0x23>(c,0x0A4D); n++;
+    case 0x0A4D: AOT::op<0xF5>(c,0x0A4E); n++; if (x.stop) return n;
+    case 0x0A4E: AOT::op<0xD5>(c,0x0A4F); n++; if (x.stop) return n;
+    case 0x0A4F: AOT::op<0xCD>(c,0x0A52,0x149E); n++; return n;
+    case 0x0A52: AOT::op<0xE3>(c,0x0A53); n++; if (x.stop) return n;
+    case 0x0A53: AOT::op<0xE5>(c,0x0A54); n++; if (x.stop) return n;
+    case 0x0A54: AOT::op<0xCD>(c,0x0A57,0x1212); n++; return n;
+    case 0x0A57: AOT::op<0xE1>(c,0x0A58); n++;
+    case 0x0A58: AOT::op<0xCD>(c,0x0A5B,0x14B8); n++; return n;
+    case 0x0A5B: AOT::op<0xE1>(c,0x0A5C); n++;
+    case 0x0A5C: AOT::op<0xCD>(c,0x0A5F,0x14AF); n++; return n;
+    case 0x0A5F: AOT::op<0xE5>(c,0x0A60); n++; if (x.stop) return n;
+    case 0x0A60: AOT::op<0xCD>(c,0x0A63,0x14DB); n++; return n;
+    case 0x0A63: AOT::op<0xE1>(c,0x0A64); n++;
+    case 0x0A64: AOT::op<0xC1>(c,0x0A65); n++;
+    case 0x0A65: AOT::op<0x90>(c,0x0A66); n++;
+    case 0x0A66: AOT::op<0xCD>(c,0x0A69,0x14AF); n++; return n;
+    case 0x0A69: AOT::op<0xCA>(c,0x0A6C,0x0A75); n++; if (c.pc!=0x0A6C) return n;
+    case 0x0A6C: AOT::op<0xEB>(c,0x0A6D); n++;
+    case 0x0A6D: AOT::op<0x22>(c,0x0A70,0x01D4); n++; if (x.stop) return n;
+    case 0x0A70: AOT::op<0x69>(c,0x0A71); n++;
+    case 0x0A71: AOT::op<0x60>(c,0x0A72); n++;
+    case 0x0A72: AOT::op<0xC3>(c,0x0A75,0x0608); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0A75(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0A75: AOT::op<0xF9>(c,0x0A76); n++;
+    case 0x0A76: AOT::op<0x2A>(c,0x0A79,0x0243); n++;
+    case 0x0A79: AOT::op<0x7E>(c,0x0A7A); n++;
+    case 0x0A7A: AOT::op<0xFE>(c,0x0A7C,0x2C); n++;
+    case 0x0A7C: AOT::op<0xC2>(c,0x0A7F,0x060C); n++; if (c.pc!=0x0A7F) return n;
+    case 0x0A7F: AOT::op<0xD7>(c,0x0A80); n++; return n;
+    case 0x0A80: AOT::op<0xCD>(c,0x0A83,0x0A3D); n++; return n;
+    case 0x0A83: AOT::op<0xCD>(c,0x0A86,0x0A94); n++; return n;
+    case 0x0A86: AOT::op<0xF6>(c,0x0A88,0x37); n++;
+    case 0x0A88: AOT::op<0x3A>(c,0x0A8B,0x0224); n++;
+    case 0x0A8B: AOT::op<0x8F>(c,0x0A8C); n++;
+    case 0x0A8C: AOT::op<0xE8>(c,0x0A8D); n++; if (c.pc!=0x0A8D) return n;
+    case 0x0A8D: AOT::op<0x1E>(c,0x0A8F,0x18); n++;
+    case 0x0A8F: AOT::op<0xC3>(c,0x0A92,0x02D1); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0A92(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0A92: AOT::op<0xCF>(c,0x0A93); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0A94(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0A94: AOT::op<0x2B>(c,0x0A95); n++;
+    case 0x0A95: AOT::op<0x16>(c,0x0A97,0x00); n++;
+    case 0x0A97: AOT::op<0xD5>(c,0x0A98); n++; if (x.stop) return n;
+    case 0x0A98: AOT::op<0x0E>(c,0x0A9A,0x01); n++;
+    case 0x0A9A: AOT::op<0xCD>(c,0x0A9D,0x02A6); n++; return n;
+    case 0x0A9D: AOT::op<0xCD>(c,0x0AA0,0x0B09); n++; return n;
+    case 0x0AA0: AOT::op<0x22>(c,0x0AA3,0x0245); n++; if (x.stop) return n;
+    case 0x0AA3: AOT::op<0x2A>(c,0x0AA6,0x0245); n++;
+    case 0x0AA6: AOT::op<0xC1>(c,0x0AA7); n++;
+    case 0x0AA7: AOT::op<0x78>(c,0x0AA8); n++;
+    case 0x0AA8: AOT::op<0xFE>(c,0x0AAA,0x78); n++;
+    case 0x0AAA: AOT::op<0xD4>(c,0x0AAD,0x0A86); n++; if (c.pc!=0x0AAD) return n; if (x.stop) return n;
+    case 0x0AAD: AOT::op<0x7E>(c,0x0AAE); n++;
+    case 0x0AAE: AOT::op<0x16>(c,0x0AB0,0x00); n++;
+    case 0x0AB0: L0AB0: AOT::op<0xD6>(c,0x0AB2,0xAB); n++;
+    case 0x0AB2: AOT::op<0xDA>(c,0x0AB5,0x0ACA); n++; if (c.pc!=0x0AB5) return n;
+    case 0x0AB5: AOT::op<0xFE>(c,0x0AB7,0x03); n++;
+    case 0x0AB7: AOT::op<0xD2>(c,0x0ABA,0x0ACA); n++; if (c.pc!=0x0ABA) return n;
+    case 0x0ABA: AOT::op<0xFE>(c,0x0ABC,0x01); n++;
+    case 0x0ABC: AOT::op<0x17>(c,0x0ABD); n++;
+    case 0x0ABD: AOT::op<0xAA>(c,0x0ABE); n++;
+    case 0x0ABE: AOT::op<0xBA>(c,0x0ABF); n++;
+    case 0x0ABF: AOT::op<0x57>(c,0x0AC0); n++;
+    case 0x0AC0: AOT::op<0xDA>(c,0x0AC3,0x02C6); n++; if (c.pc!=0x0AC3) return n;
+    case 0x0AC3: AOT::op<0x22>(c,0x0AC6,0x023C); n++; if (x.stop) return n;
+    case 0x0AC6: AOT::op<0xD7>(c,0x0AC7); n++; return n;
+    case 0x0AC7: AOT::op<0xC3>(c,0x0ACA,0x0AB0); n++; { if (n<x.left) goto L0AB0; return n; }
+    }
+  return n;
+}
+
+static unsigned b0ACA(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0ACA: AOT::op<0x7A>(c,0x0ACB); n++;
+    case 0x0ACB: AOT::op<0xB7>(c,0x0ACC); n++;
+    case 0x0ACC: AOT::op<0xC2>(c,0x0ACF,0x0BC3); n++; if (c.pc!=0x0ACF) return n;
+    case 0x0ACF: AOT::op<0x7E>(c,0x0AD0); n++;
+    case 0x0AD0: AOT::op<0x22>(c,0x0AD3,0x023C); n++; if (x.stop) return n;
+    case 0x0AD3: AOT::op<0xD6>(c,0x0AD5,0xA4); n++;
+    case 0x0AD5: AOT::op<0xD8>(c,0x0AD6); n++; if (c.pc!=0x0AD6) return n;
+    case 0x0AD6: AOT::op<0xFE>(c,0x0AD8,0x07); n++;
+    case 0x0AD8: AOT::op<0xD0>(c,0x0AD9); n++; if (c.pc!=0x0AD9) return n;
+    case 0x0AD9: AOT::op<0x5F>(c,0x0ADA); n++;
+    case 0x0ADA: AOT::op<0x3A>(c,0x0ADD,0x0224); n++;
+    case 0x0ADD: AOT::op<0x3D>(c,0x0ADE); n++;
+    case 0x0ADE: AOT::op<0xB3>(c,0x0ADF); n++;
+    case 0x0ADF: AOT::op<0x7B>(c,0x0AE0); n++;
+    case 0x0AE0: AOT::op<0xCA>(c,0x0AE3,0x0FC9); n++; if (c.pc!=0x0AE3) return n;
+    case 0x0AE3: AOT::op<0x07>(c,0x0AE4); n++;
+    case 0x0AE4: AOT::op<0x83>(c,0x0AE5); n++;
+    case 0x0AE5: AOT::op<0x5F>(c,0x0AE6); n++;
+    case 0x0AE6: AOT::op<0x21>(c,0x0AE9,0x0195); n++;
+    case 0x0AE9: AOT::op<0x19>(c,0x0AEA); n++;
+    case 0x0AEA: AOT::op<0x78>(c,0x0AEB); n++;
+    case 0x0AEB: AOT::op<0x56>(c,0x0AEC); n++;
+    case 0x0AEC: AOT::op<0xBA>(c,0x0AED); n++;
+    case 0x0AED: AOT::op<0xD0>(c,0x0AEE); n++; if (c.pc!=0x0AEE) return n;
+    case 0x0AEE: AOT::op<0x23>(c,0x0AEF); n++;
+    case 0x0AEF: AOT::op<0xCD>(c,0x0AF2,0x0A86); n++; return n;
+    case 0x0AF2: AOT::op<0xC5>(c,0x0AF3); n++; if (x.stop) return n;
+    case 0x0AF3: AOT::op<0x01>(c,0x0AF6,0x0AA3); n++;
+    case 0x0AF6: AOT::op<0xC5>(c,0x0AF7); n++; if (x.stop) return n;
+    case 0x0AF7: AOT::op<0x43>(c,0x0AF8); n++;
+    case 0x0AF8: AOT::op<0x4A>(c,0x0AF9); n++;
+    case 0x0AF9: AOT::op<0xCD>(c,0x0AFC,0x1491); n++; return n;
+    case 0x0AFC: AOT::op<0x58>(c,0x0AFD); n++;
+    case 0x0AFD: AOT::op<0x51>(c,0x0AFE); n++;
+    case 0x0AFE: AOT::op<0x4E>(c,0x0AFF); n++;
+    case 0x0AFF: AOT::op<0x23>(c,0x0B00); n++;
+    case 0x0B00: AOT::op<0x46>(c,0x0B01); n++;
+    case 0x0B01: AOT::op<0x23>(c,0x0B02); n++;
+    case 0x0B02: AOT::op<0xC5>(c,0x0B03); n++; if (x.stop) return n;
+    case 0x0B03: AOT::op<0x2A>(c,0x0B06,0x023C); n++;
+    case 0x0B06: AOT::op<0xC3>(c,0x0B09,0x0A97); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0B09(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0B09: L0B09: AOT::op<0xAF>(c,0x0B0A); n++;
+    case 0x0B0A: AOT::op<0x32>(c,0x0B0D,0x0224); n++; if (x.stop) return n;
+    case 0x0B0D: AOT::op<0xD7>(c,0x0B0E); n++; return n;
+    case 0x0B0E: AOT::op<0x1E>(c,0x0B10,0x24); n++;
+    case 0x0B10: AOT::op<0xCA>(c,0x0B13,0x02D1); n++; if (c.pc!=0x0B13) return n;
+    case 0x0B13: AOT::op<0xDA>(c,0x0B16,0x1565); n++; if (c.pc!=0x0B16) return n;
+    case 0x0B16: AOT::op<0xCD>(c,0x0B19,0x0728); n++; return n;
+    case 0x0B19: AOT::op<0xD2>(c,0x0B1C,0x0B56); n++; if (c.pc!=0x0B1C) return n;
+    case 0x0B1C: AOT::op<0xFE>(c,0x0B1E,0xA4); n++;
+    case 0x0B1E: AOT::op<0xCA>(c,0x0B21,0x0B09); n++; if (c.pc!=0x0B21) { if (n<x.left) goto L0B09; return n; }
+    case 0x0B21: AOT::op<0xFE>(c,0x0B23,0x2E); n++;
+    case 0x0B23: AOT::op<0xCA>(c,0x0B26,0x1565); n++; if (c.pc!=0x0B26) return n;
+    case 0x0B26: AOT::op<0xFE>(c,0x0B28,0xA5); n++;
+    case 0x0B28: AOT::op<0xCA>(c,0x0B2B,0x0B45); n++; if (c.pc!=0x0B2B) return n;
+    case 0x0B2B: AOT::op<0xFE>(c,0x0B2D,0x22); n++;
+    case 0x0B2D: AOT::op<0xCA>(c,0x0B30,0x0EA4); n++; if (c.pc!=0x0B30) return n;
+    case 0x0B30: AOT::op<0xFE>(c,0x0B32,0xA2); n++;
+    case 0x0B32: AOT::op<0xCA>(c,0x0B35,0x0C23); n++; if (c.pc!=0x0B35) return n;
+    case 0x0B35: AOT::op<0xFE>(c,0x0B37,0x9F); n++;
+    case 0x0B37: AOT::op<0xCA>(c,0x0B3A,0x0E16); n++; if (c.pc!=0x0B3A) return n;
+    case 0x0B3A: AOT::op<0xD6>(c,0x0B3C,0xAE); n++;
+    case 0x0B3C: AOT::op<0xD2>(c,0x0B3F,0x0B67); n++; if (c.pc!=0x0B3F) return n;
+    case 0x0B3F: AOT::op<0xCD>(c,0x0B42,0x0A92); n++; return n;
+    case 0x0B42: AOT::op<0xCF>(c,0x0B43); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0B44(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0B44: AOT::op<0xC9>(c,0x0B45); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0B45(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0B45: AOT::op<0x16>(c,0x0B47,0x7D); n++;
+    case 0x0B47: AOT::op<0xCD>(c,0x0B4A,0x0A97); n++; return n;
+    case 0x0B4A: AOT::op<0x2A>(c,0x0B4D,0x0245); n++;
+    case 0x0B4D: AOT::op<0xE5>(c,0x0B4E); n++; if (x.stop) return n;
+    case 0x0B4E: AOT::op<0xCD>(c,0x0B51,0x1489); n++; return n;
+    case 0x0B51: AOT::op<0xCD>(c,0x0B54,0x0A86); n++; return n;
+    case 0x0B54: AOT::op<0xE1>(c,0x0B55); n++;
+    case 0x0B55: AOT::op<0xC9>(c,0x0B56); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0B56(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0B56: AOT::op<0xCD>(c,0x0B59,0x0C44); n++; return n;
+    case 0x0B59: AOT::op<0xE5>(c,0x0B5A); n++; if (x.stop) return n;
+    case 0x0B5A: AOT::op<0xEB>(c,0x0B5B); n++;
+    case 0x0B5B: AOT::op<0x22>(c,0x0B5E,0x0253); n++; if (x.stop) return n;
+    case 0x0B5E: AOT::op<0x3A>(c,0x0B61,0x0224); n++;
+    case 0x0B61: AOT::op<0xB7>(c,0x0B62); n++;
+    case 0x0B62: AOT::op<0xCC>(c,0x0B65,0x149E); n++; if (c.pc!=0x0B65) return n; if (x.stop) return n;
+    case 0x0B65: AOT::op<0xE1>(c,0x0B66); n++;
+    case 0x0B66: AOT::op<0xC9>(c,0x0B67); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0B67(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0B67: AOT::op<0x06>(c,0x0B69,0x00); n++;
+    case 0x0B69: AOT::op<0x07>(c,0x0B6A); n++;
+    case 0x0B6A: AOT::op<0x4F>(c,0x0B6B); n++;
+    case 0x0B6B: AOT::op<0xC5>(c,0x0B6C); n++; if (x.stop) return n;
+    case 0x0B6C: AOT::op<0xD7>(c,0x0B6D); n++; return n;
+    case 0x0B6D: AOT::op<0x79>(c,0x0B6E); n++;
+    case 0x0B6E: AOT::op<0xFE>(c,0x0B70,0x29); n++;
+    case 0x0B70: AOT::op<0xDA>(c,0x0B73,0x0B8A); n++; if (c.pc!=0x0B73) return n;
+    case 0x0B73: AOT::op<0xCD>(c,0x0B76,0x0A92); n++; return n;
+    case 0x0B76: AOT::op<0xCF>(c,0x0B77); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0B78(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0B78: AOT::op<0xCD>(c,0x0B7B,0x0A87); n++; return n;
+    case 0x0B7B: AOT::op<0xEB>(c,0x0B7C); n++;
+    case 0x0B7C: AOT::op<0x2A>(c,0x0B7F,0x0253); n++;
+    case 0x0B7F: AOT::op<0xE3>(c,0x0B80); n++; if (x.stop) return n;
+    case 0x0B80: AOT::op<0xE5>(c,0x0B81); n++; if (x.stop) return n;
+    case 0x0B81: AOT::op<0xEB>(c,0x0B82); n++;
+    case 0x0B82: AOT::op<0xCD>(c,0x0B85,0x1131); n++; return n;
+    case 0x0B85: AOT::op<0xEB>(c,0x0B86); n++;
+    case 0x0B86: AOT::op<0xE3>(c,0x0B87); n++; if (x.stop) return n;
+    case 0x0B87: AOT::op<0xC3>(c,0x0B8A,0x0B92); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0B8A(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0B8A: AOT::op<0xCD>(c,0x0B8D,0x0B3F); n++; return n;
+    case 0x0B8D: AOT::op<0xE3>(c,0x0B8E); n++; if (x.stop) return n;
+    case 0x0B8E: AOT::op<0x11>(c,0x0B91,0x0B51); n++;
+    case 0x0B91: AOT::op<0xD5>(c,0x0B92); n++; if (x.stop) return n;
+    case 0x0B92: AOT::op<0x01>(c,0x0B95,0x0043); n++;
+    case 0x0B95: AOT::op<0x09>(c,0x0B96); n++;
+    case 0x0B96: AOT::op<0x4E>(c,0x0B97); n++;
+    case 0x0B97: AOT::op<0x23>(c,0x0B98); n++;
+    case 0x0B98: AOT::op<0x66>(c,0x0B99); n++;
+    case 0x0B99: AOT::op<0x69>(c,0x0B9A); n++;
+    case 0x0B9A: AOT::op<0xE9>(c,0x0B9B); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0BC3(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0BC3: AOT::op<0x21>(c,0x0BC6,0x0BD5); n++;
+    case 0x0BC6: AOT::op<0x3A>(c,0x0BC9,0x0224); n++;
+    case 0x0BC9: AOT::op<0x1F>(c,0x0BCA); n++;
+    case 0x0BCA: AOT::op<0x7A>(c,0x0BCB); n++;
+    case 0x0BCB: AOT::op<0x17>(c,0x0BCC); n++;
+    case 0x0BCC: AOT::op<0x5F>(c,0x0BCD); n++;
+    case 0x0BCD: AOT::op<0x16>(c,0x0BCF,0x64); n++;
+    case 0x0BCF: AOT::op<0x78>(c,0x0BD0); n++;
+    case 0x0BD0: AOT::op<0xBA>(c,0x0BD1); n++;
+    case 0x0BD1: AOT::op<0xD0>(c,0x0BD2); n++; if (c.pc!=0x0BD2) return n;
+    case 0x0BD2: AOT::op<0xC3>(c,0x0BD5,0x0AF2); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0C23(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0C23: AOT::op<0x16>(c,0x0C25,0x5A); n++;
+    case 0x0C25: AOT::op<0xCD>(c,0x0C28,0x0A97); n++; return n;
+    case 0x0C28: AOT::op<0xCD>(c,0x0C2B,0x0A86); n++; return n;
+    case 0x0C2B: AOT::op<0xCD>(c,0x0C2E,0x0738); n++; return n;
+    case 0x0C2E: AOT::op<0x7B>(c,0x0C2F); n++;
+    case 0x0C2F: AOT::op<0x2F>(c,0x0C30); n++;
+    case 0x0C30: AOT::op<0x4F>(c,0x0C31); n++;
+    case 0x0C31: AOT::op<0x7A>(c,0x0C32); n++;
+    case 0x0C32: AOT::op<0x2F>(c,0x0C33); n++;
+    case 0x0C33: AOT::op<0xCD>(c,0x0C36,0x0DE4); n++; return n;
+    case 0x0C36: AOT::op<0xC1>(c,0x0C37); n++;
+    case 0x0C37: AOT::op<0xC3>(c,0x0C3A,0x0AA3); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0C3A(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0C3A: AOT::op<0x2B>(c,0x0C3B); n++;
+    case 0x0C3B: AOT::op<0xD7>(c,0x0C3C); n++; return n;
+    case 0x0C3C: AOT::op<0xC8>(c,0x0C3D); n++; if (c.pc!=0x0C3D) return n;
+    case 0x0C3D: AOT::op<0xCF>(c,0x0C3E); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0C3F(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0C3F: AOT::op<0x01>(c,0x0C42,0x0C3A); n++;
+    case 0x0C42: AOT::op<0xC5>(c,0x0C43); n++; if (x.stop) return n;
+    }
+  return n;
+}
+
+static unsigned b0C44(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0C44: AOT::op<0xAF>(c,0x0C45); n++;
+    case 0x0C45: AOT::op<0x32>(c,0x0C48,0x0223); n++; if (x.stop) return n;
+    case 0x0C48: AOT::op<0x46>(c,0x0C49); n++;
+    case 0x0C49: AOT::op<0xCD>(c,0x0C4C,0x0728); n++; return n;
+    case 0x0C4C: AOT::op<0xDA>(c,0x0C4F,0x02C6); n++; if (c.pc!=0x0C4F) return n;
+    case 0x0C4F: AOT::op<0xAF>(c,0x0C50); n++;
+    case 0x0C50: AOT::op<0x4F>(c,0x0C51); n++;
+    case 0x0C51: AOT::op<0x32>(c,0x0C54,0x0224); n++; if (x.stop) return n;
+    case 0x0C54: AOT::op<0xD7>(c,0x0C55); n++; return n;
+    case 0x0C55: AOT::op<0xDA>(c,0x0C58,0x0C5E); n++; if (c.pc!=0x0C58) { if (n<x.left) goto L0C5E; return n; }
+    case 0x0C58: AOT::op<0xCD>(c,0x0C5B,0x0728); n++; return n;
+    case 0x0C5B: AOT::op<0xDA>(c,0x0C5E,0x0C69); n++; if (c.pc!=0x0C5E) { if (n<x.left) goto L0C69; return n; }
+    case 0x0C5E: L0C5E: AOT::op<0x4F>(c,0x0C5F); n++;
+    case 0x0C5F: L0C5F: AOT::op<0xD7>(c,0x0C60); n++; return n;
+    case 0x0C60: AOT::op<0xDA>(c,0x0C63,0x0C5F); n++; if (c.pc!=0x0C63) { if (n<x.left) goto L0C5F; return n; }
+    case 0x0C63: AOT::op<0xCD>(c,0x0C66,0x0728); n++; return n;
+    case 0x0C66: AOT::op<0xD2>(c,0x0C69,0x0C5F); n++; if (c.pc!=0x0C69) { if (n<x.left) goto L0C5F; return n; }
+    case 0x0C69: L0C69: AOT::op<0xD6>(c,0x0C6B,0x24); n++;
+    case 0x0C6B: AOT::op<0xC2>(c,0x0C6E,0x0C76); n++; if (c.pc!=0x0C6E) { if (n<x.left) goto L0C76; return n; }
+    case 0x0C6E: AOT::op<0x3C>(c,0x0C6F); n++;
+    case 0x0C6F: AOT::op<0x32>(c,0x0C72,0x0224); n++; if (x.stop) return n;
+    case 0x0C72: AOT::op<0x0F>(c,0x0C73); n++;
+    case 0x0C73: AOT::op<0x81>(c,0x0C74); n++;
+    case 0x0C74: AOT::op<0x4F>(c,0x0C75); n++;
+    case 0x0C75: AOT::op<0xD7>(c,0x0C76); n++; return n;
+    case 0x0C76: L0C76: AOT::op<0x3A>(c,0x0C79,0x0240); n++;
+    case 0x0C79: AOT::op<0x3D>(c,0x0C7A); n++;
+    case 0x0C7A: AOT::op<0xCA>(c,0x0C7D,0x0D0D); n++; if (c.pc!=0x0C7D) return n;
+    case 0x0C7D: AOT::op<0xF2>(c,0x0C80,0x0C86); n++; if (c.pc!=0x0C80) { if (n<x.left) goto L0C86; return n; }
+    case 0x0C80: AOT::op<0x7E>(c,0x0C81); n++;
+    case 0x0C81: AOT::op<0xD6>(c,0x0C83,0x28); n++;
+    case 0x0C83: AOT::op<0xCA>(c,0x0C86,0x0CE7); n++; if (c.pc!=0x0C86) return n;
+    case 0x0C86: L0C86: AOT::op<0xAF>(c,0x0C87); n++;
+    case 0x0C87: AOT::op<0x32>(c,0x0C8A,0x0240); n++; if (x.stop) return n;
+    case 0x0C8A: AOT::op<0xE5>(c,0x0C8B); n++; if (x.stop) return n;
+    case 0x0C8B: AOT::op<0x2A>(c,0x0C8E,0x024D); n++;
+    case 0x0C8E: AOT::op<0xEB>(c,0x0C8F); n++;
+    case 0x0C8F: AOT::op<0x2A>(c,0x0C92,0x024B); n++;
+    case 0x0C92: L0C92: AOT::op<0xE7>(c,0x0C93); n++; return n;
+    case 0x0C93: AOT::op<0xCA>(c,0x0C96,0x0CA9); n++; if (c.pc!=0x0C96) return n;
+    case 0x0C96: AOT::op<0x79>(c,0x0C97); n++;
+    case 0x0C97: AOT::op<0x96>(c,0x0C98); n++;
+    case 0x0C98: AOT::op<0x23>(c,0x0C99); n++;
+    case 0x0C99: AOT::op<0xC2>(c,0x0C9C,0x0C9E); n++; if (c.pc!=0x0C9C) { if (n<x.left) goto L0C9E; return n; }
+    case 0x0C9C: AOT::op<0x78>(c,0x0C9D); n++;
+    case 0x0C9D: AOT::op<0x96>(c,0x0C9E); n++;
+    case 0x0C9E: L0C9E: AOT::op<0x23>(c,0x0C9F); n++;
+    case 0x0C9F: AOT::op<0xCA>(c,0x0CA2,0x0CD9); n++; if (c.pc!=0x0CA2) return n;
+    case 0x0CA2: AOT::op<0x23>(c,0x0CA3); n++;
+    case 0x0CA3: AOT::op<0x23>(c,0x0CA4); n++;
+    case 0x0CA4: AOT::op<0x23>(c,0x0CA5); n++;
+    case 0x0CA5: AOT::op<0x23>(c,0x0CA6); n++;
+    case 0x0CA6: AOT::op<0xC3>(c,0x0CA9,0x0C92); n++; { if (n<x.left) goto L0C92; return n; }
+    }
+  return n;
+}
+
+static unsigned b0CA9(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0CA9: AOT::op<0xE1>(c,0x0CAA); n++;
+    case 0x0CAA: AOT::op<0xE3>(c,0x0CAB); n++; if (x.stop) return n;
+    case 0x0CAB: AOT::op<0xD5>(c,0x0CAC); n++; if (x.stop) return n;
+    case 0x0CAC: AOT::op<0x11>(c,0x0CAF,0x0B59); n++;
+    case 0x0CAF: AOT::op<0xE7>(c,0x0CB0); n++; return n;
+    case 0x0CB0: AOT::op<0xD1>(c,0x0CB1); n++;
+    case 0x0CB1: AOT::op<0xCA>(c,0x0CB4,0x0CDC); n++; if (c.pc!=0x0CB4) return n;
+    case 0x0CB4: AOT::op<0xE3>(c,0x0CB5); n++; if (x.stop) return n;
+    case 0x0CB5: AOT::op<0xE5>(c,0x0CB6); n++; if (x.stop) return n;
+    case 0x0CB6: AOT::op<0xC5>(c,0x0CB7); n++; if (x.stop) return n;
+    case 0x0CB7: AOT::op<0x01>(c,0x0CBA,0x0006); n++;
+    case 0x0CBA: AOT::op<0x2A>(c,0x0CBD,0x024F); n++;
+    case 0x0CBD: AOT::op<0xE5>(c,0x0CBE); n++; if (x.stop) return n;
+    case 0x0CBE: AOT::op<0x09>(c,0x0CBF); n++;
+    case 0x0CBF: AOT::op<0xC1>(c,0x0CC0); n++;
+    case 0x0CC0: AOT::op<0xE5>(c,0x0CC1); n++; if (x.stop) return n;
+    case 0x0CC1: AOT::op<0xCD>(c,0x0CC4,0x0297); n++; return n;
+    case 0x0CC4: AOT::op<0xE1>(c,0x0CC5); n++;
+    case 0x0CC5: AOT::op<0x22>(c,0x0CC8,0x024F); n++; if (x.stop) return n;
+    case 0x0CC8: AOT::op<0x60>(c,0x0CC9); n++;
+    case 0x0CC9: AOT::op<0x69>(c,0x0CCA); n++;
+    case 0x0CCA: AOT::op<0x22>(c,0x0CCD,0x024D); n++; if (x.stop) return n;
+    case 0x0CCD: L0CCD: AOT::op<0x2B>(c,0x0CCE); n++;
+    case 0x0CCE: AOT::op<0x36>(c,0x0CD0,0x00); n++; if (x.stop) return n;
+    case 0x0CD0: AOT::op<0xE7>(c,0x0CD1); n++; return n;
+    case 0x0CD1: AOT::op<0xC2>(c,0x0CD4,0x0CCD); n++; if (c.pc!=0x0CD4) { if (n<x.left) goto L0CCD; return n; }
+    case 0x0CD4: AOT::op<0xD1>(c,0x0CD5); n++;
+    case 0x0CD5: AOT::op<0x73>(c,0x0CD6); n++; if (x.stop) return n;
+    case 0x0CD6: AOT::op<0x23>(c,0x0CD7); n++;
+    case 0x0CD7: AOT::op<0x72>(c,0x0CD8); n++; if (x.stop) return n;
+    case 0x0CD8: AOT::op<0x23>(c,0x0CD9); n++;
+    case 0x0CD9: AOT::op<0xEB>(c,0x0CDA); n++;
+    case 0x0CDA: AOT::op<0xE1>(c,0x0CDB); n++;
+    case 0x0CDB: AOT::op<0xC9>(c,0x0CDC); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0CDC(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0CDC: AOT::op<0x32>(c,0x0CDF,0x0256); n++; if (x.stop) return n;
+    case 0x0CDF: AOT::op<0x21>(c,0x0CE2,0x0270); n++;
+    case 0x0CE2: AOT::op<0x22>(c,0x0CE5,0x0253); n++; if (x.stop) return n;
+    case 0x0CE5: AOT::op<0xE1>(c,0x0CE6); n++;
+    case 0x0CE6: AOT::op<0xC9>(c,0x0CE7); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0CE7(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0CE7: AOT::op<0xE5>(c,0x0CE8); n++; if (x.stop) return n;
+    case 0x0CE8: AOT::op<0x2A>(c,0x0CEB,0x0223); n++;
+    case 0x0CEB: AOT::op<0xE3>(c,0x0CEC); n++; if (x.stop) return n;
+    case 0x0CEC: AOT::op<0x57>(c,0x0CED); n++;
+    case 0x0CED: L0CED: AOT::op<0xD5>(c,0x0CEE); n++; if (x.stop) return n;
+    case 0x0CEE: AOT::op<0xC5>(c,0x0CEF); n++; if (x.stop) return n;
+    case 0x0CEF: AOT::op<0xCD>(c,0x0CF2,0x0730); n++; return n;
+    case 0x0CF2: AOT::op<0xC1>(c,0x0CF3); n++;
+    case 0x0CF3: AOT::op<0xF1>(c,0x0CF4); n++;
+    case 0x0CF4: AOT::op<0xEB>(c,0x0CF5); n++;
+    case 0x0CF5: AOT::op<0xE3>(c,0x0CF6); n++; if (x.stop) return n;
+    case 0x0CF6: AOT::op<0xE5>(c,0x0CF7); n++; if (x.stop) return n;
+    case 0x0CF7: AOT::op<0xEB>(c,0x0CF8); n++;
+    case 0x0CF8: AOT::op<0x3C>(c,0x0CF9); n++;
+    case 0x0CF9: AOT::op<0x57>(c,0x0CFA); n++;
+    case 0x0CFA: AOT::op<0x7E>(c,0x0CFB); n++;
+    case 0x0CFB: AOT::op<0xFE>(c,0x0CFD,0x2C); n++;
+    case 0x0CFD: AOT::op<0xCA>(c,0x0D00,0x0CED); n++; if (c.pc!=0x0D00) { if (n<x.left) goto L0CED; return n; }
+    case 0x0D00: AOT::op<0xCF>(c,0x0D01); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0D02(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0D02: AOT::op<0x22>(c,0x0D05,0x0245); n++; if (x.stop) return n;
+    case 0x0D05: AOT::op<0xE1>(c,0x0D06); n++;
+    case 0x0D06: AOT::op<0x22>(c,0x0D09,0x0223); n++; if (x.stop) return n;
+    case 0x0D09: AOT::op<0x1E>(c,0x0D0B,0x00); n++;
+    case 0x0D0B: AOT::op<0xD5>(c,0x0D0C); n++; if (x.stop) return n;
+    case 0x0D0C: AOT::op<0x11>(c,0x0D0F,0xF5E5); n++;
+    case 0x0D0F: AOT::op<0x2A>(c,0x0D12,0x024D); n++;
+    case 0x0D12: AOT::op<0x3E>(c,0x0D14,0x19); n++;
+    case 0x0D14: AOT::op<0xEB>(c,0x0D15); n++;
+    case 0x0D15: AOT::op<0x2A>(c,0x0D18,0x024F); n++;
+    case 0x0D18: AOT::op<0xEB>(c,0x0D19); n++;
+    case 0x0D19: AOT::op<0xE7>(c,0x0D1A); n++; return n;
+    case 0x0D1A: AOT::op<0xCA>(c,0x0D1D,0x0D41); n++; if (c.pc!=0x0D1D) return n;
+    case 0x0D1D: AOT::op<0x7E>(c,0x0D1E); n++;
+    case 0x0D1E: AOT::op<0xB9>(c,0x0D1F); n++;
+    case 0x0D1F: AOT::op<0x23>(c,0x0D20); n++;
+    case 0x0D20: AOT::op<0xC2>(c,0x0D23,0x0D25); n++; if (c.pc!=0x0D23) { if (n<x.left) goto L0D25; return n; }
+    case 0x0D23: AOT::op<0x7E>(c,0x0D24); n++;
+    case 0x0D24: AOT::op<0xB8>(c,0x0D25); n++;
+    case 0x0D25: L0D25: AOT::op<0x23>(c,0x0D26); n++;
+    case 0x0D26: AOT::op<0x5E>(c,0x0D27); n++;
+    case 0x0D27: AOT::op<0x23>(c,0x0D28); n++;
+    case 0x0D28: AOT::op<0x56>(c,0x0D29); n++;
+    case 0x0D29: AOT::op<0x23>(c,0x0D2A); n++;
+    case 0x0D2A: AOT::op<0xC2>(c,0x0D2D,0x0D13); n++; if (c.pc!=0x0D2D) return n;
+    case 0x0D2D: AOT::op<0x3A>(c,0x0D30,0x0223); n++;
+    case 0x0D30: AOT::op<0xB7>(c,0x0D31); n++;
+    case 0x0D31: AOT::op<0xC2>(c,0x0D34,0x02CF); n++; if (c.pc!=0x0D34) return n;
+    case 0x0D34: AOT::op<0xF1>(c,0x0D35); n++;
+    case 0x0D35: AOT::op<0xCA>(c,0x0D38,0x06DD); n++; if (c.pc!=0x0D38) return n;
+    case 0x0D38: AOT::op<0x96>(c,0x0D39); n++;
+    case 0x0D39: AOT::op<0xCA>(c,0x0D3C,0x0D9D); n++; if (c.pc!=0x0D3C) return n;
+    case 0x0D3C: AOT::op<0x1E>(c,0x0D3E,0x10); n++;
+    case 0x0D3E: AOT::op<0xC3>(c,0x0D41,0x02D1); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0D41(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0D41: AOT::op<0x11>(c,0x0D44,0x0004); n++;
+    case 0x0D44: AOT::op<0xF1>(c,0x0D45); n++;
+    case 0x0D45: AOT::op<0xCA>(c,0x0D48,0x074D); n++; if (c.pc!=0x0D48) return n;
+    case 0x0D48: AOT::op<0x71>(c,0x0D49); n++; if (x.stop) return n;
+    case 0x0D49: AOT::op<0x23>(c,0x0D4A); n++;
+    case 0x0D4A: AOT::op<0x70>(c,0x0D4B); n++; if (x.stop) return n;
+    case 0x0D4B: AOT::op<0x23>(c,0x0D4C); n++;
+    case 0x0D4C: AOT::op<0x4F>(c,0x0D4D); n++;
+    case 0x0D4D: AOT::op<0xCD>(c,0x0D50,0x02A6); n++; return n;
+    case 0x0D50: AOT::op<0x23>(c,0x0D51); n++;
+    case 0x0D51: AOT::op<0x23>(c,0x0D52); n++;
+    case 0x0D52: AOT::op<0x22>(c,0x0D55,0x023C); n++; if (x.stop) return n;
+    case 0x0D55: AOT::op<0x71>(c,0x0D56); n++; if (x.stop) return n;
+    case 0x0D56: AOT::op<0x23>(c,0x0D57); n++;
+    case 0x0D57: AOT::op<0x3A>(c,0x0D5A,0x0223); n++;
+    case 0x0D5A: AOT::op<0x17>(c,0x0D5B); n++;
+    case 0x0D5B: AOT::op<0x79>(c,0x0D5C); n++;
+    case 0x0D5C: L0D5C: AOT::op<0x01>(c,0x0D5F,0x000B); n++;
+    case 0x0D5F: AOT::op<0xD2>(c,0x0D62,0x0D64); n++; if (c.pc!=0x0D62) { if (n<x.left) goto L0D64; return n; }
+    case 0x0D62: AOT::op<0xC1>(c,0x0D63); n++;
+    case 0x0D63: AOT::op<0x03>(c,0x0D64); n++;
+    case 0x0D64: L0D64: AOT::op<0x71>(c,0x0D65); n++; if (x.stop) return n;
+    case 0x0D65: AOT::op<0x23>(c,0x0D66); n++;
+    case 0x0D66: AOT::op<0x70>(c,0x0D67); n++; if (x.stop) return n;
+    case 0x0D67: AOT::op<0x23>(c,0x0D68); n++;
+    case 0x0D68: AOT::op<0xF5>(c,0x0D69); n++; if (x.stop) return n;
+    case 0x0D69: AOT::op<0xE5>(c,0x0D6A); n++; if (x.stop) return n;
+    case 0x0D6A: AOT::op<0xCD>(c,0x0D6D,0x154A); n++; return n;
+    case 0x0D6D: AOT::op<0xEB>(c,0x0D6E); n++;
+    case 0x0D6E: AOT::op<0xE1>(c,0x0D6F); n++;
+    case 0x0D6F: AOT::op<0xF1>(c,0x0D70); n++;
+    case 0x0D70: AOT::op<0x3D>(c,0x0D71); n++;
+    case 0x0D71: AOT::op<0xC2>(c,0x0D74,0x0D5C); n++; if (c.pc!=0x0D74) { if (n<x.left) goto L0D5C; return n; }
+    case 0x0D74: AOT::op<0xF5>(c,0x0D75); n++; if (x.stop) return n;
+    case 0x0D75: AOT::op<0x42>(c,0x0D76); n++;
+    case 0x0D76: AOT::op<0x4B>(c,0x0D77); n++;
+    case 0x0D77: AOT::op<0xEB>(c,0x0D78); n++;
+    case 0x0D78: AOT::op<0x19>(c,0x0D79); n++;
+    case 0x0D79: AOT::op<0xDA>(c,0x0D7C,0x0D3C); n++; if (c.pc!=0x0D7C) return n;
+    case 0x0D7C: AOT::op<0xCD>(c,0x0D7F,0x02AF); n++; return n;
+    case 0x0D7F: AOT::op<0x22>(c,0x0D82,0x024F); n++; if (x.stop) return n;
+    case 0x0D82: L0D82: AOT::op<0x2B>(c,0x0D83); n++;
+    case 0x0D83: AOT::op<0x36>(c,0x0D85,0x00); n++; if (x.stop) return n;
+    case 0x0D85: AOT::op<0xE7>(c,0x0D86); n++; return n;
+    case 0x0D86: AOT::op<0xC2>(c,0x0D89,0x0D82); n++; if (c.pc!=0x0D89) { if (n<x.left) goto L0D82; return n; }
+    case 0x0D89: AOT::op<0x03>(c,0x0D8A); n++;
+    case 0x0D8A: AOT::op<0x57>(c,0x0D8B); n++;
+    case 0x0D8B: AOT::op<0x2A>(c,0x0D8E,0x023C); n++;
+    case 0x0D8E: AOT::op<0x5E>(c,0x0D8F); n++;
+    case 0x0D8F: AOT::op<0xEB>(c,0x0D90); n++;
+    case 0x0D90: AOT::op<0x29>(c,0x0D91); n++;
+    case 0x0D91: AOT::op<0x09>(c,0x0D92); n++;
+    case 0x0D92: AOT::op<0xEB>(c,0x0D93); n++;
+    case 0x0D93: AOT::op<0x2B>(c,0x0D94); n++;
+    case 0x0D94: AOT::op<0x2B>(c,0x0D95); n++;
+    case 0x0D95: AOT::op<0x73>(c,0x0D96); n++; if (x.stop) return n;
+    case 0x0D96: AOT::op<0x23>(c,0x0D97); n++;
+    case 0x0D97: AOT::op<0x72>(c,0x0D98); n++; if (x.stop) return n;
+    case 0x0D98: AOT::op<0x23>(c,0x0D99); n++;
+    case 0x0D99: AOT::op<0xF1>(c,0x0D9A); n++;
+    case 0x0D9A: AOT::op<0xDA>(c,0x0D9D,0x0DBF); n++; if (c.pc!=0x0D9D) { if (n<x.left) goto L0DBF; return n; }
+    case 0x0D9D: AOT::op<0x47>(c,0x0D9E); n++;
+    case 0x0D9E: AOT::op<0x4F>(c,0x0D9F); n++;
+    case 0x0D9F: AOT::op<0x7E>(c,0x0DA0); n++;
+    case 0x0DA0: AOT::op<0x23>(c,0x0DA1); n++;
+    case 0x0DA1: AOT::op<0x16>(c,0x0DA3,0xE1); n++;
+    case 0x0DA3: AOT::op<0x5E>(c,0x0DA4); n++;
+    case 0x0DA4: AOT::op<0x23>(c,0x0DA5); n++;
+    case 0x0DA5: AOT::op<0x56>(c,0x0DA6); n++;
+    case 0x0DA6: AOT::op<0x23>(c,0x0DA7); n++;
+    case 0x0DA7: AOT::op<0xE3>(c,0x0DA8); n++; if (x.stop) return n;
+    case 0x0DA8: AOT::op<0xF5>(c,0x0DA9); n++; if (x.stop) return n;
+    case 0x0DA9: AOT::op<0xE7>(c,0x0DAA); n++; return n;
+    case 0x0DAA: AOT::op<0xD2>(c,0x0DAD,0x0D3C); n++; if (c.pc!=0x0DAD) return n;
+    case 0x0DAD: AOT::op<0xE5>(c,0x0DAE); n++; if (x.stop) return n;
+    case 0x0DAE: AOT::op<0xCD>(c,0x0DB1,0x154A); n++; return n;
+    case 0x0DB1: AOT::op<0xD1>(c,0x0DB2); n++;
+    case 0x0DB2: AOT::op<0x19>(c,0x0DB3); n++;
+    case 0x0DB3: AOT::op<0xF1>(c,0x0DB4); n++;
+    case 0x0DB4: AOT::op<0x3D>(c,0x0DB5); n++;
+    case 0x0DB5: AOT::op<0x44>(c,0x0DB6); n++;
+    case 0x0DB6: AOT::op<0x4D>(c,0x0DB7); n++;
+    case 0x0DB7: AOT::op<0xC2>(c,0x0DBA,0x0DA2); n++; if (c.pc!=0x0DBA) return n;
+    case 0x0DBA: AOT::op<0x29>(c,0x0DBB); n++;
+    case 0x0DBB: AOT::op<0x29>(c,0x0DBC); n++;
+    case 0x0DBC: AOT::op<0xC1>(c,0x0DBD); n++;
+    case 0x0DBD: AOT::op<0x09>(c,0x0DBE); n++;
+    case 0x0DBE: AOT::op<0xEB>(c,0x0DBF); n++;
+    case 0x0DBF: L0DBF: AOT::op<0x2A>(c,0x0DC2,0x0245); n++;
+    case 0x0DC2: AOT::op<0xC9>(c,0x0DC3); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0DC3(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0DC3: AOT::op<0x2A>(c,0x0DC6,0x024F); n++;
+    case 0x0DC6: AOT::op<0xEB>(c,0x0DC7); n++;
+    case 0x0DC7: AOT::op<0x21>(c,0x0DCA,0x0000); n++;
+    case 0x0DCA: AOT::op<0x39>(c,0x0DCB); n++;
+    case 0x0DCB: AOT::op<0x3A>(c,0x0DCE,0x0224); n++;
+    case 0x0DCE: AOT::op<0xB7>(c,0x0DCF); n++;
+    case 0x0DCF: AOT::op<0xCA>(c,0x0DD2,0x0DDF); n++; if (c.pc!=0x0DD2) { if (n<x.left) goto L0DDF; return n; }
+    case 0x0DD2: AOT::op<0xCD>(c,0x0DD5,0x1016); n++; return n;
+    case 0x0DD5: AOT::op<0xCD>(c,0x0DD8,0x0F22); n++; return n;
+    case 0x0DD8: AOT::op<0x2A>(c,0x0DDB,0x01D2); n++;
+    case 0x0DDB: AOT::op<0xEB>(c,0x0DDC); n++;
+    case 0x0DDC: AOT::op<0x2A>(c,0x0DDF,0x023A); n++;
+    case 0x0DDF: L0DDF: AOT::op<0x7D>(c,0x0DE0); n++;
+    case 0x0DE0: AOT::op<0x93>(c,0x0DE1); n++;
+    case 0x0DE1: AOT::op<0x4F>(c,0x0DE2); n++;
+    case 0x0DE2: AOT::op<0x7C>(c,0x0DE3); n++;
+    case 0x0DE3: AOT::op<0x9A>(c,0x0DE4); n++;
+    case 0x0DE4: AOT::op<0x41>(c,0x0DE5); n++;
+    case 0x0DE5: AOT::op<0x50>(c,0x0DE6); n++;
+    case 0x0DE6: AOT::op<0x1E>(c,0x0DE8,0x00); n++;
+    case 0x0DE8: AOT::op<0x21>(c,0x0DEB,0x0224); n++;
+    case 0x0DEB: AOT::op<0x73>(c,0x0DEC); n++; if (x.stop) return n;
+    case 0x0DEC: AOT::op<0x06>(c,0x0DEE,0x90); n++;
+    case 0x0DEE: AOT::op<0xC3>(c,0x0DF1,0x1479); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0DF1(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0DF1: AOT::op<0x3A>(c,0x0DF4,0x0027); n++;
+    case 0x0DF4: AOT::op<0x47>(c,0x0DF5); n++;
+    case 0x0DF5: AOT::op<0xAF>(c,0x0DF6); n++;
+    case 0x0DF6: AOT::op<0xC3>(c,0x0DF9,0x0DE5); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0DF9(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0DF9: AOT::op<0xCD>(c,0x0DFC,0x0E60); n++; return n;
+    case 0x0DFC: AOT::op<0xCD>(c,0x0DFF,0x0E52); n++; return n;
+    case 0x0DFF: AOT::op<0x01>(c,0x0E02,0x07FA); n++;
+    case 0x0E02: AOT::op<0xC5>(c,0x0E03); n++; if (x.stop) return n;
+    case 0x0E03: AOT::op<0xD5>(c,0x0E04); n++; if (x.stop) return n;
+    case 0x0E04: AOT::op<0xCF>(c,0x0E05); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0E06(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0E06: AOT::op<0xCD>(c,0x0E09,0x0C44); n++; return n;
+    case 0x0E09: AOT::op<0xCD>(c,0x0E0C,0x0A86); n++; return n;
+    case 0x0E0C: AOT::op<0xCF>(c,0x0E0D); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0E0E(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0E0E: AOT::op<0xCF>(c,0x0E0F); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0E10(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0E10: AOT::op<0x44>(c,0x0E11); n++;
+    case 0x0E11: AOT::op<0x4D>(c,0x0E12); n++;
+    case 0x0E12: AOT::op<0xE3>(c,0x0E13); n++; if (x.stop) return n;
+    case 0x0E13: AOT::op<0xC3>(c,0x0E16,0x0E4C); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0E16(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0E16: AOT::op<0xCD>(c,0x0E19,0x0E60); n++; return n;
+    case 0x0E19: AOT::op<0xD5>(c,0x0E1A); n++; if (x.stop) return n;
+    case 0x0E1A: AOT::op<0xCD>(c,0x0E1D,0x0B3F); n++; return n;
+    case 0x0E1D: AOT::op<0xCD>(c,0x0E20,0x0A86); n++; return n;
+    case 0x0E20: AOT::op<0xE3>(c,0x0E21); n++; if (x.stop) return n;
+    case 0x0E21: AOT::op<0x5E>(c,0x0E22); n++;
+    case 0x0E22: AOT::op<0x23>(c,0x0E23); n++;
+    case 0x0E23: AOT::op<0x56>(c,0x0E24); n++;
+    case 0x0E24: AOT::op<0x23>(c,0x0E25); n++;
+    case 0x0E25: AOT::op<0x7E>(c,0x0E26); n++;
+    case 0x0E26: AOT::op<0x23>(c,0x0E27); n++;
+    case 0x0E27: AOT::op<0x66>(c,0x0E28); n++;
+    case 0x0E28: AOT::op<0x6F>(c,0x0E29); n++;
+    case 0x0E29: AOT::op<0x4E>(c,0x0E2A); n++;
+    case 0x0E2A: AOT::op<0x23>(c,0x0E2B); n++;
+    case 0x0E2B: AOT::op<0x46>(c,0x0E2C); n++;
+    case 0x0E2C: AOT::op<0x23>(c,0x0E2D); n++;
+    case 0x0E2D: AOT::op<0xC5>(c,0x0E2E); n++; if (x.stop) return n;
+    case 0x0E2E: AOT::op<0x4E>(c,0x0E2F); n++;
+    case 0x0E2F: AOT::op<0x23>(c,0x0E30); n++;
+    case 0x0E30: AOT::op<0x46>(c,0x0E31); n++;
+    case 0x0E31: AOT::op<0xC5>(c,0x0E32); n++; if (x.stop) return n;
+    case 0x0E32: AOT::op<0x2B>(c,0x0E33); n++;
+    case 0x0E33: AOT::op<0x2B>(c,0x0E34); n++;
+    case 0x0E34: AOT::op<0x2B>(c,0x0E35); n++;
+    case 0x0E35: AOT::op<0xE5>(c,0x0E36); n++; if (x.stop) return n;
+    case 0x0E36: AOT::op<0xE7>(c,0x0E37); n++; return n;
+    case 0x0E37: AOT::op<0xD5>(c,0x0E38); n++; if (x.stop) return n;
+    case 0x0E38: AOT::op<0x1E>(c,0x0E3A,0x22); n++;
+    case 0x0E3A: AOT::op<0xCA>(c,0x0E3D,0x02D1); n++; if (c.pc!=0x0E3D) return n;
+    case 0x0E3D: AOT::op<0xCD>(c,0x0E40,0x14B8); n++; return n;
+    case 0x0E40: AOT::op<0xE1>(c,0x0E41); n++;
+    case 0x0E41: AOT::op<0xCD>(c,0x0E44,0x0A83); n++; return n;
+    case 0x0E44: AOT::op<0x2B>(c,0x0E45); n++;
+    case 0x0E45: AOT::op<0xD7>(c,0x0E46); n++; return n;
+    case 0x0E46: AOT::op<0xC2>(c,0x0E49,0x02C6); n++; if (c.pc!=0x0E49) return n;
+    case 0x0E49: AOT::op<0xE1>(c,0x0E4A); n++;
+    case 0x0E4A: AOT::op<0xD1>(c,0x0E4B); n++;
+    case 0x0E4B: AOT::op<0xC1>(c,0x0E4C); n++;
+    case 0x0E4C: AOT::op<0x71>(c,0x0E4D); n++; if (x.stop) return n;
+    case 0x0E4D: AOT::op<0x23>(c,0x0E4E); n++;
+    case 0x0E4E: AOT::op<0x70>(c,0x0E4F); n++; if (x.stop) return n;
+    case 0x0E4F: AOT::op<0xC3>(c,0x0E52,0x0E9D); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0E52(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0E52: AOT::op<0xE5>(c,0x0E53); n++; if (x.stop) return n;
+    case 0x0E53: AOT::op<0x2A>(c,0x0E56,0x01D4); n++;
+    case 0x0E56: AOT::op<0x23>(c,0x0E57); n++;
+    case 0x0E57: AOT::op<0x7C>(c,0x0E58); n++;
+    case 0x0E58: AOT::op<0xB5>(c,0x0E59); n++;
+    case 0x0E59: AOT::op<0xE1>(c,0x0E5A); n++;
+    case 0x0E5A: AOT::op<0xC0>(c,0x0E5B); n++; if (c.pc!=0x0E5B) return n;
+    case 0x0E5B: AOT::op<0x1E>(c,0x0E5D,0x16); n++;
+    case 0x0E5D: AOT::op<0xC3>(c,0x0E60,0x02D1); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0E60(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0E60: AOT::op<0xCF>(c,0x0E61); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0E62(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0E62: AOT::op<0x3E>(c,0x0E64,0x80); n++;
+    case 0x0E64: AOT::op<0x32>(c,0x0E67,0x0240); n++; if (x.stop) return n;
+    case 0x0E67: AOT::op<0xB6>(c,0x0E68); n++;
+    case 0x0E68: AOT::op<0x47>(c,0x0E69); n++;
+    case 0x0E69: AOT::op<0xCD>(c,0x0E6C,0x0C49); n++; return n;
+    case 0x0E6C: AOT::op<0xC3>(c,0x0E6F,0x0A86); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0E6F(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0E6F: AOT::op<0xCD>(c,0x0E72,0x0A86); n++; return n;
+    case 0x0E72: AOT::op<0xCD>(c,0x0E75,0x160F); n++; return n;
+    case 0x0E75: AOT::op<0xCD>(c,0x0E78,0x0EA3); n++; return n;
+    case 0x0E78: AOT::op<0xCD>(c,0x0E7B,0x1016); n++; return n;
+    case 0x0E7B: AOT::op<0x01>(c,0x0E7E,0x106D); n++;
+    case 0x0E7E: AOT::op<0xC5>(c,0x0E7F); n++; if (x.stop) return n;
+    case 0x0E7F: AOT::op<0x7E>(c,0x0E80); n++;
+    case 0x0E80: AOT::op<0x23>(c,0x0E81); n++;
+    case 0x0E81: AOT::op<0x23>(c,0x0E82); n++;
+    case 0x0E82: AOT::op<0xE5>(c,0x0E83); n++; if (x.stop) return n;
+    case 0x0E83: AOT::op<0xCD>(c,0x0E86,0x0EFA); n++; return n;
+    case 0x0E86: AOT::op<0xE1>(c,0x0E87); n++;
+    case 0x0E87: AOT::op<0x4E>(c,0x0E88); n++;
+    case 0x0E88: AOT::op<0x23>(c,0x0E89); n++;
+    case 0x0E89: AOT::op<0x46>(c,0x0E8A); n++;
+    case 0x0E8A: AOT::op<0xCD>(c,0x0E8D,0x0E97); n++; return n;
+    case 0x0E8D: AOT::op<0xE5>(c,0x0E8E); n++; if (x.stop) return n;
+    case 0x0E8E: AOT::op<0x6F>(c,0x0E8F); n++;
+    case 0x0E8F: AOT::op<0xCD>(c,0x0E92,0x1009); n++; return n;
+    case 0x0E92: AOT::op<0xD1>(c,0x0E93); n++;
+    case 0x0E93: AOT::op<0xC9>(c,0x0E94); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0E94(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0E94: AOT::op<0xCD>(c,0x0E97,0x0EFA); n++; return n;
+    case 0x0E97: AOT::op<0x21>(c,0x0E9A,0x0236); n++;
+    case 0x0E9A: AOT::op<0xE5>(c,0x0E9B); n++; if (x.stop) return n;
+    case 0x0E9B: AOT::op<0x77>(c,0x0E9C); n++; if (x.stop) return n;
+    case 0x0E9C: AOT::op<0x23>(c,0x0E9D); n++;
+    case 0x0E9D: AOT::op<0x23>(c,0x0E9E); n++;
+    case 0x0E9E: AOT::op<0x73>(c,0x0E9F); n++; if (x.stop) return n;
+    case 0x0E9F: AOT::op<0x23>(c,0x0EA0); n++;
+    case 0x0EA0: AOT::op<0x72>(c,0x0EA1); n++; if (x.stop) return n;
+    case 0x0EA1: AOT::op<0xE1>(c,0x0EA2); n++;
+    case 0x0EA2: AOT::op<0xC9>(c,0x0EA3); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0EA3(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0EA3: AOT::op<0x2B>(c,0x0EA4); n++;
+    case 0x0EA4: AOT::op<0x06>(c,0x0EA6,0x22); n++;
+    case 0x0EA6: AOT::op<0x50>(c,0x0EA7); n++;
+    case 0x0EA7: AOT::op<0xE5>(c,0x0EA8); n++; if (x.stop) return n;
+    case 0x0EA8: AOT::op<0x0E>(c,0x0EAA,0xFF); n++;
+    case 0x0EAA: L0EAA: AOT::op<0x23>(c,0x0EAB); n++;
+    case 0x0EAB: AOT::op<0x7E>(c,0x0EAC); n++;
+    case 0x0EAC: AOT::op<0x0C>(c,0x0EAD); n++;
+    case 0x0EAD: AOT::op<0xB7>(c,0x0EAE); n++;
+    case 0x0EAE: AOT::op<0xCA>(c,0x0EB1,0x0EB9); n++; if (c.pc!=0x0EB1) { if (n<x.left) goto L0EB9; return n; }
+    case 0x0EB1: AOT::op<0xBA>(c,0x0EB2); n++;
+    case 0x0EB2: AOT::op<0xCA>(c,0x0EB5,0x0EB9); n++; if (c.pc!=0x0EB5) { if (n<x.left) goto L0EB9; return n; }
+    case 0x0EB5: AOT::op<0xB8>(c,0x0EB6); n++;
+    case 0x0EB6: AOT::op<0xC2>(c,0x0EB9,0x0EAA); n++; if (c.pc!=0x0EB9) { if (n<x.left) goto L0EAA; return n; }
+    case 0x0EB9: L0EB9: AOT::op<0xFE>(c,0x0EBB,0x22); n++;
+    case 0x0EBB: AOT::op<0xCC>(c,0x0EBE,0x064E); n++; if (c.pc!=0x0EBE) return n; if (x.stop) return n;
+    case 0x0EBE: AOT::op<0xE3>(c,0x0EBF); n++; if (x.stop) return n;
+    case 0x0EBF: AOT::op<0x23>(c,0x0EC0); n++;
+    case 0x0EC0: AOT::op<0xEB>(c,0x0EC1); n++;
+    case 0x0EC1: AOT::op<0x79>(c,0x0EC2); n++;
+    case 0x0EC2: AOT::op<0xCD>(c,0x0EC5,0x0E97); n++; return n;
+    case 0x0EC5: AOT::op<0x11>(c,0x0EC8,0x0236); n++;
+    case 0x0EC8: AOT::op<0x2A>(c,0x0ECB,0x0228); n++;
+    case 0x0ECB: AOT::op<0x22>(c,0x0ECE,0x0253); n++; if (x.stop) return n;
+    case 0x0ECE: AOT::op<0x3E>(c,0x0ED0,0x01); n++;
+    case 0x0ED0: AOT::op<0x32>(c,0x0ED3,0x0224); n++; if (x.stop) return n;
+    case 0x0ED3: AOT::op<0xCD>(c,0x0ED6,0x14BB); n++; return n;
+    case 0x0ED6: AOT::op<0xE7>(c,0x0ED7); n++; return n;
+    case 0x0ED7: AOT::op<0x22>(c,0x0EDA,0x0228); n++; if (x.stop) return n;
+    case 0x0EDA: AOT::op<0xE1>(c,0x0EDB); n++;
+    case 0x0EDB: AOT::op<0x7E>(c,0x0EDC); n++;
+    case 0x0EDC: AOT::op<0xC0>(c,0x0EDD); n++; if (c.pc!=0x0EDD) return n;
+    case 0x0EDD: AOT::op<0x1E>(c,0x0EDF,0x1E); n++;
+    case 0x0EDF: AOT::op<0xC3>(c,0x0EE2,0x02D1); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0EE2(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0EE2: AOT::op<0x23>(c,0x0EE3); n++;
+    case 0x0EE3: AOT::op<0xCD>(c,0x0EE6,0x0EA3); n++; return n;
+    case 0x0EE6: AOT::op<0xCD>(c,0x0EE9,0x1016); n++; return n;
+    case 0x0EE9: AOT::op<0xCD>(c,0x0EEC,0x14AF); n++; return n;
+    case 0x0EEC: AOT::op<0x1C>(c,0x0EED); n++;
+    case 0x0EED: L0EED: AOT::op<0x1D>(c,0x0EEE); n++;
+    case 0x0EEE: AOT::op<0xC8>(c,0x0EEF); n++; if (c.pc!=0x0EEF) return n;
+    case 0x0EEF: AOT::op<0x0A>(c,0x0EF0); n++;
+    case 0x0EF0: AOT::op<0xDF>(c,0x0EF1); n++; return n;
+    case 0x0EF1: AOT::op<0xFE>(c,0x0EF3,0x0D); n++;
+    case 0x0EF3: AOT::op<0xCC>(c,0x0EF6,0x08F3); n++; if (c.pc!=0x0EF6) return n; if (x.stop) return n;
+    case 0x0EF6: AOT::op<0x03>(c,0x0EF7); n++;
+    case 0x0EF7: AOT::op<0xC3>(c,0x0EFA,0x0EED); n++; { if (n<x.left) goto L0EED; return n; }
+    }
+  return n;
+}
+
+static unsigned b0EFA(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0EFA: AOT::op<0xB7>(c,0x0EFB); n++;
+    case 0x0EFB: AOT::op<0x0E>(c,0x0EFD,0xF1); n++;
+    case 0x0EFD: AOT::op<0xF5>(c,0x0EFE); n++; if (x.stop) return n;
+    case 0x0EFE: AOT::op<0x2A>(c,0x0F01,0x01D2); n++;
+    case 0x0F01: AOT::op<0xEB>(c,0x0F02); n++;
+    case 0x0F02: AOT::op<0x2A>(c,0x0F05,0x023A); n++;
+    case 0x0F05: AOT::op<0x2F>(c,0x0F06); n++;
+    case 0x0F06: AOT::op<0x4F>(c,0x0F07); n++;
+    case 0x0F07: AOT::op<0x06>(c,0x0F09,0xFF); n++;
+    case 0x0F09: AOT::op<0x09>(c,0x0F0A); n++;
+    case 0x0F0A: AOT::op<0x23>(c,0x0F0B); n++;
+    case 0x0F0B: AOT::op<0xE7>(c,0x0F0C); n++; return n;
+    case 0x0F0C: AOT::op<0xDA>(c,0x0F0F,0x0F16); n++; if (c.pc!=0x0F0F) return n;
+    case 0x0F0F: AOT::op<0x22>(c,0x0F12,0x023A); n++; if (x.stop) return n;
+    case 0x0F12: AOT::op<0x23>(c,0x0F13); n++;
+    case 0x0F13: AOT::op<0xEB>(c,0x0F14); n++;
+    case 0x0F14: AOT::op<0xF1>(c,0x0F15); n++;
+    case 0x0F15: AOT::op<0xC9>(c,0x0F16); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0F16(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0F16: AOT::op<0xF1>(c,0x0F17); n++;
+    case 0x0F17: AOT::op<0x1E>(c,0x0F19,0x1A); n++;
+    case 0x0F19: AOT::op<0xCA>(c,0x0F1C,0x02D1); n++; if (c.pc!=0x0F1C) return n;
+    case 0x0F1C: AOT::op<0xBF>(c,0x0F1D); n++;
+    case 0x0F1D: AOT::op<0xF5>(c,0x0F1E); n++; if (x.stop) return n;
+    case 0x0F1E: AOT::op<0x01>(c,0x0F21,0x0EFC); n++;
+    case 0x0F21: AOT::op<0xC5>(c,0x0F22); n++; if (x.stop) return n;
+    case 0x0F22: AOT::op<0x2A>(c,0x0F25,0x0226); n++;
+    case 0x0F25: AOT::op<0x22>(c,0x0F28,0x023A); n++; if (x.stop) return n;
+    case 0x0F28: AOT::op<0x21>(c,0x0F2B,0x0000); n++;
+    case 0x0F2B: AOT::op<0xE5>(c,0x0F2C); n++; if (x.stop) return n;
+    case 0x0F2C: AOT::op<0x2A>(c,0x0F2F,0x01D2); n++;
+    case 0x0F2F: AOT::op<0xE5>(c,0x0F30); n++; if (x.stop) return n;
+    case 0x0F30: AOT::op<0x21>(c,0x0F33,0x022A); n++;
+    case 0x0F33: AOT::op<0xEB>(c,0x0F34); n++;
+    case 0x0F34: AOT::op<0x2A>(c,0x0F37,0x0228); n++;
+    case 0x0F37: AOT::op<0xEB>(c,0x0F38); n++;
+    case 0x0F38: AOT::op<0xE7>(c,0x0F39); n++; return n;
+    case 0x0F39: AOT::op<0x01>(c,0x0F3C,0x0F33); n++;
+    case 0x0F3C: AOT::op<0xC2>(c,0x0F3F,0x0F7F); n++; if (c.pc!=0x0F3F) return n;
+    case 0x0F3F: AOT::op<0x2A>(c,0x0F42,0x024B); n++;
+    case 0x0F42: L0F42: AOT::op<0xEB>(c,0x0F43); n++;
+    case 0x0F43: AOT::op<0x2A>(c,0x0F46,0x024D); n++;
+    case 0x0F46: AOT::op<0xEB>(c,0x0F47); n++;
+    case 0x0F47: AOT::op<0xE7>(c,0x0F48); n++; return n;
+    case 0x0F48: AOT::op<0xCA>(c,0x0F4B,0x0F56); n++; if (c.pc!=0x0F4B) return n;
+    case 0x0F4B: AOT::op<0x7E>(c,0x0F4C); n++;
+    case 0x0F4C: AOT::op<0x23>(c,0x0F4D); n++;
+    case 0x0F4D: AOT::op<0x23>(c,0x0F4E); n++;
+    case 0x0F4E: AOT::op<0xB7>(c,0x0F4F); n++;
+    case 0x0F4F: AOT::op<0xCD>(c,0x0F52,0x0F82); n++; return n;
+    case 0x0F52: AOT::op<0xC3>(c,0x0F55,0x0F42); n++; { if (n<x.left) goto L0F42; return n; }
+    }
+  return n;
+}
+
+static unsigned b0F55(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0F55: L0F55: AOT::op<0xC1>(c,0x0F56); n++;
+    case 0x0F56: L0F56: AOT::op<0xEB>(c,0x0F57); n++;
+    case 0x0F57: AOT::op<0x2A>(c,0x0F5A,0x024F); n++;
+    case 0x0F5A: AOT::op<0xEB>(c,0x0F5B); n++;
+    case 0x0F5B: AOT::op<0xE7>(c,0x0F5C); n++; return n;
+    case 0x0F5C: AOT::op<0xCA>(c,0x0F5F,0x0FA4); n++; if (c.pc!=0x0F5F) return n;
+    case 0x0F5F: AOT::op<0xCD>(c,0x0F62,0x14AF); n++; return n;
+    case 0x0F62: AOT::op<0x7B>(c,0x0F63); n++;
+    case 0x0F63: AOT::op<0xE5>(c,0x0F64); n++; if (x.stop) return n;
+    case 0x0F64: AOT::op<0x09>(c,0x0F65); n++;
+    case 0x0F65: AOT::op<0xB7>(c,0x0F66); n++;
+    case 0x0F66: AOT::op<0xF2>(c,0x0F69,0x0F55); n++; if (c.pc!=0x0F69) { if (n<x.left) goto L0F55; return n; }
+    case 0x0F69: AOT::op<0x22>(c,0x0F6C,0x023C); n++; if (x.stop) return n;
+    case 0x0F6C: AOT::op<0xE1>(c,0x0F6D); n++;
+    case 0x0F6D: AOT::op<0x4E>(c,0x0F6E); n++;
+    case 0x0F6E: AOT::op<0x06>(c,0x0F70,0x00); n++;
+    case 0x0F70: AOT::op<0x09>(c,0x0F71); n++;
+    case 0x0F71: AOT::op<0x09>(c,0x0F72); n++;
+    case 0x0F72: AOT::op<0x23>(c,0x0F73); n++;
+    case 0x0F73: AOT::op<0xEB>(c,0x0F74); n++;
+    case 0x0F74: AOT::op<0x2A>(c,0x0F77,0x023C); n++;
+    case 0x0F77: AOT::op<0xEB>(c,0x0F78); n++;
+    case 0x0F78: AOT::op<0xE7>(c,0x0F79); n++; return n;
+    case 0x0F79: AOT::op<0xCA>(c,0x0F7C,0x0F56); n++; if (c.pc!=0x0F7C) { if (n<x.left) goto L0F56; return n; }
+    case 0x0F7C: AOT::op<0x01>(c,0x0F7F,0x0F73); n++;
+    case 0x0F7F: AOT::op<0xC5>(c,0x0F80); n++; if (x.stop) return n;
+    case 0x0F80: AOT::op<0xF6>(c,0x0F82,0x80); n++;
+    case 0x0F82: AOT::op<0x7E>(c,0x0F83); n++;
+    case 0x0F83: AOT::op<0x23>(c,0x0F84); n++;
+    case 0x0F84: AOT::op<0x23>(c,0x0F85); n++;
+    case 0x0F85: AOT::op<0x5E>(c,0x0F86); n++;
+    case 0x0F86: AOT::op<0x23>(c,0x0F87); n++;
+    case 0x0F87: AOT::op<0x56>(c,0x0F88); n++;
+    case 0x0F88: AOT::op<0x23>(c,0x0F89); n++;
+    case 0x0F89: AOT::op<0xF0>(c,0x0F8A); n++; if (c.pc!=0x0F8A) return n;
+    case 0x0F8A: AOT::op<0xB7>(c,0x0F8B); n++;
+    case 0x0F8B: AOT::op<0xC8>(c,0x0F8C); n++; if (c.pc!=0x0F8C) return n;
+    case 0x0F8C: AOT::op<0x44>(c,0x0F8D); n++;
+    case 0x0F8D: AOT::op<0x4D>(c,0x0F8E); n++;
+    case 0x0F8E: AOT::op<0x2A>(c,0x0F91,0x023A); n++;
+    case 0x0F91: AOT::op<0xE7>(c,0x0F92); n++; return n;
+    case 0x0F92: AOT::op<0x60>(c,0x0F93); n++;
+    case 0x0F93: AOT::op<0x69>(c,0x0F94); n++;
+    case 0x0F94: AOT::op<0xD8>(c,0x0F95); n++; if (c.pc!=0x0F95) return n;
+    case 0x0F95: AOT::op<0xE1>(c,0x0F96); n++;
+    case 0x0F96: AOT::op<0xE3>(c,0x0F97); n++; if (x.stop) return n;
+    case 0x0F97: AOT::op<0xE7>(c,0x0F98); n++; return n;
+    case 0x0F98: AOT::op<0xE3>(c,0x0F99); n++; if (x.stop) return n;
+    case 0x0F99: AOT::op<0xE5>(c,0x0F9A); n++; if (x.stop) return n;
+    case 0x0F9A: AOT::op<0x60>(c,0x0F9B); n++;
+    case 0x0F9B: AOT::op<0x69>(c,0x0F9C); n++;
+    case 0x0F9C: AOT::op<0xD0>(c,0x0F9D); n++; if (c.pc!=0x0F9D) return n;
+    case 0x0F9D: AOT::op<0xC1>(c,0x0F9E); n++;
+    case 0x0F9E: AOT::op<0xF1>(c,0x0F9F); n++;
+    case 0x0F9F: AOT::op<0xF1>(c,0x0FA0); n++;
+    case 0x0FA0: AOT::op<0xE5>(c,0x0FA1); n++; if (x.stop) return n;
+    case 0x0FA1: AOT::op<0xD5>(c,0x0FA2); n++; if (x.stop) return n;
+    case 0x0FA2: AOT::op<0xC5>(c,0x0FA3); n++; if (x.stop) return n;
+    case 0x0FA3: AOT::op<0xC9>(c,0x0FA4); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0FA4(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0FA4: AOT::op<0xD1>(c,0x0FA5); n++;
+    case 0x0FA5: AOT::op<0xE1>(c,0x0FA6); n++;
+    case 0x0FA6: AOT::op<0x7D>(c,0x0FA7); n++;
+    case 0x0FA7: AOT::op<0xB4>(c,0x0FA8); n++;
+    case 0x0FA8: AOT::op<0xC8>(c,0x0FA9); n++; if (c.pc!=0x0FA9) return n;
+    case 0x0FA9: AOT::op<0x2B>(c,0x0FAA); n++;
+    case 0x0FAA: AOT::op<0x46>(c,0x0FAB); n++;
+    case 0x0FAB: AOT::op<0x2B>(c,0x0FAC); n++;
+    case 0x0FAC: AOT::op<0x4E>(c,0x0FAD); n++;
+    case 0x0FAD: AOT::op<0xE5>(c,0x0FAE); n++; if (x.stop) return n;
+    case 0x0FAE: AOT::op<0x2B>(c,0x0FAF); n++;
+    case 0x0FAF: AOT::op<0x2B>(c,0x0FB0); n++;
+    case 0x0FB0: AOT::op<0x6E>(c,0x0FB1); n++;
+    case 0x0FB1: AOT::op<0x26>(c,0x0FB3,0x00); n++;
+    case 0x0FB3: AOT::op<0x09>(c,0x0FB4); n++;
+    case 0x0FB4: AOT::op<0x50>(c,0x0FB5); n++;
+    case 0x0FB5: AOT::op<0x59>(c,0x0FB6); n++;
+    case 0x0FB6: AOT::op<0x2B>(c,0x0FB7); n++;
+    case 0x0FB7: AOT::op<0x44>(c,0x0FB8); n++;
+    case 0x0FB8: AOT::op<0x4D>(c,0x0FB9); n++;
+    case 0x0FB9: AOT::op<0x2A>(c,0x0FBC,0x023A); n++;
+    case 0x0FBC: AOT::op<0xCD>(c,0x0FBF,0x029A); n++; return n;
+    case 0x0FBF: AOT::op<0xE1>(c,0x0FC0); n++;
+    case 0x0FC0: AOT::op<0x71>(c,0x0FC1); n++; if (x.stop) return n;
+    case 0x0FC1: AOT::op<0x23>(c,0x0FC2); n++;
+    case 0x0FC2: AOT::op<0x70>(c,0x0FC3); n++; if (x.stop) return n;
+    case 0x0FC3: AOT::op<0x69>(c,0x0FC4); n++;
+    case 0x0FC4: AOT::op<0x60>(c,0x0FC5); n++;
+    case 0x0FC5: AOT::op<0x2B>(c,0x0FC6); n++;
+    case 0x0FC6: AOT::op<0xC3>(c,0x0FC9,0x0F25); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b0FC9(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x0FC9: AOT::op<0xC5>(c,0x0FCA); n++; if (x.stop) return n;
+    case 0x0FCA: AOT::op<0xE5>(c,0x0FCB); n++; if (x.stop) return n;
+    case 0x0FCB: AOT::op<0x2A>(c,0x0FCE,0x0253); n++;
+    case 0x0FCE: AOT::op<0xE3>(c,0x0FCF); n++; if (x.stop) return n;
+    case 0x0FCF: AOT::op<0xCD>(c,0x0FD2,0x0B09); n++; return n;
+    case 0x0FD2: AOT::op<0xE3>(c,0x0FD3); n++; if (x.stop) return n;
+    case 0x0FD3: AOT::op<0xCD>(c,0x0FD6,0x0A87); n++; return n;
+    case 0x0FD6: AOT::op<0x7E>(c,0x0FD7); n++;
+    case 0x0FD7: AOT::op<0xE5>(c,0x0FD8); n++; if (x.stop) return n;
+    case 0x0FD8: AOT::op<0x2A>(c,0x0FDB,0x0253); n++;
+    case 0x0FDB: AOT::op<0xE5>(c,0x0FDC); n++; if (x.stop) return n;
+    case 0x0FDC: AOT::op<0x86>(c,0x0FDD); n++;
+    case 0x0FDD: AOT::op<0x1E>(c,0x0FDF,0x1C); n++;
+    case 0x0FDF: AOT::op<0xDA>(c,0x0FE2,0x02D1); n++; if (c.pc!=0x0FE2) return n;
+    case 0x0FE2: AOT::op<0xCD>(c,0x0FE5,0x0E94); n++; return n;
+    case 0x0FE5: AOT::op<0xD1>(c,0x0FE6); n++;
+    case 0x0FE6: AOT::op<0xCD>(c,0x0FE9,0x101A); n++; return n;
+    case 0x0FE9: AOT::op<0xE3>(c,0x0FEA); n++; if (x.stop) return n;
+    case 0x0FEA: AOT::op<0xCD>(c,0x0FED,0x1019); n++; return n;
+    case 0x0FED: AOT::op<0xE5>(c,0x0FEE); n++; if (x.stop) return n;
+    case 0x0FEE: AOT::op<0x2A>(c,0x0FF1,0x0238); n++;
+    case 0x0FF1: AOT::op<0xEB>(c,0x0FF2); n++;
+    case 0x0FF2: AOT::op<0xCD>(c,0x0FF5,0x1000); n++; return n;
+    case 0x0FF5: AOT::op<0xCD>(c,0x0FF8,0x1000); n++; return n;
+    case 0x0FF8: AOT::op<0x21>(c,0x0FFB,0x0AA6); n++;
+    case 0x0FFB: AOT::op<0xE3>(c,0x0FFC); n++; if (x.stop) return n;
+    case 0x0FFC: AOT::op<0xE5>(c,0x0FFD); n++; if (x.stop) return n;
+    case 0x0FFD: AOT::op<0xC3>(c,0x1000,0x0EC5); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1000(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1000: AOT::op<0xE1>(c,0x1001); n++;
+    case 0x1001: AOT::op<0xE3>(c,0x1002); n++; if (x.stop) return n;
+    case 0x1002: AOT::op<0x7E>(c,0x1003); n++;
+    case 0x1003: AOT::op<0x23>(c,0x1004); n++;
+    case 0x1004: AOT::op<0x23>(c,0x1005); n++;
+    case 0x1005: AOT::op<0x4E>(c,0x1006); n++;
+    case 0x1006: AOT::op<0x23>(c,0x1007); n++;
+    case 0x1007: AOT::op<0x46>(c,0x1008); n++;
+    case 0x1008: AOT::op<0x6F>(c,0x1009); n++;
+    case 0x1009: AOT::op<0x2C>(c,0x100A); n++;
+    case 0x100A: L100A: AOT::op<0x2D>(c,0x100B); n++;
+    case 0x100B: AOT::op<0xC8>(c,0x100C); n++; if (c.pc!=0x100C) return n;
+    case 0x100C: AOT::op<0x0A>(c,0x100D); n++;
+    case 0x100D: AOT::op<0x12>(c,0x100E); n++; if (x.stop) return n;
+    case 0x100E: AOT::op<0x03>(c,0x100F); n++;
+    case 0x100F: AOT::op<0x13>(c,0x1010); n++;
+    case 0x1010: AOT::op<0xC3>(c,0x1013,0x100A); n++; { if (n<x.left) goto L100A; return n; }
+    }
+  return n;
+}
+
+static unsigned b1013(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1013: AOT::op<0xCD>(c,0x1016,0x0A87); n++; return n;
+    case 0x1016: AOT::op<0x2A>(c,0x1019,0x0253); n++;
+    case 0x1019: AOT::op<0xEB>(c,0x101A); n++;
+    case 0x101A: AOT::op<0xCD>(c,0x101D,0x1032); n++; return n;
+    case 0x101D: AOT::op<0xEB>(c,0x101E); n++;
+    case 0x101E: AOT::op<0xC0>(c,0x101F); n++; if (c.pc!=0x101F) return n;
+    case 0x101F: AOT::op<0xD5>(c,0x1020); n++; if (x.stop) return n;
+    case 0x1020: AOT::op<0x50>(c,0x1021); n++;
+    case 0x1021: AOT::op<0x59>(c,0x1022); n++;
+    case 0x1022: AOT::op<0x1B>(c,0x1023); n++;
+    case 0x1023: AOT::op<0x4E>(c,0x1024); n++;
+    case 0x1024: AOT::op<0x2A>(c,0x1027,0x023A); n++;
+    case 0x1027: AOT::op<0xE7>(c,0x1028); n++; return n;
+    case 0x1028: AOT::op<0xC2>(c,0x102B,0x1030); n++; if (c.pc!=0x102B) { if (n<x.left) goto L1030; return n; }
+    case 0x102B: AOT::op<0x47>(c,0x102C); n++;
+    case 0x102C: AOT::op<0x09>(c,0x102D); n++;
+    case 0x102D: AOT::op<0x22>(c,0x1030,0x023A); n++; if (x.stop) return n;
+    case 0x1030: L1030: AOT::op<0xE1>(c,0x1031); n++;
+    case 0x1031: AOT::op<0xC9>(c,0x1032); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1032(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1032: AOT::op<0x2A>(c,0x1035,0x0228); n++;
+    case 0x1035: AOT::op<0x2B>(c,0x1036); n++;
+    case 0x1036: AOT::op<0x46>(c,0x1037); n++;
+    case 0x1037: AOT::op<0x2B>(c,0x1038); n++;
+    case 0x1038: AOT::op<0x4E>(c,0x1039); n++;
+    case 0x1039: AOT::op<0x2B>(c,0x103A); n++;
+    case 0x103A: AOT::op<0x2B>(c,0x103B); n++;
+    case 0x103B: AOT::op<0xE7>(c,0x103C); n++; return n;
+    case 0x103C: AOT::op<0xC0>(c,0x103D); n++; if (c.pc!=0x103D) return n;
+    case 0x103D: AOT::op<0x22>(c,0x1040,0x0228); n++; if (x.stop) return n;
+    case 0x1040: AOT::op<0xC9>(c,0x1041); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1041(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1041: AOT::op<0x01>(c,0x1044,0x0DF4); n++;
+    case 0x1044: AOT::op<0xC5>(c,0x1045); n++; if (x.stop) return n;
+    case 0x1045: AOT::op<0xCD>(c,0x1048,0x1013); n++; return n;
+    case 0x1048: AOT::op<0xAF>(c,0x1049); n++;
+    case 0x1049: AOT::op<0x57>(c,0x104A); n++;
+    case 0x104A: AOT::op<0x32>(c,0x104D,0x0224); n++; if (x.stop) return n;
+    case 0x104D: AOT::op<0x7E>(c,0x104E); n++;
+    case 0x104E: AOT::op<0xB7>(c,0x104F); n++;
+    case 0x104F: AOT::op<0xC9>(c,0x1050); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1050(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1050: AOT::op<0x01>(c,0x1053,0x0DF4); n++;
+    case 0x1053: AOT::op<0xC5>(c,0x1054); n++; if (x.stop) return n;
+    case 0x1054: AOT::op<0xCD>(c,0x1057,0x1045); n++; return n;
+    case 0x1057: AOT::op<0xCA>(c,0x105A,0x074D); n++; if (c.pc!=0x105A) return n;
+    case 0x105A: AOT::op<0x23>(c,0x105B); n++;
+    case 0x105B: AOT::op<0x23>(c,0x105C); n++;
+    case 0x105C: AOT::op<0x5E>(c,0x105D); n++;
+    case 0x105D: AOT::op<0x23>(c,0x105E); n++;
+    case 0x105E: AOT::op<0x56>(c,0x105F); n++;
+    case 0x105F: AOT::op<0x1A>(c,0x1060); n++;
+    case 0x1060: AOT::op<0xC9>(c,0x1061); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1061(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1061: AOT::op<0x3E>(c,0x1063,0x01); n++;
+    case 0x1063: AOT::op<0xCD>(c,0x1066,0x0E94); n++; return n;
+    case 0x1066: AOT::op<0xCD>(c,0x1069,0x1134); n++; return n;
+    case 0x1069: AOT::op<0x2A>(c,0x106C,0x0238); n++;
+    case 0x106C: AOT::op<0x73>(c,0x106D); n++; if (x.stop) return n;
+    case 0x106D: AOT::op<0xC1>(c,0x106E); n++;
+    case 0x106E: AOT::op<0xC3>(c,0x1071,0x0EC5); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1071(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1071: AOT::op<0xCD>(c,0x1074,0x10ED); n++; return n;
+    case 0x1074: AOT::op<0xAF>(c,0x1075); n++;
+    case 0x1075: AOT::op<0xE3>(c,0x1076); n++; if (x.stop) return n;
+    case 0x1076: AOT::op<0x4F>(c,0x1077); n++;
+    case 0x1077: AOT::op<0xE5>(c,0x1078); n++; if (x.stop) return n;
+    case 0x1078: AOT::op<0x7E>(c,0x1079); n++;
+    case 0x1079: AOT::op<0xB8>(c,0x107A); n++;
+    case 0x107A: AOT::op<0xDA>(c,0x107D,0x107F); n++; if (c.pc!=0x107D) return n;
+    case 0x107D: AOT::op<0x78>(c,0x107E); n++;
+    case 0x107E: AOT::op<0x11>(c,0x1081,0x000E); n++;
+    case 0x1081: AOT::op<0xC5>(c,0x1082); n++; if (x.stop) return n;
+    case 0x1082: AOT::op<0xCD>(c,0x1085,0x0EFA); n++; return n;
+    case 0x1085: AOT::op<0xC1>(c,0x1086); n++;
+    case 0x1086: AOT::op<0xE1>(c,0x1087); n++;
+    case 0x1087: AOT::op<0xE5>(c,0x1088); n++; if (x.stop) return n;
+    case 0x1088: AOT::op<0x23>(c,0x1089); n++;
+    case 0x1089: AOT::op<0x23>(c,0x108A); n++;
+    case 0x108A: AOT::op<0x46>(c,0x108B); n++;
+    case 0x108B: AOT::op<0x23>(c,0x108C); n++;
+    case 0x108C: AOT::op<0x66>(c,0x108D); n++;
+    case 0x108D: AOT::op<0x68>(c,0x108E); n++;
+    case 0x108E: AOT::op<0x06>(c,0x1090,0x00); n++;
+    case 0x1090: AOT::op<0x09>(c,0x1091); n++;
+    case 0x1091: AOT::op<0x44>(c,0x1092); n++;
+    case 0x1092: AOT::op<0x4D>(c,0x1093); n++;
+    case 0x1093: AOT::op<0xCD>(c,0x1096,0x0E97); n++; return n;
+    case 0x1096: AOT::op<0x6F>(c,0x1097); n++;
+    case 0x1097: AOT::op<0xCD>(c,0x109A,0x1009); n++; return n;
+    case 0x109A: AOT::op<0xD1>(c,0x109B); n++;
+    case 0x109B: AOT::op<0xCD>(c,0x109E,0x101A); n++; return n;
+    case 0x109E: AOT::op<0xC3>(c,0x10A1,0x0EC5); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b10A1(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x10A1: AOT::op<0xCD>(c,0x10A4,0x10ED); n++; return n;
+    case 0x10A4: AOT::op<0xD1>(c,0x10A5); n++;
+    case 0x10A5: AOT::op<0xD5>(c,0x10A6); n++; if (x.stop) return n;
+    case 0x10A6: AOT::op<0x1A>(c,0x10A7); n++;
+    case 0x10A7: AOT::op<0x90>(c,0x10A8); n++;
+    case 0x10A8: AOT::op<0xC3>(c,0x10AB,0x1075); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b10AB(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x10AB: AOT::op<0xEB>(c,0x10AC); n++;
+    case 0x10AC: AOT::op<0x7E>(c,0x10AD); n++;
+    case 0x10AD: AOT::op<0xCD>(c,0x10B0,0x10F0); n++; return n;
+    case 0x10B0: AOT::op<0xC5>(c,0x10B1); n++; if (x.stop) return n;
+    case 0x10B1: AOT::op<0x1E>(c,0x10B3,0xFF); n++;
+    case 0x10B3: AOT::op<0xFE>(c,0x10B5,0x29); n++;
+    case 0x10B5: AOT::op<0xCA>(c,0x10B8,0x10BD); n++; if (c.pc!=0x10B8) return n;
+    case 0x10B8: AOT::op<0xCF>(c,0x10B9); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b10BA(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x10BA: AOT::op<0xCD>(c,0x10BD,0x1131); n++; return n;
+    case 0x10BD: AOT::op<0xCF>(c,0x10BE); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b10BF(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x10BF: AOT::op<0xF1>(c,0x10C0); n++;
+    case 0x10C0: AOT::op<0xE3>(c,0x10C1); n++; if (x.stop) return n;
+    case 0x10C1: AOT::op<0x01>(c,0x10C4,0x1077); n++;
+    case 0x10C4: AOT::op<0xC5>(c,0x10C5); n++; if (x.stop) return n;
+    case 0x10C5: AOT::op<0x3D>(c,0x10C6); n++;
+    case 0x10C6: AOT::op<0xBE>(c,0x10C7); n++;
+    case 0x10C7: AOT::op<0x06>(c,0x10C9,0x00); n++;
+    case 0x10C9: AOT::op<0xD0>(c,0x10CA); n++; if (c.pc!=0x10CA) return n;
+    case 0x10CA: AOT::op<0x4F>(c,0x10CB); n++;
+    case 0x10CB: AOT::op<0x7E>(c,0x10CC); n++;
+    case 0x10CC: AOT::op<0x91>(c,0x10CD); n++;
+    case 0x10CD: AOT::op<0xBB>(c,0x10CE); n++;
+    case 0x10CE: AOT::op<0x47>(c,0x10CF); n++;
+    case 0x10CF: AOT::op<0xD8>(c,0x10D0); n++; if (c.pc!=0x10D0) return n;
+    case 0x10D0: AOT::op<0x43>(c,0x10D1); n++;
+    case 0x10D1: AOT::op<0xC9>(c,0x10D2); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b10D2(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x10D2: AOT::op<0xCD>(c,0x10D5,0x1045); n++; return n;
+    case 0x10D5: AOT::op<0xCA>(c,0x10D8,0x1287); n++; if (c.pc!=0x10D8) return n;
+    case 0x10D8: AOT::op<0x5F>(c,0x10D9); n++;
+    case 0x10D9: AOT::op<0x23>(c,0x10DA); n++;
+    case 0x10DA: AOT::op<0x23>(c,0x10DB); n++;
+    case 0x10DB: AOT::op<0x7E>(c,0x10DC); n++;
+    case 0x10DC: AOT::op<0x23>(c,0x10DD); n++;
+    case 0x10DD: AOT::op<0x66>(c,0x10DE); n++;
+    case 0x10DE: AOT::op<0x6F>(c,0x10DF); n++;
+    case 0x10DF: AOT::op<0xE5>(c,0x10E0); n++; if (x.stop) return n;
+    case 0x10E0: AOT::op<0x19>(c,0x10E1); n++;
+    case 0x10E1: AOT::op<0x46>(c,0x10E2); n++;
+    case 0x10E2: AOT::op<0x72>(c,0x10E3); n++; if (x.stop) return n;
+    case 0x10E3: AOT::op<0xE3>(c,0x10E4); n++; if (x.stop) return n;
+    case 0x10E4: AOT::op<0xC5>(c,0x10E5); n++; if (x.stop) return n;
+    case 0x10E5: AOT::op<0x7E>(c,0x10E6); n++;
+    case 0x10E6: AOT::op<0xCD>(c,0x10E9,0x1565); n++; return n;
+    case 0x10E9: AOT::op<0xC1>(c,0x10EA); n++;
+    case 0x10EA: AOT::op<0xE1>(c,0x10EB); n++;
+    case 0x10EB: AOT::op<0x70>(c,0x10EC); n++; if (x.stop) return n;
+    case 0x10EC: AOT::op<0xC9>(c,0x10ED); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b10ED(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x10ED: AOT::op<0xEB>(c,0x10EE); n++;
+    case 0x10EE: AOT::op<0xCF>(c,0x10EF); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b10F0(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x10F0: AOT::op<0xC1>(c,0x10F1); n++;
+    case 0x10F1: AOT::op<0xD1>(c,0x10F2); n++;
+    case 0x10F2: AOT::op<0xC5>(c,0x10F3); n++; if (x.stop) return n;
+    case 0x10F3: AOT::op<0x43>(c,0x10F4); n++;
+    case 0x10F4: AOT::op<0x04>(c,0x10F5); n++;
+    case 0x10F5: AOT::op<0x05>(c,0x10F6); n++;
+    case 0x10F6: AOT::op<0xC0>(c,0x10F7); n++; if (c.pc!=0x10F7) return n;
+    case 0x10F7: AOT::op<0xC3>(c,0x10FA,0x074D); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b10FA(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x10FA: AOT::op<0xCD>(c,0x10FD,0x1134); n++; return n;
+    case 0x10FD: AOT::op<0x32>(c,0x1100,0x1101); n++; if (x.stop) return n;
+    case 0x1100: AOT::op<0xDB>(c,0x1102,AOT::imm8(c,0x1101)); n++;
+    case 0x1102: AOT::op<0xC3>(c,0x1105,0x0DF4); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1105(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1105: AOT::op<0xCD>(c,0x1108,0x1124); n++; return n;
+    case 0x1108: AOT::op<0xD3>(c,0x110A,AOT::imm8(c,0x1109)); n++;
+    case 0x110A: AOT::op<0xC9>(c,0x110B); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b110B(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x110B: AOT::op<0xCD>(c,0x110E,0x1124); n++; return n;
+    case 0x110E: AOT::op<0xF5>(c,0x110F); n++; if (x.stop) return n;
+    case 0x110F: AOT::op<0x1E>(c,0x1111,0x00); n++;
+    case 0x1111: AOT::op<0x2B>(c,0x1112); n++;
+    case 0x1112: AOT::op<0xD7>(c,0x1113); n++; return n;
+    case 0x1113: AOT::op<0xCA>(c,0x1116,0x111B); n++; if (c.pc!=0x1116) return n;
+    case 0x1116: AOT::op<0xCF>(c,0x1117); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1118(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1118: AOT::op<0xCD>(c,0x111B,0x1131); n++; return n;
+    case 0x111B: AOT::op<0xC1>(c,0x111C); n++;
+    case 0x111C: L111C: AOT::op<0xDB>(c,0x111E,AOT::imm8(c,0x111D)); n++;
+    case 0x111E: AOT::op<0xAB>(c,0x111F); n++;
+    case 0x111F: AOT::op<0xA0>(c,0x1120); n++;
+    case 0x1120: AOT::op<0xCA>(c,0x1123,0x111C); n++; if (c.pc!=0x1123) { if (n<x.left) goto L111C; return n; }
+    case 0x1123: AOT::op<0xC9>(c,0x1124); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1124(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1124: AOT::op<0xCD>(c,0x1127,0x1131); n++; return n;
+    case 0x1127: AOT::op<0x32>(c,0x112A,0x111D); n++; if (x.stop) return n;
+    case 0x112A: AOT::op<0x32>(c,0x112D,0x1109); n++; if (x.stop) return n;
+    case 0x112D: AOT::op<0xCF>(c,0x112E); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1130(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1130: AOT::op<0xD7>(c,0x1131); n++; return n;
+    case 0x1131: AOT::op<0xCD>(c,0x1134,0x0A83); n++; return n;
+    case 0x1134: AOT::op<0xCD>(c,0x1137,0x0734); n++; return n;
+    case 0x1137: AOT::op<0x7A>(c,0x1138); n++;
+    case 0x1138: AOT::op<0xB7>(c,0x1139); n++;
+    case 0x1139: AOT::op<0xC2>(c,0x113C,0x074D); n++; if (c.pc!=0x113C) return n;
+    case 0x113C: AOT::op<0x2B>(c,0x113D); n++;
+    case 0x113D: AOT::op<0xD7>(c,0x113E); n++; return n;
+    case 0x113E: AOT::op<0x7B>(c,0x113F); n++;
+    case 0x113F: AOT::op<0xC9>(c,0x1140); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1140(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1140: L1140: AOT::op<0xDB>(c,0x1142,0x06); n++;
+    case 0x1142: AOT::op<0xE6>(c,0x1144,0x01); n++;
+    case 0x1144: AOT::op<0xC2>(c,0x1147,0x1140); n++; if (c.pc!=0x1147) { if (n<x.left) goto L1140; return n; }
+    case 0x1147: AOT::op<0xDB>(c,0x1149,0x07); n++;
+    case 0x1149: AOT::op<0xC9>(c,0x114A); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b114A(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x114A: AOT::op<0xCD>(c,0x114D,0x114D); n++; return n;
+    case 0x114D: AOT::op<0xF5>(c,0x114E); n++; if (x.stop) return n;
+    case 0x114E: L114E: AOT::op<0xDB>(c,0x1150,0x06); n++;
+    case 0x1150: AOT::op<0xE6>(c,0x1152,0x80); n++;
+    case 0x1152: AOT::op<0xC2>(c,0x1155,0x114E); n++; if (c.pc!=0x1155) { if (n<x.left) goto L114E; return n; }
+    case 0x1155: AOT::op<0xF1>(c,0x1156); n++;
+    case 0x1156: AOT::op<0xD3>(c,0x1158,0x07); n++;
+    case 0x1158: AOT::op<0xC9>(c,0x1159); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b11F9(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x11F9: AOT::op<0xCD>(c,0x11FC,0x0738); n++; return n;
+    case 0x11FC: AOT::op<0x1A>(c,0x11FD); n++;
+    case 0x11FD: AOT::op<0xC3>(c,0x1200,0x0DF4); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1200(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1200: AOT::op<0xCD>(c,0x1203,0x0A83); n++; return n;
+    case 0x1203: AOT::op<0xCD>(c,0x1206,0x0738); n++; return n;
+    case 0x1206: AOT::op<0xD5>(c,0x1207); n++; if (x.stop) return n;
+    case 0x1207: AOT::op<0xCF>(c,0x1208); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1209(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1209: AOT::op<0xCD>(c,0x120C,0x1131); n++; return n;
+    case 0x120C: AOT::op<0xD1>(c,0x120D); n++;
+    case 0x120D: AOT::op<0x12>(c,0x120E); n++; if (x.stop) return n;
+    case 0x120E: AOT::op<0xC9>(c,0x120F); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b120F(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x120F: AOT::op<0x21>(c,0x1212,0x16E4); n++;
+    case 0x1212: AOT::op<0xCD>(c,0x1215,0x14AF); n++; return n;
+    case 0x1215: AOT::op<0xC3>(c,0x1218,0x1221); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1218(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1218: AOT::op<0xCD>(c,0x121B,0x14AF); n++; return n;
+    case 0x121B: AOT::op<0x21>(c,0x121E,0xD1C1); n++;
+    case 0x121E: AOT::op<0xCD>(c,0x1221,0x1489); n++; return n;
+    case 0x1221: AOT::op<0x78>(c,0x1222); n++;
+    case 0x1222: AOT::op<0xB7>(c,0x1223); n++;
+    case 0x1223: AOT::op<0xC8>(c,0x1224); n++; if (c.pc!=0x1224) return n;
+    case 0x1224: AOT::op<0x3A>(c,0x1227,0x0256); n++;
+    case 0x1227: AOT::op<0xB7>(c,0x1228); n++;
+    case 0x1228: AOT::op<0xCA>(c,0x122B,0x14A1); n++; if (c.pc!=0x122B) return n;
+    case 0x122B: AOT::op<0x90>(c,0x122C); n++;
+    case 0x122C: AOT::op<0xD2>(c,0x122F,0x123B); n++; if (c.pc!=0x122F) { if (n<x.left) goto L123B; return n; }
+    case 0x122F: AOT::op<0x2F>(c,0x1230); n++;
+    case 0x1230: AOT::op<0x3C>(c,0x1231); n++;
+    case 0x1231: AOT::op<0xEB>(c,0x1232); n++;
+    case 0x1232: AOT::op<0xCD>(c,0x1235,0x1491); n++; return n;
+    case 0x1235: AOT::op<0xEB>(c,0x1236); n++;
+    case 0x1236: AOT::op<0xCD>(c,0x1239,0x14A1); n++; return n;
+    case 0x1239: AOT::op<0xC1>(c,0x123A); n++;
+    case 0x123A: AOT::op<0xD1>(c,0x123B); n++;
+    case 0x123B: L123B: AOT::op<0xFE>(c,0x123D,0x19); n++;
+    case 0x123D: AOT::op<0xD0>(c,0x123E); n++; if (c.pc!=0x123E) return n;
+    case 0x123E: AOT::op<0xF5>(c,0x123F); n++; if (x.stop) return n;
+    case 0x123F: AOT::op<0xCD>(c,0x1242,0x14C6); n++; return n;
+    case 0x1242: AOT::op<0x67>(c,0x1243); n++;
+    case 0x1243: AOT::op<0xF1>(c,0x1244); n++;
+    case 0x1244: AOT::op<0xCD>(c,0x1247,0x12E8); n++; return n;
+    case 0x1247: AOT::op<0xB4>(c,0x1248); n++;
+    case 0x1248: AOT::op<0x21>(c,0x124B,0x0253); n++;
+    case 0x124B: AOT::op<0xF2>(c,0x124E,0x1261); n++; if (c.pc!=0x124E) return n;
+    case 0x124E: AOT::op<0xCD>(c,0x1251,0x12C8); n++; return n;
+    case 0x1251: AOT::op<0xD2>(c,0x1254,0x12A7); n++; if (c.pc!=0x1254) return n;
+    case 0x1254: AOT::op<0x23>(c,0x1255); n++;
+    case 0x1255: AOT::op<0x34>(c,0x1256); n++; if (x.stop) return n;
+    case 0x1256: AOT::op<0xCA>(c,0x1259,0x12C3); n++; if (c.pc!=0x1259) return n;
+    case 0x1259: AOT::op<0x2E>(c,0x125B,0x01); n++;
+    case 0x125B: AOT::op<0xCD>(c,0x125E,0x12FE); n++; return n;
+    case 0x125E: AOT::op<0xC3>(c,0x1261,0x12A7); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1261(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1261: AOT::op<0xAF>(c,0x1262); n++;
+    case 0x1262: AOT::op<0x90>(c,0x1263); n++;
+    case 0x1263: AOT::op<0x47>(c,0x1264); n++;
+    case 0x1264: AOT::op<0x7E>(c,0x1265); n++;
+    case 0x1265: AOT::op<0x9B>(c,0x1266); n++;
+    case 0x1266: AOT::op<0x5F>(c,0x1267); n++;
+    case 0x1267: AOT::op<0x23>(c,0x1268); n++;
+    case 0x1268: AOT::op<0x7E>(c,0x1269); n++;
+    case 0x1269: AOT::op<0x9A>(c,0x126A); n++;
+    case 0x126A: AOT::op<0x57>(c,0x126B); n++;
+    case 0x126B: AOT::op<0x23>(c,0x126C); n++;
+    case 0x126C: AOT::op<0x7E>(c,0x126D); n++;
+    case 0x126D: AOT::op<0x99>(c,0x126E); n++;
+    case 0x126E: AOT::op<0x4F>(c,0x126F); n++;
+    case 0x126F: AOT::op<0xDC>(c,0x1272,0x12D4); n++; if (c.pc!=0x1272) return n; if (x.stop) return n;
+    case 0x1272: AOT::op<0x68>(c,0x1273); n++;
+    case 0x1273: AOT::op<0x63>(c,0x1274); n++;
+    case 0x1274: AOT::op<0xAF>(c,0x1275); n++;
+    case 0x1275: L1275: AOT::op<0x47>(c,0x1276); n++;
+    case 0x1276: AOT::op<0x79>(c,0x1277); n++;
+    case 0x1277: AOT::op<0xB7>(c,0x1278); n++;
+    case 0x1278: AOT::op<0xC2>(c,0x127B,0x1294); n++; if (c.pc!=0x127B) return n;
+    case 0x127B: AOT::op<0x4A>(c,0x127C); n++;
+    case 0x127C: AOT::op<0x54>(c,0x127D); n++;
+    case 0x127D: AOT::op<0x65>(c,0x127E); n++;
+    case 0x127E: AOT::op<0x6F>(c,0x127F); n++;
+    case 0x127F: AOT::op<0x78>(c,0x1280); n++;
+    case 0x1280: AOT::op<0xD6>(c,0x1282,0x08); n++;
+    case 0x1282: AOT::op<0xFE>(c,0x1284,0xE0); n++;
+    case 0x1284: AOT::op<0xC2>(c,0x1287,0x1275); n++; if (c.pc!=0x1287) { if (n<x.left) goto L1275; return n; }
+    case 0x1287: AOT::op<0xAF>(c,0x1288); n++;
+    case 0x1288: AOT::op<0x32>(c,0x128B,0x0256); n++; if (x.stop) return n;
+    case 0x128B: AOT::op<0xC9>(c,0x128C); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b128C(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x128C: L128C: AOT::op<0x05>(c,0x128D); n++;
+    case 0x128D: AOT::op<0x29>(c,0x128E); n++;
+    case 0x128E: AOT::op<0x7A>(c,0x128F); n++;
+    case 0x128F: AOT::op<0x17>(c,0x1290); n++;
+    case 0x1290: AOT::op<0x57>(c,0x1291); n++;
+    case 0x1291: AOT::op<0x79>(c,0x1292); n++;
+    case 0x1292: AOT::op<0x8F>(c,0x1293); n++;
+    case 0x1293: AOT::op<0x4F>(c,0x1294); n++;
+    case 0x1294: AOT::op<0xF2>(c,0x1297,0x128C); n++; if (c.pc!=0x1297) { if (n<x.left) goto L128C; return n; }
+    case 0x1297: AOT::op<0x78>(c,0x1298); n++;
+    case 0x1298: AOT::op<0x5C>(c,0x1299); n++;
+    case 0x1299: AOT::op<0x45>(c,0x129A); n++;
+    case 0x129A: AOT::op<0xB7>(c,0x129B); n++;
+    case 0x129B: AOT::op<0xCA>(c,0x129E,0x12A7); n++; if (c.pc!=0x129E) { if (n<x.left) goto L12A7; return n; }
+    case 0x129E: AOT::op<0x21>(c,0x12A1,0x0256); n++;
+    case 0x12A1: AOT::op<0x86>(c,0x12A2); n++;
+    case 0x12A2: AOT::op<0x77>(c,0x12A3); n++; if (x.stop) return n;
+    case 0x12A3: AOT::op<0xD2>(c,0x12A6,0x1287); n++; if (c.pc!=0x12A6) return n;
+    case 0x12A6: AOT::op<0xC8>(c,0x12A7); n++; if (c.pc!=0x12A7) return n;
+    case 0x12A7: L12A7: AOT::op<0x78>(c,0x12A8); n++;
+    case 0x12A8: AOT::op<0x21>(c,0x12AB,0x0256); n++;
+    case 0x12AB: AOT::op<0xB7>(c,0x12AC); n++;
+    case 0x12AC: AOT::op<0xFC>(c,0x12AF,0x12B9); n++; if (c.pc!=0x12AF) return n; if (x.stop) return n;
+    case 0x12AF: AOT::op<0x46>(c,0x12B0); n++;
+    case 0x12B0: AOT::op<0x23>(c,0x12B1); n++;
+    case 0x12B1: AOT::op<0x7E>(c,0x12B2); n++;
+    case 0x12B2: AOT::op<0xE6>(c,0x12B4,0x80); n++;
+    case 0x12B4: AOT::op<0xA9>(c,0x12B5); n++;
+    case 0x12B5: AOT::op<0x4F>(c,0x12B6); n++;
+    case 0x12B6: AOT::op<0xC3>(c,0x12B9,0x14A1); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b12B9(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x12B9: AOT::op<0x1C>(c,0x12BA); n++;
+    case 0x12BA: AOT::op<0xC0>(c,0x12BB); n++; if (c.pc!=0x12BB) return n;
+    case 0x12BB: AOT::op<0x14>(c,0x12BC); n++;
+    case 0x12BC: AOT::op<0xC0>(c,0x12BD); n++; if (c.pc!=0x12BD) return n;
+    case 0x12BD: AOT::op<0x0C>(c,0x12BE); n++;
+    case 0x12BE: AOT::op<0xC0>(c,0x12BF); n++; if (c.pc!=0x12BF) return n;
+    case 0x12BF: AOT::op<0x0E>(c,0x12C1,0x80); n++;
+    case 0x12C1: AOT::op<0x34>(c,0x12C2); n++; if (x.stop) return n;
+    case 0x12C2: AOT::op<0xC0>(c,0x12C3); n++; if (c.pc!=0x12C3) return n;
+    case 0x12C3: AOT::op<0x1E>(c,0x12C5,0x0A); n++;
+    case 0x12C5: AOT::op<0xC3>(c,0x12C8,0x02D1); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b12C8(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x12C8: AOT::op<0x7E>(c,0x12C9); n++;
+    case 0x12C9: AOT::op<0x83>(c,0x12CA); n++;
+    case 0x12CA: AOT::op<0x5F>(c,0x12CB); n++;
+    case 0x12CB: AOT::op<0x23>(c,0x12CC); n++;
+    case 0x12CC: AOT::op<0x7E>(c,0x12CD); n++;
+    case 0x12CD: AOT::op<0x8A>(c,0x12CE); n++;
+    case 0x12CE: AOT::op<0x57>(c,0x12CF); n++;
+    case 0x12CF: AOT::op<0x23>(c,0x12D0); n++;
+    case 0x12D0: AOT::op<0x7E>(c,0x12D1); n++;
+    case 0x12D1: AOT::op<0x89>(c,0x12D2); n++;
+    case 0x12D2: AOT::op<0x4F>(c,0x12D3); n++;
+    case 0x12D3: AOT::op<0xC9>(c,0x12D4); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b12D4(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x12D4: AOT::op<0x21>(c,0x12D7,0x0257); n++;
+    case 0x12D7: AOT::op<0x7E>(c,0x12D8); n++;
+    case 0x12D8: AOT::op<0x2F>(c,0x12D9); n++;
+    case 0x12D9: AOT::op<0x77>(c,0x12DA); n++; if (x.stop) return n;
+    case 0x12DA: AOT::op<0xAF>(c,0x12DB); n++;
+    case 0x12DB: AOT::op<0x6F>(c,0x12DC); n++;
+    case 0x12DC: AOT::op<0x90>(c,0x12DD); n++;
+    case 0x12DD: AOT::op<0x47>(c,0x12DE); n++;
+    case 0x12DE: AOT::op<0x7D>(c,0x12DF); n++;
+    case 0x12DF: AOT::op<0x9B>(c,0x12E0); n++;
+    case 0x12E0: AOT::op<0x5F>(c,0x12E1); n++;
+    case 0x12E1: AOT::op<0x7D>(c,0x12E2); n++;
+    case 0x12E2: AOT::op<0x9A>(c,0x12E3); n++;
+    case 0x12E3: AOT::op<0x57>(c,0x12E4); n++;
+    case 0x12E4: AOT::op<0x7D>(c,0x12E5); n++;
+    case 0x12E5: AOT::op<0x99>(c,0x12E6); n++;
+    case 0x12E6: AOT::op<0x4F>(c,0x12E7); n++;
+    case 0x12E7: AOT::op<0xC9>(c,0x12E8); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b12E8(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x12E8: AOT::op<0x06>(c,0x12EA,0x00); n++;
+    case 0x12EA: L12EA: AOT::op<0xD6>(c,0x12EC,0x08); n++;
+    case 0x12EC: AOT::op<0xDA>(c,0x12EF,0x12F7); n++; if (c.pc!=0x12EF) return n;
+    case 0x12EF: AOT::op<0x43>(c,0x12F0); n++;
+    case 0x12F0: AOT::op<0x5A>(c,0x12F1); n++;
+    case 0x12F1: AOT::op<0x51>(c,0x12F2); n++;
+    case 0x12F2: AOT::op<0x0E>(c,0x12F4,0x00); n++;
+    case 0x12F4: AOT::op<0xC3>(c,0x12F7,0x12EA); n++; { if (n<x.left) goto L12EA; return n; }
+    }
+  return n;
+}
+
+static unsigned b12F7(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x12F7: AOT::op<0xC6>(c,0x12F9,0x09); n++;
+    case 0x12F9: AOT::op<0x6F>(c,0x12FA); n++;
+    case 0x12FA: L12FA: AOT::op<0xAF>(c,0x12FB); n++;
+    case 0x12FB: AOT::op<0x2D>(c,0x12FC); n++;
+    case 0x12FC: AOT::op<0xC8>(c,0x12FD); n++; if (c.pc!=0x12FD) return n;
+    case 0x12FD: AOT::op<0x79>(c,0x12FE); n++;
+    case 0x12FE: AOT::op<0x1F>(c,0x12FF); n++;
+    case 0x12FF: AOT::op<0x4F>(c,0x1300); n++;
+    case 0x1300: AOT::op<0x7A>(c,0x1301); n++;
+    case 0x1301: AOT::op<0x1F>(c,0x1302); n++;
+    case 0x1302: AOT::op<0x57>(c,0x1303); n++;
+    case 0x1303: AOT::op<0x7B>(c,0x1304); n++;
+    case 0x1304: AOT::op<0x1F>(c,0x1305); n++;
+    case 0x1305: AOT::op<0x5F>(c,0x1306); n++;
+    case 0x1306: AOT::op<0x78>(c,0x1307); n++;
+    case 0x1307: AOT::op<0x1F>(c,0x1308); n++;
+    case 0x1308: AOT::op<0x47>(c,0x1309); n++;
+    case 0x1309: AOT::op<0xC3>(c,0x130C,0x12FA); n++; { if (n<x.left) goto L12FA; return n; }
+    }
+  return n;
+}
+
+static unsigned b131D(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x131D: AOT::op<0xEF>(c,0x131E); n++; return n;
+    case 0x131E: AOT::op<0xEA>(c,0x1321,0x074D); n++; if (c.pc!=0x1321) return n;
+    case 0x1321: AOT::op<0x21>(c,0x1324,0x0256); n++;
+    case 0x1324: AOT::op<0x7E>(c,0x1325); n++;
+    case 0x1325: AOT::op<0x01>(c,0x1328,0x8035); n++;
+    case 0x1328: AOT::op<0x11>(c,0x132B,0x04F3); n++;
+    case 0x132B: AOT::op<0x90>(c,0x132C); n++;
+    case 0x132C: AOT::op<0xF5>(c,0x132D); n++; if (x.stop) return n;
+    case 0x132D: AOT::op<0x70>(c,0x132E); n++; if (x.stop) return n;
+    case 0x132E: AOT::op<0xD5>(c,0x132F); n++; if (x.stop) return n;
+    case 0x132F: AOT::op<0xC5>(c,0x1330); n++; if (x.stop) return n;
+    case 0x1330: AOT::op<0xCD>(c,0x1333,0x1221); n++; return n;
+    case 0x1333: AOT::op<0xC1>(c,0x1334); n++;
+    case 0x1334: AOT::op<0xD1>(c,0x1335); n++;
+    case 0x1335: AOT::op<0x04>(c,0x1336); n++;
+    case 0x1336: AOT::op<0xCD>(c,0x1339,0x13B9); n++; return n;
+    case 0x1339: AOT::op<0x21>(c,0x133C,0x130C); n++;
+    case 0x133C: AOT::op<0xCD>(c,0x133F,0x1218); n++; return n;
+    case 0x133F: AOT::op<0x21>(c,0x1342,0x1310); n++;
+    case 0x1342: AOT::op<0xCD>(c,0x1345,0x17AC); n++; return n;
+    case 0x1345: AOT::op<0x01>(c,0x1348,0x8080); n++;
+    case 0x1348: AOT::op<0x11>(c,0x134B,0x0000); n++;
+    case 0x134B: AOT::op<0xCD>(c,0x134E,0x1221); n++; return n;
+    case 0x134E: AOT::op<0xF1>(c,0x134F); n++;
+    case 0x134F: AOT::op<0xCD>(c,0x1352,0x15E5); n++; return n;
+    case 0x1352: AOT::op<0x01>(c,0x1355,0x8031); n++;
+    case 0x1355: AOT::op<0x11>(c,0x1358,0x7218); n++;
+    }
+  return n;
+}
+
+static unsigned b1359(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1359: AOT::op<0xC1>(c,0x135A); n++;
+    case 0x135A: AOT::op<0xD1>(c,0x135B); n++;
+    case 0x135B: AOT::op<0xEF>(c,0x135C); n++; return n;
+    case 0x135C: AOT::op<0xC8>(c,0x135D); n++; if (c.pc!=0x135D) return n;
+    case 0x135D: AOT::op<0x2E>(c,0x135F,0x00); n++;
+    case 0x135F: AOT::op<0xCD>(c,0x1362,0x1429); n++; return n;
+    case 0x1362: AOT::op<0x79>(c,0x1363); n++;
+    case 0x1363: AOT::op<0x32>(c,0x1366,0x1392); n++; if (x.stop) return n;
+    case 0x1366: AOT::op<0xEB>(c,0x1367); n++;
+    case 0x1367: AOT::op<0x22>(c,0x136A,0x138D); n++; if (x.stop) return n;
+    case 0x136A: AOT::op<0x01>(c,0x136D,0x0000); n++;
+    case 0x136D: AOT::op<0x50>(c,0x136E); n++;
+    case 0x136E: AOT::op<0x58>(c,0x136F); n++;
+    case 0x136F: AOT::op<0x21>(c,0x1372,0x1272); n++;
+    case 0x1372: AOT::op<0xE5>(c,0x1373); n++; if (x.stop) return n;
+    case 0x1373: AOT::op<0x21>(c,0x1376,0x137B); n++;
+    case 0x1376: AOT::op<0xE5>(c,0x1377); n++; if (x.stop) return n;
+    case 0x1377: AOT::op<0xE5>(c,0x1378); n++; if (x.stop) return n;
+    case 0x1378: AOT::op<0x21>(c,0x137B,0x0253); n++;
+    case 0x137B: AOT::op<0x7E>(c,0x137C); n++;
+    case 0x137C: AOT::op<0x23>(c,0x137D); n++;
+    case 0x137D: AOT::op<0xB7>(c,0x137E); n++;
+    case 0x137E: AOT::op<0xCA>(c,0x1381,0x13A6); n++; if (c.pc!=0x1381) return n;
+    case 0x1381: AOT::op<0xE5>(c,0x1382); n++; if (x.stop) return n;
+    case 0x1382: AOT::op<0xEB>(c,0x1383); n++;
+    case 0x1383: AOT::op<0x1E>(c,0x1385,0x08); n++;
+    case 0x1385: L1385: AOT::op<0x1F>(c,0x1386); n++;
+    case 0x1386: AOT::op<0x57>(c,0x1387); n++;
+    case 0x1387: AOT::op<0x79>(c,0x1388); n++;
+    case 0x1388: AOT::op<0xD2>(c,0x138B,0x1393); n++; if (c.pc!=0x138B) { if (n<x.left) goto L1393; return n; }
+    case 0x138B: AOT::op<0xD5>(c,0x138C); n++; if (x.stop) return n;
+    case 0x138C: AOT::op<0x11>(c,0x138F,AOT::imm16(c,0x138D)); n++;
+    case 0x138F: AOT::op<0x19>(c,0x1390); n++;
+    case 0x1390: AOT::op<0xD1>(c,0x1391); n++;
+    case 0x1391: AOT::op<0xCE>(c,0x1393,AOT::imm8(c,0x1392)); n++;
+    case 0x1393: L1393: AOT::op<0x1F>(c,0x1394); n++;
+    case 0x1394: AOT::op<0x4F>(c,0x1395); n++;
+    case 0x1395: AOT::op<0x7C>(c,0x1396); n++;
+    case 0x1396: AOT::op<0x1F>(c,0x1397); n++;
+    case 0x1397: AOT::op<0x67>(c,0x1398); n++;
+    case 0x1398: AOT::op<0x7D>(c,0x1399); n++;
+    case 0x1399: AOT::op<0x1F>(c,0x139A); n++;
+    case 0x139A: AOT::op<0x6F>(c,0x139B); n++;
+    case 0x139B: AOT::op<0x78>(c,0x139C); n++;
+    case 0x139C: AOT::op<0x1F>(c,0x139D); n++;
+    case 0x139D: AOT::op<0x47>(c,0x139E); n++;
+    case 0x139E: AOT::op<0x1D>(c,0x139F); n++;
+    case 0x139F: AOT::op<0x7A>(c,0x13A0); n++;
+    case 0x13A0: AOT::op<0xC2>(c,0x13A3,0x1385); n++; if (c.pc!=0x13A3) { if (n<x.left) goto L1385; return n; }
+    case 0x13A3: AOT::op<0xEB>(c,0x13A4); n++;
+    case 0x13A4: AOT::op<0xE1>(c,0x13A5); n++;
+    case 0x13A5: AOT::op<0xC9>(c,0x13A6); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b13A6(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x13A6: AOT::op<0x43>(c,0x13A7); n++;
+    case 0x13A7: AOT::op<0x5A>(c,0x13A8); n++;
+    case 0x13A8: AOT::op<0x51>(c,0x13A9); n++;
+    case 0x13A9: AOT::op<0x4F>(c,0x13AA); n++;
+    case 0x13AA: AOT::op<0xC9>(c,0x13AB); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b13AB(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x13AB: AOT::op<0xCD>(c,0x13AE,0x1491); n++; return n;
+    case 0x13AE: AOT::op<0x01>(c,0x13B1,0x8420); n++;
+    case 0x13B1: AOT::op<0x11>(c,0x13B4,0x0000); n++;
+    case 0x13B4: AOT::op<0xCD>(c,0x13B7,0x14A1); n++; return n;
+    case 0x13B7: AOT::op<0xC1>(c,0x13B8); n++;
+    case 0x13B8: AOT::op<0xD1>(c,0x13B9); n++;
+    case 0x13B9: AOT::op<0xEF>(c,0x13BA); n++; return n;
+    case 0x13BA: AOT::op<0xCA>(c,0x13BD,0x02C9); n++; if (c.pc!=0x13BD) return n;
+    case 0x13BD: AOT::op<0x2E>(c,0x13BF,0xFF); n++;
+    case 0x13BF: AOT::op<0xCD>(c,0x13C2,0x1429); n++; return n;
+    case 0x13C2: AOT::op<0x34>(c,0x13C3); n++; if (x.stop) return n;
+    case 0x13C3: AOT::op<0x34>(c,0x13C4); n++; if (x.stop) return n;
+    case 0x13C4: AOT::op<0x2B>(c,0x13C5); n++;
+    case 0x13C5: AOT::op<0x7E>(c,0x13C6); n++;
+    case 0x13C6: AOT::op<0x32>(c,0x13C9,0x13E8); n++; if (x.stop) return n;
+    case 0x13C9: AOT::op<0x2B>(c,0x13CA); n++;
+    case 0x13CA: AOT::op<0x7E>(c,0x13CB); n++;
+    case 0x13CB: AOT::op<0x32>(c,0x13CE,0x13E4); n++; if (x.stop) return n;
+    case 0x13CE: AOT::op<0x2B>(c,0x13CF); n++;
+    case 0x13CF: AOT::op<0x7E>(c,0x13D0); n++;
+    case 0x13D0: AOT::op<0x32>(c,0x13D3,0x13E0); n++; if (x.stop) return n;
+    case 0x13D3: AOT::op<0x41>(c,0x13D4); n++;
+    case 0x13D4: AOT::op<0xEB>(c,0x13D5); n++;
+    case 0x13D5: AOT::op<0xAF>(c,0x13D6); n++;
+    case 0x13D6: AOT::op<0x4F>(c,0x13D7); n++;
+    case 0x13D7: AOT::op<0x57>(c,0x13D8); n++;
+    case 0x13D8: AOT::op<0x5F>(c,0x13D9); n++;
+    case 0x13D9: AOT::op<0x32>(c,0x13DC,0x13EB); n++; if (x.stop) return n;
+    case 0x13DC: L13DC: AOT::op<0xE5>(c,0x13DD); n++; if (x.stop) return n;
+    case 0x13DD: AOT::op<0xC5>(c,0x13DE); n++; if (x.stop) return n;
+    case 0x13DE: AOT::op<0x7D>(c,0x13DF); n++;
+    case 0x13DF: AOT::op<0xD6>(c,0x13E1,AOT::imm8(c,0x13E0)); n++;
+    case 0x13E1: AOT::op<0x6F>(c,0x13E2); n++;
+    case 0x13E2: AOT::op<0x7C>(c,0x13E3); n++;
+    case 0x13E3: AOT::op<0xDE>(c,0x13E5,AOT::imm8(c,0x13E4)); n++;
+    case 0x13E5: AOT::op<0x67>(c,0x13E6); n++;
+    case 0x13E6: AOT::op<0x78>(c,0x13E7); n++;
+    case 0x13E7: AOT::op<0xDE>(c,0x13E9,AOT::imm8(c,0x13E8)); n++;
+    case 0x13E9: AOT::op<0x47>(c,0x13EA); n++;
+    case 0x13EA: AOT::op<0x3E>(c,0x13EC,AOT::imm8(c,0x13EB)); n++;
+    case 0x13EC: AOT::op<0xDE>(c,0x13EE,0x00); n++;
+    case 0x13EE: AOT::op<0x3F>(c,0x13EF); n++;
+    case 0x13EF: AOT::op<0xD2>(c,0x13F2,0x13F9); n++; if (c.pc!=0x13F2) return n;
+    case 0x13F2: AOT::op<0x32>(c,0x13F5,0x13EB); n++; if (x.stop) return n;
+    case 0x13F5: AOT::op<0xF1>(c,0x13F6); n++;
+    case 0x13F6: AOT::op<0xF1>(c,0x13F7); n++;
+    case 0x13F7: AOT::op<0x37>(c,0x13F8); n++;
+    case 0x13F8: AOT::op<0xD2>(c,0x13FB,0xE1C1); n++; if (c.pc!=0x13FB) return n;
+    case 0x13FB: AOT::op<0x79>(c,0x13FC); n++;
+    case 0x13FC: AOT::op<0x3C>(c,0x13FD); n++;
+    case 0x13FD: AOT::op<0x3D>(c,0x13FE); n++;
+    case 0x13FE: AOT::op<0x1F>(c,0x13FF); n++;
+    case 0x13FF: AOT::op<0xFA>(c,0x1402,0x12A8); n++; if (c.pc!=0x1402) return n;
+    case 0x1402: AOT::op<0x17>(c,0x1403); n++;
+    case 0x1403: AOT::op<0x7B>(c,0x1404); n++;
+    case 0x1404: AOT::op<0x17>(c,0x1405); n++;
+    case 0x1405: AOT::op<0x5F>(c,0x1406); n++;
+    case 0x1406: AOT::op<0x7A>(c,0x1407); n++;
+    case 0x1407: AOT::op<0x17>(c,0x1408); n++;
+    case 0x1408: AOT::op<0x57>(c,0x1409); n++;
+    case 0x1409: AOT::op<0x79>(c,0x140A); n++;
+    case 0x140A: AOT::op<0x17>(c,0x140B); n++;
+    case 0x140B: AOT::op<0x4F>(c,0x140C); n++;
+    case 0x140C: AOT::op<0x29>(c,0x140D); n++;
+    case 0x140D: AOT::op<0x78>(c,0x140E); n++;
+    case 0x140E: AOT::op<0x17>(c,0x140F); n++;
+    case 0x140F: AOT::op<0x47>(c,0x1410); n++;
+    case 0x1410: AOT::op<0x3A>(c,0x1413,0x13EB); n++;
+    case 0x1413: AOT::op<0x17>(c,0x1414); n++;
+    case 0x1414: AOT::op<0x32>(c,0x1417,0x13EB); n++; if (x.stop) return n;
+    case 0x1417: AOT::op<0x79>(c,0x1418); n++;
+    case 0x1418: AOT::op<0xB2>(c,0x1419); n++;
+    case 0x1419: AOT::op<0xB3>(c,0x141A); n++;
+    case 0x141A: AOT::op<0xC2>(c,0x141D,0x13DC); n++; if (c.pc!=0x141D) { if (n<x.left) goto L13DC; return n; }
+    case 0x141D: AOT::op<0xE5>(c,0x141E); n++; if (x.stop) return n;
+    case 0x141E: AOT::op<0x21>(c,0x1421,0x0256); n++;
+    case 0x1421: AOT::op<0x35>(c,0x1422); n++; if (x.stop) return n;
+    case 0x1422: AOT::op<0xE1>(c,0x1423); n++;
+    case 0x1423: AOT::op<0xC2>(c,0x1426,0x13DC); n++; if (c.pc!=0x1426) { if (n<x.left) goto L13DC; return n; }
+    case 0x1426: AOT::op<0xC3>(c,0x1429,0x12C3); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1429(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1429: AOT::op<0x78>(c,0x142A); n++;
+    case 0x142A: AOT::op<0xB7>(c,0x142B); n++;
+    case 0x142B: AOT::op<0xCA>(c,0x142E,0x144B); n++; if (c.pc!=0x142E) return n;
+    case 0x142E: AOT::op<0x7D>(c,0x142F); n++;
+    case 0x142F: AOT::op<0x21>(c,0x1432,0x0256); n++;
+    case 0x1432: AOT::op<0xAE>(c,0x1433); n++;
+    case 0x1433: AOT::op<0x80>(c,0x1434); n++;
+    case 0x1434: AOT::op<0x47>(c,0x1435); n++;
+    case 0x1435: AOT::op<0x1F>(c,0x1436); n++;
+    case 0x1436: AOT::op<0xA8>(c,0x1437); n++;
+    case 0x1437: AOT::op<0x78>(c,0x1438); n++;
+    case 0x1438: AOT::op<0xF2>(c,0x143B,0x144A); n++; if (c.pc!=0x143B) return n;
+    case 0x143B: AOT::op<0xC6>(c,0x143D,0x80); n++;
+    case 0x143D: AOT::op<0x77>(c,0x143E); n++; if (x.stop) return n;
+    case 0x143E: AOT::op<0xCA>(c,0x1441,0x13A4); n++; if (c.pc!=0x1441) return n;
+    case 0x1441: AOT::op<0xCD>(c,0x1444,0x14C6); n++; return n;
+    case 0x1444: AOT::op<0x77>(c,0x1445); n++; if (x.stop) return n;
+    case 0x1445: AOT::op<0x2B>(c,0x1446); n++;
+    case 0x1446: AOT::op<0xC9>(c,0x1447); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1447(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1447: AOT::op<0xEF>(c,0x1448); n++; return n;
+    case 0x1448: AOT::op<0x2F>(c,0x1449); n++;
+    case 0x1449: AOT::op<0xE1>(c,0x144A); n++;
+    case 0x144A: AOT::op<0xB7>(c,0x144B); n++;
+    case 0x144B: AOT::op<0xE1>(c,0x144C); n++;
+    case 0x144C: AOT::op<0xF2>(c,0x144F,0x1287); n++; if (c.pc!=0x144F) return n;
+    case 0x144F: AOT::op<0xC3>(c,0x1452,0x12C3); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1452(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1452: AOT::op<0xCD>(c,0x1455,0x14AC); n++; return n;
+    case 0x1455: AOT::op<0x78>(c,0x1456); n++;
+    case 0x1456: AOT::op<0xB7>(c,0x1457); n++;
+    case 0x1457: AOT::op<0xC8>(c,0x1458); n++; if (c.pc!=0x1458) return n;
+    case 0x1458: AOT::op<0xC6>(c,0x145A,0x02); n++;
+    case 0x145A: AOT::op<0xDA>(c,0x145D,0x12C3); n++; if (c.pc!=0x145D) return n;
+    case 0x145D: AOT::op<0x47>(c,0x145E); n++;
+    case 0x145E: AOT::op<0xCD>(c,0x1461,0x1221); n++; return n;
+    case 0x1461: AOT::op<0x21>(c,0x1464,0x0256); n++;
+    case 0x1464: AOT::op<0x34>(c,0x1465); n++; if (x.stop) return n;
+    case 0x1465: AOT::op<0xC0>(c,0x1466); n++; if (c.pc!=0x1466) return n;
+    case 0x1466: AOT::op<0xC3>(c,0x1469,0x12C3); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1469(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1469: AOT::op<0x3A>(c,0x146C,0x0255); n++;
+    }
+  return n;
+}
+
+static unsigned b146D(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x146D: AOT::op<0x2F>(c,0x146E); n++;
+    case 0x146E: AOT::op<0x17>(c,0x146F); n++;
+    case 0x146F: AOT::op<0x9F>(c,0x1470); n++;
+    case 0x1470: AOT::op<0xC0>(c,0x1471); n++; if (c.pc!=0x1471) return n;
+    case 0x1471: AOT::op<0x3C>(c,0x1472); n++;
+    case 0x1472: AOT::op<0xC9>(c,0x1473); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1473(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1473: AOT::op<0xEF>(c,0x1474); n++; return n;
+    case 0x1474: AOT::op<0x06>(c,0x1476,0x88); n++;
+    case 0x1476: AOT::op<0x11>(c,0x1479,0x0000); n++;
+    case 0x1479: AOT::op<0x21>(c,0x147C,0x0256); n++;
+    case 0x147C: AOT::op<0x4F>(c,0x147D); n++;
+    case 0x147D: AOT::op<0x70>(c,0x147E); n++; if (x.stop) return n;
+    case 0x147E: AOT::op<0x06>(c,0x1480,0x00); n++;
+    case 0x1480: AOT::op<0x23>(c,0x1481); n++;
+    case 0x1481: AOT::op<0x36>(c,0x1483,0x80); n++; if (x.stop) return n;
+    case 0x1483: AOT::op<0x17>(c,0x1484); n++;
+    case 0x1484: AOT::op<0xC3>(c,0x1487,0x126F); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1487(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1487: AOT::op<0xEF>(c,0x1488); n++; return n;
+    case 0x1488: AOT::op<0xF0>(c,0x1489); n++; if (c.pc!=0x1489) return n;
+    case 0x1489: AOT::op<0x21>(c,0x148C,0x0255); n++;
+    case 0x148C: AOT::op<0x7E>(c,0x148D); n++;
+    case 0x148D: AOT::op<0xEE>(c,0x148F,0x80); n++;
+    case 0x148F: AOT::op<0x77>(c,0x1490); n++; if (x.stop) return n;
+    case 0x1490: AOT::op<0xC9>(c,0x1491); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1491(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1491: AOT::op<0xEB>(c,0x1492); n++;
+    case 0x1492: AOT::op<0x2A>(c,0x1495,0x0253); n++;
+    case 0x1495: AOT::op<0xE3>(c,0x1496); n++; if (x.stop) return n;
+    case 0x1496: AOT::op<0xE5>(c,0x1497); n++; if (x.stop) return n;
+    case 0x1497: AOT::op<0x2A>(c,0x149A,0x0255); n++;
+    case 0x149A: AOT::op<0xE3>(c,0x149B); n++; if (x.stop) return n;
+    case 0x149B: AOT::op<0xE5>(c,0x149C); n++; if (x.stop) return n;
+    case 0x149C: AOT::op<0xEB>(c,0x149D); n++;
+    case 0x149D: AOT::op<0xC9>(c,0x149E); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b149E(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x149E: AOT::op<0xCD>(c,0x14A1,0x14AF); n++; return n;
+    case 0x14A1: AOT::op<0xEB>(c,0x14A2); n++;
+    case 0x14A2: AOT::op<0x22>(c,0x14A5,0x0253); n++; if (x.stop) return n;
+    case 0x14A5: AOT::op<0x60>(c,0x14A6); n++;
+    case 0x14A6: AOT::op<0x69>(c,0x14A7); n++;
+    case 0x14A7: AOT::op<0x22>(c,0x14AA,0x0255); n++; if (x.stop) return n;
+    case 0x14AA: AOT::op<0xEB>(c,0x14AB); n++;
+    case 0x14AB: AOT::op<0xC9>(c,0x14AC); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b14AC(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x14AC: AOT::op<0x21>(c,0x14AF,0x0253); n++;
+    case 0x14AF: AOT::op<0x5E>(c,0x14B0); n++;
+    case 0x14B0: AOT::op<0x23>(c,0x14B1); n++;
+    case 0x14B1: AOT::op<0x56>(c,0x14B2); n++;
+    case 0x14B2: AOT::op<0x23>(c,0x14B3); n++;
+    case 0x14B3: AOT::op<0x4E>(c,0x14B4); n++;
+    case 0x14B4: AOT::op<0x23>(c,0x14B5); n++;
+    case 0x14B5: AOT::op<0x46>(c,0x14B6); n++;
+    case 0x14B6: AOT::op<0x23>(c,0x14B7); n++;
+    case 0x14B7: AOT::op<0xC9>(c,0x14B8); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b14B8(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x14B8: AOT::op<0x11>(c,0x14BB,0x0253); n++;
+    case 0x14BB: AOT::op<0x06>(c,0x14BD,0x04); n++;
+    case 0x14BD: L14BD: AOT::op<0x1A>(c,0x14BE); n++;
+    case 0x14BE: AOT::op<0x77>(c,0x14BF); n++; if (x.stop) return n;
+    case 0x14BF: AOT::op<0x13>(c,0x14C0); n++;
+    case 0x14C0: AOT::op<0x23>(c,0x14C1); n++;
+    case 0x14C1: AOT::op<0x05>(c,0x14C2); n++;
+    case 0x14C2: AOT::op<0xC2>(c,0x14C5,0x14BD); n++; if (c.pc!=0x14C5) { if (n<x.left) goto L14BD; return n; }
+    case 0x14C5: AOT::op<0xC9>(c,0x14C6); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b14C6(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x14C6: AOT::op<0x21>(c,0x14C9,0x0255); n++;
+    case 0x14C9: AOT::op<0x7E>(c,0x14CA); n++;
+    case 0x14CA: AOT::op<0x07>(c,0x14CB); n++;
+    case 0x14CB: AOT::op<0x37>(c,0x14CC); n++;
+    case 0x14CC: AOT::op<0x1F>(c,0x14CD); n++;
+    case 0x14CD: AOT::op<0x77>(c,0x14CE); n++; if (x.stop) return n;
+    case 0x14CE: AOT::op<0x3F>(c,0x14CF); n++;
+    case 0x14CF: AOT::op<0x1F>(c,0x14D0); n++;
+    case 0x14D0: AOT::op<0x23>(c,0x14D1); n++;
+    case 0x14D1: AOT::op<0x23>(c,0x14D2); n++;
+    case 0x14D2: AOT::op<0x77>(c,0x14D3); n++; if (x.stop) return n;
+    case 0x14D3: AOT::op<0x79>(c,0x14D4); n++;
+    case 0x14D4: AOT::op<0x07>(c,0x14D5); n++;
+    case 0x14D5: AOT::op<0x37>(c,0x14D6); n++;
+    case 0x14D6: AOT::op<0x1F>(c,0x14D7); n++;
+    case 0x14D7: AOT::op<0x4F>(c,0x14D8); n++;
+    case 0x14D8: AOT::op<0x1F>(c,0x14D9); n++;
+    case 0x14D9: AOT::op<0xAE>(c,0x14DA); n++;
+    case 0x14DA: AOT::op<0xC9>(c,0x14DB); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b14DB(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x14DB: AOT::op<0x78>(c,0x14DC); n++;
+    case 0x14DC: AOT::op<0xB7>(c,0x14DD); n++;
+    case 0x14DD: AOT::op<0xCA>(c,0x14E0,0x0028); n++; if (c.pc!=0x14E0) return n;
+    case 0x14E0: AOT::op<0x21>(c,0x14E3,0x146D); n++;
+    case 0x14E3: AOT::op<0xE5>(c,0x14E4); n++; if (x.stop) return n;
+    case 0x14E4: AOT::op<0xEF>(c,0x14E5); n++; return n;
+    case 0x14E5: AOT::op<0x79>(c,0x14E6); n++;
+    case 0x14E6: AOT::op<0xC8>(c,0x14E7); n++; if (c.pc!=0x14E7) return n;
+    case 0x14E7: AOT::op<0x21>(c,0x14EA,0x0255); n++;
+    case 0x14EA: AOT::op<0xAE>(c,0x14EB); n++;
+    case 0x14EB: AOT::op<0x79>(c,0x14EC); n++;
+    case 0x14EC: AOT::op<0xF8>(c,0x14ED); n++; if (c.pc!=0x14ED) return n;
+    case 0x14ED: AOT::op<0xCD>(c,0x14F0,0x14F3); n++; return n;
+    case 0x14F0: AOT::op<0x1F>(c,0x14F1); n++;
+    case 0x14F1: AOT::op<0xA9>(c,0x14F2); n++;
+    case 0x14F2: AOT::op<0xC9>(c,0x14F3); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b14F3(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x14F3: AOT::op<0x23>(c,0x14F4); n++;
+    case 0x14F4: AOT::op<0x78>(c,0x14F5); n++;
+    case 0x14F5: AOT::op<0xBE>(c,0x14F6); n++;
+    case 0x14F6: AOT::op<0xC0>(c,0x14F7); n++; if (c.pc!=0x14F7) return n;
+    case 0x14F7: AOT::op<0x2B>(c,0x14F8); n++;
+    case 0x14F8: AOT::op<0x79>(c,0x14F9); n++;
+    case 0x14F9: AOT::op<0xBE>(c,0x14FA); n++;
+    case 0x14FA: AOT::op<0xC0>(c,0x14FB); n++; if (c.pc!=0x14FB) return n;
+    case 0x14FB: AOT::op<0x2B>(c,0x14FC); n++;
+    case 0x14FC: AOT::op<0x7A>(c,0x14FD); n++;
+    case 0x14FD: AOT::op<0xBE>(c,0x14FE); n++;
+    case 0x14FE: AOT::op<0xC0>(c,0x14FF); n++; if (c.pc!=0x14FF) return n;
+    case 0x14FF: AOT::op<0x2B>(c,0x1500); n++;
+    case 0x1500: AOT::op<0x7B>(c,0x1501); n++;
+    case 0x1501: AOT::op<0x96>(c,0x1502); n++;
+    case 0x1502: AOT::op<0xC0>(c,0x1503); n++; if (c.pc!=0x1503) return n;
+    case 0x1503: AOT::op<0xE1>(c,0x1504); n++;
+    case 0x1504: AOT::op<0xE1>(c,0x1505); n++;
+    case 0x1505: AOT::op<0xC9>(c,0x1506); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1506(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1506: AOT::op<0x47>(c,0x1507); n++;
+    case 0x1507: AOT::op<0x4F>(c,0x1508); n++;
+    case 0x1508: AOT::op<0x57>(c,0x1509); n++;
+    case 0x1509: AOT::op<0x5F>(c,0x150A); n++;
+    case 0x150A: AOT::op<0xB7>(c,0x150B); n++;
+    case 0x150B: AOT::op<0xC8>(c,0x150C); n++; if (c.pc!=0x150C) return n;
+    case 0x150C: AOT::op<0xE5>(c,0x150D); n++; if (x.stop) return n;
+    case 0x150D: AOT::op<0xCD>(c,0x1510,0x14AC); n++; return n;
+    case 0x1510: AOT::op<0xCD>(c,0x1513,0x14C6); n++; return n;
+    case 0x1513: AOT::op<0xAE>(c,0x1514); n++;
+    case 0x1514: AOT::op<0x67>(c,0x1515); n++;
+    case 0x1515: AOT::op<0xFC>(c,0x1518,0x152A); n++; if (c.pc!=0x1518) return n; if (x.stop) return n;
+    case 0x1518: AOT::op<0x3E>(c,0x151A,0x98); n++;
+    case 0x151A: AOT::op<0x90>(c,0x151B); n++;
+    case 0x151B: AOT::op<0xCD>(c,0x151E,0x12E8); n++; return n;
+    case 0x151E: AOT::op<0x7C>(c,0x151F); n++;
+    case 0x151F: AOT::op<0x17>(c,0x1520); n++;
+    case 0x1520: AOT::op<0xDC>(c,0x1523,0x12B9); n++; if (c.pc!=0x1523) return n; if (x.stop) return n;
+    case 0x1523: AOT::op<0x06>(c,0x1525,0x00); n++;
+    case 0x1525: AOT::op<0xDC>(c,0x1528,0x12D4); n++; if (c.pc!=0x1528) return n; if (x.stop) return n;
+    case 0x1528: AOT::op<0xE1>(c,0x1529); n++;
+    case 0x1529: AOT::op<0xC9>(c,0x152A); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b152A(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x152A: AOT::op<0x1B>(c,0x152B); n++;
+    case 0x152B: AOT::op<0x7A>(c,0x152C); n++;
+    case 0x152C: AOT::op<0xA3>(c,0x152D); n++;
+    case 0x152D: AOT::op<0x3C>(c,0x152E); n++;
+    case 0x152E: AOT::op<0xC0>(c,0x152F); n++; if (c.pc!=0x152F) return n;
+    case 0x152F: AOT::op<0x0B>(c,0x1530); n++;
+    case 0x1530: AOT::op<0xC9>(c,0x1531); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1531(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1531: AOT::op<0x21>(c,0x1534,0x0256); n++;
+    case 0x1534: AOT::op<0x7E>(c,0x1535); n++;
+    case 0x1535: AOT::op<0xFE>(c,0x1537,0x98); n++;
+    case 0x1537: AOT::op<0x3A>(c,0x153A,0x0253); n++;
+    case 0x153A: AOT::op<0xD0>(c,0x153B); n++; if (c.pc!=0x153B) return n;
+    case 0x153B: AOT::op<0x7E>(c,0x153C); n++;
+    case 0x153C: AOT::op<0xCD>(c,0x153F,0x1506); n++; return n;
+    case 0x153F: AOT::op<0x36>(c,0x1541,0x98); n++; if (x.stop) return n;
+    case 0x1541: AOT::op<0x7B>(c,0x1542); n++;
+    case 0x1542: AOT::op<0xF5>(c,0x1543); n++; if (x.stop) return n;
+    case 0x1543: AOT::op<0x79>(c,0x1544); n++;
+    case 0x1544: AOT::op<0x17>(c,0x1545); n++;
+    case 0x1545: AOT::op<0xCD>(c,0x1548,0x126F); n++; return n;
+    case 0x1548: AOT::op<0xF1>(c,0x1549); n++;
+    case 0x1549: AOT::op<0xC9>(c,0x154A); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b154A(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x154A: AOT::op<0x21>(c,0x154D,0x0000); n++;
+    case 0x154D: AOT::op<0x78>(c,0x154E); n++;
+    case 0x154E: AOT::op<0xB1>(c,0x154F); n++;
+    case 0x154F: AOT::op<0xC8>(c,0x1550); n++; if (c.pc!=0x1550) return n;
+    case 0x1550: AOT::op<0x3E>(c,0x1552,0x10); n++;
+    case 0x1552: L1552: AOT::op<0x29>(c,0x1553); n++;
+    case 0x1553: AOT::op<0xDA>(c,0x1556,0x0D3C); n++; if (c.pc!=0x1556) return n;
+    case 0x1556: AOT::op<0xEB>(c,0x1557); n++;
+    case 0x1557: AOT::op<0x29>(c,0x1558); n++;
+    case 0x1558: AOT::op<0xEB>(c,0x1559); n++;
+    case 0x1559: AOT::op<0xD2>(c,0x155C,0x1560); n++; if (c.pc!=0x155C) { if (n<x.left) goto L1560; return n; }
+    case 0x155C: AOT::op<0x09>(c,0x155D); n++;
+    case 0x155D: AOT::op<0xDA>(c,0x1560,0x0D3C); n++; if (c.pc!=0x1560) return n;
+    case 0x1560: L1560: AOT::op<0x3D>(c,0x1561); n++;
+    case 0x1561: AOT::op<0xC2>(c,0x1564,0x1552); n++; if (c.pc!=0x1564) { if (n<x.left) goto L1552; return n; }
+    case 0x1564: AOT::op<0xC9>(c,0x1565); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1565(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1565: AOT::op<0xFE>(c,0x1567,0x2D); n++;
+    case 0x1567: AOT::op<0xF5>(c,0x1568); n++; if (x.stop) return n;
+    case 0x1568: AOT::op<0xCA>(c,0x156B,0x1571); n++; if (c.pc!=0x156B) { if (n<x.left) goto L1571; return n; }
+    case 0x156B: AOT::op<0xFE>(c,0x156D,0x2B); n++;
+    case 0x156D: AOT::op<0xCA>(c,0x1570,0x1571); n++; if (c.pc!=0x1570) { if (n<x.left) goto L1571; return n; }
+    case 0x1570: AOT::op<0x2B>(c,0x1571); n++;
+    case 0x1571: L1571: AOT::op<0xCD>(c,0x1574,0x1287); n++; return n;
+    case 0x1574: AOT::op<0x47>(c,0x1575); n++;
+    case 0x1575: AOT::op<0x57>(c,0x1576); n++;
+    case 0x1576: AOT::op<0x5F>(c,0x1577); n++;
+    case 0x1577: AOT::op<0x2F>(c,0x1578); n++;
+    case 0x1578: AOT::op<0x4F>(c,0x1579); n++;
+    case 0x1579: L1579: AOT::op<0xD7>(c,0x157A); n++; return n;
+    case 0x157A: AOT::op<0xDA>(c,0x157D,0x15CE); n++; if (c.pc!=0x157D) return n;
+    case 0x157D: AOT::op<0xFE>(c,0x157F,0x2E); n++;
+    case 0x157F: AOT::op<0xCA>(c,0x1582,0x15A9); n++; if (c.pc!=0x1582) { if (n<x.left) goto L15A9; return n; }
+    case 0x1582: AOT::op<0xFE>(c,0x1584,0x45); n++;
+    case 0x1584: AOT::op<0xC2>(c,0x1587,0x15AD); n++; if (c.pc!=0x1587) { if (n<x.left) goto L15AD; return n; }
+    case 0x1587: AOT::op<0xD7>(c,0x1588); n++; return n;
+    case 0x1588: AOT::op<0xE5>(c,0x1589); n++; if (x.stop) return n;
+    case 0x1589: AOT::op<0x21>(c,0x158C,0x159D); n++;
+    case 0x158C: AOT::op<0xE3>(c,0x158D); n++; if (x.stop) return n;
+    case 0x158D: AOT::op<0x15>(c,0x158E); n++;
+    case 0x158E: AOT::op<0xFE>(c,0x1590,0xA5); n++;
+    case 0x1590: AOT::op<0xC8>(c,0x1591); n++; if (c.pc!=0x1591) return n;
+    case 0x1591: AOT::op<0xFE>(c,0x1593,0x2D); n++;
+    case 0x1593: AOT::op<0xC8>(c,0x1594); n++; if (c.pc!=0x1594) return n;
+    case 0x1594: AOT::op<0x14>(c,0x1595); n++;
+    case 0x1595: AOT::op<0xFE>(c,0x1597,0x2B); n++;
+    case 0x1597: AOT::op<0xC8>(c,0x1598); n++; if (c.pc!=0x1598) return n;
+    case 0x1598: AOT::op<0xFE>(c,0x159A,0xA4); n++;
+    case 0x159A: AOT::op<0xC8>(c,0x159B); n++; if (c.pc!=0x159B) return n;
+    case 0x159B: AOT::op<0xF1>(c,0x159C); n++;
+    case 0x159C: AOT::op<0x2B>(c,0x159D); n++;
+    case 0x159D: AOT::op<0xD7>(c,0x159E); n++; return n;
+    case 0x159E: AOT::op<0xDA>(c,0x15A1,0x15F0); n++; if (c.pc!=0x15A1) return n;
+    case 0x15A1: AOT::op<0x14>(c,0x15A2); n++;
+    case 0x15A2: AOT::op<0xC2>(c,0x15A5,0x15AD); n++; if (c.pc!=0x15A5) { if (n<x.left) goto L15AD; return n; }
+    case 0x15A5: AOT::op<0xAF>(c,0x15A6); n++;
+    case 0x15A6: AOT::op<0x93>(c,0x15A7); n++;
+    case 0x15A7: AOT::op<0x5F>(c,0x15A8); n++;
+    case 0x15A8: AOT::op<0x0C>(c,0x15A9); n++;
+    case 0x15A9: L15A9: AOT::op<0x0C>(c,0x15AA); n++;
+    case 0x15AA: AOT::op<0xCA>(c,0x15AD,0x1579); n++; if (c.pc!=0x15AD) { if (n<x.left) goto L1579; return n; }
+    case 0x15AD: L15AD: AOT::op<0xE5>(c,0x15AE); n++; if (x.stop) return n;
+    case 0x15AE: AOT::op<0x7B>(c,0x15AF); n++;
+    case 0x15AF: AOT::op<0x90>(c,0x15B0); n++;
+    case 0x15B0: L15B0: AOT::op<0xF4>(c,0x15B3,0x15C6); n++; if (c.pc!=0x15B3) return n; if (x.stop) return n;
+    case 0x15B3: AOT::op<0xF2>(c,0x15B6,0x15BC); n++; if (c.pc!=0x15B6) { if (n<x.left) goto L15BC; return n; }
+    case 0x15B6: AOT::op<0xF5>(c,0x15B7); n++; if (x.stop) return n;
+    case 0x15B7: AOT::op<0xCD>(c,0x15BA,0x13AB); n++; return n;
+    case 0x15BA: AOT::op<0xF1>(c,0x15BB); n++;
+    case 0x15BB: AOT::op<0x3C>(c,0x15BC); n++;
+    case 0x15BC: L15BC: AOT::op<0xC2>(c,0x15BF,0x15B0); n++; if (c.pc!=0x15BF) { if (n<x.left) goto L15B0; return n; }
+    case 0x15BF: AOT::op<0xD1>(c,0x15C0); n++;
+    case 0x15C0: AOT::op<0xF1>(c,0x15C1); n++;
+    case 0x15C1: AOT::op<0xCC>(c,0x15C4,0x1489); n++; if (c.pc!=0x15C4) return n; if (x.stop) return n;
+    case 0x15C4: AOT::op<0xEB>(c,0x15C5); n++;
+    case 0x15C5: AOT::op<0xC9>(c,0x15C6); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b15C6(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x15C6: AOT::op<0xC8>(c,0x15C7); n++; if (c.pc!=0x15C7) return n;
+    case 0x15C7: AOT::op<0xF5>(c,0x15C8); n++; if (x.stop) return n;
+    case 0x15C8: AOT::op<0xCD>(c,0x15CB,0x1452); n++; return n;
+    case 0x15CB: AOT::op<0xF1>(c,0x15CC); n++;
+    case 0x15CC: AOT::op<0x3D>(c,0x15CD); n++;
+    case 0x15CD: AOT::op<0xC9>(c,0x15CE); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b15CE(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x15CE: AOT::op<0xD5>(c,0x15CF); n++; if (x.stop) return n;
+    case 0x15CF: AOT::op<0x57>(c,0x15D0); n++;
+    case 0x15D0: AOT::op<0x78>(c,0x15D1); n++;
+    case 0x15D1: AOT::op<0x89>(c,0x15D2); n++;
+    case 0x15D2: AOT::op<0x47>(c,0x15D3); n++;
+    case 0x15D3: AOT::op<0xC5>(c,0x15D4); n++; if (x.stop) return n;
+    case 0x15D4: AOT::op<0xE5>(c,0x15D5); n++; if (x.stop) return n;
+    case 0x15D5: AOT::op<0xD5>(c,0x15D6); n++; if (x.stop) return n;
+    case 0x15D6: AOT::op<0xCD>(c,0x15D9,0x1452); n++; return n;
+    case 0x15D9: AOT::op<0xF1>(c,0x15DA); n++;
+    case 0x15DA: AOT::op<0xD6>(c,0x15DC,0x30); n++;
+    case 0x15DC: AOT::op<0xCD>(c,0x15DF,0x15E5); n++; return n;
+    case 0x15DF: AOT::op<0xE1>(c,0x15E0); n++;
+    case 0x15E0: AOT::op<0xC1>(c,0x15E1); n++;
+    case 0x15E1: AOT::op<0xD1>(c,0x15E2); n++;
+    case 0x15E2: AOT::op<0xC3>(c,0x15E5,0x1579); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b15E5(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x15E5: AOT::op<0xCD>(c,0x15E8,0x1491); n++; return n;
+    case 0x15E8: AOT::op<0xCD>(c,0x15EB,0x1474); n++; return n;
+    case 0x15EB: AOT::op<0xC1>(c,0x15EC); n++;
+    case 0x15EC: AOT::op<0xD1>(c,0x15ED); n++;
+    case 0x15ED: AOT::op<0xC3>(c,0x15F0,0x1221); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b15F0(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x15F0: AOT::op<0x7B>(c,0x15F1); n++;
+    case 0x15F1: AOT::op<0x07>(c,0x15F2); n++;
+    case 0x15F2: AOT::op<0x07>(c,0x15F3); n++;
+    case 0x15F3: AOT::op<0x83>(c,0x15F4); n++;
+    case 0x15F4: AOT::op<0x07>(c,0x15F5); n++;
+    case 0x15F5: AOT::op<0x86>(c,0x15F6); n++;
+    case 0x15F6: AOT::op<0xD6>(c,0x15F8,0x30); n++;
+    case 0x15F8: AOT::op<0x5F>(c,0x15F9); n++;
+    case 0x15F9: AOT::op<0xC3>(c,0x15FC,0x159D); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b15FC(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x15FC: AOT::op<0xE5>(c,0x15FD); n++; if (x.stop) return n;
+    case 0x15FD: AOT::op<0x21>(c,0x1600,0x026C); n++;
+    case 0x1600: AOT::op<0xCD>(c,0x1603,0x0EE3); n++; return n;
+    case 0x1603: AOT::op<0xE1>(c,0x1604); n++;
+    case 0x1604: AOT::op<0xEB>(c,0x1605); n++;
+    case 0x1605: AOT::op<0xAF>(c,0x1606); n++;
+    case 0x1606: AOT::op<0x06>(c,0x1608,0x98); n++;
+    case 0x1608: AOT::op<0xCD>(c,0x160B,0x1479); n++; return n;
+    case 0x160B: AOT::op<0x21>(c,0x160E,0x0EE2); n++;
+    case 0x160E: AOT::op<0xE5>(c,0x160F); n++; if (x.stop) return n;
+    case 0x160F: AOT::op<0x21>(c,0x1612,0x0258); n++;
+    case 0x1612: AOT::op<0xE5>(c,0x1613); n++; if (x.stop) return n;
+    case 0x1613: AOT::op<0xEF>(c,0x1614); n++; return n;
+    case 0x1614: AOT::op<0x36>(c,0x1616,0x20); n++; if (x.stop) return n;
+    case 0x1616: AOT::op<0xF2>(c,0x1619,0x161B); n++; if (c.pc!=0x1619) { if (n<x.left) goto L161B; return n; }
+    case 0x1619: AOT::op<0x36>(c,0x161B,0x2D); n++; if (x.stop) return n;
+    case 0x161B: L161B: AOT::op<0x23>(c,0x161C); n++;
+    case 0x161C: AOT::op<0x36>(c,0x161E,0x30); n++; if (x.stop) return n;
+    case 0x161E: AOT::op<0xCA>(c,0x1621,0x16D0); n++; if (c.pc!=0x1621) return n;
+    case 0x1621: AOT::op<0xE5>(c,0x1622); n++; if (x.stop) return n;
+    case 0x1622: AOT::op<0xFC>(c,0x1625,0x1489); n++; if (c.pc!=0x1625) return n; if (x.stop) return n;
+    case 0x1625: AOT::op<0xAF>(c,0x1626); n++;
+    case 0x1626: AOT::op<0xF5>(c,0x1627); n++; if (x.stop) return n;
+    case 0x1627: AOT::op<0xCD>(c,0x162A,0x16D6); n++; return n;
+    case 0x162A: L162A: AOT::op<0x01>(c,0x162D,0x9143); n++;
+    case 0x162D: AOT::op<0x11>(c,0x1630,0x4FF8); n++;
+    case 0x1630: AOT::op<0xCD>(c,0x1633,0x14DB); n++; return n;
+    case 0x1633: AOT::op<0xE2>(c,0x1636,0x1647); n++; if (c.pc!=0x1636) return n;
+    case 0x1636: AOT::op<0xF1>(c,0x1637); n++;
+    case 0x1637: AOT::op<0xCD>(c,0x163A,0x15C7); n++; return n;
+    case 0x163A: AOT::op<0xF5>(c,0x163B); n++; if (x.stop) return n;
+    case 0x163B: AOT::op<0xC3>(c,0x163E,0x162A); n++; { if (n<x.left) goto L162A; return n; }
+    }
+  return n;
+}
+
+static unsigned b163E(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x163E: AOT::op<0xCD>(c,0x1641,0x13AB); n++; return n;
+    case 0x1641: AOT::op<0xF1>(c,0x1642); n++;
+    case 0x1642: AOT::op<0x3C>(c,0x1643); n++;
+    case 0x1643: AOT::op<0xF5>(c,0x1644); n++; if (x.stop) return n;
+    case 0x1644: AOT::op<0xCD>(c,0x1647,0x16D6); n++; return n;
+    case 0x1647: AOT::op<0xCD>(c,0x164A,0x120F); n++; return n;
+    case 0x164A: AOT::op<0x3C>(c,0x164B); n++;
+    case 0x164B: AOT::op<0xCD>(c,0x164E,0x1506); n++; return n;
+    case 0x164E: AOT::op<0xCD>(c,0x1651,0x14A1); n++; return n;
+    case 0x1651: AOT::op<0x01>(c,0x1654,0x0306); n++;
+    case 0x1654: AOT::op<0xF1>(c,0x1655); n++;
+    case 0x1655: AOT::op<0x81>(c,0x1656); n++;
+    case 0x1656: AOT::op<0x3C>(c,0x1657); n++;
+    case 0x1657: AOT::op<0xFA>(c,0x165A,0x1663); n++; if (c.pc!=0x165A) { if (n<x.left) goto L1663; return n; }
+    case 0x165A: AOT::op<0xFE>(c,0x165C,0x08); n++;
+    case 0x165C: AOT::op<0xD2>(c,0x165F,0x1663); n++; if (c.pc!=0x165F) { if (n<x.left) goto L1663; return n; }
+    case 0x165F: AOT::op<0x3C>(c,0x1660); n++;
+    case 0x1660: AOT::op<0x47>(c,0x1661); n++;
+    case 0x1661: AOT::op<0x3E>(c,0x1663,0x02); n++;
+    case 0x1663: L1663: AOT::op<0x3D>(c,0x1664); n++;
+    case 0x1664: AOT::op<0x3D>(c,0x1665); n++;
+    case 0x1665: AOT::op<0xE1>(c,0x1666); n++;
+    case 0x1666: AOT::op<0xF5>(c,0x1667); n++; if (x.stop) return n;
+    case 0x1667: AOT::op<0x11>(c,0x166A,0x16E8); n++;
+    case 0x166A: AOT::op<0x05>(c,0x166B); n++;
+    case 0x166B: AOT::op<0xC2>(c,0x166E,0x1674); n++; if (c.pc!=0x166E) { if (n<x.left) goto L1674; return n; }
+    case 0x166E: AOT::op<0x36>(c,0x1670,0x2E); n++; if (x.stop) return n;
+    case 0x1670: AOT::op<0x23>(c,0x1671); n++;
+    case 0x1671: AOT::op<0x36>(c,0x1673,0x30); n++; if (x.stop) return n;
+    case 0x1673: AOT::op<0x23>(c,0x1674); n++;
+    case 0x1674: L1674: AOT::op<0x05>(c,0x1675); n++;
+    case 0x1675: AOT::op<0x36>(c,0x1677,0x2E); n++; if (x.stop) return n;
+    case 0x1677: AOT::op<0xCC>(c,0x167A,0x14B6); n++; if (c.pc!=0x167A) return n; if (x.stop) return n;
+    case 0x167A: AOT::op<0xC5>(c,0x167B); n++; if (x.stop) return n;
+    case 0x167B: AOT::op<0xE5>(c,0x167C); n++; if (x.stop) return n;
+    case 0x167C: AOT::op<0xD5>(c,0x167D); n++; if (x.stop) return n;
+    case 0x167D: AOT::op<0xCD>(c,0x1680,0x14AC); n++; return n;
+    case 0x1680: AOT::op<0xE1>(c,0x1681); n++;
+    case 0x1681: AOT::op<0x06>(c,0x1683,0x2F); n++;
+    case 0x1683: L1683: AOT::op<0x04>(c,0x1684); n++;
+    case 0x1684: AOT::op<0x7B>(c,0x1685); n++;
+    case 0x1685: AOT::op<0x96>(c,0x1686); n++;
+    case 0x1686: AOT::op<0x5F>(c,0x1687); n++;
+    case 0x1687: AOT::op<0x23>(c,0x1688); n++;
+    case 0x1688: AOT::op<0x7A>(c,0x1689); n++;
+    case 0x1689: AOT::op<0x9E>(c,0x168A); n++;
+    case 0x168A: AOT::op<0x57>(c,0x168B); n++;
+    case 0x168B: AOT::op<0x23>(c,0x168C); n++;
+    case 0x168C: AOT::op<0x79>(c,0x168D); n++;
+    case 0x168D: AOT::op<0x9E>(c,0x168E); n++;
+    case 0x168E: AOT::op<0x4F>(c,0x168F); n++;
+    case 0x168F: AOT::op<0x2B>(c,0x1690); n++;
+    case 0x1690: AOT::op<0x2B>(c,0x1691); n++;
+    case 0x1691: AOT::op<0xD2>(c,0x1694,0x1683); n++; if (c.pc!=0x1694) { if (n<x.left) goto L1683; return n; }
+    case 0x1694: AOT::op<0xCD>(c,0x1697,0x12C8); n++; return n;
+    case 0x1697: AOT::op<0x23>(c,0x1698); n++;
+    case 0x1698: AOT::op<0xCD>(c,0x169B,0x14A1); n++; return n;
+    case 0x169B: AOT::op<0xEB>(c,0x169C); n++;
+    case 0x169C: AOT::op<0xE1>(c,0x169D); n++;
+    case 0x169D: AOT::op<0x70>(c,0x169E); n++; if (x.stop) return n;
+    case 0x169E: AOT::op<0x23>(c,0x169F); n++;
+    case 0x169F: AOT::op<0xC1>(c,0x16A0); n++;
+    case 0x16A0: AOT::op<0x0D>(c,0x16A1); n++;
+    case 0x16A1: AOT::op<0xC2>(c,0x16A4,0x1674); n++; if (c.pc!=0x16A4) { if (n<x.left) goto L1674; return n; }
+    case 0x16A4: AOT::op<0x05>(c,0x16A5); n++;
+    case 0x16A5: AOT::op<0xCA>(c,0x16A8,0x16B4); n++; if (c.pc!=0x16A8) { if (n<x.left) goto L16B4; return n; }
+    case 0x16A8: L16A8: AOT::op<0x2B>(c,0x16A9); n++;
+    case 0x16A9: AOT::op<0x7E>(c,0x16AA); n++;
+    case 0x16AA: AOT::op<0xFE>(c,0x16AC,0x30); n++;
+    case 0x16AC: AOT::op<0xCA>(c,0x16AF,0x16A8); n++; if (c.pc!=0x16AF) { if (n<x.left) goto L16A8; return n; }
+    case 0x16AF: AOT::op<0xFE>(c,0x16B1,0x2E); n++;
+    case 0x16B1: AOT::op<0xC4>(c,0x16B4,0x14B6); n++; if (c.pc!=0x16B4) return n; if (x.stop) return n;
+    case 0x16B4: L16B4: AOT::op<0xF1>(c,0x16B5); n++;
+    case 0x16B5: AOT::op<0xCA>(c,0x16B8,0x16D3); n++; if (c.pc!=0x16B8) { if (n<x.left) goto L16D3; return n; }
+    case 0x16B8: AOT::op<0x36>(c,0x16BA,0x45); n++; if (x.stop) return n;
+    case 0x16BA: AOT::op<0x23>(c,0x16BB); n++;
+    case 0x16BB: AOT::op<0x36>(c,0x16BD,0x2B); n++; if (x.stop) return n;
+    case 0x16BD: AOT::op<0xF2>(c,0x16C0,0x16C4); n++; if (c.pc!=0x16C0) { if (n<x.left) goto L16C4; return n; }
+    case 0x16C0: AOT::op<0x36>(c,0x16C2,0x2D); n++; if (x.stop) return n;
+    case 0x16C2: AOT::op<0x2F>(c,0x16C3); n++;
+    case 0x16C3: AOT::op<0x3C>(c,0x16C4); n++;
+    case 0x16C4: L16C4: AOT::op<0x06>(c,0x16C6,0x2F); n++;
+    case 0x16C6: L16C6: AOT::op<0x04>(c,0x16C7); n++;
+    case 0x16C7: AOT::op<0xD6>(c,0x16C9,0x0A); n++;
+    case 0x16C9: AOT::op<0xD2>(c,0x16CC,0x16C6); n++; if (c.pc!=0x16CC) { if (n<x.left) goto L16C6; return n; }
+    case 0x16CC: AOT::op<0xC6>(c,0x16CE,0x3A); n++;
+    case 0x16CE: AOT::op<0x23>(c,0x16CF); n++;
+    case 0x16CF: AOT::op<0x70>(c,0x16D0); n++; if (x.stop) return n;
+    case 0x16D0: AOT::op<0x23>(c,0x16D1); n++;
+    case 0x16D1: AOT::op<0x77>(c,0x16D2); n++; if (x.stop) return n;
+    case 0x16D2: AOT::op<0x23>(c,0x16D3); n++;
+    case 0x16D3: L16D3: AOT::op<0x71>(c,0x16D4); n++; if (x.stop) return n;
+    case 0x16D4: AOT::op<0xE1>(c,0x16D5); n++;
+    case 0x16D5: AOT::op<0xC9>(c,0x16D6); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b16D6(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x16D6: AOT::op<0x01>(c,0x16D9,0x9474); n++;
+    case 0x16D9: AOT::op<0x11>(c,0x16DC,0x23F7); n++;
+    case 0x16DC: AOT::op<0xCD>(c,0x16DF,0x14DB); n++; return n;
+    case 0x16DF: AOT::op<0xE1>(c,0x16E0); n++;
+    case 0x16E0: AOT::op<0xE2>(c,0x16E3,0x163E); n++; if (c.pc!=0x16E3) return n;
+    case 0x16E3: AOT::op<0xE9>(c,0x16E4); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b16FA(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x16FA: AOT::op<0x21>(c,0x16FD,0x1489); n++;
+    case 0x16FD: AOT::op<0xE3>(c,0x16FE); n++; if (x.stop) return n;
+    case 0x16FE: AOT::op<0xE9>(c,0x16FF); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b16FF(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x16FF: AOT::op<0xCD>(c,0x1702,0x1491); n++; return n;
+    case 0x1702: AOT::op<0x21>(c,0x1705,0x16E4); n++;
+    case 0x1705: AOT::op<0xCD>(c,0x1708,0x149E); n++; return n;
+    case 0x1708: AOT::op<0xC1>(c,0x1709); n++;
+    case 0x1709: AOT::op<0xD1>(c,0x170A); n++;
+    case 0x170A: AOT::op<0xEF>(c,0x170B); n++; return n;
+    case 0x170B: AOT::op<0x78>(c,0x170C); n++;
+    case 0x170C: AOT::op<0xCA>(c,0x170F,0x174B); n++; if (c.pc!=0x170F) { if (n<x.left) goto L174B; return n; }
+    case 0x170F: AOT::op<0xF2>(c,0x1712,0x1716); n++; if (c.pc!=0x1712) { if (n<x.left) goto L1716; return n; }
+    case 0x1712: AOT::op<0xB7>(c,0x1713); n++;
+    case 0x1713: AOT::op<0xCA>(c,0x1716,0x02C9); n++; if (c.pc!=0x1716) return n;
+    case 0x1716: L1716: AOT::op<0xB7>(c,0x1717); n++;
+    case 0x1717: AOT::op<0xCA>(c,0x171A,0x1288); n++; if (c.pc!=0x171A) return n;
+    case 0x171A: AOT::op<0xD5>(c,0x171B); n++; if (x.stop) return n;
+    case 0x171B: AOT::op<0xC5>(c,0x171C); n++; if (x.stop) return n;
+    case 0x171C: AOT::op<0x79>(c,0x171D); n++;
+    case 0x171D: AOT::op<0xF6>(c,0x171F,0x7F); n++;
+    case 0x171F: AOT::op<0xCD>(c,0x1722,0x14AC); n++; return n;
+    case 0x1722: AOT::op<0xF2>(c,0x1725,0x1733); n++; if (c.pc!=0x1725) { if (n<x.left) goto L1733; return n; }
+    case 0x1725: AOT::op<0xD5>(c,0x1726); n++; if (x.stop) return n;
+    case 0x1726: AOT::op<0xC5>(c,0x1727); n++; if (x.stop) return n;
+    case 0x1727: AOT::op<0xCD>(c,0x172A,0x1531); n++; return n;
+    case 0x172A: AOT::op<0xC1>(c,0x172B); n++;
+    case 0x172B: AOT::op<0xD1>(c,0x172C); n++;
+    case 0x172C: AOT::op<0xF5>(c,0x172D); n++; if (x.stop) return n;
+    case 0x172D: AOT::op<0xCD>(c,0x1730,0x14DB); n++; return n;
+    case 0x1730: AOT::op<0xE1>(c,0x1731); n++;
+    case 0x1731: AOT::op<0x7C>(c,0x1732); n++;
+    case 0x1732: AOT::op<0x1F>(c,0x1733); n++;
+    case 0x1733: L1733: AOT::op<0xE1>(c,0x1734); n++;
+    case 0x1734: AOT::op<0x22>(c,0x1737,0x0255); n++; if (x.stop) return n;
+    case 0x1737: AOT::op<0xE1>(c,0x1738); n++;
+    case 0x1738: AOT::op<0x22>(c,0x173B,0x0253); n++; if (x.stop) return n;
+    case 0x173B: AOT::op<0xDC>(c,0x173E,0x16FA); n++; if (c.pc!=0x173E) return n; if (x.stop) return n;
+    case 0x173E: AOT::op<0xCC>(c,0x1741,0x1489); n++; if (c.pc!=0x1741) return n; if (x.stop) return n;
+    case 0x1741: AOT::op<0xD5>(c,0x1742); n++; if (x.stop) return n;
+    case 0x1742: AOT::op<0xC5>(c,0x1743); n++; if (x.stop) return n;
+    case 0x1743: AOT::op<0xCD>(c,0x1746,0x131D); n++; return n;
+    case 0x1746: AOT::op<0xC1>(c,0x1747); n++;
+    case 0x1747: AOT::op<0xD1>(c,0x1748); n++;
+    case 0x1748: AOT::op<0xCD>(c,0x174B,0x135B); n++; return n;
+    case 0x174B: L174B: AOT::op<0xCD>(c,0x174E,0x1491); n++; return n;
+    case 0x174E: AOT::op<0x01>(c,0x1751,0x8138); n++;
+    case 0x1751: AOT::op<0x11>(c,0x1754,0xAA3B); n++;
+    case 0x1754: AOT::op<0xCD>(c,0x1757,0x135B); n++; return n;
+    case 0x1757: AOT::op<0x3A>(c,0x175A,0x0256); n++;
+    case 0x175A: AOT::op<0xFE>(c,0x175C,0x88); n++;
+    case 0x175C: AOT::op<0xD2>(c,0x175F,0x1447); n++; if (c.pc!=0x175F) return n;
+    case 0x175F: AOT::op<0xCD>(c,0x1762,0x1531); n++; return n;
+    case 0x1762: AOT::op<0xC6>(c,0x1764,0x80); n++;
+    case 0x1764: AOT::op<0xC6>(c,0x1766,0x02); n++;
+    case 0x1766: AOT::op<0xDA>(c,0x1769,0x1447); n++; if (c.pc!=0x1769) return n;
+    case 0x1769: AOT::op<0xF5>(c,0x176A); n++; if (x.stop) return n;
+    case 0x176A: AOT::op<0x21>(c,0x176D,0x130C); n++;
+    case 0x176D: AOT::op<0xCD>(c,0x1770,0x1212); n++; return n;
+    case 0x1770: AOT::op<0xCD>(c,0x1773,0x1352); n++; return n;
+    case 0x1773: AOT::op<0xF1>(c,0x1774); n++;
+    case 0x1774: AOT::op<0xC1>(c,0x1775); n++;
+    case 0x1775: AOT::op<0xD1>(c,0x1776); n++;
+    case 0x1776: AOT::op<0xF5>(c,0x1777); n++; if (x.stop) return n;
+    case 0x1777: AOT::op<0xCD>(c,0x177A,0x121E); n++; return n;
+    case 0x177A: AOT::op<0xCD>(c,0x177D,0x1489); n++; return n;
+    case 0x177D: AOT::op<0x21>(c,0x1780,0x178B); n++;
+    case 0x1780: AOT::op<0xCD>(c,0x1783,0x17BB); n++; return n;
+    case 0x1783: AOT::op<0x11>(c,0x1786,0x0000); n++;
+    case 0x1786: AOT::op<0xC1>(c,0x1787); n++;
+    case 0x1787: AOT::op<0x4A>(c,0x1788); n++;
+    case 0x1788: AOT::op<0xC3>(c,0x178B,0x135B); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b17AC(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x17AC: AOT::op<0xCD>(c,0x17AF,0x1491); n++; return n;
+    case 0x17AF: AOT::op<0x11>(c,0x17B2,0x1359); n++;
+    case 0x17B2: AOT::op<0xD5>(c,0x17B3); n++; if (x.stop) return n;
+    case 0x17B3: AOT::op<0xE5>(c,0x17B4); n++; if (x.stop) return n;
+    case 0x17B4: AOT::op<0xCD>(c,0x17B7,0x14AC); n++; return n;
+    case 0x17B7: AOT::op<0xCD>(c,0x17BA,0x135B); n++; return n;
+    case 0x17BA: AOT::op<0xE1>(c,0x17BB); n++;
+    case 0x17BB: AOT::op<0xCD>(c,0x17BE,0x1491); n++; return n;
+    case 0x17BE: AOT::op<0x7E>(c,0x17BF); n++;
+    case 0x17BF: AOT::op<0x23>(c,0x17C0); n++;
+    case 0x17C0: AOT::op<0xCD>(c,0x17C3,0x149E); n++; return n;
+    case 0x17C3: AOT::op<0x06>(c,0x17C5,0xF1); n++;
+    case 0x17C5: AOT::op<0xC1>(c,0x17C6); n++;
+    case 0x17C6: AOT::op<0xD1>(c,0x17C7); n++;
+    case 0x17C7: AOT::op<0x3D>(c,0x17C8); n++;
+    case 0x17C8: AOT::op<0xC8>(c,0x17C9); n++; if (c.pc!=0x17C9) return n;
+    case 0x17C9: AOT::op<0xD5>(c,0x17CA); n++; if (x.stop) return n;
+    case 0x17CA: AOT::op<0xC5>(c,0x17CB); n++; if (x.stop) return n;
+    case 0x17CB: AOT::op<0xF5>(c,0x17CC); n++; if (x.stop) return n;
+    case 0x17CC: AOT::op<0xE5>(c,0x17CD); n++; if (x.stop) return n;
+    case 0x17CD: AOT::op<0xCD>(c,0x17D0,0x135B); n++; return n;
+    case 0x17D0: AOT::op<0xE1>(c,0x17D1); n++;
+    case 0x17D1: AOT::op<0xCD>(c,0x17D4,0x14AF); n++; return n;
+    case 0x17D4: AOT::op<0xE5>(c,0x17D5); n++; if (x.stop) return n;
+    case 0x17D5: AOT::op<0xCD>(c,0x17D8,0x1221); n++; return n;
+    case 0x17D8: AOT::op<0xE1>(c,0x17D9); n++;
+    case 0x17D9: AOT::op<0xC3>(c,0x17DC,0x17C4); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b17DC(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x17DC: AOT::op<0xEF>(c,0x17DD); n++; return n;
+    case 0x17DD: AOT::op<0x21>(c,0x17E0,0x1845); n++;
+    case 0x17E0: AOT::op<0xFA>(c,0x17E3,0x183B); n++; if (c.pc!=0x17E3) return n;
+    case 0x17E3: AOT::op<0x21>(c,0x17E6,0x1866); n++;
+    case 0x17E6: AOT::op<0xCD>(c,0x17E9,0x149E); n++; return n;
+    case 0x17E9: AOT::op<0x21>(c,0x17EC,0x1845); n++;
+    case 0x17EC: AOT::op<0xC8>(c,0x17ED); n++; if (c.pc!=0x17ED) return n;
+    case 0x17ED: AOT::op<0x86>(c,0x17EE); n++;
+    case 0x17EE: AOT::op<0xE6>(c,0x17F0,0x07); n++;
+    case 0x17F0: AOT::op<0x06>(c,0x17F2,0x00); n++;
+    case 0x17F2: AOT::op<0x77>(c,0x17F3); n++; if (x.stop) return n;
+    case 0x17F3: AOT::op<0x23>(c,0x17F4); n++;
+    case 0x17F4: AOT::op<0x87>(c,0x17F5); n++;
+    case 0x17F5: AOT::op<0x87>(c,0x17F6); n++;
+    case 0x17F6: AOT::op<0x4F>(c,0x17F7); n++;
+    case 0x17F7: AOT::op<0x09>(c,0x17F8); n++;
+    case 0x17F8: AOT::op<0xCD>(c,0x17FB,0x14AF); n++; return n;
+    case 0x17FB: AOT::op<0xCD>(c,0x17FE,0x135B); n++; return n;
+    case 0x17FE: AOT::op<0x3A>(c,0x1801,0x1844); n++;
+    case 0x1801: AOT::op<0x3C>(c,0x1802); n++;
+    case 0x1802: AOT::op<0xE6>(c,0x1804,0x03); n++;
+    case 0x1804: AOT::op<0x06>(c,0x1806,0x00); n++;
+    case 0x1806: AOT::op<0xFE>(c,0x1808,0x01); n++;
+    case 0x1808: AOT::op<0x88>(c,0x1809); n++;
+    case 0x1809: AOT::op<0x32>(c,0x180C,0x1844); n++; if (x.stop) return n;
+    case 0x180C: AOT::op<0x21>(c,0x180F,0x1866); n++;
+    case 0x180F: AOT::op<0x87>(c,0x1810); n++;
+    case 0x1810: AOT::op<0x87>(c,0x1811); n++;
+    case 0x1811: AOT::op<0x4F>(c,0x1812); n++;
+    case 0x1812: AOT::op<0x09>(c,0x1813); n++;
+    case 0x1813: AOT::op<0xCD>(c,0x1816,0x1212); n++; return n;
+    case 0x1816: AOT::op<0xCD>(c,0x1819,0x14AC); n++; return n;
+    case 0x1819: AOT::op<0x7B>(c,0x181A); n++;
+    case 0x181A: AOT::op<0x59>(c,0x181B); n++;
+    case 0x181B: AOT::op<0xEE>(c,0x181D,0x4F); n++;
+    case 0x181D: AOT::op<0x4F>(c,0x181E); n++;
+    case 0x181E: AOT::op<0x36>(c,0x1820,0x80); n++; if (x.stop) return n;
+    case 0x1820: AOT::op<0x2B>(c,0x1821); n++;
+    case 0x1821: AOT::op<0x46>(c,0x1822); n++;
+    case 0x1822: AOT::op<0x36>(c,0x1824,0x80); n++; if (x.stop) return n;
+    case 0x1824: AOT::op<0x21>(c,0x1827,0x1843); n++;
+    case 0x1827: AOT::op<0x34>(c,0x1828); n++; if (x.stop) return n;
+    case 0x1828: AOT::op<0x7E>(c,0x1829); n++;
+    case 0x1829: AOT::op<0xD6>(c,0x182B,0xAB); n++;
+    case 0x182B: AOT::op<0xC2>(c,0x182E,0x1832); n++; if (c.pc!=0x182E) { if (n<x.left) goto L1832; return n; }
+    case 0x182E: AOT::op<0x77>(c,0x182F); n++; if (x.stop) return n;
+    case 0x182F: AOT::op<0x0C>(c,0x1830); n++;
+    case 0x1830: AOT::op<0x15>(c,0x1831); n++;
+    case 0x1831: AOT::op<0x1C>(c,0x1832); n++;
+    case 0x1832: L1832: AOT::op<0xCD>(c,0x1835,0x1272); n++; return n;
+    case 0x1835: AOT::op<0x21>(c,0x1838,0x1866); n++;
+    case 0x1838: AOT::op<0xC3>(c,0x183B,0x14B8); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b183B(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x183B: AOT::op<0x77>(c,0x183C); n++; if (x.stop) return n;
+    case 0x183C: AOT::op<0x2B>(c,0x183D); n++;
+    case 0x183D: AOT::op<0x77>(c,0x183E); n++; if (x.stop) return n;
+    case 0x183E: AOT::op<0x2B>(c,0x183F); n++;
+    case 0x183F: AOT::op<0x77>(c,0x1840); n++; if (x.stop) return n;
+    case 0x1840: AOT::op<0xC3>(c,0x1843,0x1816); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1876(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1876: AOT::op<0x21>(c,0x1879,0x18BC); n++;
+    case 0x1879: AOT::op<0xCD>(c,0x187C,0x1212); n++; return n;
+    case 0x187C: AOT::op<0xCD>(c,0x187F,0x1491); n++; return n;
+    case 0x187F: AOT::op<0x01>(c,0x1882,0x8349); n++;
+    case 0x1882: AOT::op<0x11>(c,0x1885,0x0FDB); n++;
+    case 0x1885: AOT::op<0xCD>(c,0x1888,0x14A1); n++; return n;
+    case 0x1888: AOT::op<0xC1>(c,0x1889); n++;
+    case 0x1889: AOT::op<0xD1>(c,0x188A); n++;
+    case 0x188A: AOT::op<0xCD>(c,0x188D,0x13B9); n++; return n;
+    case 0x188D: AOT::op<0xCD>(c,0x1890,0x1491); n++; return n;
+    case 0x1890: AOT::op<0xCD>(c,0x1893,0x1531); n++; return n;
+    case 0x1893: AOT::op<0xC1>(c,0x1894); n++;
+    case 0x1894: AOT::op<0xD1>(c,0x1895); n++;
+    case 0x1895: AOT::op<0xCD>(c,0x1898,0x121E); n++; return n;
+    case 0x1898: AOT::op<0x21>(c,0x189B,0x18C0); n++;
+    case 0x189B: AOT::op<0xCD>(c,0x189E,0x1218); n++; return n;
+    case 0x189E: AOT::op<0xEF>(c,0x189F); n++; return n;
+    case 0x189F: AOT::op<0x37>(c,0x18A0); n++;
+    case 0x18A0: AOT::op<0xF2>(c,0x18A3,0x18A8); n++; if (c.pc!=0x18A3) { if (n<x.left) goto L18A8; return n; }
+    case 0x18A3: AOT::op<0xCD>(c,0x18A6,0x120F); n++; return n;
+    case 0x18A6: AOT::op<0xEF>(c,0x18A7); n++; return n;
+    case 0x18A7: AOT::op<0xB7>(c,0x18A8); n++;
+    case 0x18A8: L18A8: AOT::op<0xF5>(c,0x18A9); n++; if (x.stop) return n;
+    case 0x18A9: AOT::op<0xF4>(c,0x18AC,0x1489); n++; if (c.pc!=0x18AC) return n; if (x.stop) return n;
+    case 0x18AC: AOT::op<0x21>(c,0x18AF,0x18C0); n++;
+    case 0x18AF: AOT::op<0xCD>(c,0x18B2,0x1212); n++; return n;
+    case 0x18B2: AOT::op<0xF1>(c,0x18B3); n++;
+    case 0x18B3: AOT::op<0xD4>(c,0x18B6,0x1489); n++; if (c.pc!=0x18B6) return n; if (x.stop) return n;
+    case 0x18B6: AOT::op<0x21>(c,0x18B9,0x18C4); n++;
+    case 0x18B9: AOT::op<0xC3>(c,0x18BC,0x17AC); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b18D9(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x18D9: AOT::op<0xCD>(c,0x18DC,0x1491); n++; return n;
+    case 0x18DC: AOT::op<0xCD>(c,0x18DF,0x187C); n++; return n;
+    case 0x18DF: AOT::op<0xC1>(c,0x18E0); n++;
+    case 0x18E0: AOT::op<0xE1>(c,0x18E1); n++;
+    case 0x18E1: AOT::op<0xCD>(c,0x18E4,0x1491); n++; return n;
+    case 0x18E4: AOT::op<0xEB>(c,0x18E5); n++;
+    case 0x18E5: AOT::op<0xCD>(c,0x18E8,0x14A1); n++; return n;
+    case 0x18E8: AOT::op<0xCD>(c,0x18EB,0x1876); n++; return n;
+    case 0x18EB: AOT::op<0xC3>(c,0x18EE,0x13B7); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b18EE(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x18EE: AOT::op<0xEF>(c,0x18EF); n++; return n;
+    case 0x18EF: AOT::op<0xFC>(c,0x18F2,0x16FA); n++; if (c.pc!=0x18F2) return n; if (x.stop) return n;
+    case 0x18F2: AOT::op<0xFC>(c,0x18F5,0x1489); n++; if (c.pc!=0x18F5) return n; if (x.stop) return n;
+    case 0x18F5: AOT::op<0x3A>(c,0x18F8,0x0256); n++;
+    case 0x18F8: AOT::op<0xFE>(c,0x18FA,0x81); n++;
+    case 0x18FA: AOT::op<0xDA>(c,0x18FD,0x1909); n++; if (c.pc!=0x18FD) { if (n<x.left) goto L1909; return n; }
+    case 0x18FD: AOT::op<0x01>(c,0x1900,0x8100); n++;
+    case 0x1900: AOT::op<0x51>(c,0x1901); n++;
+    case 0x1901: AOT::op<0x59>(c,0x1902); n++;
+    case 0x1902: AOT::op<0xCD>(c,0x1905,0x13B9); n++; return n;
+    case 0x1905: AOT::op<0x21>(c,0x1908,0x1218); n++;
+    case 0x1908: AOT::op<0xE5>(c,0x1909); n++; if (x.stop) return n;
+    case 0x1909: L1909: AOT::op<0x21>(c,0x190C,0x1913); n++;
+    case 0x190C: AOT::op<0xCD>(c,0x190F,0x17AC); n++; return n;
+    case 0x190F: AOT::op<0x21>(c,0x1912,0x18BC); n++;
+    case 0x1912: AOT::op<0xC9>(c,0x1913); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b193A(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x193A: AOT::op<0xDB>(c,0x193C,0xFF); n++;
+    case 0x193C: AOT::op<0xE6>(c,0x193E,0xF0); n++;
+    case 0x193E: AOT::op<0x0F>(c,0x193F); n++;
+    case 0x193F: AOT::op<0x0F>(c,0x1940); n++;
+    case 0x1940: AOT::op<0xFE>(c,0x1942,0x3C); n++;
+    case 0x1942: AOT::op<0xC8>(c,0x1943); n++; if (c.pc!=0x1943) return n;
+    case 0x1943: AOT::op<0xFE>(c,0x1945,0x38); n++;
+    case 0x1945: AOT::op<0x37>(c,0x1946); n++;
+    case 0x1946: AOT::op<0xC2>(c,0x1949,0x1953); n++; if (c.pc!=0x1949) { if (n<x.left) goto L1953; return n; }
+    case 0x1949: AOT::op<0x21>(c,0x194C,0x1FFF); n++;
+    case 0x194C: AOT::op<0x4E>(c,0x194D); n++;
+    case 0x194D: AOT::op<0x2B>(c,0x194E); n++;
+    case 0x194E: AOT::op<0x7E>(c,0x194F); n++;
+    case 0x194F: AOT::op<0xE6>(c,0x1951,0xF0); n++;
+    case 0x1951: AOT::op<0x0F>(c,0x1952); n++;
+    case 0x1952: AOT::op<0x0F>(c,0x1953); n++;
+    case 0x1953: L1953: AOT::op<0xF5>(c,0x1954); n++; if (x.stop) return n;
+    case 0x1954: AOT::op<0x6F>(c,0x1955); n++;
+    case 0x1955: AOT::op<0x26>(c,0x1957,0x00); n++;
+    case 0x1957: AOT::op<0x11>(c,0x195A,0x19B8); n++;
+    case 0x195A: AOT::op<0x19>(c,0x195B); n++;
+    case 0x195B: AOT::op<0x7E>(c,0x195C); n++;
+    case 0x195C: AOT::op<0x23>(c,0x195D); n++;
+    case 0x195D: AOT::op<0x56>(c,0x195E); n++;
+    case 0x195E: AOT::op<0x23>(c,0x195F); n++;
+    case 0x195F: AOT::op<0x46>(c,0x1960); n++;
+    case 0x1960: AOT::op<0x23>(c,0x1961); n++;
+    case 0x1961: AOT::op<0x5E>(c,0x1962); n++;
+    case 0x1962: AOT::op<0x67>(c,0x1963); n++;
+    case 0x1963: AOT::op<0xF1>(c,0x1964); n++;
+    case 0x1964: AOT::op<0xF5>(c,0x1965); n++; if (x.stop) return n;
+    case 0x1965: AOT::op<0x7C>(c,0x1966); n++;
+    case 0x1966: AOT::op<0xDA>(c,0x1969,0x196A); n++; if (c.pc!=0x1969) { if (n<x.left) goto L196A; return n; }
+    case 0x1969: AOT::op<0x79>(c,0x196A); n++;
+    case 0x196A: L196A: AOT::op<0x32>(c,0x196D,0x19B6); n++; if (x.stop) return n;
+    case 0x196D: AOT::op<0xF1>(c,0x196E); n++;
+    case 0x196E: AOT::op<0x21>(c,0x1971,0x19D4); n++;
+    case 0x1971: AOT::op<0xE5>(c,0x1972); n++; if (x.stop) return n;
+    case 0x1972: AOT::op<0x0E>(c,0x1974,0xFF); n++;
+    case 0x1974: AOT::op<0xFE>(c,0x1976,0x10); n++;
+    case 0x1976: AOT::op<0x21>(c,0x1979,0x0000); n++;
+    case 0x1979: AOT::op<0x22>(c,0x197C,0x0552); n++; if (x.stop) return n;
+    case 0x197C: AOT::op<0xCA>(c,0x197F,0x198E); n++; if (c.pc!=0x197F) return n;
+    case 0x197F: AOT::op<0xFE>(c,0x1981,0x08); n++;
+    case 0x1981: AOT::op<0xD0>(c,0x1982); n++; if (c.pc!=0x1982) return n;
+    case 0x1982: AOT::op<0xC6>(c,0x1984,0x11); n++;
+    case 0x1984: AOT::op<0xF5>(c,0x1985); n++; if (x.stop) return n;
+    case 0x1985: AOT::op<0x3E>(c,0x1987,0x03); n++;
+    case 0x1987: AOT::op<0xCD>(c,0x198A,0x19B5); n++; return n;
+    case 0x198A: AOT::op<0xF1>(c,0x198B); n++;
+    case 0x198B: AOT::op<0xC3>(c,0x198E,0x19B5); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b198E(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x198E: AOT::op<0xAF>(c,0x198F); n++;
+    case 0x198F: AOT::op<0xCD>(c,0x1992,0x19B5); n++; return n;
+    case 0x1992: AOT::op<0xCD>(c,0x1995,0x19B1); n++; return n;
+    case 0x1995: AOT::op<0xCD>(c,0x1998,0x19B1); n++; return n;
+    case 0x1998: AOT::op<0x2F>(c,0x1999); n++;
+    case 0x1999: AOT::op<0x0E>(c,0x199B,0x01); n++;
+    case 0x199B: AOT::op<0xCD>(c,0x199E,0x19B1); n++; return n;
+    case 0x199E: AOT::op<0xE5>(c,0x199F); n++; if (x.stop) return n;
+    case 0x199F: AOT::op<0x2A>(c,0x19A2,0x19B5); n++;
+    case 0x19A2: AOT::op<0x2E>(c,0x19A4,0xDB); n++;
+    case 0x19A4: AOT::op<0x22>(c,0x19A7,0x0552); n++; if (x.stop) return n;
+    case 0x19A7: AOT::op<0xE1>(c,0x19A8); n++;
+    case 0x19A8: AOT::op<0x3E>(c,0x19AA,0x2C); n++;
+    case 0x19AA: AOT::op<0x35>(c,0x19AB); n++; if (x.stop) return n;
+    case 0x19AB: AOT::op<0xCD>(c,0x19AE,0x19B5); n++; return n;
+    case 0x19AE: AOT::op<0x35>(c,0x19AF); n++; if (x.stop) return n;
+    case 0x19AF: AOT::op<0x35>(c,0x19B0); n++; if (x.stop) return n;
+    case 0x19B0: AOT::op<0x35>(c,0x19B1); n++; if (x.stop) return n;
+    case 0x19B1: AOT::op<0x21>(c,0x19B4,0x19B6); n++;
+    case 0x19B4: AOT::op<0x34>(c,0x19B5); n++; if (x.stop) return n;
+    case 0x19B5: AOT::op<0xD3>(c,0x19B7,AOT::imm8(c,0x19B6)); n++;
+    case 0x19B7: AOT::op<0xC9>(c,0x19B8); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b19D4(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x19D4: AOT::op<0x62>(c,0x19D5); n++;
+    case 0x19D5: AOT::op<0x68>(c,0x19D6); n++;
+    case 0x19D6: AOT::op<0x22>(c,0x19D9,0x0559); n++; if (x.stop) return n;
+    case 0x19D9: AOT::op<0x7C>(c,0x19DA); n++;
+    case 0x19DA: AOT::op<0xE6>(c,0x19DC,0xC8); n++;
+    case 0x19DC: AOT::op<0x67>(c,0x19DD); n++;
+    case 0x19DD: AOT::op<0x22>(c,0x19E0,0x066B); n++; if (x.stop) return n;
+    case 0x19E0: AOT::op<0xEE>(c,0x19E2,0x0C); n++;
+    case 0x19E2: AOT::op<0x67>(c,0x19E3); n++;
+    case 0x19E3: AOT::op<0x22>(c,0x19E6,0x060F); n++; if (x.stop) return n;
+    case 0x19E6: AOT::op<0xEB>(c,0x19E7); n++;
+    case 0x19E7: AOT::op<0x22>(c,0x19EA,0x054A); n++; if (x.stop) return n;
+    case 0x19EA: AOT::op<0x3A>(c,0x19ED,0x19B6); n++;
+    case 0x19ED: AOT::op<0x32>(c,0x19F0,0x0557); n++; if (x.stop) return n;
+    case 0x19F0: AOT::op<0x32>(c,0x19F3,0x0669); n++; if (x.stop) return n;
+    case 0x19F3: AOT::op<0x32>(c,0x19F6,0x060D); n++; if (x.stop) return n;
+    case 0x19F6: AOT::op<0x3C>(c,0x19F7); n++;
+    case 0x19F7: AOT::op<0x32>(c,0x19FA,0x055E); n++; if (x.stop) return n;
+    case 0x19FA: AOT::op<0x81>(c,0x19FB); n++;
+    case 0x19FB: AOT::op<0x32>(c,0x19FE,0x0548); n++; if (x.stop) return n;
+    case 0x19FE: AOT::op<0x3C>(c,0x19FF); n++;
+    case 0x19FF: AOT::op<0x32>(c,0x1A02,0x0550); n++; if (x.stop) return n;
+    case 0x1A02: AOT::op<0xC9>(c,0x1A03); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1A05(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1A05: L1A05: AOT::op<0x21>(c,0x1A08,0x1B30); n++;
+    case 0x1A08: AOT::op<0xCD>(c,0x1A0B,0x0EE3); n++; return n;
+    case 0x1A0B: AOT::op<0x21>(c,0x1A0E,0x1C0F); n++;
+    case 0x1A0E: AOT::op<0xF9>(c,0x1A0F); n++;
+    case 0x1A0F: AOT::op<0x22>(c,0x1A12,0x01D2); n++; if (x.stop) return n;
+    case 0x1A12: AOT::op<0xCD>(c,0x1A15,0x193A); n++; return n;
+    case 0x1A15: AOT::op<0x21>(c,0x1A18,0xFFFF); n++;
+    case 0x1A18: AOT::op<0x22>(c,0x1A1B,0x01D4); n++; if (x.stop) return n;
+    case 0x1A1B: AOT::op<0xAF>(c,0x1A1C); n++;
+    case 0x1A1C: AOT::op<0x32>(c,0x1A1F,0x01D1); n++; if (x.stop) return n;
+    case 0x1A1F: AOT::op<0xCD>(c,0x1A22,0x08ED); n++; return n;
+    case 0x1A22: AOT::op<0x21>(c,0x1A25,0x022A); n++;
+    case 0x1A25: AOT::op<0x22>(c,0x1A28,0x0228); n++; if (x.stop) return n;
+    case 0x1A28: L1A28: AOT::op<0x21>(c,0x1A2B,0x1B68); n++;
+    case 0x1A2B: AOT::op<0xCD>(c,0x1A2E,0x0EE3); n++; return n;
+    case 0x1A2E: AOT::op<0xCD>(c,0x1A31,0x03EF); n++; return n;
+    case 0x1A31: AOT::op<0xDA>(c,0x1A34,0x1A28); n++; if (c.pc!=0x1A34) { if (n<x.left) goto L1A28; return n; }
+    case 0x1A34: AOT::op<0xD7>(c,0x1A35); n++; return n;
+    case 0x1A35: AOT::op<0xFE>(c,0x1A37,0x41); n++;
+    case 0x1A37: AOT::op<0xCA>(c,0x1A3A,0x1A05); n++; if (c.pc!=0x1A3A) { if (n<x.left) goto L1A05; return n; }
+    case 0x1A3A: AOT::op<0xB7>(c,0x1A3B); n++;
+    case 0x1A3B: AOT::op<0xC2>(c,0x1A3E,0x1A51); n++; if (c.pc!=0x1A3E) return n;
+    case 0x1A3E: AOT::op<0x21>(c,0x1A41,0x1BC9); n++;
+    case 0x1A41: L1A41: AOT::op<0x23>(c,0x1A42); n++;
+    case 0x1A42: AOT::op<0x7C>(c,0x1A43); n++;
+    case 0x1A43: AOT::op<0xB5>(c,0x1A44); n++;
+    case 0x1A44: AOT::op<0xCA>(c,0x1A47,0x1A5D); n++; if (c.pc!=0x1A47) return n;
+    case 0x1A47: AOT::op<0x7E>(c,0x1A48); n++;
+    case 0x1A48: AOT::op<0x2F>(c,0x1A49); n++;
+    case 0x1A49: AOT::op<0x77>(c,0x1A4A); n++; if (x.stop) return n;
+    case 0x1A4A: AOT::op<0xBE>(c,0x1A4B); n++;
+    case 0x1A4B: AOT::op<0xCA>(c,0x1A4E,0x1A41); n++; if (c.pc!=0x1A4E) { if (n<x.left) goto L1A41; return n; }
+    case 0x1A4E: AOT::op<0xC3>(c,0x1A51,0x1A5D); n++; return n;
+    }
+  return n;
+}
+
+static unsigned b1A51(CPU &c, AOT &x)
+{
+  unsigned n=0;
+  switch (c.pc)
+    {
+    case 0x1A51: AOT::op<0x21>(c,0x1A54,0x01D9); n++;
+    case 0x1A54: AOT::op<0xCD>(c,0x1A57,0x0752); n++; return n;
+    case 0x1A57: AOT::op<0x7E>(c,0x1A58); n++;
+    case 0x1A58: AOT::op<0xB7>(c,0x1A59); n++;
+    case 0x1A59: AOT::op<0xC2>(c,0x1A5C,0x02C6); n++; if (c.pc!=0x1A5C) return n;
+    case 0x1A5C: AOT::op<0xEB>(c,0x1A5D); n++;
+    case 0x1A5D: AOT::op<0x2B>(c,0x1A5E); n++;
+    case 0x1A5E: AOT::op<0xE5>(c,0x1A5F); n++; if (x.stop) return n;
+    case 0x1A5F: L1A5F: AOT::op<0x21>(c,0x1A62,0x1B59); n++;
+    case 0x1A62: AOT::op<0xCD>(c,0x1A65,0x0EE3); n++; return n;
+    case 0x1A65: AOT::op<0xCD>(c,0x1A68,0x03EF); n++; return n;
+    case 0x1A68: AOT::op<0xDA>(c,0x1A6B,0x1A5F); n++; if (c.pc!=0x1A6B) { if (n<x.left) goto L1A5F; return n; }
+    case 0x1A6B: AOT::op<0xD7>(c,0x1A6C); n++; return n;
+    case 0x1A6C: AOT::op<0xB7>(c,0x1A6D); n++;
+    case 0x1A6D: AOT::op<0x3E>(c,0x1A6F,0x48); n++;
+    case 0x1A6F: AOT::op<0x5F>(c,0x1A70); n++;
+    case 0x1A70: AOT::op<0xCA>(c,0x1A73,0x1A81); n++; if (c.pc!=0x1A73) { if (n<x.left) goto L1A81; return n; }
+    case 0x1A73: AOT::op<0xCD>(c,0x1A76,0x0752); n++; return n;
+    case 0x1A76: AOT::op<0x7A>(c,0x1A77); n++;
+    case 0x1A77: AOT::op<0xB7>(c,0x1A78); n++;
+    case 0x1A78: AOT::op<0xC2>(c,0x1A7B,0x1A5F); n++; if (c.pc!=0x1A7B) { if (n<x.left) goto L1A5F; return n; }
+    case 0x1A7B: AOT::op<0x7B>(c,0x1A7C); n++;
+    case 0x1A7C: AOT::op<0xFE>(c,0x1A7E,0x0F); n++;
+    case 0x1A7E: AOT::op<0xDA>(c,0x1A81,0x1A5F); n++; if (c.pc!=0x1A81) { if (n<x.left) goto L1A5F; return n; }
+    case 0x1A81: L1A81: AOT::op<0x32>(c,0x1A84,0x053F); n++; if (x.stop) return n;
+    case 0x1A84: AOT::op<0x32>(c,0x1A87,0x06C6); n++; if (x.stop) return n;
+    case 0x1A87: AOT::op<0x32>(c,0x1A8A,0x08CE); n++; if (x.stop) return n;
+    case 0x1A8A: L1A8A: AOT::op<0xD6>(c,0x1A8C,0x0E); n++;
+    case 0x1A8C: AOT::op<0xD2>(c,0x1A8F,0x1A8A); n++; if (c.pc!=0x1A8F) { if (n<x.left) goto L1A8A; return n; }
+    case 0x1A8F: AOT::op<0xC6>(c,0x1A91,0x1C); n++;
+    case 0x1A91: AOT::op<0x2F>(c,0x1A92); n++;
+    case 0x1A92: AOT::op<0x3C>(c,0x1A93); n++;
+    case 0x1A93: AOT::op<0x83>(c,0x1A94); n++;
+    case 0x1A94: AOT::op<0x32>(c,0x1A97,0x0906); n++; if (x.stop) return n;
+    case 0x1A97: AOT::op<0x11>(c,0x1A9A,0xFFCF); n++;
+    case 0x1A9A: AOT::op<0xE1>(c,0x1A9B); n++;
+    case 0x1A9B: AOT::op<0x22>(c,0x1A9E,0x0226); n++; if (x.stop) return n;
+    case 0x1A9E: AOT::op<0x19>(c,0x1A9F); n++;
+    case 0x1A9F: AOT::op<0xD2>(c,0x1AA2,0x02BB); n++; if (c.pc!=0x1AA2) return n;
+    case 0x1AA2: AOT::op<0x2B>(c,0x1AA3); n++;
+    case 0x1AA3: AOT::op<0xE5>(c,0x1AA4); n++; if (x.stop) return n;
+    case 0x1AA4: L1AA4: AOT::op<0x21>(c,0x1AA7,0x1B1B); n++;
+    case 0x1AA7: AOT::op<0xCD>(c,0x1AAA,0x0EE3); n++; return n;
+    case 0x1AAA: AOT::op<0xCD>(c,0x1AAD,0x03EF); n++; return n;
+    case 0x1AAD: AOT::op<0xDA>(c,0x1AB0,0x1AA4); n++; if (c.pc!=0x1AB0) { if (n<x.left) goto L1AA4; return n; }
+    case 0x1AB0: AOT::op<0xD7>(c,0x1AB1); n++; return n;
+    case 0x1AB1: AOT::op<0x21>(c,0x1AB4,0x074D); n++;
+    case 0x1AB4: AOT::op<0xFE>(c,0x1AB6,0x59); n++;
+    case 0x1AB6: AOT::op<0x11>(c,0x1AB9,0x1938); n++;
+    case 0x1AB9: AOT::op<0xCA>(c,0x1ABC,0x1ADD); n++; if (c.pc!=0x1ABC) { if (n<x.left) goto L1ADD; return n; }
+    case 0x1ABC: AOT::op<0xFE>(c,0x1ABE,0x41); n++;
+    case 0x1ABE: AOT::op<0xCA>(c,0x1AC1,0x1AC6); n++; if (c.pc!=0x1AC1) { if (n<x.left) goto L1AC6; return n; }
+    case 0x1AC1: AOT::op<0xFE>(c,0x1AC3,0x4E); n++;
+    case 0x1AC3: AOT::op<0xC2>(c,0x1AC6,0x1AA4); n++; if (c.pc!=0x1AC6) { if (n<x.left) goto L1AA4; return n; }
+    case 0x1AC6: L1AC6: AOT::op<0x11>(c,0x1AC9,0x18EE); n++;
+    case 0x1AC9: AOT::op<0x22>(c,0x1ACC,0x005F); n++; if (x.stop) return n;
+    case 0x1ACC: AOT::op<0xFE>(c,0x1ACE,0x41); n++;
+    case 0x1ACE: AOT::op<0xCA>(c,0x1AD1,0x1ADD); n++; if (c.pc!=0x1AD1) { if (n<x.left) goto L1ADD; return n; }
+    case 0x1AD1: AOT::op<0x22>(c,0x1AD4,0x0059); n++; if (x.stop) return n;
+    case 0x1AD4: AOT::op<0x22>(c,0x1AD7,0x005D); n++; if (x.stop) return n;
+    case 0x1AD7: AOT::op<0x22>(c,0x1ADA,0x005B); n++; if (x.stop) return n;
+    case 0x1ADA: AOT::op<0x11>(c,0x1ADD,0x1876); n++;
+    case 0x1ADD: L1ADD: AOT::op<0xEB>(c,0x1ADE); n++;
+    case 0x1ADE: AOT::op<0x36>(c,0x1AE0,0x00); n++; if (x.stop) return n;
+    case 0x1AE0: AOT::op<0x23>(c,0x1AE1); n++;
+    case 0x1AE1: AOT::op<0x22>(c,0x1AE4,0x01D6); n++; if (x.stop) return n;
+    case 0x1AE4: AOT::op<0xE3>(c,0x1AE5); n++; if (x.stop) return n;
+    case 0x1AE5: AOT::op<0x11>(c,0x1AE8,0x1C0F); n++;
+    case 0x1AE8: AOT::op<0xE7>(c,0x1AE9); n++; return n;
+    case 0x1AE9: AOT::op<0xDA>(c,0x1AEC,0x02BB); n++; if (c.pc!=0x1AEC) return n;
+    case 0x1AEC: AOT::op<0xD1>(c,0x1AED); n++;
+    case 0x1AED: AOT::op<0xF9>(c,0x1AEE); n++;
+    case 0x1AEE: AOT::op<0x22>(c,0x1AF1,0x01D2); n++; if (x.stop) return n;
+    case 0x1AF1: AOT::op<0xEB>(c,0x1AF2); n++;
+    case 0x1AF2: AOT::op<0xCD>(c,0x1AF5,0x02AF); n++; return n;
+    case 0x1AF5: AOT::op<0x7B>(c,0x1AF6); n++;
+    case 0x1AF6: AOT::op<0x95>(c,0x1AF7); n++;
+    case 0x1AF7: AOT::op<0x6F>(c,0x1AF8); n++;
+    case 0x1AF8: AOT::op<0x7A>(c,0x1AF9); n++;
+    case 0x1AF9: AOT::op<0x9C>(c,0x1AFA); n++;
+    case 0x1AFA: AOT::op<0x67>(c,0x1AFB); n++;
+    case 0x1AFB: AOT::op<0x01>(c,0x1AFE,0xFFF0); n++;
+    case 0x1AFE: AOT::op<0x09>(c,0x1AFF); n++;
+    case 0x1AFF: AOT::op<0xCD>(c,0x1B02,0x08ED); n++; return n;
+    case 0x1B02: AOT::op<0xCD>(c,0x1B05,0x1604); n++; return n;
+    case 0x1B05: AOT::op<0x21>(c,0x1B08,0x1B74); n++;
+    case 0x1B08: AOT::op<0xCD>(c,0x1B0B,0x0EE3); n++; return n;
+    case 0x1B0B: AOT::op<0x21>(c,0x1B0E,0x0EE3); n++;
+    case 0x1B0E: AOT::op<0x22>(c,0x1B11,0x0302); n++; if (x.stop) return n;
+    case 0x1B11: AOT::op<0xCD>(c,0x1B14,0x03B1); n++; return n;
+    case 0x1B14: AOT::op<0x21>(c,0x1B17,0x02F7); n++;
+    case 0x1B17: AOT::op<0x22>(c,0x1B1A,0x0002); n++; if (x.stop) return n;
+    case 0x1B1A: AOT::op<0xE9>(c,0x1B1B); n++; return n;
+    }
+  return n;
+}
+
+static const AOT::block blocks[173]=
+  {
+    { 0x0000, 0x0004, b0000 },
+    { 0x0008, 0x0018, b0008 },
+    { 0x0018, 0x0020, b0018 },
+    { 0x0020, 0x0026, b0020 },
+    { 0x0028, 0x0030, b0028 },
+    { 0x0236, 0x0297, b0236 },
+    { 0x0297, 0x02A6, b0297 },
+    { 0x02A6, 0x02AE, b02A6 },
+    { 0x02AF, 0x02C0, b02AF },
+    { 0x02C0, 0x0392, b02C0 },
+    { 0x0392, 0x03B0, b0392 },
+    { 0x03B1, 0x03EF, b03B1 },
+    { 0x03EF, 0x03F8, b03EF },
+    { 0x03F8, 0x0476, b03F8 },
+    { 0x0476, 0x047A, b0476 },
+    { 0x047A, 0x04A5, b047A },
+    { 0x04A5, 0x04AE, b04A5 },
+    { 0x04AE, 0x04CA, b04AE },
+    { 0x04CA, 0x052D, b04CA },
+    { 0x052D, 0x0556, b052D },
+    { 0x0556, 0x056D, b0556 },
+    { 0x05B7, 0x05DD, b05B7 },
+    { 0x05DE, 0x065E, b05DE },
+    { 0x065E, 0x0668, b065E },
+    { 0x0668, 0x06AD, b0668 },
+    { 0x06AD, 0x06C0, b06AD },
+    { 0x06C0, 0x06CE, b06C0 },
+    { 0x06DD, 0x0703, b06DD },
+    { 0x0703, 0x0725, b0703 },
+    { 0x0725, 0x0728, b0725 },
+    { 0x0728, 0x0730, b0728 },
+    { 0x0730, 0x0752, b0730 },
+    { 0x0752, 0x0773, b0752 },
+    { 0x079C, 0x07A8, b079C },
+    { 0x07A8, 0x07D5, b07A8 },
+    { 0x07D5, 0x0811, b07D5 },
+    { 0x0811, 0x0815, b0811 },
+    { 0x0816, 0x085C, b0816 },
+    { 0x085C, 0x0863, b085C },
+    { 0x0863, 0x086E, b0863 },
+    { 0x086F, 0x087F, b086F },
+    { 0x087F, 0x0889, b087F },
+    { 0x088A, 0x0899, b088A },
+    { 0x0899, 0x08E0, b0899 },
+    { 0x08E0, 0x08E8, b08E0 },
+    { 0x08E8, 0x0902, b08E8 },
+    { 0x0902, 0x0916, b0902 },
+    { 0x0916, 0x091B, b0916 },
+    { 0x091C, 0x093A, b091C },
+    { 0x094D, 0x095E, b094D },
+    { 0x095E, 0x096C, b095E },
+    { 0x096D, 0x0988, b096D },
+    { 0x0988, 0x09DB, b0988 },
+    { 0x09DB, 0x0A07, b09DB },
+    { 0x0A18, 0x0A3A, b0A18 },
+    { 0x0A3A, 0x0A75, b0A3A },
+    { 0x0A75, 0x0A92, b0A75 },
+    { 0x0A92, 0x0A93, b0A92 },
+    { 0x0A94, 0x0ACA, b0A94 },
+    { 0x0ACA, 0x0B09, b0ACA },
+    { 0x0B09, 0x0B43, b0B09 },
+    { 0x0B44, 0x0B45, b0B44 },
+    { 0x0B45, 0x0B56, b0B45 },
+    { 0x0B56, 0x0B67, b0B56 },
+    { 0x0B67, 0x0B77, b0B67 },
+    { 0x0B78, 0x0B8A, b0B78 },
+    { 0x0B8A, 0x0B9B, b0B8A },
+    { 0x0BC3, 0x0BD5, b0BC3 },
+    { 0x0C23, 0x0C3A, b0C23 },
+    { 0x0C3A, 0x0C3E, b0C3A },
+    { 0x0C3F, 0x0C43, b0C3F },
+    { 0x0C44, 0x0CA9, b0C44 },
+    { 0x0CA9, 0x0CDC, b0CA9 },
+    { 0x0CDC, 0x0CE7, b0CDC },
+    { 0x0CE7, 0x0D01, b0CE7 },
+    { 0x0D02, 0x0D41, b0D02 },
+    { 0x0D41, 0x0DC3, b0D41 },
+    { 0x0DC3, 0x0DF1, b0DC3 },
+    { 0x0DF1, 0x0DF9, b0DF1 },
+    { 0x0DF9, 0x0E05, b0DF9 },
+    { 0x0E06, 0x0E0D, b0E06 },
+    { 0x0E0E, 0x0E0F, b0E0E },
+    { 0x0E10, 0x0E16, b0E10 },
+    { 0x0E16, 0x0E52, b0E16 },
+    { 0x0E52, 0x0E60, b0E52 },
+    { 0x0E60, 0x0E61, b0E60 },
+    { 0x0E62, 0x0E6F, b0E62 },
+    { 0x0E6F, 0x0E94, b0E6F },
+    { 0x0E94, 0x0EA3, b0E94 },
+    { 0x0EA3, 0x0EE2, b0EA3 },
+    { 0x0EE2, 0x0EFA, b0EE2 },
+    { 0x0EFA, 0x0F16, b0EFA },
+    { 0x0F16, 0x0F55, b0F16 },
+    { 0x0F55, 0x0FA4, b0F55 },
+    { 0x0FA4, 0x0FC9, b0FA4 },
+    { 0x0FC9, 0x1000, b0FC9 },
+    { 0x1000, 0x1013, b1000 },
+    { 0x1013, 0x1032, b1013 },
+    { 0x1032, 0x1041, b1032 },
+    { 0x1041, 0x1050, b1041 },
+    { 0x1050, 0x1061, b1050 },
+    { 0x1061, 0x1071, b1061 },
+    { 0x1071, 0x10A1, b1071 },
+    { 0x10A1, 0x10AB, b10A1 },
+    { 0x10AB, 0x10B9, b10AB },
+    { 0x10BA, 0x10BE, b10BA },
+    { 0x10BF, 0x10D2, b10BF },
+    { 0x10D2, 0x10ED, b10D2 },
+    { 0x10ED, 0x10EF, b10ED },
+    { 0x10F0, 0x10FA, b10F0 },
+    { 0x10FA, 0x1105, b10FA },
+    { 0x1105, 0x110B, b1105 },
+    { 0x110B, 0x1117, b110B },
+    { 0x1118, 0x1124, b1118 },
+    { 0x1124, 0x112E, b1124 },
+    { 0x1130, 0x1140, b1130 },
+    { 0x1140, 0x114A, b1140 },
+    { 0x114A, 0x1159, b114A },
+    { 0x11F9, 0x1200, b11F9 },
+    { 0x1200, 0x1208, b1200 },
+    { 0x1209, 0x120F, b1209 },
+    { 0x120F, 0x1218, b120F },
+    { 0x1218, 0x1261, b1218 },
+    { 0x1261, 0x128C, b1261 },
+    { 0x128C, 0x12B9, b128C },
+    { 0x12B9, 0x12C8, b12B9 },
+    { 0x12C8, 0x12D4, b12C8 },
+    { 0x12D4, 0x12E8, b12D4 },
+    { 0x12E8, 0x12F7, b12E8 },
+    { 0x12F7, 0x130C, b12F7 },
+    { 0x131D, 0x1358, b131D },
+    { 0x1359, 0x13A6, b1359 },
+    { 0x13A6, 0x13AB, b13A6 },
+    { 0x13AB, 0x1429, b13AB },
+    { 0x1429, 0x1447, b1429 },
+    { 0x1447, 0x1452, b1447 },
+    { 0x1452, 0x1469, b1452 },
+    { 0x1469, 0x146C, b1469 },
+    { 0x146D, 0x1473, b146D },
+    { 0x1473, 0x1487, b1473 },
+    { 0x1487, 0x1491, b1487 },
+    { 0x1491, 0x149E, b1491 },
+    { 0x149E, 0x14AC, b149E },
+    { 0x14AC, 0x14B8, b14AC },
+    { 0x14B8, 0x14C6, b14B8 },
+    { 0x14C6, 0x14DB, b14C6 },
+    { 0x14DB, 0x14F3, b14DB },
+    { 0x14F3, 0x1506, b14F3 },
+    { 0x1506, 0x152A, b1506 },
+    { 0x152A, 0x1531, b152A },
+    { 0x1531, 0x154A, b1531 },
+    { 0x154A, 0x1565, b154A },
+    { 0x1565, 0x15C6, b1565 },
+    { 0x15C6, 0x15CE, b15C6 },
+    { 0x15CE, 0x15E5, b15CE },
+    { 0x15E5, 0x15F0, b15E5 },
+    { 0x15F0, 0x15FC, b15F0 },
+    { 0x15FC, 0x163E, b15FC },
+    { 0x163E, 0x16D6, b163E },
+    { 0x16D6, 0x16E4, b16D6 },
+    { 0x16FA, 0x16FF, b16FA },
+    { 0x16FF, 0x178B, b16FF },
+    { 0x17AC, 0x17DC, b17AC },
+    { 0x17DC, 0x183B, b17DC },
+    { 0x183B, 0x1843, b183B },
+    { 0x1876, 0x18BC, b1876 },
+    { 0x18D9, 0x18EE, b18D9 },
+    { 0x18EE, 0x1913, b18EE },
+    { 0x193A, 0x198E, b193A },
+    { 0x198E, 0x19B8, b198E },
+    { 0x19D4, 0x1A03, b19D4 },
+    { 0x1A05, 0x1A51, b1A05 },
+    { 0x1A51, 0x1B1B, b1A51 }
+  };
+
+static const unsigned short vars[]=
+  {
+    0x0002, 0x0003, 0x0302, 0x0303, 0x053F, 0x0548, 0x054A, 0x0550, 0x0553, 0x0557, 0x0559, 0x055E, 0x060D, 0x060F, 0x0669, 0x066B, 0x06C6, 0x08CE, 0x0906, 0x1101, 0x1109, 0x111D, 0x138D, 0x138E, 0x1392, 0x13E0, 0x13E4, 0x13E8, 0x13EB, 0x19B6
+  };
+
+static AOT::personality personality("8kbas",image,0x0000,8192,blocks,173,vars,30);
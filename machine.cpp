@@ -0,0 +1,347 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+// A whole machine (see machine.h)
+
+#include "machine.h"
+#include <stdlib.h>
+#include <string.h>
+#if !defined(NOTELNET)
+#include <sched.h>
+#else
+#define sched_yield()
+#endif
+
+Machine::Machine(char *port, unsigned memsize) 
+  : rfp(io,port,port==NULL || !*port), ram(rfp,memsize), cpu(ram,rfp), term(*this)
+{
+  for (int b=0;b<26;b++) bps[b].id='A'+b;
+  for (int b=0;b<27;b++) bps[b].m=this;
+  runonly=rfp.soft;  // no front panel means nothing else to do
+  forcetrace=0;
+  skip=0;
+  quantum=QMIN;
+  flushed=0;
+  nstop=0;
+  memset(stopmap,0,sizeof(stopmap));
+}
+
+// Memory map from the command line (see machine.h)
+int Machine::layout(const char *spec)
+{
+  // in RAM::pagekinds order; nv is RAM kept in its file
+  static const char *const kinds[]={ "ram", "rom", "none", "io", "nv" };
+  enum { NV=RAM::PG_DEVICE+1 };
+  char buf[1024], *entry, *next;
+  strncpy(buf,spec,sizeof(buf)-1);
+  buf[sizeof(buf)-1]='\0';
+  for (entry=buf;entry;entry=next)
+    {
+      char *colon, *dash, *file, *end;
+      if ((next=strchr(entry,','))) *next++='\0';
+      colon=strchr(entry,':');
+      unsigned start, last;
+      int kind;
+      if (!colon) goto bad;
+      *colon='\0';
+      for (kind=RAM::PG_RAM;kind<=NV;kind++)
+	if (!strcmp(entry,kinds[kind])) break;
+      start=strtoul(colon+1,&dash,16);
+      if (*dash!='-') goto bad;
+      last=strtoul(dash+1,&end,16);
+      file=NULL;
+      if (*end=='=') file=end+1;
+      else if (*end) goto bad;
+      if (kind==NV)
+	{
+	  if (!file || !ram.map(start,last,RAM::PG_RAM)) goto bad;
+	  if (!ram.persist(file,start&~0xFF,(last|0xFF)-(start&~0xFF)+1))
+	    {
+	      io.printf(iobase::ERROROUT,"Can't keep %04X-%04X in %s (it has to be whole host pages)\n",start,last,file);
+	      return 0;
+	    }
+	  continue;
+	}
+      if (!ram.map(start,last,kind,kind==RAM::PG_DEVICE?&cpu:NULL)) goto bad;
+      if (file && !ram.load(file,start&~0xFF,(last|0xFF)-(start&~0xFF)+1)) return 0;
+      continue;
+    bad:
+      io.printf(iobase::ERROROUT,"Can't read memory map entry %s (want ram, rom, none, or io:start-end[=file] or nv:start-end=file)\n",entry);
+      return 0;
+    }
+  return 1;
+}
+
+// Bank switching from the command line (see machine.h)
+int Machine::banking(const char *spec)
+{
+  char *colon, *dash, *end;
+  unsigned port=strtoul(spec,&colon,16), start, last;
+  if (*colon!=':' || port>0xFF || port==0x10 || port==0x11 || port==0xFF) goto bad;
+  start=strtoul(colon+1,&dash,16);
+  if (*dash!='-') goto bad;
+  last=strtoul(dash+1,&end,16);
+  if (*end || start>last || last>0xFFFF) goto bad;
+  if (!ram.banks(start,last,port))
+    {
+      io.printf(iobase::ERROROUT,"Not enough memory past 64K for a second bank of %04X-%04X (see -m)\n",start,last);
+      return 0;
+    }
+  return 1;
+ bad:
+  io.printf(iobase::ERROROUT,"Can't read bank switching %s (want port:start-end in hex, and not port 10, 11, or FF)\n",spec);
+  return 0;
+}
+
+// Get the breakpoints ready for a quantum: PC breakpoints go in
+// stopmap and the rest decide if every instruction has to go 
+// through watched(). Returns 1 if it does (armed is 1 if any 
+// breakpoint is on at all)
+int Machine::arm(int &armed)
+{
+  int polled=0;
+  armed=0;
+  while (nstop) 
+    {
+      nstop--;
+      stopmap[stopat[nstop]>>3]=0;
+    }
+  for (int b=0;b<27;b++)
+    {
+      int s=bps[b].getstate();
+      if (s) armed=1;
+      if (s && bps[b].pcstop())
+	{
+	  // resumed and gone on from it, so it can go off hold
+	  if (s==-1 && cpu.pc!=bps[b].value) bps[b].check();
+	  stopat[nstop++]=bps[b].value;
+	  stopmap[bps[b].value>>3]|=1<<(bps[b].value&7);
+	}
+      else if (bps[b].polled()) polled=1;
+    }
+  return polled;
+}
+
+// One instruction with the breakpoints and tracing looked at 
+// (returns 0 without doing it if a breakpoint says stop)
+int Machine::watched(int tracing)
+{
+  int armed=0;
+  for (int b=0;b<27;b++)
+    {
+      int act;
+      if (bps[b].getstate()) armed=1;
+      act=bps[b].check();
+      if (act==-1) continue;  // no hit
+      if (act==1) tracing=1;  // trace point
+      // enable a breakpoint
+      if (act&0x80) bps[act&0x3F].setstate(1);
+      // disable a breakpoint
+      if (act&0x40) bps[act&0x3F].setstate(0);
+      if (act==0) return 0;  // stop
+    }
+  // superinstructions would hide the boundary between 
+  // the two so only if nobody is watching
+  cpu.fuse=!(tracing||armed);
+  cpu.exec();  // do an instruction
+  pace.pace(cpu.tstates);
+  // trace if required
+  if (tracing) cpu.dump();
+  return 1;
+}
+
+// This is the main part of the simulator
+void Machine::run(void)
+{
+  int tracing=0;
+  rfp.dat=ram.read(rfp.add);
+  rfp.setstate();
+  while (1)
+    {
+      // reaad function switches
+      int func=runonly?1:rfp.getSWFunc();
+      func=term.virtsw(func);
+      // see if we are tracing
+      tracing=forcetrace||((func&0x40)==0x40);
+      if ((func&0x80))  // reset?
+	{
+	cpureset:
+	  int cmd;
+	  if (!term.running) 
+	    {
+	      io.printf(iobase::CONTROL,"\n<R>eset, <S>ave, e<X>it, or <C>ontinue? ");
+	      do
+		{
+		  cmd=io.getchar(iobase::CONTROL);
+		  io.putchar(iobase::CONTROL,cmd);
+		} while (cmd!='R' && cmd!='r' && cmd!='S' && cmd!='s' && cmd!='c' && cmd!='C' && cmd!='X' && cmd!='x');
+	  io.putchar(iobase::CONTROL,'\n');
+	    }
+	  else  cmd='R'; 
+	  if (cmd=='x'||cmd=='X') exit(0);
+	  if (cmd=='r'||cmd=='R')  cpu.reset();
+	  else if (cmd=='s' || cmd=='S') 
+	    {
+#if defined(WIN32)
+	      const char *fn="altairsave.bin";
+#else
+	      const char *fn="/tmp/altairsave.bin";
+#endif
+	      if (ram.save(fn)) io.printf(iobase::CONTROL,"Saved to %s\n",fn);
+	      if (ram.persists() && ram.flush(1)) io.printf(iobase::CONTROL,"Persistent memory written\n");
+
+	    }
+	  while (rfp.getSWFunc()&0x80);  // wait for release
+	}
+      else if (func&1)  // running
+	{ 
+	  // we are running so attend to that first
+	  ram.statusct=0;
+	  ram.statusskip=skip;
+	  // finish anything the STEP switch left half done
+	  // so the loop below only sees instruction boundaries
+	  if (!cpu.isInst()) cpu.exec();
+	  pace.restart(cpu.tstates);
+	  int wasfast=-1;
+	  while (func&1) 
+	    {
+	      // one quantum: run, then see to the panel and switches
+	      double t0=throttle::now();
+	      int armed, idle=0;
+	      tracing=forcetrace||((func&0x40)==0x40);
+	      int polled=arm(armed);
+	      // with the JIT or recompiled code one exec() is a lot of
+	      // instructions, so a quantum that suits them is far too
+	      // long without them and the other way around: start over
+	      int fast=!polled && !tracing && !armed;
+	      if (fast!=wasfast) quantum=QMIN;
+	      wasfast=fast;
+	      if (!polled && !tracing)
+		{
+		  // nobody is watching every instruction boundary, so
+		  // there's nothing to look at until the quantum is 
+		  // over (or we halt with nothing to wake us) unless 
+		  // PC gets to a breakpoint (the breakpoints look then)
+		  // or a write trips a memory change breakpoint (the
+		  // next quantum checks it before going on). That has
+		  // to be right at the boundary, so no 
+		  // superinstructions, JIT, or recompiled code while 
+		  // one is armed
+		  cpu.fuse=!armed;
+		  ram.tripped=0;
+		  for (unsigned i=0;i<quantum && !ram.tripped && !(cpu.ishalted() && !cpu.intenabled());i++)
+		    {
+		      if (nstop && stopping(cpu.pc))
+			{
+			  if (!watched(0)) idle=1;  // at a breakpoint
+			  break;
+			}
+		      cpu.exec();
+		      pace.pace(cpu.tstates);
+		    }
+		}
+	      else
+		for (unsigned i=0;i<quantum;i++)
+		  if (!watched(tracing))
+		    {
+		      idle=1;  // at a breakpoint
+		      break;
+		    }
+	      rfp.add=cpu.pc; // set the new address
+	      rfp.dat=ram.read(rfp.add); // get the address
+	      // check to see if it is still running
+	      func=term.virtsw(runonly?1:rfp.getSWFunc());
+	      if (func&0x80) goto cpureset;  // reset during run
+	      if (cpu.ishalted() && !cpu.intenabled()) idle=1;
+	      // start writing persistent memory out now and then
+	      if (ram.persists() && t0-flushed>FLUSH)
+		{
+		  ram.flush();
+		  flushed=t0;
+		}
+	      // keep the time between looks at the switches near LATENCY
+	      double ms=(throttle::now()-t0)*1000;
+	      if (idle)
+		throttle::sleep(LATENCY/1000.0);  // nothing to do until a switch changes
+	      else if (ms>LATENCY && quantum>QMIN) quantum/=2;
+	      else if (ms<LATENCY/2 && quantum<QMAX) quantum*=2;
+	    }
+	  ram.statusskip=0;  // only skip during run
+	}
+      else if (func & 2)  // step
+	{
+	  // step
+	  // tell CPU to do next instruction
+	  cpu.step();
+	  rfp.add=cpu.pc;
+	  rfp.dat=ram.read(rfp.add);
+	  // could do dumps etc conditionally on tracing 
+	  if (tracing) cpu.dump();
+	  while (rfp.getSWFunc()&2);  // wait for release
+	}
+      else if (func & 4)   // examine
+	{
+	  // examine
+	  unsigned hi, lo;
+	  hi=rfp.getSWHigh();
+	  lo=rfp.getSWLow();
+	  rfp.add=(hi<<8)+lo;
+	  rfp.dat=ram.read(rfp.add);
+	  // could do dumps etc
+	  while (rfp.getSWFunc()&4);  // wait for release
+	}
+      else if (func & 8)  
+	{
+	  // ex next
+	  rfp.dat=ram.read(++rfp.add);
+	  while (rfp.getSWFunc()&8);  // wait for release
+	}
+      else if (func & 16)
+	{
+	  // deposit
+	  ram.write(rfp.add,rfp.dat=rfp.getSWLow());
+	  while (rfp.getSWFunc()&16);  // wait for release
+	}
+      else if (func & 32)
+	{
+	  // dep next
+	  ram.write(++rfp.add,rfp.dat=rfp.getSWLow());
+	  while (rfp.getSWFunc()&32);  // wait for release
+	}
+    }
+}
+
+      
+
+
+      
+
+      
+
+
+
+
+
+
+
@@ -0,0 +1,93 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __MACHINE_H
+#define __MACHINE_H
+
+#include "iobase.h"
+#include "rfp.h"
+#include "ram.h"
+#include "cpu.h"
+#include "breakpoint.h"
+#include "throttle.h"
+#include "contterm.h"
+
+// One whole Altair: streams, front panel, memory, CPU, breakpoints,
+// and control terminal. Nothing in here is shared with any other
+// machine, so a process can run as many as it likes (on as many
+// threads as it likes). The only thing a process can have just
+// one of is a real front panel on a serial port
+class Machine
+{
+ public:
+  iostreams io;  // console, trace, etc. (empty until somebody adds them)
+  RFP rfp;   // front panel
+  RAM ram;
+  CPU cpu;
+  breakpoint bps[27];  // note one extra for private use
+  throttle pace;  // run speed
+  contterm term;  // control terminal
+  // how run() behaves (the command line sets these from options)
+  int runonly;  // ignore the front panel switches and just run
+  int forcetrace;  // trace regardless of the protect switch
+  unsigned skip;  // LED updates to skip while running
+  // While running, the CPU does quantum instructions between looks
+  // at the front panel and the control terminal's switches (and
+  // the LEDs get the address then). quantum doubles or halves to
+  // keep the looks about LATENCY milliseconds apart: a panel on a
+  // serial line costs a round trip, so it pays to look no more
+  // often than a person can notice
+  enum { LATENCY=10, QMIN=16, QMAX=1<<20 };
+  unsigned quantum;
+  // and every FLUSH seconds it starts persistent memory (RAM::persist)
+  // on its way to its files
+  enum { FLUSH=1 };
+  double flushed;
+  // PC breakpoints (breakpoint::pcstop) the quantum stops at
+  unsigned char stopmap[0x10000/8];
+  unsigned stopat[27], nstop;
+  // port is the front panel's serial port (NULL for none)
+  Machine(char *port=NULL, unsigned memsize=0x10000);
+  int isReady(void) { return rfp.isReady(); }
+  // Set up the memory map from a list like 
+  // rom:0000-1FFF=8kbas.bin,none:8000-EFFF,io:F000-F0FF
+  // Each entry is ram, rom, none, or io (the I/O ports, with the 
+  // port in the low byte of the address) and a range in hex; a 
+  // file after = is loaded at the start of the range first. nv is
+  // RAM kept in the file after = (see RAM::persist). Later entries
+  // win. Returns 0 (and says why) if it can't read it
+  int layout(const char *spec);
+  // Set up bank switching from port:start-end (hex; see RAM::banks)
+  // Returns 0 (and says why) if it can't
+  int banking(const char *spec);
+  // the main loop: follow the front panel (or the control
+  // terminal's virtual switches) forever
+  void run(void);
+ protected:
+  int watched(int tracing);
+  int arm(int &armed);
+  int stopping(unsigned a) { return stopmap[a>>3]&(1<<(a&7)); }
+};
+
+#endif
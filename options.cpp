@@ -1,5 +1,6 @@
 #include "options.h"
 #include "iobase.h"
+#include "cpumodel.h"
 #include <stdlib.h>
 #include <string.h>
 #include <getopt.h>
@@ -15,9 +16,27 @@ int baudselect=0;
  unsigned options::memsize=0x10000;
  int options::upper=0;
  int options::softonly=1;
+ int options::refcore=0;
+ int options::lazyflags=0;
+ int options::nocache=0;
+ int options::nosuper=0;
+ int options::jit=0;
+ char options::aot[1024];
+ unsigned options::speed=0;
+ int options::model=I8080;
+ unsigned options::lanes=0;
+ unsigned long long options::laneinstr=10000000;
+ char options::batch[1024];
+ unsigned options::workers=0;
+ char options::zygote[1024];
+ char options::warmup[1024];
+ char options::warmmark[1024];
   // need to make these smarter instead of just large
  char options::fn[1024];
  char options::port[1024];
+ char options::profile[1024];
+ char options::memmap[1024];
+ char options::banking[1024];
  int options::killchar=-1;
  int options::cstream;
  char options::tstream[1024];
@@ -28,7 +47,7 @@ int baudselect=0;
 int options::process_options(int argc, char *argv[])
 {
   int c;
-  *estream=*tstream=*dstream=*port=*fn='\0';
+  *estream=*tstream=*dstream=*port=*fn=*profile=*aot=*batch=*zygote=*warmup=*warmmark=*memmap=*banking='\0';
   xstream=cstream=0;
   // no command line?
   if (argc==1)
@@ -37,7 +56,7 @@ int options::process_options(int argc, char *argv[])
       fprintf(stderr,
 "altairrfp " VERSION_STRING " by Al Williams http://www.hotsolder.com\n"
 "Usage: altairrfp [-p port_name] [-b baudcode] [-l skipupdates] [-m memorysize] [-r] [-t] [-k char]\n"
-"[-u] [-f load_file] [-C telnetport] [-E stream] [-T stream] [-D stream] [-X telnetport]\n"
+"[-u] [-s] [-z] [-d] [-F] [-J] [-A personality] [-S speed] [-M model] [-L lanes[:instructions]] [-B manifest[:workers]] [-Z socket [-w input] [-W marker]] [-P profile] [-R memory_map] [-K port:start-end] [-f load_file] [-C telnetport] [-E stream] [-T stream] [-D stream] [-X telnetport]\n"
 	      "\tskipupdates: Skips updating LEDs in run mode to speed execution\n"
 	      "\tmemorysize: RAM size in decimal (default=65536)\n"
 	      "\t-r forces the CPU to run and ignores front panel switches (faster execution)\n"
@@ -45,6 +64,20 @@ int options::process_options(int argc, char *argv[])
 	      "\t-p Sets port name to use for remote front panel\n"
 	      "\tbaudcodes: 0=>9600, 1=>19200, 2=>57k, 3=>115k; default=0\n"
 	      "\t-u forces input to uppercase\n"
+	      "\t-s uses the reference (switch-based) CPU engine instead of the table-driven one\n"
+	      "\t-z evaluates flags lazily in the table-driven engine\n"
+	      "\t-d turns off the decoded instruction cache in the table-driven engine\n"
+	      "\t-F turns off superinstructions (fused opcode pairs) in the cache\n"
+	      "\t-J translates 8080 code to native code where it can (x86-64 only; off while tracing or with breakpoints set)\n"
+	      "\t-A runs the recompiled code built in for the image (see altairaot; -A ? lists them)\n"
+	      "\t-S paces the CPU to speed times a real 2 MHz Altair (1 is authentic; default 0 is as fast as possible)\n"
+	      "\t-M sets the CPU model: 8080 (default), 8085, or z80 (-s, -J, -A, and superinstructions are 8080 only)\n"
+	      "\t-L runs the load file on that many lanes at once for the given number of instructions each (default 10000000), then checks lane 0 against the table engine and reports the speed (8080, polled console only)\n"
+	      "\t-B runs the jobs in manifest headless on workers threads (default one per host CPU) and writes a summary (see batch.h for the manifest; the JIT is not used)\n"
+	      "\t-Z boots the load file once, typing input (-w) until the console shows marker (-W) or waits for more, then forks a copy from there for each job sent to the Unix socket (see zygote.h; input and marker are written as in a -B manifest)\n"
+	      "\t-P counts opcode pairs and writes the most common ones to profile at exit (copy it to superops.h and rebuild to use it)\n"
+	      "\t-R lays out memory as a comma separated list of ram, rom, none, or io (the I/O ports, port number in the low byte) with a hex range and maybe a file to load there, like rom:0000-1FFF=8kbas.bin,none:8000-EFFF,io:F000-F0FF (256 byte pages; later entries win; the JIT and the fastest memory path need it all RAM); nv:start-end=file is RAM kept in file (whole host pages)\n"
+	      "\t-K switches banks of the memory past 64K (see -m) into the window start-end when the program writes the bank number to port (all hex; bank 0 is the first 64K; no JIT or recompiled code)\n"
 	      "\t-k sets a character used to exit the emulator\n"
 	      "\t-C sets the console telnet port (if omitted, the standard I/O is used)\n"
 	      "\t-E -T -D - sets the error, trace, and debug streams. All of these default to the console. If the argument is numeric it is taken as a telnet port. If the argument is a string, it is taken as a file name. Existing files will be overwritten.\n"
@@ -55,7 +88,7 @@ int options::process_options(int argc, char *argv[])
     }
   // process options
   opterr = 0;
-  while ((c = getopt (argc, argv, "k:p:rtb:l:m:hf:uC:T:D:E:X:")) != -1)
+  while ((c = getopt (argc, argv, "k:p:rstb:l:m:hf:uzdFJA:S:M:L:B:Z:w:W:P:R:K:C:T:D:E:X:")) != -1)
          switch (c)
            {
 	   case 'E':
@@ -99,6 +132,87 @@ int options::process_options(int argc, char *argv[])
 	   case 'u':
 	     upper=1;
 	     break;
+
+	   case 's':
+	     refcore=1;
+	     break;
+
+	   case 'z':
+	     lazyflags=1;
+	     break;
+
+	   case 'd':
+	     nocache=1;
+	     break;
+
+	   case 'F':
+	     nosuper=1;
+	     break;
+
+	   case 'J':
+	     jit=1;
+	     break;
+
+	   case 'A':
+	     strcpy(aot,optarg);
+	     break;
+
+	   case 'S':
+	     speed=atoi(optarg);
+	     break;
+
+	   case 'M':
+	     if (!strcmp(optarg,"8080")) model=I8080;
+	     else if (!strcmp(optarg,"8085")) model=I8085;
+	     else if (!strcmp(optarg,"z80") || !strcmp(optarg,"Z80")) model=Z80;
+	     else goto help;
+	     break;
+
+	   case 'L':
+	     {
+	       char *colon;
+	       lanes=strtoul(optarg,&colon,0);
+	       if (*colon==':') laneinstr=strtoull(colon+1,NULL,0);
+	       if (!lanes) goto help;
+	     }
+	     break;
+
+	   case 'B':
+	     {
+	       char *colon;
+	       strcpy(batch,optarg);
+	       // a Windows path has a colon after the drive letter
+	       if ((colon=strrchr(batch,':')) && colon>batch+1)
+		 {
+		   *colon='\0';
+		   workers=atoi(colon+1);
+		 }
+	     }
+	     break;
+
+	   case 'Z':
+	     strcpy(zygote,optarg);
+	     break;
+
+	   case 'w':
+	     strcpy(warmup,optarg);
+	     break;
+
+	   case 'W':
+	     strcpy(warmmark,optarg);
+	     break;
+
+	   case 'P':
+	     strcpy(profile,optarg);
+	     break;
+
+	   case 'R':
+	     strcpy(memmap,optarg);
+	     break;
+
+	   case 'K':
+	     strcpy(banking,optarg);
+	     break;
 	     
            case 'b':
              baud=atoi(optarg);
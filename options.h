@@ -25,6 +25,24 @@ class options
   static unsigned memsize;  // RAM size
   static int upper;  // force terminal to upper case
   static int softonly;  // no front panel?
+  static int refcore;  // -s use the reference (switch) CPU engine
+  static int lazyflags;  // -z compute flags only when something reads them
+  static int nocache;  // -d don't cache decoded instructions
+  static int nosuper;  // -F don't use superinstructions
+  static int jit;  // -J translate to native code
+  static char aot[1024];  // -A recompiled personality to run
+  static unsigned speed;  // -S times the speed of a real Altair (0=no limit)
+  static int model;  // -M CPU model (cpumodels)
+  static unsigned lanes;  // -L run this many copies side by side (0=off)
+  static unsigned long long laneinstr;  // -L instructions per lane
+  static char batch[1024];  // -B run the jobs in this manifest
+  static unsigned workers;  // -B threads to run them on (0=one per host CPU)
+  static char zygote[1024];  // -Z fork a warm machine per job from this socket
+  static char warmup[1024];  // -w what to type to warm up
+  static char warmmark[1024];  // -W what the console shows when warm
+  static char profile[1024];  // -P write an opcode pair profile here at exit
+  static char memmap[1024];  // -R memory map (see Machine::layout)
+  static char banking[1024];  // -K bank switching port and window (see Machine::banking)
   // need to make these smarter instead of just large
   static char fn[1024];  // load file name
   static char port[1024];  // front panel port
@@ -26,7 +26,7 @@ Altairrfp (c) 2011 by Al Williams.
 
 // Stream that is an output file (no input)
 
-outfile::outfile(streamtype type, const char *fn) : iobase(type)
+outfile::outfile(iostreams &set, streamtype type, const char *fn) : iobase(set,type)
 {
   fp=fopen(fn,"w");
 }
@@ -37,7 +37,7 @@ class outfile : public iobase
   int getchar(void)   { return -1;  }
   int ischar(void) { return 0; }
   void putchar(int c);
-  outfile(streamtype type, const char *fn);
+  outfile(iostreams &set, streamtype type, const char *fn);
   virtual ~outfile();
 };
 
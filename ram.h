@@ -25,17 +25,240 @@ Altairrfp (c) 2011 by Al Williams.
 #ifndef __RAM_H
 #define __RAM_H
 #include <stdio.h>
+#include <string.h>
+#include <new>
 #include "iobase.h"
 #include "rfp.h"
+#include "jit.h"
+#include "aot.h"
+#if !defined(WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <pthread.h>
+#define MAPIMAGES
+#endif
 
 // Class representing memory (no implementation file at all)
+// Where the host has mmap, memory is an anonymous mapping and load()
+// maps the whole pages of an image file over it copy on write, so 
+// every machine in the process that loads the same image shares its
+// pages until one of them writes a page and gets its own copy. The
+// pages come from a private snapshot of the file (see snapshot()),
+// not the file itself, so changing or truncating the file later 
+// can't reach into memory. Anything that isn't a whole page (or
+// isn't page aligned) is read in as usual
+// persist() maps a file over a range shared instead, so what the
+// program writes there ends up in the file (like battery backed
+// RAM); flush() pushes it out. Without mmap the range is read from
+// the file at the start and written back by flush(1)
+// Memory past 64K is for bank switching (see banks()): a window of
+// the address space shows one bank at a time, and switching just
+// repoints the window's pages, so it costs the same whatever the 
+// banks hold. load(), save(), and persist() take offsets into all
+// of memory: bank 0 is the first 64K and bank n (n>0) starts at
+// 0x10000+(n-1) times the window size
+// The CPU sees memory through a map of 256 byte pages (see map()):
+// each page is RAM, ROM (writes are ignored), nothing (reads FF), 
+// or a device. RAM and ROM pages are just a pointer into memory,
+// which always covers the whole 64K address space (more if len
+// is bigger) whatever the map says
+
+// A device that answers for pages of memory (see RAM::map)
+class mapped
+{
+ public:
+  virtual ~mapped() {}
+  virtual unsigned memread(unsigned a)=0;
+  virtual void memwrite(unsigned a, unsigned v)=0;
+};
+
+// Something that wants to hear about writes that change memory it
+// watches (see RAM::watch). Returns 1 if it wants whoever runs the
+// CPU to stop and look (RAM::tripped)
+class watcher
+{
+ public:
+  virtual ~watcher() {}
+  virtual int changed(unsigned a, unsigned old, unsigned v)=0;
+};
+
+// Memory access policies for the table engine (see RAM::get and 
+// RAM::put; CPU::setmodel picks the handlers built for one)
+// panelmem does what read() and write() always have: each access 
+// goes to the front panel LEDs and through the map. fastmem is for
+// a map that is all RAM with no front panel: no LED bookkeeping and
+// no map, just the address masked to 16 bits. quietmem is read() 
+// and write() with setled 0: the map but no LEDs and no devices, 
+// so debuggers and loaders can look without side effects
+struct panelmem { enum { LEDS=1, WRAP=0, DEVICES=1 }; };
+struct fastmem { enum { LEDS=0, WRAP=1, DEVICES=0 }; };
+struct quietmem { enum { LEDS=0, WRAP=0, DEVICES=0 }; };
 
 class RAM
 {
+  friend class JIT;
  protected:
   unsigned len;
+  unsigned size;  // bytes at memory (len but at least 64K)
   unsigned char *memory;
   RFP& rfp;
+  // the map (rdpage and wrpage are NULL where the page isn't 
+  // RAM or ROM; see map())
+  unsigned char *rdpage[256], *wrpage[256];
+  mapped *device[256];
+  unsigned char pagekind[256];
+  int flat;  // every page is RAM
+#if defined(MAPIMAGES)
+  unsigned pagesize, maplen;  // host page size; memory rounded up to it
+  unsigned char *filepage;  // each host page: 1 if load() mapped it, 2 if persist() did
+  // A copy of the first bytes (whole pages) of the open file fd 
+  // that nobody else can get at, to map images from: a file mapped
+  // straight shows later edits to pages nobody wrote, and 
+  // truncating it kills us. There is one for each version of a file
+  // (as fstat tells them apart) shared by every machine in the 
+  // process. Returns -1 if it can't
+  static int snapshot(int fd, const struct stat &st, unsigned bytes)
+  {
+    static struct snap
+    {
+      dev_t dev;
+      ino_t ino;
+      off_t size;
+      time_t mtime, ctime;
+      unsigned bytes;
+      int fd;
+    } snaps[16];
+    static unsigned nsnaps, next;
+    static pthread_mutex_t lock=PTHREAD_MUTEX_INITIALIZER;
+    int sfd=-1;
+    pthread_mutex_lock(&lock);
+    for (unsigned i=0;i<nsnaps;i++)
+      {
+	snap &s=snaps[i];
+	if (s.dev==st.st_dev && s.ino==st.st_ino && s.size==st.st_size && s.mtime==st.st_mtime 
+	    && s.ctime==st.st_ctime && s.bytes>=bytes)
+	  {
+	    sfd=s.fd;
+	    break;
+	  }
+      }
+    if (sfd<0)
+      {
+#if defined(__linux__)
+	sfd=memfd_create("altairimage",MFD_CLOEXEC);
+#else
+	char tmpl[]="/tmp/altairimageXXXXXX";
+	if ((sfd=mkstemp(tmpl))>=0) unlink(tmpl);
+#endif
+	unsigned char *p=NULL;
+	unsigned done=0;
+	if (sfd>=0 && !ftruncate(sfd,bytes) 
+	    && (p=(unsigned char *)mmap(NULL,bytes,PROT_READ|PROT_WRITE,MAP_SHARED,sfd,0))!=MAP_FAILED)
+	  {
+	    ssize_t got;
+	    while (done<bytes && (got=pread(fd,p+done,bytes-done,done))>0) done+=got;
+	    munmap(p,bytes);
+	  }
+	if (done<bytes)  // the file got shorter or something went wrong
+	  {
+	    if (sfd>=0) close(sfd);
+	    sfd=-1;
+	  }
+	else
+	  {
+	    // the oldest goes (machines that mapped it keep its pages)
+	    if (nsnaps<sizeof(snaps)/sizeof(snaps[0])) next=nsnaps++;
+	    else 
+	      {
+		next=(next+1)%nsnaps;
+		close(snaps[next].fd);
+	      }
+	    snap &s=snaps[next];
+	    s.dev=st.st_dev;
+	    s.ino=st.st_ino;
+	    s.size=st.st_size;
+	    s.mtime=st.st_mtime;
+	    s.ctime=st.st_ctime;
+	    s.bytes=bytes;
+	    s.fd=sfd;
+	  }
+      }
+    pthread_mutex_unlock(&lock);
+    return sfd;
+  }
+  // map bytes of the open file fd at off (returns how many it did)
+  unsigned mapimage(int fd, unsigned off, unsigned bytes)
+  {
+    if (off%pagesize) return 0;
+    struct stat st;
+    int sfd;
+    if (fstat(fd,&st)<0 || !S_ISREG(st.st_mode)) return 0;
+    if ((unsigned long long)st.st_size<bytes) bytes=st.st_size;
+    bytes-=bytes%pagesize;
+    // loading into a persistent range has to go to its file
+    for (unsigned p=off/pagesize;p<(off+bytes)/pagesize;p++) 
+      if (filepage[p]==2) return 0;
+    if (!bytes || (sfd=snapshot(fd,st,bytes))<0 
+	|| mmap(memory+off,bytes,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_FIXED,sfd,0)==MAP_FAILED) 
+      return 0;
+    for (unsigned p=off/pagesize;p<(off+bytes)/pagesize;p++) filepage[p]=1;
+    return bytes;
+  }
+#endif
+  // persistent ranges (see persist())
+  enum { MAXPERSIST=8 };
+  struct region
+  {
+    char *fn;
+    unsigned off, bytes;
+  } persistent[MAXPERSIST];
+  unsigned npersist;
+  // watchpoints (see watch())
+  // The control terminal sets these up while the CPU thread reads
+  // them, so a slot belongs to one watcher for good (who never
+  // changes once set) and is only looked at while on is set; 
+  // watch() fills the slot in before it publishes on and nwatch
+  enum { MAXWATCH=32 };
+  struct watchrange
+  {
+    unsigned start, end;
+    watcher *who;
+    int on;
+  } watches[MAXWATCH];
+  unsigned nwatch;  // slots ever used
+  unsigned char watchpage[256];  // how many watches cover each page
+  void written(unsigned a, unsigned old, unsigned v)
+  {
+    if (old==v) return;
+    unsigned n=__atomic_load_n(&nwatch,__ATOMIC_ACQUIRE);
+    for (unsigned i=0;i<n;i++)
+      if (__atomic_load_n(&watches[i].on,__ATOMIC_ACQUIRE) && a>=watches[i].start 
+	  && a<=watches[i].end && watches[i].who->changed(a,old,v)) tripped=1;
+  }
+  // who's slot (or a new one; NULL if there's no room)
+  watchrange *slot(watcher *who, int make)
+  {
+    unsigned i;
+    for (i=0;i<nwatch;i++) if (watches[i].who==who) return watches+i;
+    if (!make || nwatch==MAXWATCH) return NULL;
+    watches[i].who=who;
+    watches[i].on=0;
+    __atomic_store_n(&nwatch,i+1,__ATOMIC_RELEASE);
+    return watches+i;
+  }
+  // bank switching (see banks())
+  unsigned winfirst, winpages;  // the window, in pages
+  unsigned nbanks, curbank;  // nbanks is 0 if there are none
+  // where page p of the address space is in memory for bank b
+  unsigned char *pagebase(unsigned p, unsigned b)
+  {
+    if (b && p>=winfirst && p<winfirst+winpages)
+      return memory+0x10000+((b-1)*winpages+p-winfirst)*256;
+    return memory+p*256;
+  }
   // set the front panel LEDs if possible
   void setstatus(unsigned a, unsigned status=0xFF) 
   {
@@ -44,38 +267,333 @@ class RAM
     rfp.setAhigh(a>>8); 
     rfp.setAlow(a&0xFF); 
     if (status!=0xFF) rfp.setLED(status);
-    rfp.setDB(a<len?memory[a]:0xFF);
+    rfp.setDB(get<quietmem>(a));
   }
   
  public:
   unsigned getlen(void)  { return len; }
- RAM(RFP &r, unsigned siz=0x10000, char *filen=NULL) : rfp(r) { memory=new unsigned char[len=siz]; statusct=0;  statusskip=0;
+ RAM(RFP &r, unsigned siz=0x10000, char *filen=NULL) : rfp(r) { 
+    len=siz;
+    size=len>0x10000?len:0x10000;
+#if defined(MAPIMAGES)
+    pagesize=sysconf(_SC_PAGESIZE);
+    maplen=(size+pagesize-1)/pagesize*pagesize;
+    memory=(unsigned char *)mmap(NULL,maplen,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+    if (memory==MAP_FAILED) throw std::bad_alloc();
+    filepage=new unsigned char[maplen/pagesize];
+    memset(filepage,0,maplen/pagesize);
+#else
+    memory=new unsigned char[size]();  // zero, like fresh anonymous pages
+#endif
+    statusct=0;  statusskip=0;  npersist=0;  nwatch=0;  tripped=0;
+    memset(watchpage,0,sizeof(watchpage));
+    memset(watches,0,sizeof(watches));
+    nbanks=curbank=0;  bankport=-1;
+    codemap=NULL; codeinval=0; jitmap=NULL; jit=NULL; aotmap=NULL; aot=NULL;
+    // RAM up to len (a partial page counts) and nothing above
+    map(0,0xFFFF,PG_NONE);
+    if (len) map(0,(len>0x10000?0x10000:len)-1,PG_RAM);
     if  (filen) load(filen);  };
-  ~RAM() { delete memory; }
+  ~RAM() 
+  { 
+    flush(1);
+    for (unsigned i=0;i<npersist;i++) delete [] persistent[i].fn;
+#if defined(MAPIMAGES)
+    munmap(memory,maplen);
+    delete [] filepage;
+#else
+    delete [] memory; 
+#endif
+  }
   // track infrequent updates
   unsigned statusct;
   unsigned statusskip;
-  void load(const char *filen,unsigned off=0, unsigned flen=0xFFFF)   // todo: more error checking
+  // If set, one byte per address holding the length of the
+  // instruction the CPU has decoded there (0 if none). A write
+  // clears any instruction that covers the byte (see CPU::exec)
+  // Superinstructions cover two instructions so up to 6 bytes
+  unsigned char *codemap;
+  unsigned long long codeinval;  // how many decoded instructions writes killed
+  void invalidate(unsigned a)
+  {
+    for (unsigned i=0;i<6;i++)
+      if (codemap[(a-i)&0xFFFF]>i) 
+	{
+	  codemap[(a-i)&0xFFFF]=0;
+	  codeinval++;
+	}
+  }
+  // If set, bytes the JIT has translated are marked here
+  unsigned char *jitmap;
+  JIT *jit;
+  // Same for bytes recompiled code depends on
+  unsigned char *aotmap;
+  AOT *aot;
+  // Memory map
+  // Pages from start to end (rounded out to whole pages) become 
+  // kind; a PG_DEVICE range goes to dev (returns 0 for a bad range)
+  enum pagekinds { PG_RAM=0, PG_ROM, PG_NONE, PG_DEVICE };
+  int map(unsigned start, unsigned end, int kind, mapped *dev=NULL)
+  {
+    if (start>end || end>0xFFFF || kind<PG_RAM || kind>PG_DEVICE || (kind==PG_DEVICE && !dev)) return 0;
+    for (unsigned p=start>>8;p<=end>>8;p++)
+      {
+	pagekind[p]=kind;
+	rdpage[p]=kind==PG_RAM || kind==PG_ROM?pagebase(p,curbank):NULL;
+	wrpage[p]=kind==PG_RAM?pagebase(p,curbank):NULL;
+	device[p]=kind==PG_DEVICE?dev:NULL;
+      }
+    flat=1;
+    for (unsigned p=0;p<256;p++) if (pagekind[p]!=PG_RAM) flat=0;
+    return 1;
+  }
+  int kindof(unsigned a) { return pagekind[(a>>8)&0xFF]; }
+  int isflat(void) { return flat && !nbanks; }  // all RAM (so memory is the whole story)
+  // Bank switching
+  // Pages from start to end become a window onto as many banks as 
+  // the memory past 64K holds (plus bank 0 in the first 64K). An OUT
+  // to port picks the bank (-1 for no port). Returns the number of
+  // banks, 0 if there's not room for at least two
+  int banks(unsigned start, unsigned end, int port)
+  {
+    if (start>end || end>0xFFFF || size<=0x10000) return 0;
+    unsigned first=start>>8, pages=(end>>8)-first+1;
+    unsigned n=1+(size-0x10000)/(pages*256);
+    if (n<2) return 0;
+    bank(0);
+    winfirst=first;
+    winpages=pages;
+    nbanks=n;
+    bankport=port;
+    return nbanks;
+  }
+  int bankport;  // the port that switches banks (-1 for none)
+  unsigned getbanks(void) { return nbanks; }
+  unsigned getbank(void) { return curbank; }
+  unsigned windowstart(void) { return winfirst*256; }
+  unsigned windowend(void) { return (winfirst+winpages)*256-1; }
+  // Show bank n in the window (out of range numbers are ignored)
+  void bank(unsigned n)
+  {
+    if (n>=nbanks || n==curbank) return;
+    curbank=n;
+    for (unsigned p=winfirst;p<winfirst+winpages;p++)
+      {
+	if (rdpage[p]) rdpage[p]=pagebase(p,n);
+	if (wrpage[p]) wrpage[p]=pagebase(p,n);
+      }
+    // decoded instructions in (or running into) the window are 
+    // the old bank's
+    if (codemap)
+      {
+	unsigned a=winfirst*256, end=a+winpages*256;
+	a=a>5?a-5:0;
+	memset(codemap+a,0,end-a);
+      }
+  }
+  // Watchpoints
+  // Writes from start to end that change a byte go to who (only 
+  // pages somebody watches cost anything, and only on a write).
+  // A watcher has one range; this replaces any it had. Returns 0 
+  // if there's no room. Safe to call while the CPU runs
+  int watch(unsigned start, unsigned end, watcher *who)
+  {
+    watchrange *w;
+    if (start>end || end>0xFFFF) return 0;
+    unwatch(who);
+    if (!(w=slot(who,1))) return 0;
+    w->start=start;
+    w->end=end;
+    for (unsigned p=start>>8;p<=end>>8;p++) watchpage[p]++;
+    __atomic_store_n(&w->on,1,__ATOMIC_RELEASE);
+    return 1;
+  }
+  // stop telling who about anything
+  void unwatch(watcher *who)
+  {
+    watchrange *w=slot(who,0);
+    if (!w || !w->on) return;
+    __atomic_store_n(&w->on,0,__ATOMIC_RELEASE);
+    for (unsigned p=w->start>>8;p<=w->end>>8;p++) watchpage[p]--;
+  }
+  int tripped;  // a watcher wanted to stop (whoever runs the CPU clears it)
+  // Byte at a as bank n sees it (no devices)
+  unsigned peek(unsigned n, unsigned a)
+  {
+    a&=0xFFFF;
+    if (n>=nbanks || a<winfirst*256 || a>=(winfirst+winpages)*256) return get<quietmem>(a);
+    return rdpage[a>>8]?pagebase(a>>8,n)[a&0xFF]:0xFF;
+  }
+  // returns 0 if the file isn't there
+  // (or can't be read)
+  int load(const char *filen,unsigned off=0, unsigned flen=0xFFFF)
   {
            FILE *f=fopen(filen,"rb");
-	   if (!f) 
+	   if (!f || off>=size) 
 	     {
-	       iobase::printf(iobase::ERROROUT,"Failed to read %s\n",filen);
-	       return;
+	       rfp.io.printf(iobase::ERROROUT,"Failed to read %s\n",filen);
+	       if (f) fclose(f);
+	       return 0;
 	     }
-	   int dbg=fread(memory+off,len>flen?flen:len,1,f);
+	   unsigned n=size-off>flen?flen:size-off, done=0;
+#if defined(MAPIMAGES)
+	   if ((done=mapimage(fileno(f),off,n))) fseek(f,done,SEEK_SET);
+#endif
+	   // a file shorter than n is fine
+	   int bad=fread(memory+off+done,1,n-done,f)<n-done && ferror(f);
            fclose(f);
+	   if (codemap) memset(codemap,0,0x10000);
+	   if (jit) jit->flush();
+	   if (aot) aot->flush();
+	   if (bad) rfp.io.printf(iobase::ERROROUT,"Failed to read %s\n",filen);
+	   return !bad;
   }
-  void save(const char *filen, unsigned off=0, unsigned flen=0xFFFF)
+  // Keep bytes at off in the file (made that long if it is 
+  // shorter; off and bytes must be multiples of the host page size
+  // where there is mmap). Returns 0 if it can't
+  int persist(const char *filen, unsigned off, unsigned bytes)
   {
+    if (npersist==MAXPERSIST || !bytes || off>=size || bytes>size-off) return 0;
+#if defined(MAPIMAGES)
+    if (off%pagesize || bytes%pagesize) return 0;
+    int fd=open(filen,O_RDWR|O_CREAT,0666);
+    struct stat st;
+    if (fd<0) return 0;
+    if (fstat(fd,&st)<0 || ((unsigned long long)st.st_size<bytes && ftruncate(fd,bytes)<0) ||
+	mmap(memory+off,bytes,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_FIXED,fd,0)==MAP_FAILED)
+      {
+	close(fd);
+	return 0;
+      }
+    close(fd);  // the mapping keeps the file
+    for (unsigned p=off/pagesize;p<(off+bytes)/pagesize;p++) filepage[p]=2;
+#else
+    FILE *f=fopen(filen,"rb");
+    if (f)
+      {
+	fread(memory+off,1,bytes,f);
+	fclose(f);
+      }
+#endif
+    region &r=persistent[npersist++];
+    r.fn=new char[strlen(filen)+1];
+    strcpy(r.fn,filen);
+    r.off=off;
+    r.bytes=bytes;
+    if (codemap) memset(codemap,0,0x10000);
+    if (jit) jit->flush();
+    if (aot) aot->flush();
+    return 1;
+  }
+  // Write the persistent ranges out: wait=0 just starts it (and 
+  // does nothing without mmap), 1 finishes it. Returns 0 if any failed
+  int flush(int wait=0)
+  {
+    int ok=1;
+    for (unsigned i=0;i<npersist;i++)
+      {
+	region &r=persistent[i];
+#if defined(MAPIMAGES)
+	if (msync(memory+r.off,r.bytes,wait?MS_SYNC:MS_ASYNC)<0) ok=0;
+#else
+	if (wait && !save(r.fn,r.off,r.bytes)) ok=0;
+#endif
+      }
+    return ok;
+  }
+  unsigned persists(void) { return npersist; }
+  // Of the pages load() mapped from files, how many are still
+  // shared and how many have been written (so they are private
+  // now). Returns 0 if the host can't say
+  int sharing(unsigned *shared, unsigned *priv)
+  {
+    *shared=*priv=0;
+#if defined(MAPIMAGES) && defined(__linux__)
+    // pagemap has 64 bits for each page: bit 61 is set for a page
+    // of a file, clear for an anonymous (copied) one; 62 and 63 
+    // are swapped and present (neither means never touched)
+    int fd=open("/proc/self/pagemap",O_RDONLY);
+    if (fd<0) return 0;
+    for (unsigned p=0;p<maplen/pagesize;p++)
+      {
+	unsigned long long e;
+	if (filepage[p]!=1) continue;
+	if (pread(fd,&e,sizeof(e),(off_t)((size_t)(memory+p*pagesize)/pagesize*sizeof(e)))!=sizeof(e))
+	  {
+	    close(fd);
+	    return 0;
+	  }
+	if (!(e>>62) || (e>>61&1)) ++*shared;
+	else ++*priv;
+      }
+    close(fd);
+    return 1;
+#else
+    return 0;
+#endif
+  }
+  // returns 0 (and says so) if it can't write it all
+  // Where there is mmap this writes a new file and renames it over
+  // filen, so the old one (which may be mapped somewhere) is never
+  // cut short and a failed save leaves it as it was
+  int save(const char *filen, unsigned off=0, unsigned flen=0xFFFF)
+  {
+    unsigned n=off<size?(size-off>flen?flen:size-off):0;
+#if defined(MAPIMAGES)
+    char *tmp=new char[strlen(filen)+8];
+    struct stat st;
+    int fd;
+    FILE *f=NULL;
+    sprintf(tmp,"%s.XXXXXX",filen);
+    if ((fd=mkstemp(tmp))>=0)
+      {
+	// keep the old file's permissions (mkstemp makes it private)
+	fchmod(fd,stat(filen,&st)==0?(st.st_mode&07777):0644);
+	if (!(f=fdopen(fd,"wb"))) close(fd);
+      }
+#else
     FILE *f=fopen(filen,"wb");
-    fwrite(memory+off,len>flen?flen:len,1,f);
-    fclose(f);
+#endif
+    int ok=f && fwrite(memory+off,1,n,f)==n;
+    if (f && fclose(f)) ok=0;
+#if defined(MAPIMAGES)
+    if (ok && rename(tmp,filen)<0) ok=0;
+    if (!ok && fd>=0) unlink(tmp);
+    delete [] tmp;
+#endif
+    if (!ok) rfp.io.printf(iobase::ERROROUT,"Failed to write %s\n",filen);
+    return ok;
   }
   
   // todo set MR or MW leds
-  unsigned read(unsigned a,int setled=1) { if (setled) setstatus(a); return a<len?memory[a]:0xFF; }
-  void write(unsigned a, unsigned v, int setled=1) { if (a<len) memory[a]=v; if (setled) setstatus(a); } ;
+  unsigned read(unsigned a,int setled=1) { return setled?get<panelmem>(a):get<quietmem>(a); }
+  void write(unsigned a, unsigned v, int setled=1) { if (setled) put<panelmem>(a,v); else put<quietmem>(a,v); }
+  // The same with the policy fixed at compile time (fastmem only
+  // when the map is flat)
+  template<class P> unsigned get(unsigned a) 
+  { 
+    if (P::LEDS) setstatus(a); 
+    a&=0xFFFF;
+    if (P::WRAP) return memory[a];
+    unsigned char *p=rdpage[a>>8];
+    if (p) return p[a&0xFF];
+    return P::DEVICES && device[a>>8]?device[a>>8]->memread(a):0xFF;
+  }
+  template<class P> void put(unsigned a, unsigned v)
+  {
+    a&=0xFFFF;
+    unsigned char *p=P::WRAP?memory+(a&0xFF00):wrpage[a>>8];
+    if (p)
+      {
+	if (nwatch && watchpage[a>>8]) written(a,p[a&0xFF],v&0xFF);
+	p[a&0xFF]=v;
+	if (codemap) invalidate(a);
+	if (jitmap && jitmap[a]) jit->invalidate(a); 
+	if (aotmap && aotmap[a]) aot->invalidate(a); 
+      }
+    else if (P::DEVICES && device[a>>8]) device[a>>8]->memwrite(a,v);
+    if (P::LEDS) setstatus(a);
+  }
 };
 
 
@@ -36,11 +36,12 @@ extern "C"
 
 class RAM;
 class RFP;
+class Machine;
 
-#include "breakpoint.h"
-
+// The front panel (a real one on a serial port or none at all)
 class RFP 
 {
+  friend class Machine;
  protected:
   int ready;  // ready to go
   int soft;  // if 1, then software only
@@ -52,11 +53,11 @@ class RFP
   unsigned oldhadd;  // caches
   unsigned oldstat;  
  public:
-  RFP(char *port, int software=0);
+  RFP(iostreams &streams, char *port, int software=0);
   ~RFP();
-  iobase *io;
-  breakpoint bps[27];  // note one extra for private use
+  iostreams &io;  // the machine's streams
   int isReady(void)   { return ready;  }
+  int isSoft(void)  { return soft; }  // no front panel at all?
   unsigned getID(void);
   void setAhigh(unsigned a);
   void setAlow(unsigned a);
@@ -72,12 +73,6 @@ class RFP
   void releaseDB(void);
   // high level
   void setstate(void);  // set state
-  void execute(RAM& ram);  // execute an instruction
 };
 
-  
-// references for everyone
-extern CPU *thecpu;
-extern RFP *theRFP;
-  
 #endif
@@ -0,0 +1,96 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#include "scheduler.h"
+
+void scheduler::up(unsigned i)
+{
+  event e=heap[i];
+  while (i)
+    {
+      unsigned parent=(i-1)/2;
+      if (heap[parent].when<=e.when) break;
+      heap[i]=heap[parent];
+      i=parent;
+    }
+  heap[i]=e;
+}
+
+void scheduler::down(unsigned i)
+{
+  event e=heap[i];
+  while (1)
+    {
+      unsigned child=2*i+1;
+      if (child>=n) break;
+      if (child+1<n && heap[child+1].when<heap[child].when) child++;
+      if (e.when<=heap[child].when) break;
+      heap[i]=heap[child];
+      i=child;
+    }
+  heap[i]=e;
+}
+
+// take out entry i (the last one fills the hole)
+void scheduler::remove(unsigned i)
+{
+  if (--n!=i)
+    {
+      heap[i]=heap[n];
+      up(i);
+      down(i);
+    }
+  next=n?heap[0].when:NEVER;
+}
+
+int scheduler::at(unsigned long long when, timed *who, unsigned tag)
+{
+  if (n==MAXEVENTS) return 0;
+  heap[n].when=when;
+  heap[n].who=who;
+  heap[n].tag=tag;
+  up(n++);
+  next=heap[0].when;
+  return 1;
+}
+
+void scheduler::cancel(timed *who, unsigned tag)
+{
+  for (unsigned i=0;i<n;i++)
+    if (heap[i].who==who && heap[i].tag==tag)
+      {
+	remove(i);
+	return;
+      }
+}
+
+void scheduler::run(CPU &cpu, unsigned long long now)
+{
+  while (n && heap[0].when<=now)
+    {
+      event e=heap[0];
+      remove(0);
+      e.who->event(cpu,e.tag);
+    }
+}
@@ -0,0 +1,69 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __SCHEDULER_H
+#define __SCHEDULER_H
+
+class CPU;
+
+// A device that wants the CPU to call it back later
+class timed
+{
+ public:
+  virtual ~timed() {}
+  // tag is whatever the device passed to CPU::schedule
+  virtual void event(CPU &cpu, unsigned tag)=0;
+};
+
+// Device events keyed on CPU::tstates
+// The events sit in a binary min-heap so the CPU only has to
+// compare its clock against next until something is actually due
+// (see CPU::deadline)
+class scheduler
+{
+ protected:
+  struct event
+  {
+    unsigned long long when;
+    timed *who;
+    unsigned tag;
+  };
+  enum { MAXEVENTS=64 };
+  event heap[MAXEVENTS];
+  unsigned n;
+  void up(unsigned i);
+  void down(unsigned i);
+  void remove(unsigned i);
+ public:
+  static const unsigned long long NEVER=~0ULL;
+  unsigned long long next;  // when the first event is due (NEVER if none)
+  scheduler() { n=0; next=NEVER; }
+  // returns 0 if there is no room
+  int at(unsigned long long when, timed *who, unsigned tag=0);
+  void cancel(timed *who, unsigned tag);
+  // call everything due by now (events may schedule more)
+  void run(CPU &cpu, unsigned long long now);
+};
+
+#endif
@@ -0,0 +1,35 @@
+// Superinstructions (opcode pairs) for cpuops.cpp
+// Merged from altairrfp -P profiles of 8K BASIC, 16K BASIC and
+// Star Trek (each weighted the same). Counts are in the comments
+SUPER(0xDB,0xE6)   // 31344827
+SUPER(0xE6,0xCA)   // 31342905
+SUPER(0x1F,0x4F)   // 4741796
+SUPER(0x57,0x79)   // 4701731
+SUPER(0x1F,0x47)   // 4311156
+SUPER(0x1F,0x57)   // 4311156
+SUPER(0x78,0x1F)   // 4311156
+SUPER(0x6F,0x78)   // 3680826
+SUPER(0x4F,0x7C)   // 3629097
+SUPER(0x1D,0x7A)   // 3629096
+SUPER(0x1F,0x67)   // 3629096
+SUPER(0x1F,0x6F)   // 3629096
+SUPER(0x47,0x1D)   // 3629096
+SUPER(0x67,0x7D)   // 3629096
+SUPER(0x79,0xD2)   // 3629096
+SUPER(0x7A,0xC2)   // 3629096
+SUPER(0x7C,0x1F)   // 3629096
+SUPER(0x7D,0x1F)   // 3629096
+SUPER(0xD5,0x11)   // 1868568
+SUPER(0x11,0x19)   // 1844685
+SUPER(0x19,0xD1)   // 1844683
+SUPER(0xCE,0x1F)   // 1844683
+SUPER(0xD1,0xCE)   // 1844683
+SUPER(0xD2,0xD5)   // 1844683
+SUPER(0xB7,0xCA)   // 1323367
+SUPER(0x23,0x7E)   // 1287780
+SUPER(0x7A,0x17)   // 1067216
+SUPER(0x17,0x57)   // 1066539
+SUPER(0xEB,0xC9)   // 953293
+SUPER(0xEB,0x22)   // 940692
+SUPER(0x2D,0xC8)   // 918492
+SUPER(0xAF,0x2D)   // 918492
@@ -0,0 +1,60 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+/* An instruction that wraps from FFFF to 0000 has to run under the
+   JIT (it used to make an empty block the JIT went around forever).
+   MVI A,55 at FFFD starts a block the LXI at FFFF has to end, and
+   the LXI (its operand at 0000) starts the next one. 
+   Run by make check in linux */
+#include <stdio.h>
+#include <unistd.h>
+#include "altair.h"
+
+int main(void)
+{
+  static const unsigned char top[3]={ 0x3E, 0x55, 0x21 };  /* MVI A,55; LXI H,1234 */
+  static const unsigned char bottom[3]={ 0x34, 0x12, 0x76 };  /* ...; HLT */
+  altair *a=altair_create(0x10000);
+  if (!a) return 1;
+  if (!altair_jit(a,1))
+    {
+      printf("jitwrap: no JIT here\n");
+      return 0;
+    }
+  altair_writemem(a,0xFFFD,top,3);
+  altair_writemem(a,0x0000,bottom,3);
+  altair_setreg(a,"PC",0xFFFD);
+  alarm(5);  /* a hang is a failure */
+  altair_run(a,1000);
+  if (!altair_halted(a) || altair_getreg(a,"PC")!=2 || altair_getreg(a,"H")!=0x1234
+      || (altair_getreg(a,"A")>>8)!=0x55)
+    {
+      printf("jitwrap: FAIL pc=%04X hl=%04X af=%04X\n",altair_getreg(a,"PC"),
+	     altair_getreg(a,"H"),altair_getreg(a,"A"));
+      return 1;
+    }
+  altair_destroy(a);
+  printf("jitwrap: ok\n");
+  return 0;
+}
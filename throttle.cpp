@@ -0,0 +1,83 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#include "throttle.h"
+#if defined(WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// host clock in seconds
+double throttle::now(void)
+{
+#if defined(WIN32)
+  LARGE_INTEGER t, f;
+  QueryPerformanceCounter(&t);
+  QueryPerformanceFrequency(&f);
+  return (double)t.QuadPart/f.QuadPart;
+#else
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC,&t);
+  return t.tv_sec+t.tv_nsec*1e-9;
+#endif
+}
+
+void throttle::set(unsigned mult)
+{
+  hz=(unsigned long long)mult*CLOCK;
+  next=~0ULL;  // until restart()
+}
+
+void throttle::restart(unsigned long long tstates)
+{
+  if (!hz) return;
+  t0=tstates;
+  w0=now();
+  next=tstates+hz*QUANTUM/1000;
+}
+
+void throttle::wait(unsigned long long tstates)
+{
+  double ahead=(double)(tstates-t0)/hz-(now()-w0);
+  if (ahead<-SLACK/1000.0) 
+    {
+      restart(tstates);
+      return;
+    }
+  if (ahead>0) sleep(ahead);
+  next=tstates+hz*QUANTUM/1000;
+}
+
+void throttle::sleep(double secs)
+{
+#if defined(WIN32)
+  Sleep((DWORD)(secs*1000));
+#else
+  struct timespec t;
+  t.tv_sec=(time_t)secs;
+  t.tv_nsec=(long)((secs-t.tv_sec)*1e9);
+  nanosleep(&t,NULL);
+#endif
+}
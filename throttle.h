@@ -0,0 +1,60 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __THROTTLE_H
+#define __THROTTLE_H
+
+// Paces the CPU to a clock speed (-S on the command line)
+// The CPU counts T states; every QUANTUM worth of them we look
+// at the host clock and sleep off however far ahead we are, so
+// the host sees one sleep per QUANTUM instead of one per
+// instruction. If we fall more than SLACK behind (a slow host,
+// a breakpoint, somebody stopped the machine) we just start
+// timing over instead of racing to catch up
+class throttle
+{
+ protected:
+  unsigned long long hz;  // 0 means flat out
+  unsigned long long next;  // T state count to look at the clock again
+  unsigned long long t0;  // T state count when we started timing
+  double w0;  // and the host clock then (seconds)
+  void wait(unsigned long long tstates);
+ public:
+  enum { CLOCK=2000000 };  // a real Altair 8800 (2 MHz)
+  enum { QUANTUM=10, SLACK=100 };  // milliseconds
+  throttle() { hz=0; next=~0ULL; }
+  // host clock in seconds
+  static double now(void);
+  // give the host the CPU for a while (seconds)
+  static void sleep(double secs);
+  // mult times a real Altair (0 for no limit)
+  void set(unsigned mult);
+  unsigned getmult(void) { return hz/CLOCK; }
+  // (re)start timing from here
+  void restart(unsigned long long tstates);
+  // call after each exec(): cheap unless it is time to sleep
+  void pace(unsigned long long tstates) { if (tstates>=next) wait(tstates); }
+};
+
+#endif
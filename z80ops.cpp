@@ -0,0 +1,609 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+// Z80 engine (-M z80 on the command line)
+// The Z80 runs 8080 code, so its table (optablez80) starts from
+// the 8080 handlers and swaps in its own where the two differ:
+// the flag-setting instructions (the Z80 has overflow instead of
+// parity after arithmetic, plus N and H, and the undocumented bits
+// 3 and 5 follow the result), the relative jumps, the second
+// register set, and the CB, DD, ED, and FD prefixes. The prefix
+// handlers fetch the rest of the instruction themselves, so as far
+// as step() and exec() know those are one byte opcodes
+// Flags are always eager here (-z makes no difference)
+
+#include "cpuops.h"
+
+// Z80 flag bits (S, Z, and CY are where the 8080 has them and P/V 
+// is the 8080's P)
+enum z80flags { FC=0x01, FN=0x02, FV=0x04, FX=0x08, FH=0x10, FY=0x20, FZ=0x40, FS=0x80,
+		FXY=FX|FY, FSZ=FS|FZ };
+
+// R counts instruction fetches on a real Z80; we count T states
+// instead (about one per four) so nothing has to keep it up to date.
+// Programs only use it as a seed anyway. LD R,A stores the value
+// less the count so far (see x_ed)
+unsigned CPU::getR(void)
+{
+  return (rreg&0x80)|((rreg+(tstates>>2))&0x7F);
+}
+
+// ADD..CP on A
+inline void CPU::zalu(unsigned op, unsigned v)
+{
+  unsigned a=regs[A], r, f;
+  switch (op)
+    {
+    case 0:  // ADD
+    case 1:  // ADC
+      r=a+v+(op==1?(regs[F]&FC):0);
+      f=(ftab.szp[r&0xFF]&FSZ)|(r&FXY)|((a^v^r)&FH)|(((a^r)&(v^r)&0x80)>>5)|(r>>8);
+      break;
+    case 2:  // SUB
+    case 3:  // SBC
+    case 7:  // CP
+      r=(a-v-(op==3?(regs[F]&FC):0))&0x1FF;
+      f=(ftab.szp[r&0xFF]&FSZ)|((op==7?v:r)&FXY)|((a^v^r)&FH)|(((a^v)&(a^r)&0x80)>>5)|FN|(r>>8);
+      break;
+    case 4:  // AND
+      r=a&v;
+      f=ftab.szp[r]|(r&FXY)|FH;
+      break;
+    case 5:  // XOR
+      r=a^v;
+      f=ftab.szp[r]|(r&FXY);
+      break;
+    default:  // OR
+      r=a|v;
+      f=ftab.szp[r]|(r&FXY);
+      break;
+    }
+  if (op!=7) regs[A]=r&0xFF;
+  regs[F]=f;
+}
+
+inline unsigned CPU::zinc(unsigned v)
+{
+  unsigned r=(v+1)&0xFF;
+  regs[F]=(regs[F]&FC)|(ftab.szp[r]&FSZ)|(r&FXY)|((r&0xF)==0?FH:0)|(r==0x80?FV:0);
+  return r;
+}
+
+inline unsigned CPU::zdec(unsigned v)
+{
+  unsigned r=(v-1)&0xFF;
+  regs[F]=(regs[F]&FC)|(ftab.szp[r]&FSZ)|(r&FXY)|((r&0xF)==0xF?FH:0)|(r==0x7F?FV:0)|FN;
+  return r;
+}
+
+// ADD HL (or IX or IY)
+inline unsigned CPU::zadd16(unsigned a, unsigned b)
+{
+  unsigned r=a+b;
+  regs[F]=(regs[F]&(FSZ|FV))|((r>>8)&FXY)|(((a^b^r)>>8)&FH)|(r>>16);
+  return r&0xFFFF;
+}
+
+// Handlers
+
+template<unsigned R> void CPU::x_zinc(void)
+{
+  set8<R>(zinc(get8<R>()));
+}
+
+template<unsigned R> void CPU::x_zdec(void)
+{
+  set8<R>(zdec(get8<R>()));
+}
+
+template<unsigned OP, unsigned R> void CPU::x_zalu(void)
+{
+  zalu(OP,get8<R>());
+}
+
+template<unsigned OP> void CPU::x_zalui(void)
+{
+  zalu(OP,t1);
+}
+
+template<unsigned RP> void CPU::x_zadd(void)
+{
+  regs.pair(HL)=zadd16(regs.pair(HL),RP==3?sp:regs.pair(RP));
+}
+
+// RLCA RRCA RLA RRA leave S, Z, and P/V alone
+template<unsigned OP> void CPU::x_zrot(void)
+{
+  unsigned a=regs[A], c;
+  switch (OP)
+    {
+    case 0: c=a>>7; a=(a<<1)|c; break;
+    case 1: c=a&1; a=(a>>1)|(c<<7); break;
+    case 2: c=a>>7; a=(a<<1)|(regs[F]&FC); break;
+    default: c=a&1; a=(a>>1)|((regs[F]&FC)<<7); break;
+    }
+  regs[A]=a;
+  regs[F]=(regs[F]&(FSZ|FV))|(regs[A]&FXY)|c;
+}
+
+inline void CPU::x_zdaa(void)
+{
+  unsigned a=regs[A], f=regs[F], corr=0, c=f&FC, h;
+  if ((f&FH) || (a&0xF)>9) corr=0x06;
+  if (c || a>0x99)
+    {
+      corr|=0x60;
+      c=FC;
+    }
+  if (f&FN)
+    {
+      h=(f&FH) && (a&0xF)<6;
+      a-=corr;
+    }
+  else
+    {
+      h=(a&0xF)>9;
+      a+=corr;
+    }
+  a&=0xFF;
+  regs[A]=a;
+  regs[F]=ftab.szp[a]|(a&FXY)|(h?FH:0)|(f&FN)|c;
+}
+
+inline void CPU::x_zcpl(void)
+{
+  regs[A]=~regs[A];
+  regs[F]=(regs[F]&(FSZ|FV|FC))|(regs[A]&FXY)|FH|FN;
+}
+
+inline void CPU::x_zscf(void)
+{
+  regs[F]=(regs[F]&(FSZ|FV))|(regs[A]&FXY)|FC;
+}
+
+inline void CPU::x_zccf(void)
+{
+  unsigned c=regs[F]&FC;
+  regs[F]=(regs[F]&(FSZ|FV))|(regs[A]&FXY)|(c?FH:FC);
+}
+
+inline void CPU::x_exaf(void)
+{
+  unsigned t=regs.pair(PSW);
+  regs.pair(PSW)=alt.pair(PSW);
+  alt.pair(PSW)=t;
+}
+
+inline void CPU::x_exx(void)
+{
+  for (unsigned p=BC;p<=HL;p++)
+    {
+      unsigned t=regs.pair(p);
+      regs.pair(p)=alt.pair(p);
+      alt.pair(p)=t;
+    }
+}
+
+// relative jumps take 5 more T states when they go
+inline void CPU::x_jr(void)
+{
+  pc=(pc+(signed char)t1)&0xFFFF;
+}
+
+inline void CPU::x_djnz(void)
+{
+  if (--regs[B]) 
+    {
+      tstates+=5;
+      x_jr();
+    }
+}
+
+template<unsigned CC> void CPU::x_jrcc(void)
+{
+  if (getcond(CC))
+    {
+      tstates+=5;
+      x_jr();
+    }
+}
+
+// CB prefix: rotates and shifts, BIT, RES, and SET
+// Returns the new value (BIT just sets flags)
+inline unsigned CPU::zcb(unsigned op, unsigned v)
+{
+  unsigned b=(op>>3)&7, r, c;
+  switch (op>>6)
+    {
+    case 0:
+      switch (b)
+	{
+	case 0: c=v>>7; r=(v<<1)|c; break;  // RLC
+	case 1: c=v&1; r=(v>>1)|(c<<7); break;  // RRC
+	case 2: c=v>>7; r=(v<<1)|(regs[F]&FC); break;  // RL
+	case 3: c=v&1; r=(v>>1)|((regs[F]&FC)<<7); break;  // RR
+	case 4: c=v>>7; r=v<<1; break;  // SLA
+	case 5: c=v&1; r=(v>>1)|(v&0x80); break;  // SRA
+	case 6: c=v>>7; r=(v<<1)|1; break;  // SLL (undocumented)
+	default: c=v&1; r=v>>1; break;  // SRL
+	}
+      r&=0xFF;
+      regs[F]=ftab.szp[r]|(r&FXY)|c;
+      return r;
+    case 1:  // BIT
+      r=(regs[F]&FC)|FH|(v&FXY);
+      if (!(v&(1<<b))) r|=FZ|FV;
+      else if (b==7) r|=FS;
+      regs[F]=r;
+      return v;
+    case 2:  // RES
+      return v&~(1<<b);
+    }
+  return v|(1<<b);  // SET
+}
+
+void CPU::x_cb(void)
+{
+  unsigned op=ram.read(incpc());
+  unsigned r=op&7;
+  if (r==6)
+    {
+      unsigned v=zcb(op,getM8());
+      if ((op&0xC0)==0x40) tstates+=8;
+      else
+	{
+	  setM8(v);
+	  tstates+=11;
+	}
+      return;
+    }
+  if (r==7) r=A;
+  regs[r]=zcb(op,regs[r]);
+  tstates+=4;
+}
+
+// (IX+d) and (IY+d) versions of the opcodes that use (HL)
+// Every other register in them is the real one
+void CPU::zindexed(unsigned op, unsigned xy)
+{
+  unsigned ea=(xy+(signed char)ram.read(incpc()))&0xFFFF;
+  unsigned r=op&7, d=(op>>3)&7;
+  tstates+=8;
+  switch (op&0xC0)
+    {
+    case 0x00:
+      switch (op)
+	{
+	case 0x34: ram.write(ea,zinc(ram.read(ea))); break;
+	case 0x35: ram.write(ea,zdec(ram.read(ea))); break;
+	default:
+	  ram.write(ea,ram.read(incpc()));
+	  tstates-=3;
+	  break;
+	}
+      break;
+    case 0x40: 
+      if (r==6) regs[d==7?A:d]=ram.read(ea);  // LD r,(IX+d)
+      else ram.write(ea,regs[r==7?A:r]);  // LD (IX+d),r
+      break;
+    default:
+      zalu((op>>3)&7,ram.read(ea));
+      break;
+    }
+}
+
+// DD (IX) and FD (IY) prefixes
+// Anything that works on HL, H, or L works on IX (IXH, IXL) 
+// instead, so for most opcodes we just put IX in HL and run the
+// plain handler. That also gets the undocumented IXH and IXL 
+// forms right
+template<unsigned IY> void CPU::x_index(void)
+{
+  unsigned &xy=IY?iy:ix;
+  unsigned op=ram.read(incpc());
+  if (op==0xDD || op==0xED || op==0xFD)
+    {
+      // the last prefix wins; this one was just 4 T states
+      pc=(pc-1)&0xFFFF;
+      return;
+    }
+  if (op==0xCB)
+    {
+      // DD CB d op: the result also goes to the register in op
+      // (undocumented) unless that is (HL)
+      unsigned ea=(xy+(signed char)ram.read(incpc()))&0xFFFF;
+      op=ram.read(incpc());
+      unsigned v=zcb(op,ram.read(ea));
+      if ((op&0xC0)==0x40)
+	{
+	  tstates+=16;
+	  return;
+	}
+      ram.write(ea,v);
+      unsigned r=op&7;
+      if (r!=6) regs[r==7?A:r]=v;
+      tstates+=19;
+      return;
+    }
+  tstates+=opcyclesz80[op];
+  if (op==0x34 || op==0x35 || op==0x36 || 
+      ((op&0xC0)==0x40 && ((op&7)==6 || (op&0x38)==0x30) && op!=0x76) ||
+      (op&0xC7)==0x86)
+    {
+      zindexed(op,xy);
+      return;
+    }
+  switch (oplenz80[op])
+    {
+    case 3:
+      t1=ram.read(incpc());
+      t1+=ram.read(incpc())<<8;
+      break;
+    case 2:
+      t1=ram.read(incpc());
+      break;
+    }
+  if (op==0xEB || op==0xD9)
+    {
+      // EX DE,HL and EXX always mean HL
+      (this->*optablez80[op])();
+      return;
+    }
+  unsigned hl=regs.pair(HL);
+  regs.pair(HL)=xy;
+  (this->*optablez80[op])();
+  xy=regs.pair(HL);
+  regs.pair(HL)=hl;
+}
+
+// ED prefix
+void CPU::x_ed(void)
+{
+  unsigned op=ram.read(incpc());
+  unsigned r=(op>>3)&7, rp=(op>>4)&3;
+  unsigned v, n;
+  if (op>=0xA0 && op<=0xBB && (op&4)==0)
+    {
+      // block moves, compares, and I/O
+      // bit 3 says go down and bit 4 says repeat
+      unsigned dir=(op&8)?0xFFFF:1, repeat=op&0x10, again=0;
+      tstates+=12;
+      switch (op&3)
+	{
+	case 0:  // LDI
+	  v=getM8();
+	  ram.write(regs.pair(DE),v);
+	  regs.pair(DE)+=dir;
+	  regs.pair(HL)+=dir;
+	  again=--regs.pair(BC)!=0;
+	  n=v+regs[A];
+	  regs[F]=(regs[F]&(FSZ|FC))|(again?FV:0)|(n&FX)|((n<<4)&FY);
+	  break;
+	case 1:  // CPI (CPIR also stops on a match)
+	  v=getM8();
+	  n=(regs[A]-v)&0xFF;
+	  regs.pair(HL)+=dir;
+	  again=--regs.pair(BC)!=0;
+	  regs[F]=(regs[F]&FC)|(ftab.szp[n]&FSZ)|((regs[A]^v^n)&FH)|(again?FV:0)|FN;
+	  again=again && n!=0;
+	  n-=(regs[F]&FH)?1:0;
+	  regs[F]|=(n&FX)|((n<<4)&FY);
+	  break;
+	case 2:  // INI
+	  setM8(portin(regs[C],regs[A]));
+	  regs.pair(HL)+=dir;
+	  again=--regs[B]!=0;
+	  regs[F]=(regs[F]&FC)|(ftab.szp[regs[B]]&FSZ)|(regs[B]&FXY)|FN;
+	  break;
+	default:  // OUTI
+	  v=getM8();
+	  again=--regs[B]!=0;
+	  portout(regs[C],v);
+	  regs.pair(HL)+=dir;
+	  regs[F]=(regs[F]&FC)|(ftab.szp[regs[B]]&FSZ)|(regs[B]&FXY)|FN;
+	  break;
+	}
+      if (repeat && again)
+	{
+	  // do it again next time (so interrupts get in between)
+	  pc=(pc-2)&0xFFFF;
+	  tstates+=5;
+	}
+      return;
+    }
+  if ((op&0xC0)!=0x40)
+    {
+      tstates+=4;   // everything else is a NOP
+      return;
+    }
+  switch (op&7)
+    {
+    case 0:  // IN r,(C)
+      v=portin(regs[C],regs[A]);
+      regs[F]=(regs[F]&FC)|ftab.szp[v]|(v&FXY);
+      if (r!=6) regs[r==7?A:r]=v;
+      tstates+=8;
+      break;
+    case 1:  // OUT (C),r
+      portout(regs[C],r==6?0:regs[r==7?A:r]);
+      tstates+=8;
+      break;
+    case 2:  // SBC HL,rp and ADC HL,rp
+      {
+	unsigned a=regs.pair(HL), b=rp==3?sp:regs.pair(rp), c=regs[F]&FC;
+	unsigned f;
+	if (op&8)
+	  {
+	    v=a+b+c;
+	    f=(((a^v)&(b^v)&0x8000)>>13);
+	  }
+	else
+	  {
+	    v=(a-b-c)&0x1FFFF;
+	    f=(((a^b)&(a^v)&0x8000)>>13)|FN;
+	  }
+	regs[F]=f|((v>>8)&(FS|FXY))|((v&0xFFFF)?0:FZ)|(((a^b^v)>>8)&FH)|(v>>16);
+	regs.pair(HL)=v;
+	tstates+=11;
+      }
+      break;
+    case 3:  // LD (nn),rp and LD rp,(nn)
+      n=ram.read(incpc());
+      n+=ram.read(incpc())<<8;
+      if (op&8)
+	{
+	  v=ram.read(n)+(ram.read((n+1)&0xFFFF)<<8);
+	  if (rp==3) sp=v;
+	  else regs.pair(rp)=v;
+	}
+      else
+	{
+	  v=rp==3?sp:regs.pair(rp);
+	  ram.write(n,v&0xFF);
+	  ram.write((n+1)&0xFFFF,v>>8);
+	}
+      tstates+=16;
+      break;
+    case 4:  // NEG
+      v=regs[A];
+      regs[A]=0;
+      zalu(2,v);
+      tstates+=4;
+      break;
+    case 5:  // RETN and RETI (there's no NMI, so IFF2 is just INTE)
+      x_ret();
+      tstates+=10;
+      break;
+    case 6:  // IM 0, 1, 2
+      im=(op&0x10)?((op&8)?2:1):0;
+      tstates+=4;
+      break;
+    default:
+      tstates+=5;
+      switch (op)
+	{
+	case 0x47:  // LD I,A
+	  ireg=regs[A];
+	  break;
+	case 0x4F:  // LD R,A
+	  rreg=(regs[A]&0x80)|((regs[A]-(tstates>>2))&0x7F);
+	  break;
+	case 0x57:  // LD A,I
+	case 0x5F:  // LD A,R
+	  v=op==0x57?ireg:getR();
+	  regs[A]=v;
+	  regs[F]=(regs[F]&FC)|(ftab.szp[v]&FSZ)|(v&FXY)|((inte|eidelay)?FV:0);
+	  break;
+	case 0x67:  // RRD
+	case 0x6F:  // RLD
+	  v=getM8();
+	  n=regs[A];
+	  if (op==0x67)
+	    {
+	      setM8(((n<<4)|(v>>4))&0xFF);
+	      n=(n&0xF0)|(v&0xF);
+	    }
+	  else
+	    {
+	      setM8(((v<<4)|(n&0xF))&0xFF);
+	      n=(n&0xF0)|(v>>4);
+	    }
+	  regs[A]=n;
+	  regs[F]=(regs[F]&FC)|ftab.szp[n]|(n&FXY);
+	  tstates+=9;
+	  break;
+	default:  // ED 77 and 7F are NOPs
+	  tstates-=1;
+	  break;
+	}
+      break;
+    }
+}
+
+// Opcode map (see CPU::handlerof)
+template<unsigned OP> constexpr CPU::ophandler CPU::z80of(void)
+{
+  return
+    OP==0x08 ? &CPU::x_exaf :
+    OP==0x10 ? &CPU::x_djnz :
+    OP==0x18 ? &CPU::x_jr :
+    (OP&0xE7)==0x20 ? &CPU::x_jrcc<(OP>>3)&3> :
+    OP==0xD9 ? &CPU::x_exx :
+    OP==0xCB ? &CPU::x_cb :
+    OP==0xED ? &CPU::x_ed :
+    OP==0xDD ? &CPU::x_index<0> :
+    OP==0xFD ? &CPU::x_index<1> :
+    (OP&0xC0)==0x80 ? &CPU::x_zalu<(OP>>3)&7,OP&7> :
+    (OP&0xC7)==0xC6 ? &CPU::x_zalui<(OP>>3)&7> :
+    (OP&0xC7)==0x04 ? &CPU::x_zinc<(OP>>3)&7> :
+    (OP&0xC7)==0x05 ? &CPU::x_zdec<(OP>>3)&7> :
+    (OP&0xCF)==0x09 ? &CPU::x_zadd<(OP>>4)&3> :
+    (OP&0xE7)==0x07 ? &CPU::x_zrot<(OP>>3)&3> :
+    OP==0x27 ? &CPU::x_zdaa :
+    OP==0x2F ? &CPU::x_zcpl :
+    OP==0x37 ? &CPU::x_zscf :
+    OP==0x3F ? &CPU::x_zccf :
+    handlerof<OP,false,z80>();
+}
+
+#define ZOPS4(n) z80of<(n)>(), z80of<(n)+1>(), z80of<(n)+2>(), z80of<(n)+3>()
+#define ZOPS16(n) ZOPS4(n), ZOPS4((n)+4), ZOPS4((n)+8), ZOPS4((n)+12)
+#define ZOPS64(n) ZOPS16(n), ZOPS16((n)+16), ZOPS16((n)+32), ZOPS16((n)+48)
+
+const CPU::ophandler CPU::optablez80[256]=
+  {
+    ZOPS64(0x00), ZOPS64(0x40), ZOPS64(0x80), ZOPS64(0xC0)
+  };
+
+#define LEN4(n) lenofz80(n), lenofz80((n)+1), lenofz80((n)+2), lenofz80((n)+3)
+#define LEN16(n) LEN4(n), LEN4((n)+4), LEN4((n)+8), LEN4((n)+12)
+#define LEN64(n) LEN16(n), LEN16((n)+16), LEN16((n)+32), LEN16((n)+48)
+
+const unsigned char CPU::oplenz80[256]=
+  {
+    LEN64(0x00), LEN64(0x40), LEN64(0x80), LEN64(0xC0)
+  };
+
+// T states (conditional calls take 7 more when taken, returns 6, 
+// and JR and DJNZ 5; prefixes count 4 here and their handlers add
+// the rest)
+const unsigned char CPU::opcyclesz80[256]=
+  {
+     4, 10,  7,  6,  4,  4,  7,  4,  4, 11,  7,  6,  4,  4,  7,  4,  // 00
+     8, 10,  7,  6,  4,  4,  7,  4, 12, 11,  7,  6,  4,  4,  7,  4,  // 10
+     7, 10, 16,  6,  4,  4,  7,  4,  7, 11, 16,  6,  4,  4,  7,  4,  // 20
+     7, 10, 13,  6, 11, 11, 10,  4,  7, 11, 13,  6,  4,  4,  7,  4,  // 30
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 40
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 50
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 60
+     7,  7,  7,  7,  7,  7,  4,  7,  4,  4,  4,  4,  4,  4,  7,  4,  // 70
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 80
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 90
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // A0
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // B0
+     5, 10, 10, 10, 10, 11,  7, 11,  5, 10, 10,  4, 10, 17,  7, 11,  // C0
+     5, 10, 10, 11, 10, 11,  7, 11,  5,  4, 10, 11, 10,  4,  7, 11,  // D0
+     5, 10, 10, 19, 10, 11,  7, 11,  5,  4, 10,  4, 10,  4,  7, 11,  // E0
+     5, 10, 10,  4, 10, 11,  7, 11,  5,  6, 10,  4, 10,  4,  7, 11   // F0
+  };
@@ -0,0 +1,182 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+// Fork server (see zygote.h)
+
+#include "zygote.h"
+#include "machine.h"
+#include "batch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if !defined(NOTELNET) && !defined(WIN32)
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#define HAVEFORK
+#endif
+
+zygote::zygote(Machine &mach) : m(mach)
+{
+  // the console is ours from here on (errors still go where they did)
+  con=new memconsole(m.io);
+}
+
+int zygote::warm(const char *input, const char *marker)
+{
+  CPU &cpu=m.cpu;
+  unsigned long long n=0, waits=0;
+  unsigned seen=0;
+  int typed=0;  // all the input has been read
+  if (input) con->type(input,strlen(input));
+  while (n<WARMMAX && !(cpu.ishalted() && !cpu.intenabled()))
+    {
+      for (unsigned i=0;i<4096;i++) cpu.exec();
+      n+=4096;
+      if (!typed)
+	{
+	  if (con->pending()) continue;
+	  typed=1;
+	  waits=con->starved;
+	  seen=con->outcount();
+	}
+      if (marker ? strstr(con->output()+seen,marker)!=NULL : con->starved-waits>=WAITS) 
+	{
+	  m.io.printf(iobase::ERROROUT,"Warm at %04X after %llu T states\n",cpu.pc,cpu.tstates);
+	  con->discard();
+	  return 1;
+	}
+    }
+  m.io.printf(iobase::ERROROUT,"Never got warm; the console said:\n%s\n",con->output());
+  return 0;
+}
+
+#if defined(HAVEFORK)
+// write all of it (the client may take it a bit at a time)
+static void sendall(int fd, const char *s, unsigned len)
+{
+  while (len)
+    {
+      int n=write(fd,s,len);
+      if (n<=0) return;
+      s+=n;
+      len-=n;
+    }
+}
+
+// Run one job in the child
+void zygote::job(int fd)
+{
+  // everything the client sends
+  unsigned size=4096, len=0;
+  char *req=(char *)malloc(size);
+  int n;
+  while ((n=read(fd,req+len,size-len-1))>0)
+    if ((len+=n)==size-1) req=(char *)realloc(req,size*=2);
+  req[len]='\0';
+  batch::job j;
+  memset(&j,0,sizeof(j));
+  char *body=strchr(req,'\n'), *p=req, *f[3];
+  int k, bad=0;
+  if (body) *body++='\0';
+  else body=req+len;
+  for (k=0;k<3 && (f[k]=batch::field(&p));k++);
+  if (k<2)
+    {
+      const char *err="1 error 0 0\nneed instructions seconds [expect]\n";
+      sendall(fd,err,strlen(err));
+      _exit(1);
+    }
+  j.budget=strtoull(f[0],NULL,0);
+  j.seconds=atof(f[1]);
+  j.expect=k>2?batch::text(f[2],0,&bad):NULL;
+  if (bad)
+    {
+      const char *err="1 error 0 0\nthe expect file isn't there\n";
+      sendall(fd,err,strlen(err));
+      _exit(1);
+    }
+  for (char *s=body;*s;s++) 
+    if (*s=='\n') con->type("\r",1);
+    else if (*s!='\r') con->type(s,1);
+  batch::drive(m,*con,j);
+  char head[128];
+  sprintf(head,"%d %s %llu %llu\n",!j.passed,batch::job::stopnames[j.stop],j.instructions,j.tstates);
+  sendall(fd,head,strlen(head));
+  sendall(fd,con->output(),con->outcount());
+  close(fd);
+  _exit(!j.passed);
+}
+
+int zygote::serve(const char *path)
+{
+  struct sockaddr_un addr;
+  int listener=socket(AF_UNIX,SOCK_STREAM,0);
+  memset(&addr,0,sizeof(addr));
+  addr.sun_family=AF_UNIX;
+  strncpy(addr.sun_path,path,sizeof(addr.sun_path)-1);
+  unlink(path);
+  if (listener<0 || bind(listener,(struct sockaddr *)&addr,sizeof(addr))<0 || listen(listener,64)<0)
+    {
+      m.io.printf(iobase::ERROROUT,"Can't listen on %s\n",path);
+      return 1;
+    }
+  signal(SIGCHLD,SIG_IGN);  // nobody waits for the children
+  m.io.printf(iobase::ERROROUT,"Taking jobs on %s\n",path);
+  while (1)
+    {
+      int fd=accept(listener,NULL,NULL);
+      if (fd<0)
+	{
+	  if (errno==EINTR) continue;
+	  m.io.printf(iobase::ERROROUT,"Can't take jobs on %s\n",path);
+	  return 1;
+	}
+      pid_t child=fork();
+      if (child==0)
+	{
+	  close(listener);
+	  job(fd);
+	}
+      if (child<0) 
+	{
+	  const char *err="1 error 0 0\ncan't fork\n";
+	  sendall(fd,err,strlen(err));
+	}
+      close(fd);
+    }
+}
+#else
+void zygote::job(int fd)
+{
+}
+
+int zygote::serve(const char *path)
+{
+  m.io.printf(iobase::ERROROUT,"No fork server on this system\n");
+  return 1;
+}
+#endif
@@ -0,0 +1,63 @@
+/***********************************************************************
+This file is part of Altairrfp, an Altair 8800 simulator.
+Altairrfp can work standalone or with the Briel Micro8800
+computer in remote mode as a front panel.
+
+For more information, see http://www.hotsolder.com (Altairrfp)
+or http://www.brielcomputers.com (Micro8800)
+
+Altairrfp (c) 2011 by Al Williams. 
+
+    Altairrfp is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Altairrfp is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Altairrfp.  If not, see <http://www.gnu.org/licenses/>.
+
+***********************************************************************/
+#ifndef __ZYGOTE_H
+#define __ZYGOTE_H
+
+class Machine;
+class memconsole;
+
+// Fork server (-Z on the command line)
+// Boots the machine once to a warm point and then forks a copy of
+// the whole process for every job that comes in on a Unix socket,
+// so each job starts from the warm state for the cost of a fork
+// (the child's memory is copy on write) instead of a boot.
+// The warm point is when the warm-up input (-w) has all been read
+// and either the console shows marker (-W) or, with no marker, the
+// program has gone looking for more input WAITS times.
+// A job is one connection. The client sends a line
+//   instructions seconds [expect]
+// (the budget and expected output as in a batch manifest, see
+// batch.h), then the console input (line ends go in as carriage
+// returns), then shuts down its side. The answer is a line
+//   status stop instructions tstates
+// (status 0 for passed, 1 for failed; stop says why it stopped)
+// followed by everything the job printed after the warm point
+class zygote
+{
+ protected:
+  Machine &m;
+  memconsole *con;
+  void job(int fd);  // in the child
+ public:
+  enum { WAITS=1000 };
+  enum { WARMMAX=1000000000 };  // give up warming after this many instructions
+  zygote(Machine &mach);
+  // run to the warm point (returns 0 if it didn't get there)
+  int warm(const char *input, const char *marker);
+  // take jobs on path until killed (returns 1 if it can't listen)
+  int serve(const char *path);
+};
+
+#endif